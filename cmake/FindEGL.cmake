@@ -0,0 +1,31 @@
+
+# EGL_FOUND
+# EGL_INCLUDE_DIR
+# EGL_LIBRARY
+
+find_path(EGL_INCLUDE_DIR EGL/egl.h
+    $ENV{EGLDIR}/include
+    /usr/include
+    /usr/local/include
+    /sw/include
+    /opt/local/include
+    DOC "The directory where EGL/egl.h resides"
+)
+
+find_library(EGL_LIBRARY
+    NAMES EGL
+    PATHS
+    $ENV{EGLDIR}/lib
+    /usr/lib64
+    /usr/local/lib64
+    /sw/lib64
+    /opt/local/lib64
+    /usr/lib
+    /usr/local/lib
+    /sw/lib
+    /opt/local/lib
+    DOC "The EGL library"
+)
+
+find_package_handle_standard_args(EGL REQUIRED_VARS EGL_INCLUDE_DIR EGL_LIBRARY)
+mark_as_advanced(EGL_INCLUDE_DIR EGL_LIBRARY)
@@ -1,9 +1,12 @@
 #version 150
 #extension GL_ARB_explicit_attrib_location : enable
-#extension GL_NV_bindless_texture : require
-#extension GL_NV_gpu_shader5 : require // for uint64_t
+#extension GL_ARB_bindless_texture : require
 
-uniform uint64_t textures[4];
+// handles of the texture residency manager, std140 pads each to 16 bytes
+layout (std140) uniform Textures
+{
+	uvec4 textures[4];
+};
 
 layout (location=0) out vec4 outColor;
 
@@ -21,7 +24,7 @@ void main()
 {
 	//~ outColor = foo[side];
 	
-	sampler2D s = sampler2D(textures[side]);
+	sampler2D s = sampler2D(textures[side].xy);
 	
 	outColor = texture(s, texCoord);
 }
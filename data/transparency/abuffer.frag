@@ -5,7 +5,8 @@
 
 layout(binding = 0) uniform atomic_uint counter;
 
-layout(pixel_center_integer) in ivec4 gl_FragCoord;
+// number of entries of the linked list buffer, the counter keeps counting past it to report the demand
+uniform uint fragmentCapacity;
 
 in vec3 normal;
 in float z;
@@ -15,18 +16,24 @@ layout(location = 0) out vec4 opaqueFragColorZ;
 
 void main() {
 	if (vertex_color.a < 0.9999) { // damned floats...
+		ivec2 screenCoord = ivec2(gl_FragCoord.xy);
+		int pixel = screenCoord.y * screenSize.x + screenCoord.x;
 
 		// Increment size counter for pixel
-		int size = atomicAdd(headList[gl_FragCoord.y * screenSize.x + gl_FragCoord.x].size, 1) + 1;
+		int size = atomicAdd(headList[pixel].size, 1) + 1;
 		if (size > ABUFFER_SIZE) {
 			discard;
 		}
 
 		// Get index of abuffer entry (current value of counter) and increment global counter
-		int index = int(atomicCounterIncrement(counter));
+		uint entry = atomicCounterIncrement(counter);
+		if (entry >= fragmentCapacity) {
+			discard; // the pool overflowed, it is grown for the next frames
+		}
+		int index = int(entry);
 
 		// Read the last abuffer index from the headlist and replace with current index
-		int previousHead = atomicExchange(headList[gl_FragCoord.y * screenSize.x + gl_FragCoord.x].startIndex, index);
+		int previousHead = atomicExchange(headList[pixel].startIndex, index);
 
 		list[index].next = previousHead;
 		list[index].color = vec4(vertex_color.rgb * vertex_color.a, vertex_color.a); // pre-multiply alpha
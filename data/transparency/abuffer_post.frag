@@ -6,8 +6,6 @@
 uniform vec4 backgroundColor = vec4(1.0, 1.0, 1.0, 1.0);
 uniform sampler2D opaqueBuffer;
 
-layout (pixel_center_integer) in ivec4 gl_FragCoord;
-
 layout (location = 0) out vec4 fragColor;
 
 // blends dst over src
@@ -16,11 +14,12 @@ vec4 blend(vec4 dst, vec4 src) {
 }
 
 void main() {
-	vec4 opaque = texelFetch(opaqueBuffer, gl_FragCoord.xy, 0);
+	ivec2 screenCoord = ivec2(gl_FragCoord.xy);
+	vec4 opaque = texelFetch(opaqueBuffer, screenCoord, 0);
 	vec4 color = vec4(0.0);
 
 	// retrieve head pointer
-	int index = headList[gl_FragCoord.y * screenSize.x + gl_FragCoord.x].startIndex;
+	int index = headList[screenCoord.y * screenSize.x + screenCoord.x].startIndex;
 	if (index >= 0) {
 		// copy list elements to contiguous local buffer
 		ABufferEntry fragments[ABUFFER_SIZE];
@@ -7,16 +7,17 @@ uniform sampler2D opaqueBuffer;
 uniform sampler2D coreBuffer;
 uniform sampler2D accumulationBuffer;
 
-in ivec4 gl_FragCoord;
-
 layout (location = 0) out vec4 outColor;
 
 void main() {
-	vec4 opaque = texelFetch(opaqueBuffer, gl_FragCoord.xy, 0);
-	vec4 core = texelFetch(coreBuffer, gl_FragCoord.xy, 0);
-	vec4 accumulated = texelFetch(accumulationBuffer, gl_FragCoord.xy, 0);
-	uint depthN = depthComplexity[gl_FragCoord.y * screenSize.x + gl_FragCoord.x];
-	float visibility = visibilityKTab[(gl_FragCoord.y * screenSize.x + gl_FragCoord.x) * VISIBILITY_KTAB_SIZE + ABUFFER_SIZE];
+	ivec2 screenCoord = ivec2(gl_FragCoord.xy);
+	int pixel = screenCoord.y * screenSize.x + screenCoord.x;
+
+	vec4 opaque = texelFetch(opaqueBuffer, screenCoord, 0);
+	vec4 core = texelFetch(coreBuffer, screenCoord, 0);
+	vec4 accumulated = texelFetch(accumulationBuffer, screenCoord, 0);
+	uint depthN = depthComplexity[pixel];
+	float visibility = visibilityKTab[pixel * VISIBILITY_KTAB_SIZE + ABUFFER_SIZE];
 
 	// compute wavg tail
 	vec4 weightedAverage = vec4(0.0, 0.0, 0.0, 1.0);
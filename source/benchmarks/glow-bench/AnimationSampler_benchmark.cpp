@@ -0,0 +1,143 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glow/Buffer.h>
+#include <glow/ref_ptr.h>
+
+#include <glowutils/AnimationSampler.h>
+#include <glowutils/AnimationTrackSet.h>
+
+#include "context.h"
+
+namespace
+{
+
+// random rotation tracks of 2 to 16 keys over ten seconds, e.g., per object transforms of a scene
+const glowutils::AnimationTrackSet & rotations(unsigned int count)
+{
+    static std::map<unsigned int, glowutils::AnimationTrackSet> sets;
+
+    auto it = sets.find(count);
+    if (it != sets.end())
+        return it->second;
+
+    glowutils::AnimationTrackSet & tracks = sets.insert(std::make_pair(count, glowutils::AnimationTrackSet(glowutils::AnimationTrackSet::Quat))).first->second;
+
+    std::mt19937 generator(count);
+    std::uniform_int_distribution<unsigned int> keyCount(2, 16);
+    std::uniform_int_distribution<int> interpolation(glowutils::LinearInterpolation, glowutils::SmootherStepInterpolation);
+    std::uniform_real_distribution<float> component(-1.f, 1.f);
+
+    tracks.reserve(count, count * 9);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const unsigned int keys = keyCount(generator);
+
+        std::vector<float> times(keys);
+        std::vector<float> values(keys * 4);
+        std::vector<glowutils::InterpolationType> interpolations(keys);
+
+        for (unsigned int k = 0; k < keys; ++k)
+        {
+            times[k] = 10.f * static_cast<float>(k) / static_cast<float>(keys - 1);
+            interpolations[k] = static_cast<glowutils::InterpolationType>(interpolation(generator));
+
+            const glm::vec4 q = glm::normalize(glm::vec4(component(generator), component(generator), component(generator), component(generator)));
+            for (int c = 0; c < 4; ++c)
+                values[k * 4 + c] = q[c];
+        }
+
+        tracks.add(keys, times.data(), values.data(), interpolations.data());
+    }
+    return tracks;
+}
+
+// per track evaluation, the baseline for the sampler
+void AnimationSampler_evaluate(benchmark::State & state)
+{
+    const unsigned int count = static_cast<unsigned int>(state.range(0));
+    const glowutils::AnimationTrackSet & tracks = rotations(count);
+
+    std::vector<glm::vec4> values(count);
+    float time = 0.f;
+
+    while (state.KeepRunning())
+    {
+        time = time < 10.f ? time + 1.f / 60.f : 0.f;
+
+        for (unsigned int i = 0; i < count; ++i)
+            values[i] = tracks.evaluate(i, time);
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+void AnimationSampler_sample(benchmark::State & state, glowutils::AnimationSampler::Kernel kernel, unsigned int threadCount)
+{
+    const unsigned int count = static_cast<unsigned int>(state.range(0));
+    const glowutils::AnimationTrackSet & tracks = rotations(count);
+
+    glowutils::AnimationSampler sampler;
+    sampler.setKernel(kernel);
+    sampler.setThreadCount(threadCount);
+
+    std::vector<float> values(count * 4);
+    float time = 0.f;
+
+    while (state.KeepRunning())
+    {
+        time = time < 10.f ? time + 1.f / 60.f : 0.f;
+
+        sampler.sample(tracks, time, values.data());
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetLabel(kernel == glowutils::AnimationSampler::Scalar ? "scalar" : glowutils::AnimationSampler::vectorExtension());
+}
+
+void AnimationSampler_sampleIntoBuffer(benchmark::State & state)
+{
+    if (!hasContext())
+    {
+        state.SkipWithError("no offscreen context");
+        return;
+    }
+
+    const unsigned int count = static_cast<unsigned int>(state.range(0));
+    const glowutils::AnimationTrackSet & tracks = rotations(count);
+
+    glow::ref_ptr<glow::Buffer> buffer = new glow::Buffer(GL_ARRAY_BUFFER);
+    buffer->setData(static_cast<GLsizeiptr>(count * sizeof(glm::vec4)), nullptr, GL_STREAM_DRAW);
+
+    glowutils::AnimationSampler sampler;
+    float time = 0.f;
+
+    while (state.KeepRunning())
+    {
+        time = time < 10.f ? time + 1.f / 60.f : 0.f;
+        benchmark::DoNotOptimize(sampler.sample(tracks, time, buffer));
+    }
+
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+}
+
+BENCHMARK(AnimationSampler_evaluate)
+    ->Arg(10000)->Arg(100000);
+BENCHMARK_CAPTURE(AnimationSampler_sample, scalar, glowutils::AnimationSampler::Scalar, 1u)
+    ->Arg(10000)->Arg(100000);
+BENCHMARK_CAPTURE(AnimationSampler_sample, vectorized, glowutils::AnimationSampler::Vectorized, 1u)
+    ->Arg(10000)->Arg(100000);
+BENCHMARK_CAPTURE(AnimationSampler_sample, vectorized_parallel, glowutils::AnimationSampler::Vectorized, 0u)
+    ->Arg(10000)->Arg(100000);
+BENCHMARK(AnimationSampler_sampleIntoBuffer)
+    ->Arg(10000)->Arg(100000);
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/AxisAlignedBoundingBoxSet.h>
+#include <glowutils/Camera.h>
+#include <glowutils/FrustumCulling.h>
+
+namespace
+{
+
+// random scene of boxes around the camera, roughly a sixth of them is visible
+const glowutils::AxisAlignedBoundingBoxSet & scene(unsigned int count)
+{
+    static std::map<unsigned int, glowutils::AxisAlignedBoundingBoxSet> scenes;
+
+    glowutils::AxisAlignedBoundingBoxSet & boxes = scenes[count];
+    if (boxes.size() == count)
+        return boxes;
+
+    std::mt19937 generator(count);
+    std::uniform_real_distribution<float> position(-100.f, 100.f);
+    std::uniform_real_distribution<float> size(.1f, 2.f);
+
+    boxes.reserve(count);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const glm::vec3 center(position(generator), position(generator), position(generator));
+        const glm::vec3 extent(size(generator), size(generator), size(generator));
+        boxes.add(center - extent, center + extent);
+    }
+    return boxes;
+}
+
+glowutils::Camera camera()
+{
+    glowutils::Camera camera(glm::vec3(0.f, 0.f, 0.f), glm::vec3(0.f, 0.f, -1.f));
+    camera.setViewport(1920, 1080);
+    camera.setZNear(.1f);
+    camera.setZFar(150.f);
+
+    return camera;
+}
+
+void FrustumCulling_cull(benchmark::State & state, glowutils::FrustumCulling::Kernel kernel, unsigned int threadCount)
+{
+    const unsigned int count = static_cast<unsigned int>(state.range(0));
+    const glowutils::AxisAlignedBoundingBoxSet & boxes = scene(count);
+
+    glowutils::FrustumCulling culling(camera());
+    culling.setKernel(kernel);
+    culling.setThreadCount(threadCount);
+
+    std::vector<unsigned int> visible(count);
+
+    while (state.KeepRunning())
+        benchmark::DoNotOptimize(culling.cull(boxes, visible.data()));
+
+    state.SetItemsProcessed(state.iterations() * count);
+    state.SetLabel(kernel == glowutils::FrustumCulling::Scalar ? "scalar" : glowutils::FrustumCulling::vectorExtension());
+}
+
+}
+
+BENCHMARK_CAPTURE(FrustumCulling_cull, scalar, glowutils::FrustumCulling::Scalar, 1u)
+    ->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK_CAPTURE(FrustumCulling_cull, vectorized, glowutils::FrustumCulling::Vectorized, 1u)
+    ->Arg(10000)->Arg(100000)->Arg(1000000);
+BENCHMARK_CAPTURE(FrustumCulling_cull, vectorized_parallel, glowutils::FrustumCulling::Vectorized, 0u)
+    ->Arg(10000)->Arg(100000)->Arg(1000000);
@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/Icosahedron.h>
+
+// Measures the refinement of the icosahedron into a sphere by the number of refinement levels,
+// each one quadrupling the triangles.
+
+namespace
+{
+
+void Icosahedron_refine(benchmark::State & state)
+{
+    const auto vertices = glowutils::Icosahedron::vertices();
+    const auto indices = glowutils::Icosahedron::indices();
+
+    const unsigned char levels = static_cast<unsigned char>(state.range(0));
+
+    std::vector<glm::vec3> refinedVertices;
+    std::vector<glowutils::Icosahedron::Face> refinedIndices;
+
+    while (state.KeepRunning())
+    {
+        refinedVertices.assign(vertices.begin(), vertices.end());
+        refinedIndices.assign(indices.begin(), indices.end());
+
+        glowutils::Icosahedron::refine(refinedVertices, refinedIndices, levels);
+
+        benchmark::DoNotOptimize(refinedIndices.data());
+    }
+}
+
+}
+
+BENCHMARK(Icosahedron_refine)->Arg(1)->Arg(3)->Arg(5);
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/Icosahedron.h>
+#include <glowutils/MeshOptimizer.h>
+
+// Measures the optimization of refined icosahedra in the order generated by the refinement, the
+// label shows the ACMR of a 16 vertex FIFO cache before and after.
+
+namespace
+{
+
+glowutils::MeshOptimizer::Mesh sphere(unsigned char levels)
+{
+    const auto icosahedronVertices = glowutils::Icosahedron::vertices();
+    const auto icosahedronIndices = glowutils::Icosahedron::indices();
+
+    std::vector<glm::vec3> vertices(icosahedronVertices.begin(), icosahedronVertices.end());
+    std::vector<glowutils::Icosahedron::Face> faces(icosahedronIndices.begin(), icosahedronIndices.end());
+
+    glowutils::Icosahedron::refine(vertices, faces, levels);
+
+    glowutils::MeshOptimizer::Mesh mesh;
+    mesh.setVertices(vertices);
+
+    for (const glowutils::Icosahedron::Face & face : faces)
+        mesh.indices.insert(mesh.indices.end(), face.begin(), face.end());
+
+    return mesh;
+}
+
+void MeshOptimizer_optimize(benchmark::State & state)
+{
+    const glowutils::MeshOptimizer::Mesh input = sphere(static_cast<unsigned char>(state.range(0)));
+
+    glowutils::MeshOptimizer optimizer;
+    glowutils::MeshOptimizer::Report report = glowutils::MeshOptimizer::Report();
+
+    while (state.KeepRunning())
+    {
+        glowutils::MeshOptimizer::Mesh mesh = input;
+        report = optimizer.optimize(mesh);
+
+        benchmark::DoNotOptimize(mesh.indices.data());
+    }
+
+    char label[64];
+    std::snprintf(label, sizeof(label), "ACMR %.3f -> %.3f", report.acmrBefore, report.acmrAfter);
+    state.SetLabel(label);
+
+    state.SetItemsProcessed(state.iterations() * report.triangleCount);
+}
+
+// many small meshes, optimized in parallel
+void MeshOptimizer_optimizeMeshes(benchmark::State & state)
+{
+    const std::vector<glowutils::MeshOptimizer::Mesh> input(64, sphere(3));
+
+    glowutils::MeshOptimizer optimizer;
+    optimizer.setThreadCount(static_cast<unsigned int>(state.range(0)));
+
+    while (state.KeepRunning())
+    {
+        std::vector<glowutils::MeshOptimizer::Mesh> meshes = input;
+        benchmark::DoNotOptimize(optimizer.optimize(meshes).data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(input.size()));
+}
+
+}
+
+BENCHMARK(MeshOptimizer_optimize)->Arg(2)->Arg(4)->Arg(6);
+BENCHMARK(MeshOptimizer_optimizeMeshes)->Arg(1)->Arg(4);
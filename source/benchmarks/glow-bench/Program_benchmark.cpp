@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <glm/glm.hpp>
+
+#include <glow/Program.h>
+#include <glow/Shader.h>
+#include <glow/ref_ptr.h>
+
+#include "context.h"
+
+// Measures Program::setUniform including the update of the GL uniform, by std::string, by
+// UniformName (string literals) and by location. The difference between the first two is the
+// lookup, which Uniform_benchmark measures without a context.
+
+namespace
+{
+
+const char * vertexShaderSource = R"(
+#version 150
+
+uniform mat4 modelViewProjection;
+uniform float scale;
+
+in vec3 a_vertex;
+
+void main()
+{
+    gl_Position = modelViewProjection * vec4(a_vertex * scale, 1.0);
+}
+)";
+
+const char * fragmentShaderSource = R"(
+#version 150
+
+uniform vec4 color;
+
+out vec4 fragColor;
+
+void main()
+{
+    fragColor = color;
+}
+)";
+
+glow::Program * createProgram()
+{
+    glow::Program * program = new glow::Program;
+    program->attach(
+        glow::Shader::fromString(GL_VERTEX_SHADER, vertexShaderSource)
+    ,   glow::Shader::fromString(GL_FRAGMENT_SHADER, fragmentShaderSource));
+
+    program->use();
+
+    return program;
+}
+
+void Program_setUniformByString(benchmark::State & state)
+{
+    if (!hasContext())
+    {
+        state.SkipWithError("no offscreen context");
+        return;
+    }
+
+    glow::ref_ptr<glow::Program> program = createProgram();
+
+    const std::string name("modelViewProjection");
+    glm::mat4 value(1.f);
+
+    while (state.KeepRunning())
+    {
+        value[3][0] += 1.f;
+        program->setUniform(name, value);
+    }
+
+    program->release();
+}
+
+void Program_setUniformByName(benchmark::State & state)
+{
+    if (!hasContext())
+    {
+        state.SkipWithError("no offscreen context");
+        return;
+    }
+
+    glow::ref_ptr<glow::Program> program = createProgram();
+
+    glm::mat4 value(1.f);
+
+    while (state.KeepRunning())
+    {
+        value[3][0] += 1.f;
+        program->setUniform("modelViewProjection", value);
+    }
+
+    program->release();
+}
+
+void Program_setUniformByLocation(benchmark::State & state)
+{
+    if (!hasContext())
+    {
+        state.SkipWithError("no offscreen context");
+        return;
+    }
+
+    glow::ref_ptr<glow::Program> program = createProgram();
+
+    const GLint location = program->getUniformLocation("modelViewProjection");
+    glm::mat4 value(1.f);
+
+    while (state.KeepRunning())
+    {
+        value[3][0] += 1.f;
+        program->setUniform(location, value);
+    }
+
+    program->release();
+}
+
+}
+
+BENCHMARK(Program_setUniformByString);
+BENCHMARK(Program_setUniformByName);
+BENCHMARK(Program_setUniformByLocation);
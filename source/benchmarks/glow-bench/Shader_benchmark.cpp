@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <glow/global.h>
+#include <glow/Shader.h>
+#include <glow/StaticStringSource.h>
+#include <glow/ref_ptr.h>
+
+#include "context.h"
+
+// Measures the resolution of #include directives by the fallback include processor (used
+// without GL_ARB_shading_language_include, e.g., on Mesa). The processor is internal to glow, so
+// it is measured through Shader::updateSource, which adds a single glShaderSource.
+
+namespace
+{
+
+const char * lightingSource = R"(
+#include </glow-bench/common.glsl>
+
+vec3 lighting(vec3 normal, vec3 light)
+{
+    return vec3(max(dot(normal, light), 0.0));
+}
+)";
+
+const char * commonSource = R"(
+const float pi = 3.14159265;
+
+float saturate(float value)
+{
+    return clamp(value, 0.0, 1.0);
+}
+)";
+
+const char * fragmentShaderSource = R"(
+#version 150
+#extension GL_ARB_shading_language_include : require
+
+#include <common.glsl>
+#include <lighting.glsl>
+
+in vec3 v_normal;
+
+out vec4 fragColor;
+
+void main()
+{
+    fragColor = vec4(lighting(normalize(v_normal), vec3(0.0, 1.0, 0.0)) * saturate(pi), 1.0);
+}
+)";
+
+void Shader_resolveIncludes(benchmark::State & state)
+{
+    if (!hasContext())
+    {
+        state.SkipWithError("no offscreen context");
+        return;
+    }
+
+    const bool forceFallbackIncludeProcessor = glow::Shader::forceFallbackIncludeProcessor;
+    glow::Shader::forceFallbackIncludeProcessor = true;
+
+    glow::createNamedString("/glow-bench/common.glsl", commonSource);
+    glow::createNamedString("/glow-bench/lighting.glsl", lightingSource);
+
+    glow::ref_ptr<glow::Shader> shader = new glow::Shader(GL_FRAGMENT_SHADER
+        , new glow::StaticStringSource(fragmentShaderSource), { "/glow-bench" });
+
+    while (state.KeepRunning())
+        shader->updateSource();
+
+    shader = nullptr;
+
+    glow::deleteNamedString("/glow-bench/lighting.glsl");
+    glow::deleteNamedString("/glow-bench/common.glsl");
+
+    glow::Shader::forceFallbackIncludeProcessor = forceFallbackIncludeProcessor;
+}
+
+}
+
+BENCHMARK(Shader_resolveIncludes);
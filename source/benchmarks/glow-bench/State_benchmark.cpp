@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include <glow/State.h>
+#include <glow/ref_ptr.h>
+
+#include "context.h"
+
+// Measures State::apply for a typical opaque and a blended pass, switching between both as a
+// renderer does per pass, i.e., the cost of iterating and calling the deferred settings.
+
+namespace
+{
+
+glow::State * opaqueState()
+{
+    glow::State * state = new glow::State(glow::State::DeferredMode);
+    state->enable(GL_DEPTH_TEST);
+    state->enable(GL_CULL_FACE);
+    state->disable(GL_BLEND);
+    state->depthFunc(GL_LESS);
+    state->depthMask(GL_TRUE);
+    state->cullFace(GL_BACK);
+    state->frontFace(GL_CCW);
+    state->colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+
+    return state;
+}
+
+glow::State * blendedState()
+{
+    glow::State * state = new glow::State(glow::State::DeferredMode);
+    state->enable(GL_DEPTH_TEST);
+    state->disable(GL_CULL_FACE);
+    state->enable(GL_BLEND);
+    state->blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    state->depthFunc(GL_LEQUAL);
+    state->depthMask(GL_FALSE);
+    state->frontFace(GL_CCW);
+    state->colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_FALSE);
+
+    return state;
+}
+
+void State_apply(benchmark::State & state)
+{
+    if (!hasContext())
+    {
+        state.SkipWithError("no offscreen context");
+        return;
+    }
+
+    glow::ref_ptr<glow::State> opaque = opaqueState();
+    glow::ref_ptr<glow::State> blended = blendedState();
+
+    while (state.KeepRunning())
+    {
+        opaque->apply();
+        blended->apply();
+    }
+}
+
+}
+
+BENCHMARK(State_apply);
@@ -0,0 +1,63 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include <glow/StaticStringSource.h>
+#include <glow/ref_ptr.h>
+
+#include <glowutils/StringTemplate.h>
+
+// Measures the expansion of a shader template with a few replacements, as done on each change of
+// the template or its source.
+
+namespace
+{
+
+const char * templateSource = R"(
+#version 150
+
+#define LIGHT_COUNT LIGHTS
+#define SHADOW_SAMPLES SAMPLES
+
+uniform vec3 lightPositions[LIGHTS];
+uniform vec3 lightColors[LIGHTS];
+uniform sampler2DShadow shadowMaps[LIGHTS];
+
+in vec3 v_position;
+in vec3 v_normal;
+
+out vec4 fragColor;
+
+void main()
+{
+    vec3 color = vec3(0.0);
+    for (int i = 0; i < LIGHTS; ++i)
+    {
+        vec3 light = normalize(lightPositions[i] - v_position);
+        color += lightColors[i] * max(dot(normalize(v_normal), light), 0.0) / float(SAMPLES);
+    }
+    fragColor = vec4(color * GAMMA, 1.0);
+}
+)";
+
+void StringTemplate_expand(benchmark::State & state)
+{
+    glow::ref_ptr<glowutils::StringTemplate> stringTemplate = new glowutils::StringTemplate(
+        new glow::StaticStringSource(templateSource));
+
+    stringTemplate->replace("LIGHTS", 4);
+    stringTemplate->replace("SAMPLES", 16);
+    stringTemplate->replace("GAMMA", "(1.0 / 2.2)");
+
+    while (state.KeepRunning())
+    {
+        stringTemplate->update();
+
+        const std::string expanded = stringTemplate->string();
+        benchmark::DoNotOptimize(expanded.data());
+    }
+}
+
+}
+
+BENCHMARK(StringTemplate_expand);
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glow/LocationIdentity.h>
+#include <glow/ref_ptr.h>
+#include <glow/Uniform.h>
+#include <glow/UniformName.h>
+#include <glow/UniformNameTable.h>
+
+// Compares the uniform lookup of Program by std::string (hashed LocationIdentity, dynamic_cast)
+// with the lookup by UniformName (precomputed hash, flat table, cached type tag). The lookup
+// structures are used directly, since Program itself requires a current context.
+
+namespace
+{
+
+const unsigned int uniformCount = 32;
+
+std::vector<glow::ref_ptr<glow::AbstractUniform>> & uniforms()
+{
+    static std::vector<glow::ref_ptr<glow::AbstractUniform>> uniforms;
+
+    if (uniforms.empty())
+    {
+        for (unsigned int i = 0; i < uniformCount - 1; ++i)
+            uniforms.push_back(new glow::Uniform<float>("uniform" + std::to_string(i)));
+
+        uniforms.push_back(new glow::Uniform<glm::mat4>("modelViewProjection"));
+    }
+    return uniforms;
+}
+
+void Uniform_lookupByString(benchmark::State & state)
+{
+    std::unordered_map<glow::LocationIdentity, glow::ref_ptr<glow::AbstractUniform>> map;
+    for (glow::AbstractUniform * uniform : uniforms())
+        map[uniform->identity()] = uniform;
+
+    const glm::mat4 value(1.f);
+
+    while (state.KeepRunning())
+    {
+        const std::string name("modelViewProjection");
+        glow::Uniform<glm::mat4> * uniform = map[name]->as<glm::mat4>();
+
+        benchmark::DoNotOptimize(uniform);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+void Uniform_lookupByName(benchmark::State & state)
+{
+    glow::UniformNameTable table;
+    for (glow::AbstractUniform * uniform : uniforms())
+        table.insert(uniform);
+
+    static CONSTEXPR glow::UniformName name("modelViewProjection");
+    const glm::mat4 value(1.f);
+
+    while (state.KeepRunning())
+    {
+        glow::UniformNameTable::Entry * entry = table.find(name.data(), name.length(), name.hash());
+
+        // same fast path as Program::getUniformByName
+        glow::Uniform<glm::mat4> * uniform = nullptr;
+        if (entry->type == glow::Uniform<glm::mat4>::typeTag())
+        {
+            uniform = static_cast<glow::Uniform<glm::mat4> *>(entry->uniform);
+        }
+        else
+        {
+            uniform = entry->uniform->as<glm::mat4>();
+            entry->type = glow::Uniform<glm::mat4>::typeTag();
+        }
+
+        benchmark::DoNotOptimize(uniform);
+        benchmark::DoNotOptimize(value);
+    }
+}
+
+}
+
+BENCHMARK(Uniform_lookupByString);
+BENCHMARK(Uniform_lookupByName);
@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/constants.h>
+
+// Measures enumName, which is used for every enum in log and error messages, and its
+// non-allocating variant.
+
+namespace
+{
+
+const std::vector<GLenum> & enums()
+{
+    static const std::vector<GLenum> enums = {
+        GL_TEXTURE_2D, GL_RGBA8, GL_FLOAT, GL_UNSIGNED_BYTE, GL_ARRAY_BUFFER, GL_STATIC_DRAW
+    ,   GL_FRAGMENT_SHADER, GL_INVALID_OPERATION, GL_DEPTH_TEST, GL_COLOR_ATTACHMENT0
+    ,   GL_TRIANGLES, GL_LINEAR_MIPMAP_LINEAR, GL_FLOAT_MAT4, GL_FRAMEBUFFER_COMPLETE };
+
+    return enums;
+}
+
+void constants_enumName(benchmark::State & state)
+{
+    unsigned int i = 0;
+
+    while (state.KeepRunning())
+    {
+        const std::string name = glow::enumName(enums()[i++ % enums().size()]);
+        benchmark::DoNotOptimize(name.data());
+    }
+}
+
+void constants_enumNameCStr(benchmark::State & state)
+{
+    unsigned int i = 0;
+
+    while (state.KeepRunning())
+    {
+        const char * name = glow::enumNameCStr(enums()[i++ % enums().size()]);
+        benchmark::DoNotOptimize(name);
+    }
+}
+
+}
+
+BENCHMARK(constants_enumName);
+BENCHMARK(constants_enumNameCStr);
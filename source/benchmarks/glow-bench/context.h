@@ -0,0 +1,5 @@
+#pragma once
+
+/** \return true if main() created a current offscreen context, required by benchmarks of GL objects.
+ */
+bool hasContext();
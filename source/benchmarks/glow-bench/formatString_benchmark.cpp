@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include <sstream>
+#include <string>
+
+#include <glow/formatString.h>
+
+// Compares the legacy stream based formatting against compiled and cached formats.
+
+namespace
+{
+
+const char * const format = "frame %; took %f.2; ms, %x; draw calls (%;)";
+
+void formatString_streamprintf(benchmark::State & state)
+{
+    int frame = 0;
+
+    while (state.KeepRunning())
+    {
+        std::stringstream stream;
+        glow::streamprintf(stream, format, ++frame, 16.6f, 255, "opaque");
+        benchmark::DoNotOptimize(stream.str());
+    }
+}
+
+void formatString_cached(benchmark::State & state)
+{
+    int frame = 0;
+
+    while (state.KeepRunning())
+        benchmark::DoNotOptimize(glow::formatString(format, ++frame, 16.6f, 255, "opaque"));
+}
+
+void formatString_reusedBuffer(benchmark::State & state)
+{
+    std::string buffer;
+    int frame = 0;
+
+    while (state.KeepRunning())
+    {
+        buffer.clear();
+        glow::appendFormatted(buffer, format, ++frame, 16.6f, 255, "opaque");
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+
+}
+
+BENCHMARK(formatString_streamprintf);
+BENCHMARK(formatString_cached);
+BENCHMARK(formatString_reusedBuffer);
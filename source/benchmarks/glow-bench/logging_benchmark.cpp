@@ -0,0 +1,26 @@
+#include <benchmark/benchmark.h>
+
+#include <glow/logging.h>
+
+// Measures messages above the verbosity level, which are built but not handled, e.g., debug
+// messages in hot paths of release configurations.
+
+namespace
+{
+
+void logging_filtered(benchmark::State & state)
+{
+    const glow::LogMessage::Level verbosityLevel = glow::verbosityLevel();
+    glow::setVerbosityLevel(glow::LogMessage::Warning);
+
+    int frame = 0;
+
+    while (state.KeepRunning())
+        glow::debug() << "frame " << ++frame << " took " << 16.6f << " ms";
+
+    glow::setVerbosityLevel(verbosityLevel);
+}
+
+}
+
+BENCHMARK(logging_filtered);
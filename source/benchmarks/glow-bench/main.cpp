@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <glowwindow/ContextFormat.h>
+#include <glowwindow/OffscreenContext.h>
+
+#include "context.h"
+
+namespace
+{
+
+bool l_hasContext = false;
+
+}
+
+bool hasContext()
+{
+    return l_hasContext;
+}
+
+/** Runs the benchmarks, those of GL objects in an offscreen context, e.g., Mesa's llvmpipe
+    without X server and GPU, so driver overhead is measured on the CPU as well. Without EGL,
+    these benchmarks are reported as skipped.
+
+    Results are written as JSON with --benchmark_out=<file> --benchmark_out_format=json,
+    which the 'benchmark' target does into glow-bench.json in the build directory.
+*/
+int main(int argc, char* argv[])
+{
+    ::benchmark::Initialize(&argc, argv);
+
+    glowwindow::ContextFormat format;
+    format.setVersion(3, 2);
+    format.setProfile(glowwindow::ContextFormat::CoreProfile);
+
+    glowwindow::OffscreenContext context;
+    if (glowwindow::OffscreenContext::isSupported() && context.create(format, 64, 64))
+    {
+        context.makeCurrent();
+        l_hasContext = true;
+    }
+
+    ::benchmark::RunSpecifiedBenchmarks();
+
+    if (l_hasContext)
+        context.doneCurrent();
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include <glow/Referenced.h>
+#include <glow/ref_ptr.h>
+
+// Measures the reference counting of ref_ptr when passing objects around (copies) and when
+// creating and releasing short-lived objects, e.g., per-frame uniforms and string sources.
+
+namespace
+{
+
+class Node : public glow::Referenced
+{
+public:
+    float value;
+
+protected:
+    virtual ~Node()
+    {
+    }
+};
+
+void ref_ptr_copy(benchmark::State & state)
+{
+    std::vector<glow::ref_ptr<Node>> nodes;
+    for (int i = 0; i < 64; ++i)
+        nodes.push_back(new Node);
+
+    std::vector<glow::ref_ptr<Node>> copies;
+    copies.reserve(nodes.size());
+
+    while (state.KeepRunning())
+    {
+        copies.assign(nodes.begin(), nodes.end());
+        copies.clear();
+    }
+}
+
+void ref_ptr_createAndRelease(benchmark::State & state)
+{
+    std::vector<glow::ref_ptr<Node>> nodes;
+    nodes.reserve(64);
+
+    while (state.KeepRunning())
+    {
+        for (int i = 0; i < 64; ++i)
+            nodes.push_back(new Node);
+
+        nodes.clear();
+    }
+}
+
+}
+
+BENCHMARK(ref_ptr_copy);
+BENCHMARK(ref_ptr_createAndRelease);
@@ -1,621 +1,639 @@
-#include <string>
-#include <unordered_map>
+#pragma once
 
+#include <GL/glew.h>
+
+#include <glow/glow.h>
 #include <glow/Extension.h>
-#include <glow/Version.h>
 
-const std::unordered_map<glow::Extension, std::string, std::hash<unsigned int>> extensionStrings = {
-	{ glow::GLOW_3DFX_multisample, "GL_3DFX_multisample" },
-	{ glow::GLOW_3DFX_tbuffer, "GL_3DFX_tbuffer" },
-	{ glow::GLOW_3DFX_texture_compression_FXT1, "GL_3DFX_texture_compression_FXT1" },
-	{ glow::GLOW_AMD_blend_minmax_factor, "GL_AMD_blend_minmax_factor" },
-	{ glow::GLOW_AMD_compressed_3DC_texture, "GL_AMD_compressed_3DC_texture" },
-	{ glow::GLOW_AMD_compressed_ATC_texture, "GL_AMD_compressed_ATC_texture" },
-	{ glow::GLOW_AMD_conservative_depth, "GL_AMD_conservative_depth" },
-	{ glow::GLOW_AMD_debug_output, "GL_AMD_debug_output" },
-	{ glow::GLOW_AMD_depth_clamp_separate, "GL_AMD_depth_clamp_separate" },
-	{ glow::GLOW_AMD_draw_buffers_blend, "GL_AMD_draw_buffers_blend" },
-	{ glow::GLOW_AMD_interleaved_elements, "GL_AMD_interleaved_elements" },
-	{ glow::GLOW_AMD_multi_draw_indirect, "GL_AMD_multi_draw_indirect" },
-	{ glow::GLOW_AMD_name_gen_delete, "GL_AMD_name_gen_delete" },
-	{ glow::GLOW_AMD_occlusion_query_event, "GL_AMD_occlusion_query_event" },
-	{ glow::GLOW_AMD_performance_monitor, "GL_AMD_performance_monitor" },
-	{ glow::GLOW_AMD_pinned_memory, "GL_AMD_pinned_memory" },
-	{ glow::GLOW_AMD_program_binary_Z400, "GL_AMD_program_binary_Z400" },
-	{ glow::GLOW_AMD_query_buffer_object, "GL_AMD_query_buffer_object" },
-	{ glow::GLOW_AMD_sample_positions, "GL_AMD_sample_positions" },
-	{ glow::GLOW_AMD_seamless_cubemap_per_texture, "GL_AMD_seamless_cubemap_per_texture" },
-	{ glow::GLOW_AMD_shader_atomic_counter_ops, "GL_AMD_shader_atomic_counter_ops" },
-	{ glow::GLOW_AMD_shader_stencil_export, "GL_AMD_shader_stencil_export" },
-	{ glow::GLOW_AMD_shader_trinary_minmax, "GL_AMD_shader_trinary_minmax" },
-	{ glow::GLOW_AMD_sparse_texture, "GL_AMD_sparse_texture" },
-	{ glow::GLOW_AMD_stencil_operation_extended, "GL_AMD_stencil_operation_extended" },
-	{ glow::GLOW_AMD_texture_texture4, "GL_AMD_texture_texture4" },
-	{ glow::GLOW_AMD_transform_feedback3_lines_triangles, "GL_AMD_transform_feedback3_lines_triangles" },
-	{ glow::GLOW_AMD_vertex_shader_layer, "GL_AMD_vertex_shader_layer" },
-	{ glow::GLOW_AMD_vertex_shader_tessellator, "GL_AMD_vertex_shader_tessellator" },
-	{ glow::GLOW_AMD_vertex_shader_viewport_index, "GL_AMD_vertex_shader_viewport_index" },
-	{ glow::GLOW_ANGLE_depth_texture, "GL_ANGLE_depth_texture" },
-	{ glow::GLOW_ANGLE_framebuffer_blit, "GL_ANGLE_framebuffer_blit" },
-	{ glow::GLOW_ANGLE_framebuffer_multisample, "GL_ANGLE_framebuffer_multisample" },
-	{ glow::GLOW_ANGLE_instanced_arrays, "GL_ANGLE_instanced_arrays" },
-	{ glow::GLOW_ANGLE_pack_reverse_row_order, "GL_ANGLE_pack_reverse_row_order" },
-	{ glow::GLOW_ANGLE_program_binary, "GL_ANGLE_program_binary" },
-	{ glow::GLOW_ANGLE_texture_compression_dxt3, "GL_ANGLE_texture_compression_dxt3" },
-	{ glow::GLOW_ANGLE_texture_compression_dxt5, "GL_ANGLE_texture_compression_dxt5" },
-	{ glow::GLOW_ANGLE_texture_usage, "GL_ANGLE_texture_usage" },
-	{ glow::GLOW_ANGLE_translated_shader_source, "GL_ANGLE_translated_shader_source" },
-	{ glow::GLOW_APPLE_aux_depth_stencil, "GL_APPLE_aux_depth_stencil" },
-	{ glow::GLOW_APPLE_client_storage, "GL_APPLE_client_storage" },
-	{ glow::GLOW_APPLE_copy_texture_levels, "GL_APPLE_copy_texture_levels" },
-	{ glow::GLOW_APPLE_element_array, "GL_APPLE_element_array" },
-	{ glow::GLOW_APPLE_fence, "GL_APPLE_fence" },
-	{ glow::GLOW_APPLE_float_pixels, "GL_APPLE_float_pixels" },
-	{ glow::GLOW_APPLE_flush_buffer_range, "GL_APPLE_flush_buffer_range" },
-	{ glow::GLOW_APPLE_framebuffer_multisample, "GL_APPLE_framebuffer_multisample" },
-	{ glow::GLOW_APPLE_object_purgeable, "GL_APPLE_object_purgeable" },
-	{ glow::GLOW_APPLE_rgb_422, "GL_APPLE_rgb_422" },
-	{ glow::GLOW_APPLE_row_bytes, "GL_APPLE_row_bytes" },
-	{ glow::GLOW_APPLE_specular_vector, "GL_APPLE_specular_vector" },
-	{ glow::GLOW_APPLE_sync, "GL_APPLE_sync" },
-	{ glow::GLOW_APPLE_texture_2D_limited_npot, "GL_APPLE_texture_2D_limited_npot" },
-	{ glow::GLOW_APPLE_texture_format_BGRA8888, "GL_APPLE_texture_format_BGRA8888" },
-	{ glow::GLOW_APPLE_texture_max_level, "GL_APPLE_texture_max_level" },
-	{ glow::GLOW_APPLE_texture_range, "GL_APPLE_texture_range" },
-	{ glow::GLOW_APPLE_transform_hint, "GL_APPLE_transform_hint" },
-	{ glow::GLOW_APPLE_vertex_array_object, "GL_APPLE_vertex_array_object" },
-	{ glow::GLOW_APPLE_vertex_array_range, "GL_APPLE_vertex_array_range" },
-	{ glow::GLOW_APPLE_vertex_program_evaluators, "GL_APPLE_vertex_program_evaluators" },
-	{ glow::GLOW_APPLE_ycbcr_422, "GL_APPLE_ycbcr_422" },
-	{ glow::GLOW_ARB_ES2_compatibility, "GL_ARB_ES2_compatibility" },
-	{ glow::GLOW_ARB_ES3_compatibility, "GL_ARB_ES3_compatibility" },
-	{ glow::GLOW_ARB_arrays_of_arrays, "GL_ARB_arrays_of_arrays" },
-	{ glow::GLOW_ARB_base_instance, "GL_ARB_base_instance" },
-	{ glow::GLOW_ARB_bindless_texture, "GL_ARB_bindless_texture" },
-	{ glow::GLOW_ARB_blend_func_extended, "GL_ARB_blend_func_extended" },
-	{ glow::GLOW_ARB_buffer_storage, "GL_ARB_buffer_storage" },
-	{ glow::GLOW_ARB_cl_event, "GL_ARB_cl_event" },
-	{ glow::GLOW_ARB_clear_buffer_object, "GL_ARB_clear_buffer_object" },
-	{ glow::GLOW_ARB_clear_texture, "GL_ARB_clear_texture" },
-	{ glow::GLOW_ARB_color_buffer_float, "GL_ARB_color_buffer_float" },
-	{ glow::GLOW_ARB_compatibility, "GL_ARB_compatibility" },
-	{ glow::GLOW_ARB_compressed_texture_pixel_storage, "GL_ARB_compressed_texture_pixel_storage" },
-	{ glow::GLOW_ARB_compute_shader, "GL_ARB_compute_shader" },
-	{ glow::GLOW_ARB_compute_variable_group_size, "GL_ARB_compute_variable_group_size" },
-	{ glow::GLOW_ARB_conservative_depth, "GL_ARB_conservative_depth" },
-	{ glow::GLOW_ARB_copy_buffer, "GL_ARB_copy_buffer" },
-	{ glow::GLOW_ARB_copy_image, "GL_ARB_copy_image" },
-	{ glow::GLOW_ARB_debug_output, "GL_ARB_debug_output" },
-	{ glow::GLOW_ARB_depth_buffer_float, "GL_ARB_depth_buffer_float" },
-	{ glow::GLOW_ARB_depth_clamp, "GL_ARB_depth_clamp" },
-	{ glow::GLOW_ARB_depth_texture, "GL_ARB_depth_texture" },
-	{ glow::GLOW_ARB_draw_buffers, "GL_ARB_draw_buffers" },
-	{ glow::GLOW_ARB_draw_buffers_blend, "GL_ARB_draw_buffers_blend" },
-	{ glow::GLOW_ARB_draw_elements_base_vertex, "GL_ARB_draw_elements_base_vertex" },
-	{ glow::GLOW_ARB_draw_indirect, "GL_ARB_draw_indirect" },
-	{ glow::GLOW_ARB_draw_instanced, "GL_ARB_draw_instanced" },
-	{ glow::GLOW_ARB_enhanced_layouts, "GL_ARB_enhanced_layouts" },
-	{ glow::GLOW_ARB_explicit_attrib_location, "GL_ARB_explicit_attrib_location" },
-	{ glow::GLOW_ARB_explicit_uniform_location, "GL_ARB_explicit_uniform_location" },
-	{ glow::GLOW_ARB_fragment_coord_conventions, "GL_ARB_fragment_coord_conventions" },
-	{ glow::GLOW_ARB_fragment_layer_viewport, "GL_ARB_fragment_layer_viewport" },
-	{ glow::GLOW_ARB_fragment_program, "GL_ARB_fragment_program" },
-	{ glow::GLOW_ARB_fragment_program_shadow, "GL_ARB_fragment_program_shadow" },
-	{ glow::GLOW_ARB_fragment_shader, "GL_ARB_fragment_shader" },
-	{ glow::GLOW_ARB_framebuffer_no_attachments, "GL_ARB_framebuffer_no_attachments" },
-	{ glow::GLOW_ARB_framebuffer_object, "GL_ARB_framebuffer_object" },
-	{ glow::GLOW_ARB_framebuffer_sRGB, "GL_ARB_framebuffer_sRGB" },
-	{ glow::GLOW_ARB_geometry_shader4, "GL_ARB_geometry_shader4" },
-	{ glow::GLOW_ARB_get_program_binary, "GL_ARB_get_program_binary" },
-	{ glow::GLOW_ARB_gpu_shader5, "GL_ARB_gpu_shader5" },
-	{ glow::GLOW_ARB_gpu_shader_fp64, "GL_ARB_gpu_shader_fp64" },
-	{ glow::GLOW_ARB_half_float_pixel, "GL_ARB_half_float_pixel" },
-	{ glow::GLOW_ARB_half_float_vertex, "GL_ARB_half_float_vertex" },
-	{ glow::GLOW_ARB_imaging, "GL_ARB_imaging" },
-	{ glow::GLOW_ARB_indirect_parameters, "GL_ARB_indirect_parameters" },
-	{ glow::GLOW_ARB_instanced_arrays, "GL_ARB_instanced_arrays" },
-	{ glow::GLOW_ARB_internalformat_query, "GL_ARB_internalformat_query" },
-	{ glow::GLOW_ARB_internalformat_query2, "GL_ARB_internalformat_query2" },
-	{ glow::GLOW_ARB_invalidate_subdata, "GL_ARB_invalidate_subdata" },
-	{ glow::GLOW_ARB_map_buffer_alignment, "GL_ARB_map_buffer_alignment" },
-	{ glow::GLOW_ARB_map_buffer_range, "GL_ARB_map_buffer_range" },
-	{ glow::GLOW_ARB_matrix_palette, "GL_ARB_matrix_palette" },
-	{ glow::GLOW_ARB_multi_bind, "GL_ARB_multi_bind" },
-	{ glow::GLOW_ARB_multi_draw_indirect, "GL_ARB_multi_draw_indirect" },
-	{ glow::GLOW_ARB_multisample, "GL_ARB_multisample" },
-	{ glow::GLOW_ARB_multitexture, "GL_ARB_multitexture" },
-	{ glow::GLOW_ARB_occlusion_query, "GL_ARB_occlusion_query" },
-	{ glow::GLOW_ARB_occlusion_query2, "GL_ARB_occlusion_query2" },
-	{ glow::GLOW_ARB_pixel_buffer_object, "GL_ARB_pixel_buffer_object" },
-	{ glow::GLOW_ARB_point_parameters, "GL_ARB_point_parameters" },
-	{ glow::GLOW_ARB_point_sprite, "GL_ARB_point_sprite" },
-	{ glow::GLOW_ARB_program_interface_query, "GL_ARB_program_interface_query" },
-	{ glow::GLOW_ARB_provoking_vertex, "GL_ARB_provoking_vertex" },
-	{ glow::GLOW_ARB_query_buffer_object, "GL_ARB_query_buffer_object" },
-	{ glow::GLOW_ARB_robust_buffer_access_behavior, "GL_ARB_robust_buffer_access_behavior" },
-	{ glow::GLOW_ARB_robustness, "GL_ARB_robustness" },
-	{ glow::GLOW_ARB_robustness_isolation, "GL_ARB_robustness_isolation" },
-	{ glow::GLOW_ARB_sample_shading, "GL_ARB_sample_shading" },
-	{ glow::GLOW_ARB_sampler_objects, "GL_ARB_sampler_objects" },
-	{ glow::GLOW_ARB_seamless_cube_map, "GL_ARB_seamless_cube_map" },
-	{ glow::GLOW_ARB_seamless_cubemap_per_texture, "GL_ARB_seamless_cubemap_per_texture" },
-	{ glow::GLOW_ARB_separate_shader_objects, "GL_ARB_separate_shader_objects" },
-	{ glow::GLOW_ARB_shader_atomic_counters, "GL_ARB_shader_atomic_counters" },
-	{ glow::GLOW_ARB_shader_bit_encoding, "GL_ARB_shader_bit_encoding" },
-	{ glow::GLOW_ARB_shader_draw_parameters, "GL_ARB_shader_draw_parameters" },
-	{ glow::GLOW_ARB_shader_group_vote, "GL_ARB_shader_group_vote" },
-	{ glow::GLOW_ARB_shader_image_load_store, "GL_ARB_shader_image_load_store" },
-	{ glow::GLOW_ARB_shader_image_size, "GL_ARB_shader_image_size" },
-	{ glow::GLOW_ARB_shader_objects, "GL_ARB_shader_objects" },
-	{ glow::GLOW_ARB_shader_precision, "GL_ARB_shader_precision" },
-	{ glow::GLOW_ARB_shader_stencil_export, "GL_ARB_shader_stencil_export" },
-	{ glow::GLOW_ARB_shader_storage_buffer_object, "GL_ARB_shader_storage_buffer_object" },
-	{ glow::GLOW_ARB_shader_subroutine, "GL_ARB_shader_subroutine" },
-	{ glow::GLOW_ARB_shader_texture_lod, "GL_ARB_shader_texture_lod" },
-	{ glow::GLOW_ARB_shading_language_100, "GL_ARB_shading_language_100" },
-	{ glow::GLOW_ARB_shading_language_420pack, "GL_ARB_shading_language_420pack" },
-	{ glow::GLOW_ARB_shading_language_include, "GL_ARB_shading_language_include" },
-	{ glow::GLOW_ARB_shading_language_packing, "GL_ARB_shading_language_packing" },
-	{ glow::GLOW_ARB_shadow, "GL_ARB_shadow" },
-	{ glow::GLOW_ARB_shadow_ambient, "GL_ARB_shadow_ambient" },
-	{ glow::GLOW_ARB_sparse_texture, "GL_ARB_sparse_texture" },
-	{ glow::GLOW_ARB_stencil_texturing, "GL_ARB_stencil_texturing" },
-	{ glow::GLOW_ARB_sync, "GL_ARB_sync" },
-	{ glow::GLOW_ARB_tessellation_shader, "GL_ARB_tessellation_shader" },
-	{ glow::GLOW_ARB_texture_border_clamp, "GL_ARB_texture_border_clamp" },
-	{ glow::GLOW_ARB_texture_buffer_object, "GL_ARB_texture_buffer_object" },
-	{ glow::GLOW_ARB_texture_buffer_object_rgb32, "GL_ARB_texture_buffer_object_rgb32" },
-	{ glow::GLOW_ARB_texture_buffer_range, "GL_ARB_texture_buffer_range" },
-	{ glow::GLOW_ARB_texture_compression, "GL_ARB_texture_compression" },
-	{ glow::GLOW_ARB_texture_compression_bptc, "GL_ARB_texture_compression_bptc" },
-	{ glow::GLOW_ARB_texture_compression_rgtc, "GL_ARB_texture_compression_rgtc" },
-	{ glow::GLOW_ARB_texture_cube_map, "GL_ARB_texture_cube_map" },
-	{ glow::GLOW_ARB_texture_cube_map_array, "GL_ARB_texture_cube_map_array" },
-	{ glow::GLOW_ARB_texture_env_add, "GL_ARB_texture_env_add" },
-	{ glow::GLOW_ARB_texture_env_combine, "GL_ARB_texture_env_combine" },
-	{ glow::GLOW_ARB_texture_env_crossbar, "GL_ARB_texture_env_crossbar" },
-	{ glow::GLOW_ARB_texture_env_dot3, "GL_ARB_texture_env_dot3" },
-	{ glow::GLOW_ARB_texture_float, "GL_ARB_texture_float" },
-	{ glow::GLOW_ARB_texture_gather, "GL_ARB_texture_gather" },
-	{ glow::GLOW_ARB_texture_mirror_clamp_to_edge, "GL_ARB_texture_mirror_clamp_to_edge" },
-	{ glow::GLOW_ARB_texture_mirrored_repeat, "GL_ARB_texture_mirrored_repeat" },
-	{ glow::GLOW_ARB_texture_multisample, "GL_ARB_texture_multisample" },
-	{ glow::GLOW_ARB_texture_non_power_of_two, "GL_ARB_texture_non_power_of_two" },
-	{ glow::GLOW_ARB_texture_query_levels, "GL_ARB_texture_query_levels" },
-	{ glow::GLOW_ARB_texture_query_lod, "GL_ARB_texture_query_lod" },
-	{ glow::GLOW_ARB_texture_rectangle, "GL_ARB_texture_rectangle" },
-	{ glow::GLOW_ARB_texture_rg, "GL_ARB_texture_rg" },
-	{ glow::GLOW_ARB_texture_rgb10_a2ui, "GL_ARB_texture_rgb10_a2ui" },
-	{ glow::GLOW_ARB_texture_stencil8, "GL_ARB_texture_stencil8" },
-	{ glow::GLOW_ARB_texture_storage, "GL_ARB_texture_storage" },
-	{ glow::GLOW_ARB_texture_storage_multisample, "GL_ARB_texture_storage_multisample" },
-	{ glow::GLOW_ARB_texture_swizzle, "GL_ARB_texture_swizzle" },
-	{ glow::GLOW_ARB_texture_view, "GL_ARB_texture_view" },
-	{ glow::GLOW_ARB_timer_query, "GL_ARB_timer_query" },
-	{ glow::GLOW_ARB_transform_feedback2, "GL_ARB_transform_feedback2" },
-	{ glow::GLOW_ARB_transform_feedback3, "GL_ARB_transform_feedback3" },
-	{ glow::GLOW_ARB_transform_feedback_instanced, "GL_ARB_transform_feedback_instanced" },
-	{ glow::GLOW_ARB_transpose_matrix, "GL_ARB_transpose_matrix" },
-	{ glow::GLOW_ARB_uniform_buffer_object, "GL_ARB_uniform_buffer_object" },
-	{ glow::GLOW_ARB_vertex_array_bgra, "GL_ARB_vertex_array_bgra" },
-	{ glow::GLOW_ARB_vertex_array_object, "GL_ARB_vertex_array_object" },
-	{ glow::GLOW_ARB_vertex_attrib_64bit, "GL_ARB_vertex_attrib_64bit" },
-	{ glow::GLOW_ARB_vertex_attrib_binding, "GL_ARB_vertex_attrib_binding" },
-	{ glow::GLOW_ARB_vertex_blend, "GL_ARB_vertex_blend" },
-	{ glow::GLOW_ARB_vertex_buffer_object, "GL_ARB_vertex_buffer_object" },
-	{ glow::GLOW_ARB_vertex_program, "GL_ARB_vertex_program" },
-	{ glow::GLOW_ARB_vertex_shader, "GL_ARB_vertex_shader" },
-	{ glow::GLOW_ARB_vertex_type_10f_11f_11f_rev, "GL_ARB_vertex_type_10f_11f_11f_rev" },
-	{ glow::GLOW_ARB_vertex_type_2_10_10_10_rev, "GL_ARB_vertex_type_2_10_10_10_rev" },
-	{ glow::GLOW_ARB_viewport_array, "GL_ARB_viewport_array" },
-	{ glow::GLOW_ARB_window_pos, "GL_ARB_window_pos" },
-	{ glow::GLOW_ARM_mali_program_binary, "GL_ARM_mali_program_binary" },
-	{ glow::GLOW_ARM_mali_shader_binary, "GL_ARM_mali_shader_binary" },
-	{ glow::GLOW_ARM_rgba8, "GL_ARM_rgba8" },
-	{ glow::GLOW_ATI_draw_buffers, "GL_ATI_draw_buffers" },
-	{ glow::GLOW_ATI_element_array, "GL_ATI_element_array" },
-	{ glow::GLOW_ATI_envmap_bumpmap, "GL_ATI_envmap_bumpmap" },
-	{ glow::GLOW_ATI_fragment_shader, "GL_ATI_fragment_shader" },
-	{ glow::GLOW_ATI_map_object_buffer, "GL_ATI_map_object_buffer" },
-	{ glow::GLOW_ATI_meminfo, "GL_ATI_meminfo" },
-	{ glow::GLOW_ATI_pixel_format_float, "GL_ATI_pixel_format_float" },
-	{ glow::GLOW_ATI_pn_triangles, "GL_ATI_pn_triangles" },
-	{ glow::GLOW_ATI_separate_stencil, "GL_ATI_separate_stencil" },
-	{ glow::GLOW_ATI_text_fragment_shader, "GL_ATI_text_fragment_shader" },
-	{ glow::GLOW_ATI_texture_env_combine3, "GL_ATI_texture_env_combine3" },
-	{ glow::GLOW_ATI_texture_float, "GL_ATI_texture_float" },
-	{ glow::GLOW_ATI_texture_mirror_once, "GL_ATI_texture_mirror_once" },
-	{ glow::GLOW_ATI_vertex_array_object, "GL_ATI_vertex_array_object" },
-	{ glow::GLOW_ATI_vertex_attrib_array_object, "GL_ATI_vertex_attrib_array_object" },
-	{ glow::GLOW_ATI_vertex_streams, "GL_ATI_vertex_streams" },
-	{ glow::GLOW_DMP_shader_binary, "GL_DMP_shader_binary" },
-	{ glow::GLOW_EXT_422_pixels, "GL_EXT_422_pixels" },
-	{ glow::GLOW_EXT_abgr, "GL_EXT_abgr" },
-	{ glow::GLOW_EXT_bgra, "GL_EXT_bgra" },
-	{ glow::GLOW_EXT_bindable_uniform, "GL_EXT_bindable_uniform" },
-	{ glow::GLOW_EXT_blend_color, "GL_EXT_blend_color" },
-	{ glow::GLOW_EXT_blend_equation_separate, "GL_EXT_blend_equation_separate" },
-	{ glow::GLOW_EXT_blend_func_separate, "GL_EXT_blend_func_separate" },
-	{ glow::GLOW_EXT_blend_logic_op, "GL_EXT_blend_logic_op" },
-	{ glow::GLOW_EXT_blend_minmax, "GL_EXT_blend_minmax" },
-	{ glow::GLOW_EXT_blend_subtract, "GL_EXT_blend_subtract" },
-	{ glow::GLOW_EXT_clip_volume_hint, "GL_EXT_clip_volume_hint" },
-	{ glow::GLOW_EXT_cmyka, "GL_EXT_cmyka" },
-	{ glow::GLOW_EXT_color_buffer_half_float, "GL_EXT_color_buffer_half_float" },
-	{ glow::GLOW_EXT_color_subtable, "GL_EXT_color_subtable" },
-	{ glow::GLOW_EXT_compiled_vertex_array, "GL_EXT_compiled_vertex_array" },
-	{ glow::GLOW_EXT_convolution, "GL_EXT_convolution" },
-	{ glow::GLOW_EXT_coordinate_frame, "GL_EXT_coordinate_frame" },
-	{ glow::GLOW_EXT_copy_texture, "GL_EXT_copy_texture" },
-	{ glow::GLOW_EXT_cull_vertex, "GL_EXT_cull_vertex" },
-	{ glow::GLOW_EXT_debug_label, "GL_EXT_debug_label" },
-	{ glow::GLOW_EXT_debug_marker, "GL_EXT_debug_marker" },
-	{ glow::GLOW_EXT_depth_bounds_test, "GL_EXT_depth_bounds_test" },
-	{ glow::GLOW_EXT_direct_state_access, "GL_EXT_direct_state_access" },
-	{ glow::GLOW_EXT_discard_framebuffer, "GL_EXT_discard_framebuffer" },
-	{ glow::GLOW_EXT_disjoint_timer_query, "GL_EXT_disjoint_timer_query" },
-	{ glow::GLOW_EXT_draw_buffers, "GL_EXT_draw_buffers" },
-	{ glow::GLOW_EXT_draw_buffers2, "GL_EXT_draw_buffers2" },
-	{ glow::GLOW_EXT_draw_instanced, "GL_EXT_draw_instanced" },
-	{ glow::GLOW_EXT_draw_range_elements, "GL_EXT_draw_range_elements" },
-	{ glow::GLOW_EXT_fog_coord, "GL_EXT_fog_coord" },
-	{ glow::GLOW_EXT_framebuffer_blit, "GL_EXT_framebuffer_blit" },
-	{ glow::GLOW_EXT_framebuffer_multisample, "GL_EXT_framebuffer_multisample" },
-	{ glow::GLOW_EXT_framebuffer_multisample_blit_scaled, "GL_EXT_framebuffer_multisample_blit_scaled" },
-	{ glow::GLOW_EXT_framebuffer_object, "GL_EXT_framebuffer_object" },
-	{ glow::GLOW_EXT_framebuffer_sRGB, "GL_EXT_framebuffer_sRGB" },
-	{ glow::GLOW_EXT_geometry_shader4, "GL_EXT_geometry_shader4" },
-	{ glow::GLOW_EXT_gpu_program_parameters, "GL_EXT_gpu_program_parameters" },
-	{ glow::GLOW_EXT_gpu_shader4, "GL_EXT_gpu_shader4" },
-	{ glow::GLOW_EXT_histogram, "GL_EXT_histogram" },
-	{ glow::GLOW_EXT_index_array_formats, "GL_EXT_index_array_formats" },
-	{ glow::GLOW_EXT_index_func, "GL_EXT_index_func" },
-	{ glow::GLOW_EXT_index_material, "GL_EXT_index_material" },
-	{ glow::GLOW_EXT_index_texture, "GL_EXT_index_texture" },
-	{ glow::GLOW_EXT_instanced_arrays, "GL_EXT_instanced_arrays" },
-	{ glow::GLOW_EXT_light_texture, "GL_EXT_light_texture" },
-	{ glow::GLOW_EXT_map_buffer_range, "GL_EXT_map_buffer_range" },
-	{ glow::GLOW_EXT_misc_attribute, "GL_EXT_misc_attribute" },
-	{ glow::GLOW_EXT_multi_draw_arrays, "GL_EXT_multi_draw_arrays" },
-	{ glow::GLOW_EXT_multisample, "GL_EXT_multisample" },
-	{ glow::GLOW_EXT_multisampled_render_to_texture, "GL_EXT_multisampled_render_to_texture" },
-	{ glow::GLOW_EXT_multiview_draw_buffers, "GL_EXT_multiview_draw_buffers" },
-	{ glow::GLOW_EXT_occlusion_query_boolean, "GL_EXT_occlusion_query_boolean" },
-	{ glow::GLOW_EXT_packed_depth_stencil, "GL_EXT_packed_depth_stencil" },
-	{ glow::GLOW_EXT_packed_float, "GL_EXT_packed_float" },
-	{ glow::GLOW_EXT_packed_pixels, "GL_EXT_packed_pixels" },
-	{ glow::GLOW_EXT_paletted_texture, "GL_EXT_paletted_texture" },
-	{ glow::GLOW_EXT_pixel_buffer_object, "GL_EXT_pixel_buffer_object" },
-	{ glow::GLOW_EXT_pixel_transform, "GL_EXT_pixel_transform" },
-	{ glow::GLOW_EXT_pixel_transform_color_table, "GL_EXT_pixel_transform_color_table" },
-	{ glow::GLOW_EXT_point_parameters, "GL_EXT_point_parameters" },
-	{ glow::GLOW_EXT_polygon_offset, "GL_EXT_polygon_offset" },
-	{ glow::GLOW_EXT_provoking_vertex, "GL_EXT_provoking_vertex" },
-	{ glow::GLOW_EXT_pvrtc_sRGB, "GL_EXT_pvrtc_sRGB" },
-	{ glow::GLOW_EXT_read_format_bgra, "GL_EXT_read_format_bgra" },
-	{ glow::GLOW_EXT_rescale_normal, "GL_EXT_rescale_normal" },
-	{ glow::GLOW_EXT_robustness, "GL_EXT_robustness" },
-	{ glow::GLOW_EXT_sRGB, "GL_EXT_sRGB" },
-	{ glow::GLOW_EXT_sRGB_write_control, "GL_EXT_sRGB_write_control" },
-	{ glow::GLOW_EXT_secondary_color, "GL_EXT_secondary_color" },
-	{ glow::GLOW_EXT_separate_shader_objects, "GL_EXT_separate_shader_objects" },
-	{ glow::GLOW_EXT_separate_specular_color, "GL_EXT_separate_specular_color" },
-	{ glow::GLOW_EXT_shader_framebuffer_fetch, "GL_EXT_shader_framebuffer_fetch" },
-	{ glow::GLOW_EXT_shader_image_load_store, "GL_EXT_shader_image_load_store" },
-	{ glow::GLOW_EXT_shader_integer_mix, "GL_EXT_shader_integer_mix" },
-	{ glow::GLOW_EXT_shader_texture_lod, "GL_EXT_shader_texture_lod" },
-	{ glow::GLOW_EXT_shadow_funcs, "GL_EXT_shadow_funcs" },
-	{ glow::GLOW_EXT_shadow_samplers, "GL_EXT_shadow_samplers" },
-	{ glow::GLOW_EXT_shared_texture_palette, "GL_EXT_shared_texture_palette" },
-	{ glow::GLOW_EXT_stencil_clear_tag, "GL_EXT_stencil_clear_tag" },
-	{ glow::GLOW_EXT_stencil_two_side, "GL_EXT_stencil_two_side" },
-	{ glow::GLOW_EXT_stencil_wrap, "GL_EXT_stencil_wrap" },
-	{ glow::GLOW_EXT_subtexture, "GL_EXT_subtexture" },
-	{ glow::GLOW_EXT_texture, "GL_EXT_texture" },
-	{ glow::GLOW_EXT_texture3D, "GL_EXT_texture3D" },
-	{ glow::GLOW_EXT_texture_array, "GL_EXT_texture_array" },
-	{ glow::GLOW_EXT_texture_buffer_object, "GL_EXT_texture_buffer_object" },
-	{ glow::GLOW_EXT_texture_compression_dxt1, "GL_EXT_texture_compression_dxt1" },
-	{ glow::GLOW_EXT_texture_compression_latc, "GL_EXT_texture_compression_latc" },
-	{ glow::GLOW_EXT_texture_compression_rgtc, "GL_EXT_texture_compression_rgtc" },
-	{ glow::GLOW_EXT_texture_compression_s3tc, "GL_EXT_texture_compression_s3tc" },
-	{ glow::GLOW_EXT_texture_cube_map, "GL_EXT_texture_cube_map" },
-	{ glow::GLOW_EXT_texture_env_add, "GL_EXT_texture_env_add" },
-	{ glow::GLOW_EXT_texture_env_combine, "GL_EXT_texture_env_combine" },
-	{ glow::GLOW_EXT_texture_env_dot3, "GL_EXT_texture_env_dot3" },
-	{ glow::GLOW_EXT_texture_filter_anisotropic, "GL_EXT_texture_filter_anisotropic" },
-	{ glow::GLOW_EXT_texture_format_BGRA8888, "GL_EXT_texture_format_BGRA8888" },
-	{ glow::GLOW_EXT_texture_integer, "GL_EXT_texture_integer" },
-	{ glow::GLOW_EXT_texture_lod_bias, "GL_EXT_texture_lod_bias" },
-	{ glow::GLOW_EXT_texture_mirror_clamp, "GL_EXT_texture_mirror_clamp" },
-	{ glow::GLOW_EXT_texture_object, "GL_EXT_texture_object" },
-	{ glow::GLOW_EXT_texture_perturb_normal, "GL_EXT_texture_perturb_normal" },
-	{ glow::GLOW_EXT_texture_rg, "GL_EXT_texture_rg" },
-	{ glow::GLOW_EXT_texture_sRGB, "GL_EXT_texture_sRGB" },
-	{ glow::GLOW_EXT_texture_sRGB_decode, "GL_EXT_texture_sRGB_decode" },
-	{ glow::GLOW_EXT_texture_shared_exponent, "GL_EXT_texture_shared_exponent" },
-	{ glow::GLOW_EXT_texture_snorm, "GL_EXT_texture_snorm" },
-	{ glow::GLOW_EXT_texture_storage, "GL_EXT_texture_storage" },
-	{ glow::GLOW_EXT_texture_swizzle, "GL_EXT_texture_swizzle" },
-	{ glow::GLOW_EXT_texture_type_2_10_10_10_REV, "GL_EXT_texture_type_2_10_10_10_REV" },
-	{ glow::GLOW_EXT_timer_query, "GL_EXT_timer_query" },
-	{ glow::GLOW_EXT_transform_feedback, "GL_EXT_transform_feedback" },
-	{ glow::GLOW_EXT_unpack_subimage, "GL_EXT_unpack_subimage" },
-	{ glow::GLOW_EXT_vertex_array, "GL_EXT_vertex_array" },
-	{ glow::GLOW_EXT_vertex_array_bgra, "GL_EXT_vertex_array_bgra" },
-	{ glow::GLOW_EXT_vertex_attrib_64bit, "GL_EXT_vertex_attrib_64bit" },
-	{ glow::GLOW_EXT_vertex_shader, "GL_EXT_vertex_shader" },
-	{ glow::GLOW_EXT_vertex_weighting, "GL_EXT_vertex_weighting" },
-	{ glow::GLOW_EXT_x11_sync_object, "GL_EXT_x11_sync_object" },
-	{ glow::GLOW_FJ_shader_binary_GCCSO, "GL_FJ_shader_binary_GCCSO" },
-	{ glow::GLOW_GREMEDY_frame_terminator, "GL_GREMEDY_frame_terminator" },
-	{ glow::GLOW_GREMEDY_string_marker, "GL_GREMEDY_string_marker" },
-	{ glow::GLOW_HP_convolution_border_modes, "GL_HP_convolution_border_modes" },
-	{ glow::GLOW_HP_image_transform, "GL_HP_image_transform" },
-	{ glow::GLOW_HP_occlusion_test, "GL_HP_occlusion_test" },
-	{ glow::GLOW_HP_texture_lighting, "GL_HP_texture_lighting" },
-	{ glow::GLOW_IBM_cull_vertex, "GL_IBM_cull_vertex" },
-	{ glow::GLOW_IBM_multimode_draw_arrays, "GL_IBM_multimode_draw_arrays" },
-	{ glow::GLOW_IBM_rasterpos_clip, "GL_IBM_rasterpos_clip" },
-	{ glow::GLOW_IBM_static_data, "GL_IBM_static_data" },
-	{ glow::GLOW_IBM_texture_mirrored_repeat, "GL_IBM_texture_mirrored_repeat" },
-	{ glow::GLOW_IBM_vertex_array_lists, "GL_IBM_vertex_array_lists" },
-	{ glow::GLOW_IMG_multisampled_render_to_texture, "GL_IMG_multisampled_render_to_texture" },
-	{ glow::GLOW_IMG_program_binary, "GL_IMG_program_binary" },
-	{ glow::GLOW_IMG_read_format, "GL_IMG_read_format" },
-	{ glow::GLOW_IMG_shader_binary, "GL_IMG_shader_binary" },
-	{ glow::GLOW_IMG_texture_compression_pvrtc, "GL_IMG_texture_compression_pvrtc" },
-	{ glow::GLOW_IMG_texture_compression_pvrtc2, "GL_IMG_texture_compression_pvrtc2" },
-	{ glow::GLOW_IMG_texture_env_enhanced_fixed_function, "GL_IMG_texture_env_enhanced_fixed_function" },
-	{ glow::GLOW_IMG_user_clip_plane, "GL_IMG_user_clip_plane" },
-	{ glow::GLOW_INGR_blend_func_separate, "GL_INGR_blend_func_separate" },
-	{ glow::GLOW_INGR_color_clamp, "GL_INGR_color_clamp" },
-	{ glow::GLOW_INGR_interlace_read, "GL_INGR_interlace_read" },
-	{ glow::GLOW_INTEL_fragment_shader_ordering, "GL_INTEL_fragment_shader_ordering" },
-	{ glow::GLOW_INTEL_map_texture, "GL_INTEL_map_texture" },
-	{ glow::GLOW_INTEL_parallel_arrays, "GL_INTEL_parallel_arrays" },
-	{ glow::GLOW_INTEL_performance_query, "GL_INTEL_performance_query" },
-	{ glow::GLOW_KHR_debug, "GL_KHR_debug" },
-	{ glow::GLOW_KHR_texture_compression_astc_hdr, "GL_KHR_texture_compression_astc_hdr" },
-	{ glow::GLOW_KHR_texture_compression_astc_ldr, "GL_KHR_texture_compression_astc_ldr" },
-	{ glow::GLOW_MESAX_texture_stack, "GL_MESAX_texture_stack" },
-	{ glow::GLOW_MESA_pack_invert, "GL_MESA_pack_invert" },
-	{ glow::GLOW_MESA_resize_buffers, "GL_MESA_resize_buffers" },
-	{ glow::GLOW_MESA_window_pos, "GL_MESA_window_pos" },
-	{ glow::GLOW_MESA_ycbcr_texture, "GL_MESA_ycbcr_texture" },
-	{ glow::GLOW_NVX_conditional_render, "GL_NVX_conditional_render" },
-	{ glow::GLOW_NVX_gpu_memory_info, "GL_NVX_gpu_memory_info" },
-	{ glow::GLOW_NV_bindless_multi_draw_indirect, "GL_NV_bindless_multi_draw_indirect" },
-	{ glow::GLOW_NV_bindless_texture, "GL_NV_bindless_texture" },
-	{ glow::GLOW_NV_blend_equation_advanced, "GL_NV_blend_equation_advanced" },
-	{ glow::GLOW_NV_blend_equation_advanced_coherent, "GL_NV_blend_equation_advanced_coherent" },
-	{ glow::GLOW_NV_blend_square, "GL_NV_blend_square" },
-	{ glow::GLOW_NV_compute_program5, "GL_NV_compute_program5" },
-	{ glow::GLOW_NV_conditional_render, "GL_NV_conditional_render" },
-	{ glow::GLOW_NV_copy_buffer, "GL_NV_copy_buffer" },
-	{ glow::GLOW_NV_copy_depth_to_color, "GL_NV_copy_depth_to_color" },
-	{ glow::GLOW_NV_copy_image, "GL_NV_copy_image" },
-	{ glow::GLOW_NV_coverage_sample, "GL_NV_coverage_sample" },
-	{ glow::GLOW_NV_deep_texture3D, "GL_NV_deep_texture3D" },
-	{ glow::GLOW_NV_depth_buffer_float, "GL_NV_depth_buffer_float" },
-	{ glow::GLOW_NV_depth_clamp, "GL_NV_depth_clamp" },
-	{ glow::GLOW_NV_depth_nonlinear, "GL_NV_depth_nonlinear" },
-	{ glow::GLOW_NV_draw_buffers, "GL_NV_draw_buffers" },
-	{ glow::GLOW_NV_draw_instanced, "GL_NV_draw_instanced" },
-	{ glow::GLOW_NV_draw_texture, "GL_NV_draw_texture" },
-	{ glow::GLOW_NV_evaluators, "GL_NV_evaluators" },
-	{ glow::GLOW_NV_explicit_attrib_location, "GL_NV_explicit_attrib_location" },
-	{ glow::GLOW_NV_explicit_multisample, "GL_NV_explicit_multisample" },
-	{ glow::GLOW_NV_fbo_color_attachments, "GL_NV_fbo_color_attachments" },
-	{ glow::GLOW_NV_fence, "GL_NV_fence" },
-	{ glow::GLOW_NV_float_buffer, "GL_NV_float_buffer" },
-	{ glow::GLOW_NV_fog_distance, "GL_NV_fog_distance" },
-	{ glow::GLOW_NV_fragment_program, "GL_NV_fragment_program" },
-	{ glow::GLOW_NV_fragment_program2, "GL_NV_fragment_program2" },
-	{ glow::GLOW_NV_fragment_program4, "GL_NV_fragment_program4" },
-	{ glow::GLOW_NV_fragment_program_option, "GL_NV_fragment_program_option" },
-	{ glow::GLOW_NV_framebuffer_blit, "GL_NV_framebuffer_blit" },
-	{ glow::GLOW_NV_framebuffer_multisample, "GL_NV_framebuffer_multisample" },
-	{ glow::GLOW_NV_framebuffer_multisample_coverage, "GL_NV_framebuffer_multisample_coverage" },
-	{ glow::GLOW_NV_generate_mipmap_sRGB, "GL_NV_generate_mipmap_sRGB" },
-	{ glow::GLOW_NV_geometry_program4, "GL_NV_geometry_program4" },
-	{ glow::GLOW_NV_geometry_shader4, "GL_NV_geometry_shader4" },
-	{ glow::GLOW_NV_gpu_program4, "GL_NV_gpu_program4" },
-	{ glow::GLOW_NV_gpu_program5, "GL_NV_gpu_program5" },
-	{ glow::GLOW_NV_gpu_program5_mem_extended, "GL_NV_gpu_program5_mem_extended" },
-	{ glow::GLOW_NV_gpu_shader5, "GL_NV_gpu_shader5" },
-	{ glow::GLOW_NV_half_float, "GL_NV_half_float" },
-	{ glow::GLOW_NV_instanced_arrays, "GL_NV_instanced_arrays" },
-	{ glow::GLOW_NV_light_max_exponent, "GL_NV_light_max_exponent" },
-	{ glow::GLOW_NV_multisample_coverage, "GL_NV_multisample_coverage" },
-	{ glow::GLOW_NV_multisample_filter_hint, "GL_NV_multisample_filter_hint" },
-	{ glow::GLOW_NV_non_square_matrices, "GL_NV_non_square_matrices" },
-	{ glow::GLOW_NV_occlusion_query, "GL_NV_occlusion_query" },
-	{ glow::GLOW_NV_packed_depth_stencil, "GL_NV_packed_depth_stencil" },
-	{ glow::GLOW_NV_parameter_buffer_object, "GL_NV_parameter_buffer_object" },
-	{ glow::GLOW_NV_parameter_buffer_object2, "GL_NV_parameter_buffer_object2" },
-	{ glow::GLOW_NV_path_rendering, "GL_NV_path_rendering" },
-	{ glow::GLOW_NV_pixel_data_range, "GL_NV_pixel_data_range" },
-	{ glow::GLOW_NV_point_sprite, "GL_NV_point_sprite" },
-	{ glow::GLOW_NV_present_video, "GL_NV_present_video" },
-	{ glow::GLOW_NV_primitive_restart, "GL_NV_primitive_restart" },
-	{ glow::GLOW_NV_read_buffer, "GL_NV_read_buffer" },
-	{ glow::GLOW_NV_read_buffer_front, "GL_NV_read_buffer_front" },
-	{ glow::GLOW_NV_read_depth, "GL_NV_read_depth" },
-	{ glow::GLOW_NV_read_depth_stencil, "GL_NV_read_depth_stencil" },
-	{ glow::GLOW_NV_read_stencil, "GL_NV_read_stencil" },
-	{ glow::GLOW_NV_register_combiners, "GL_NV_register_combiners" },
-	{ glow::GLOW_NV_register_combiners2, "GL_NV_register_combiners2" },
-	{ glow::GLOW_NV_sRGB_formats, "GL_NV_sRGB_formats" },
-	{ glow::GLOW_NV_shader_atomic_counters, "GL_NV_shader_atomic_counters" },
-	{ glow::GLOW_NV_shader_atomic_float, "GL_NV_shader_atomic_float" },
-	{ glow::GLOW_NV_shader_buffer_load, "GL_NV_shader_buffer_load" },
-	{ glow::GLOW_NV_shader_buffer_store, "GL_NV_shader_buffer_store" },
-	{ glow::GLOW_NV_shader_storage_buffer_object, "GL_NV_shader_storage_buffer_object" },
-	{ glow::GLOW_NV_shadow_samplers_array, "GL_NV_shadow_samplers_array" },
-	{ glow::GLOW_NV_shadow_samplers_cube, "GL_NV_shadow_samplers_cube" },
-	{ glow::GLOW_NV_tessellation_program5, "GL_NV_tessellation_program5" },
-	{ glow::GLOW_NV_texgen_emboss, "GL_NV_texgen_emboss" },
-	{ glow::GLOW_NV_texgen_reflection, "GL_NV_texgen_reflection" },
-	{ glow::GLOW_NV_texture_barrier, "GL_NV_texture_barrier" },
-	{ glow::GLOW_NV_texture_border_clamp, "GL_NV_texture_border_clamp" },
-	{ glow::GLOW_NV_texture_compression_s3tc_update, "GL_NV_texture_compression_s3tc_update" },
-	{ glow::GLOW_NV_texture_compression_vtc, "GL_NV_texture_compression_vtc" },
-	{ glow::GLOW_NV_texture_env_combine4, "GL_NV_texture_env_combine4" },
-	{ glow::GLOW_NV_texture_expand_normal, "GL_NV_texture_expand_normal" },
-	{ glow::GLOW_NV_texture_multisample, "GL_NV_texture_multisample" },
-	{ glow::GLOW_NV_texture_npot_2D_mipmap, "GL_NV_texture_npot_2D_mipmap" },
-	{ glow::GLOW_NV_texture_rectangle, "GL_NV_texture_rectangle" },
-	{ glow::GLOW_NV_texture_shader, "GL_NV_texture_shader" },
-	{ glow::GLOW_NV_texture_shader2, "GL_NV_texture_shader2" },
-	{ glow::GLOW_NV_texture_shader3, "GL_NV_texture_shader3" },
-	{ glow::GLOW_NV_transform_feedback, "GL_NV_transform_feedback" },
-	{ glow::GLOW_NV_transform_feedback2, "GL_NV_transform_feedback2" },
-	{ glow::GLOW_NV_vdpau_interop, "GL_NV_vdpau_interop" },
-	{ glow::GLOW_NV_vertex_array_range, "GL_NV_vertex_array_range" },
-	{ glow::GLOW_NV_vertex_array_range2, "GL_NV_vertex_array_range2" },
-	{ glow::GLOW_NV_vertex_attrib_integer_64bit, "GL_NV_vertex_attrib_integer_64bit" },
-	{ glow::GLOW_NV_vertex_buffer_unified_memory, "GL_NV_vertex_buffer_unified_memory" },
-	{ glow::GLOW_NV_vertex_program, "GL_NV_vertex_program" },
-	{ glow::GLOW_NV_vertex_program1_1, "GL_NV_vertex_program1_1" },
-	{ glow::GLOW_NV_vertex_program2, "GL_NV_vertex_program2" },
-	{ glow::GLOW_NV_vertex_program2_option, "GL_NV_vertex_program2_option" },
-	{ glow::GLOW_NV_vertex_program3, "GL_NV_vertex_program3" },
-	{ glow::GLOW_NV_vertex_program4, "GL_NV_vertex_program4" },
-	{ glow::GLOW_NV_video_capture, "GL_NV_video_capture" },
-	{ glow::GLOW_OES_EGL_image, "GL_OES_EGL_image" },
-	{ glow::GLOW_OES_EGL_image_external, "GL_OES_EGL_image_external" },
-	{ glow::GLOW_OES_blend_equation_separate, "GL_OES_blend_equation_separate" },
-	{ glow::GLOW_OES_blend_func_separate, "GL_OES_blend_func_separate" },
-	{ glow::GLOW_OES_blend_subtract, "GL_OES_blend_subtract" },
-	{ glow::GLOW_OES_byte_coordinates, "GL_OES_byte_coordinates" },
-	{ glow::GLOW_OES_compressed_ETC1_RGB8_texture, "GL_OES_compressed_ETC1_RGB8_texture" },
-	{ glow::GLOW_OES_compressed_paletted_texture, "GL_OES_compressed_paletted_texture" },
-	{ glow::GLOW_OES_depth24, "GL_OES_depth24" },
-	{ glow::GLOW_OES_depth32, "GL_OES_depth32" },
-	{ glow::GLOW_OES_depth_texture, "GL_OES_depth_texture" },
-	{ glow::GLOW_OES_draw_texture, "GL_OES_draw_texture" },
-	{ glow::GLOW_OES_element_index_uint, "GL_OES_element_index_uint" },
-	{ glow::GLOW_OES_extended_matrix_palette, "GL_OES_extended_matrix_palette" },
-	{ glow::GLOW_OES_fbo_render_mipmap, "GL_OES_fbo_render_mipmap" },
-	{ glow::GLOW_OES_fixed_point, "GL_OES_fixed_point" },
-	{ glow::GLOW_OES_fragment_precision_high, "GL_OES_fragment_precision_high" },
-	{ glow::GLOW_OES_framebuffer_object, "GL_OES_framebuffer_object" },
-	{ glow::GLOW_OES_get_program_binary, "GL_OES_get_program_binary" },
-	{ glow::GLOW_OES_mapbuffer, "GL_OES_mapbuffer" },
-	{ glow::GLOW_OES_matrix_get, "GL_OES_matrix_get" },
-	{ glow::GLOW_OES_matrix_palette, "GL_OES_matrix_palette" },
-	{ glow::GLOW_OES_packed_depth_stencil, "GL_OES_packed_depth_stencil" },
-	{ glow::GLOW_OES_point_size_array, "GL_OES_point_size_array" },
-	{ glow::GLOW_OES_point_sprite, "GL_OES_point_sprite" },
-	{ glow::GLOW_OES_query_matrix, "GL_OES_query_matrix" },
-	{ glow::GLOW_OES_read_format, "GL_OES_read_format" },
-	{ glow::GLOW_OES_required_internalformat, "GL_OES_required_internalformat" },
-	{ glow::GLOW_OES_rgb8_rgba8, "GL_OES_rgb8_rgba8" },
-	{ glow::GLOW_OES_single_precision, "GL_OES_single_precision" },
-	{ glow::GLOW_OES_standard_derivatives, "GL_OES_standard_derivatives" },
-	{ glow::GLOW_OES_stencil1, "GL_OES_stencil1" },
-	{ glow::GLOW_OES_stencil4, "GL_OES_stencil4" },
-	{ glow::GLOW_OES_stencil8, "GL_OES_stencil8" },
-	{ glow::GLOW_OES_stencil_wrap, "GL_OES_stencil_wrap" },
-	{ glow::GLOW_OES_surfaceless_context, "GL_OES_surfaceless_context" },
-	{ glow::GLOW_OES_texture_3D, "GL_OES_texture_3D" },
-	{ glow::GLOW_OES_texture_compression_astc, "GL_OES_texture_compression_astc" },
-	{ glow::GLOW_OES_texture_cube_map, "GL_OES_texture_cube_map" },
-	{ glow::GLOW_OES_texture_env_crossbar, "GL_OES_texture_env_crossbar" },
-	{ glow::GLOW_OES_texture_float, "GL_OES_texture_float" },
-	{ glow::GLOW_OES_texture_float_linear, "GL_OES_texture_float_linear" },
-	{ glow::GLOW_OES_texture_half_float, "GL_OES_texture_half_float" },
-	{ glow::GLOW_OES_texture_half_float_linear, "GL_OES_texture_half_float_linear" },
-	{ glow::GLOW_OES_texture_mirrored_repeat, "GL_OES_texture_mirrored_repeat" },
-	{ glow::GLOW_OES_texture_npot, "GL_OES_texture_npot" },
-	{ glow::GLOW_OES_vertex_array_object, "GL_OES_vertex_array_object" },
-	{ glow::GLOW_OES_vertex_half_float, "GL_OES_vertex_half_float" },
-	{ glow::GLOW_OES_vertex_type_10_10_10_2, "GL_OES_vertex_type_10_10_10_2" },
-	{ glow::GLOW_OML_interlace, "GL_OML_interlace" },
-	{ glow::GLOW_OML_resample, "GL_OML_resample" },
-	{ glow::GLOW_OML_subsample, "GL_OML_subsample" },
-	{ glow::GLOW_PGI_misc_hints, "GL_PGI_misc_hints" },
-	{ glow::GLOW_PGI_vertex_hints, "GL_PGI_vertex_hints" },
-	{ glow::GLOW_QCOM_alpha_test, "GL_QCOM_alpha_test" },
-	{ glow::GLOW_QCOM_binning_control, "GL_QCOM_binning_control" },
-	{ glow::GLOW_QCOM_driver_control, "GL_QCOM_driver_control" },
-	{ glow::GLOW_QCOM_extended_get, "GL_QCOM_extended_get" },
-	{ glow::GLOW_QCOM_extended_get2, "GL_QCOM_extended_get2" },
-	{ glow::GLOW_QCOM_perfmon_global_mode, "GL_QCOM_perfmon_global_mode" },
-	{ glow::GLOW_QCOM_tiled_rendering, "GL_QCOM_tiled_rendering" },
-	{ glow::GLOW_QCOM_writeonly_rendering, "GL_QCOM_writeonly_rendering" },
-	{ glow::GLOW_REND_screen_coordinates, "GL_REND_screen_coordinates" },
-	{ glow::GLOW_S3_s3tc, "GL_S3_s3tc" },
-	{ glow::GLOW_SGIS_detail_texture, "GL_SGIS_detail_texture" },
-	{ glow::GLOW_SGIS_fog_function, "GL_SGIS_fog_function" },
-	{ glow::GLOW_SGIS_generate_mipmap, "GL_SGIS_generate_mipmap" },
-	{ glow::GLOW_SGIS_multisample, "GL_SGIS_multisample" },
-	{ glow::GLOW_SGIS_pixel_texture, "GL_SGIS_pixel_texture" },
-	{ glow::GLOW_SGIS_point_line_texgen, "GL_SGIS_point_line_texgen" },
-	{ glow::GLOW_SGIS_point_parameters, "GL_SGIS_point_parameters" },
-	{ glow::GLOW_SGIS_sharpen_texture, "GL_SGIS_sharpen_texture" },
-	{ glow::GLOW_SGIS_texture4D, "GL_SGIS_texture4D" },
-	{ glow::GLOW_SGIS_texture_border_clamp, "GL_SGIS_texture_border_clamp" },
-	{ glow::GLOW_SGIS_texture_color_mask, "GL_SGIS_texture_color_mask" },
-	{ glow::GLOW_SGIS_texture_edge_clamp, "GL_SGIS_texture_edge_clamp" },
-	{ glow::GLOW_SGIS_texture_filter4, "GL_SGIS_texture_filter4" },
-	{ glow::GLOW_SGIS_texture_lod, "GL_SGIS_texture_lod" },
-	{ glow::GLOW_SGIS_texture_select, "GL_SGIS_texture_select" },
-	{ glow::GLOW_SGIX_async, "GL_SGIX_async" },
-	{ glow::GLOW_SGIX_async_histogram, "GL_SGIX_async_histogram" },
-	{ glow::GLOW_SGIX_async_pixel, "GL_SGIX_async_pixel" },
-	{ glow::GLOW_SGIX_blend_alpha_minmax, "GL_SGIX_blend_alpha_minmax" },
-	{ glow::GLOW_SGIX_calligraphic_fragment, "GL_SGIX_calligraphic_fragment" },
-	{ glow::GLOW_SGIX_clipmap, "GL_SGIX_clipmap" },
-	{ glow::GLOW_SGIX_convolution_accuracy, "GL_SGIX_convolution_accuracy" },
-	{ glow::GLOW_SGIX_depth_pass_instrument, "GL_SGIX_depth_pass_instrument" },
-	{ glow::GLOW_SGIX_depth_texture, "GL_SGIX_depth_texture" },
-	{ glow::GLOW_SGIX_flush_raster, "GL_SGIX_flush_raster" },
-	{ glow::GLOW_SGIX_fog_offset, "GL_SGIX_fog_offset" },
-	{ glow::GLOW_SGIX_fragment_lighting, "GL_SGIX_fragment_lighting" },
-	{ glow::GLOW_SGIX_framezoom, "GL_SGIX_framezoom" },
-	{ glow::GLOW_SGIX_igloo_interface, "GL_SGIX_igloo_interface" },
-	{ glow::GLOW_SGIX_instruments, "GL_SGIX_instruments" },
-	{ glow::GLOW_SGIX_interlace, "GL_SGIX_interlace" },
-	{ glow::GLOW_SGIX_ir_instrument1, "GL_SGIX_ir_instrument1" },
-	{ glow::GLOW_SGIX_list_priority, "GL_SGIX_list_priority" },
-	{ glow::GLOW_SGIX_pixel_texture, "GL_SGIX_pixel_texture" },
-	{ glow::GLOW_SGIX_pixel_tiles, "GL_SGIX_pixel_tiles" },
-	{ glow::GLOW_SGIX_polynomial_ffd, "GL_SGIX_polynomial_ffd" },
-	{ glow::GLOW_SGIX_reference_plane, "GL_SGIX_reference_plane" },
-	{ glow::GLOW_SGIX_resample, "GL_SGIX_resample" },
-	{ glow::GLOW_SGIX_scalebias_hint, "GL_SGIX_scalebias_hint" },
-	{ glow::GLOW_SGIX_shadow, "GL_SGIX_shadow" },
-	{ glow::GLOW_SGIX_shadow_ambient, "GL_SGIX_shadow_ambient" },
-	{ glow::GLOW_SGIX_sprite, "GL_SGIX_sprite" },
-	{ glow::GLOW_SGIX_subsample, "GL_SGIX_subsample" },
-	{ glow::GLOW_SGIX_tag_sample_buffer, "GL_SGIX_tag_sample_buffer" },
-	{ glow::GLOW_SGIX_texture_add_env, "GL_SGIX_texture_add_env" },
-	{ glow::GLOW_SGIX_texture_coordinate_clamp, "GL_SGIX_texture_coordinate_clamp" },
-	{ glow::GLOW_SGIX_texture_lod_bias, "GL_SGIX_texture_lod_bias" },
-	{ glow::GLOW_SGIX_texture_multi_buffer, "GL_SGIX_texture_multi_buffer" },
-	{ glow::GLOW_SGIX_texture_scale_bias, "GL_SGIX_texture_scale_bias" },
-	{ glow::GLOW_SGIX_vertex_preclip, "GL_SGIX_vertex_preclip" },
-	{ glow::GLOW_SGIX_ycrcb, "GL_SGIX_ycrcb" },
-	{ glow::GLOW_SGIX_ycrcb_subsample, "GL_SGIX_ycrcb_subsample" },
-	{ glow::GLOW_SGIX_ycrcba, "GL_SGIX_ycrcba" },
-	{ glow::GLOW_SGI_color_matrix, "GL_SGI_color_matrix" },
-	{ glow::GLOW_SGI_color_table, "GL_SGI_color_table" },
-	{ glow::GLOW_SGI_texture_color_table, "GL_SGI_texture_color_table" },
-	{ glow::GLOW_SUNX_constant_data, "GL_SUNX_constant_data" },
-	{ glow::GLOW_SUN_convolution_border_modes, "GL_SUN_convolution_border_modes" },
-	{ glow::GLOW_SUN_global_alpha, "GL_SUN_global_alpha" },
-	{ glow::GLOW_SUN_mesh_array, "GL_SUN_mesh_array" },
-	{ glow::GLOW_SUN_slice_accum, "GL_SUN_slice_accum" },
-	{ glow::GLOW_SUN_triangle_list, "GL_SUN_triangle_list" },
-	{ glow::GLOW_SUN_vertex, "GL_SUN_vertex" },
-	{ glow::GLOW_VIV_shader_binary, "GL_VIV_shader_binary" },
-	{ glow::GLOW_WIN_phong_shading, "GL_WIN_phong_shading" },
-	{ glow::GLOW_WIN_specular_fog, "GL_WIN_specular_fog" },
+namespace glow {
+
+struct ExtensionInfo
+{
+	const char * name;
+	GLint majorVersion;
+	GLint minorVersion;
+};
+
+struct ExtensionName
+{
+	const char * name;
+	glow::Extension extension;
 };
 
-const std::unordered_map<std::string, glow::Extension> extensions = {
+// Indexed by glow::Extension; extensions that are not part of any core profile have version 0.0.
+CONSTEXPR const ExtensionInfo extensionInfos[] = {
+	{ "GL_3DFX_multisample", 0, 0 },
+	{ "GL_3DFX_tbuffer", 0, 0 },
+	{ "GL_3DFX_texture_compression_FXT1", 0, 0 },
+	{ "GL_AMD_blend_minmax_factor", 0, 0 },
+	{ "GL_AMD_compressed_3DC_texture", 0, 0 },
+	{ "GL_AMD_compressed_ATC_texture", 0, 0 },
+	{ "GL_AMD_conservative_depth", 0, 0 },
+	{ "GL_AMD_debug_output", 0, 0 },
+	{ "GL_AMD_depth_clamp_separate", 0, 0 },
+	{ "GL_AMD_draw_buffers_blend", 0, 0 },
+	{ "GL_AMD_interleaved_elements", 0, 0 },
+	{ "GL_AMD_multi_draw_indirect", 0, 0 },
+	{ "GL_AMD_name_gen_delete", 0, 0 },
+	{ "GL_AMD_occlusion_query_event", 0, 0 },
+	{ "GL_AMD_performance_monitor", 0, 0 },
+	{ "GL_AMD_pinned_memory", 0, 0 },
+	{ "GL_AMD_program_binary_Z400", 0, 0 },
+	{ "GL_AMD_query_buffer_object", 0, 0 },
+	{ "GL_AMD_sample_positions", 0, 0 },
+	{ "GL_AMD_seamless_cubemap_per_texture", 3, 2 },
+	{ "GL_AMD_shader_atomic_counter_ops", 0, 0 },
+	{ "GL_AMD_shader_stencil_export", 0, 0 },
+	{ "GL_AMD_shader_trinary_minmax", 0, 0 },
+	{ "GL_AMD_sparse_texture", 0, 0 },
+	{ "GL_AMD_stencil_operation_extended", 0, 0 },
+	{ "GL_AMD_texture_texture4", 0, 0 },
+	{ "GL_AMD_transform_feedback3_lines_triangles", 0, 0 },
+	{ "GL_AMD_vertex_shader_layer", 0, 0 },
+	{ "GL_AMD_vertex_shader_tessellator", 0, 0 },
+	{ "GL_AMD_vertex_shader_viewport_index", 0, 0 },
+	{ "GL_ANGLE_depth_texture", 0, 0 },
+	{ "GL_ANGLE_framebuffer_blit", 0, 0 },
+	{ "GL_ANGLE_framebuffer_multisample", 0, 0 },
+	{ "GL_ANGLE_instanced_arrays", 0, 0 },
+	{ "GL_ANGLE_pack_reverse_row_order", 0, 0 },
+	{ "GL_ANGLE_program_binary", 0, 0 },
+	{ "GL_ANGLE_texture_compression_dxt3", 0, 0 },
+	{ "GL_ANGLE_texture_compression_dxt5", 0, 0 },
+	{ "GL_ANGLE_texture_usage", 0, 0 },
+	{ "GL_ANGLE_translated_shader_source", 0, 0 },
+	{ "GL_APPLE_aux_depth_stencil", 0, 0 },
+	{ "GL_APPLE_client_storage", 0, 0 },
+	{ "GL_APPLE_copy_texture_levels", 0, 0 },
+	{ "GL_APPLE_element_array", 0, 0 },
+	{ "GL_APPLE_fence", 0, 0 },
+	{ "GL_APPLE_float_pixels", 0, 0 },
+	{ "GL_APPLE_flush_buffer_range", 0, 0 },
+	{ "GL_APPLE_framebuffer_multisample", 0, 0 },
+	{ "GL_APPLE_object_purgeable", 0, 0 },
+	{ "GL_APPLE_rgb_422", 0, 0 },
+	{ "GL_APPLE_row_bytes", 0, 0 },
+	{ "GL_APPLE_specular_vector", 0, 0 },
+	{ "GL_APPLE_sync", 0, 0 },
+	{ "GL_APPLE_texture_2D_limited_npot", 0, 0 },
+	{ "GL_APPLE_texture_format_BGRA8888", 0, 0 },
+	{ "GL_APPLE_texture_max_level", 0, 0 },
+	{ "GL_APPLE_texture_range", 0, 0 },
+	{ "GL_APPLE_transform_hint", 0, 0 },
+	{ "GL_APPLE_vertex_array_object", 0, 0 },
+	{ "GL_APPLE_vertex_array_range", 0, 0 },
+	{ "GL_APPLE_vertex_program_evaluators", 0, 0 },
+	{ "GL_APPLE_ycbcr_422", 0, 0 },
+	{ "GL_ARB_ES2_compatibility", 4, 1 },
+	{ "GL_ARB_ES3_compatibility", 4, 3 },
+	{ "GL_ARB_arrays_of_arrays", 0, 0 },
+	{ "GL_ARB_base_instance", 4, 2 },
+	{ "GL_ARB_bindless_texture", 0, 0 },
+	{ "GL_ARB_blend_func_extended", 3, 3 },
+	{ "GL_ARB_buffer_storage", 4, 4 },
+	{ "GL_ARB_cl_event", 0, 0 },
+	{ "GL_ARB_clear_buffer_object", 4, 3 },
+	{ "GL_ARB_clear_texture", 4, 4 },
+	{ "GL_ARB_color_buffer_float", 0, 0 },
+	{ "GL_ARB_compatibility", 0, 0 },
+	{ "GL_ARB_compressed_texture_pixel_storage", 4, 2 },
+	{ "GL_ARB_compute_shader", 0, 0 },
+	{ "GL_ARB_compute_variable_group_size", 0, 0 },
+	{ "GL_ARB_conservative_depth", 0, 0 },
+	{ "GL_ARB_copy_buffer", 0, 0 },
+	{ "GL_ARB_copy_image", 4, 3 },
+	{ "GL_ARB_debug_output", 4, 3 },
+	{ "GL_ARB_depth_buffer_float", 3, 0 },
+	{ "GL_ARB_depth_clamp", 3, 2 },
+	{ "GL_ARB_depth_texture", 1, 4 },
+	{ "GL_ARB_draw_buffers", 2, 0 },
+	{ "GL_ARB_draw_buffers_blend", 4, 0 },
+	{ "GL_ARB_draw_elements_base_vertex", 3, 2 },
+	{ "GL_ARB_draw_indirect", 4, 0 },
+	{ "GL_ARB_draw_instanced", 3, 1 },
+	{ "GL_ARB_enhanced_layouts", 4, 4 },
+	{ "GL_ARB_explicit_attrib_location", 0, 0 },
+	{ "GL_ARB_explicit_uniform_location", 4, 3 },
+	{ "GL_ARB_fragment_coord_conventions", 0, 0 },
+	{ "GL_ARB_fragment_layer_viewport", 0, 0 },
+	{ "GL_ARB_fragment_program", 0, 0 },
+	{ "GL_ARB_fragment_program_shadow", 0, 0 },
+	{ "GL_ARB_fragment_shader", 2, 0 },
+	{ "GL_ARB_framebuffer_no_attachments", 4, 3 },
+	{ "GL_ARB_framebuffer_object", 4, 4 },
+	{ "GL_ARB_framebuffer_sRGB", 3, 0 },
+	{ "GL_ARB_geometry_shader4", 0, 0 },
+	{ "GL_ARB_get_program_binary", 4, 1 },
+	{ "GL_ARB_gpu_shader5", 4, 0 },
+	{ "GL_ARB_gpu_shader_fp64", 4, 0 },
+	{ "GL_ARB_half_float_pixel", 3, 0 },
+	{ "GL_ARB_half_float_vertex", 3, 0 },
+	{ "GL_ARB_imaging", 0, 0 },
+	{ "GL_ARB_indirect_parameters", 0, 0 },
+	{ "GL_ARB_instanced_arrays", 3, 3 },
+	{ "GL_ARB_internalformat_query", 4, 2 },
+	{ "GL_ARB_internalformat_query2", 0, 0 },
+	{ "GL_ARB_invalidate_subdata", 4, 3 },
+	{ "GL_ARB_map_buffer_alignment", 4, 2 },
+	{ "GL_ARB_map_buffer_range", 4, 4 },
+	{ "GL_ARB_matrix_palette", 0, 0 },
+	{ "GL_ARB_multi_bind", 4, 4 },
+	{ "GL_ARB_multi_draw_indirect", 4, 3 },
+	{ "GL_ARB_multisample", 1, 3 },
+	{ "GL_ARB_multitexture", 1, 3 },
+	{ "GL_ARB_occlusion_query", 1, 5 },
+	{ "GL_ARB_occlusion_query2", 3, 3 },
+	{ "GL_ARB_pixel_buffer_object", 2, 1 },
+	{ "GL_ARB_point_parameters", 1, 4 },
+	{ "GL_ARB_point_sprite", 2, 0 },
+	{ "GL_ARB_program_interface_query", 4, 3 },
+	{ "GL_ARB_provoking_vertex", 3, 2 },
+	{ "GL_ARB_query_buffer_object", 4, 4 },
+	{ "GL_ARB_robust_buffer_access_behavior", 0, 0 },
+	{ "GL_ARB_robustness", 0, 0 },
+	{ "GL_ARB_robustness_isolation", 0, 0 },
+	{ "GL_ARB_sample_shading", 4, 0 },
+	{ "GL_ARB_sampler_objects", 3, 3 },
+	{ "GL_ARB_seamless_cube_map", 3, 2 },
+	{ "GL_ARB_seamless_cubemap_per_texture", 3, 2 },
+	{ "GL_ARB_separate_shader_objects", 4, 1 },
+	{ "GL_ARB_shader_atomic_counters", 4, 2 },
+	{ "GL_ARB_shader_bit_encoding", 0, 0 },
+	{ "GL_ARB_shader_draw_parameters", 0, 0 },
+	{ "GL_ARB_shader_group_vote", 0, 0 },
+	{ "GL_ARB_shader_image_load_store", 4, 2 },
+	{ "GL_ARB_shader_image_size", 0, 0 },
+	{ "GL_ARB_shader_objects", 0, 0 },
+	{ "GL_ARB_shader_precision", 0, 0 },
+	{ "GL_ARB_shader_stencil_export", 0, 0 },
+	{ "GL_ARB_shader_storage_buffer_object", 4, 3 },
+	{ "GL_ARB_shader_subroutine", 4, 0 },
+	{ "GL_ARB_shader_texture_lod", 0, 0 },
+	{ "GL_ARB_shading_language_100", 2, 0 },
+	{ "GL_ARB_shading_language_420pack", 0, 0 },
+	{ "GL_ARB_shading_language_include", 0, 0 },
+	{ "GL_ARB_shading_language_packing", 0, 0 },
+	{ "GL_ARB_shadow", 1, 4 },
+	{ "GL_ARB_shadow_ambient", 0, 0 },
+	{ "GL_ARB_sparse_texture", 0, 0 },
+	{ "GL_ARB_stencil_texturing", 4, 3 },
+	{ "GL_ARB_sync", 3, 2 },
+	{ "GL_ARB_tessellation_shader", 4, 0 },
+	{ "GL_ARB_texture_border_clamp", 1, 3 },
+	{ "GL_ARB_texture_buffer_object", 0, 0 },
+	{ "GL_ARB_texture_buffer_object_rgb32", 3, 0 },
+	{ "GL_ARB_texture_buffer_range", 4, 3 },
+	{ "GL_ARB_texture_compression", 1, 3 },
+	{ "GL_ARB_texture_compression_bptc", 4, 2 },
+	{ "GL_ARB_texture_compression_rgtc", 3, 0 },
+	{ "GL_ARB_texture_cube_map", 1, 3 },
+	{ "GL_ARB_texture_cube_map_array", 4, 0 },
+	{ "GL_ARB_texture_env_add", 0, 0 },
+	{ "GL_ARB_texture_env_combine", 1, 3 },
+	{ "GL_ARB_texture_env_crossbar", 0, 0 },
+	{ "GL_ARB_texture_env_dot3", 1, 3 },
+	{ "GL_ARB_texture_float", 0, 0 },
+	{ "GL_ARB_texture_gather", 0, 0 },
+	{ "GL_ARB_texture_mirror_clamp_to_edge", 4, 4 },
+	{ "GL_ARB_texture_mirrored_repeat", 1, 4 },
+	{ "GL_ARB_texture_multisample", 3, 2 },
+	{ "GL_ARB_texture_non_power_of_two", 0, 0 },
+	{ "GL_ARB_texture_query_levels", 0, 0 },
+	{ "GL_ARB_texture_query_lod", 0, 0 },
+	{ "GL_ARB_texture_rectangle", 3, 1 },
+	{ "GL_ARB_texture_rg", 3, 0 },
+	{ "GL_ARB_texture_rgb10_a2ui", 3, 3 },
+	{ "GL_ARB_texture_stencil8", 4, 4 },
+	{ "GL_ARB_texture_storage", 4, 2 },
+	{ "GL_ARB_texture_storage_multisample", 4, 3 },
+	{ "GL_ARB_texture_swizzle", 3, 3 },
+	{ "GL_ARB_texture_view", 4, 3 },
+	{ "GL_ARB_timer_query", 3, 3 },
+	{ "GL_ARB_transform_feedback2", 0, 0 },
+	{ "GL_ARB_transform_feedback3", 4, 0 },
+	{ "GL_ARB_transform_feedback_instanced", 4, 2 },
+	{ "GL_ARB_transpose_matrix", 1, 3 },
+	{ "GL_ARB_uniform_buffer_object", 0, 0 },
+	{ "GL_ARB_vertex_array_bgra", 1, 2 },
+	{ "GL_ARB_vertex_array_object", 3, 0 },
+	{ "GL_ARB_vertex_attrib_64bit", 4, 1 },
+	{ "GL_ARB_vertex_attrib_binding", 4, 3 },
+	{ "GL_ARB_vertex_blend", 0, 0 },
+	{ "GL_ARB_vertex_buffer_object", 1, 5 },
+	{ "GL_ARB_vertex_program", 0, 0 },
+	{ "GL_ARB_vertex_shader", 0, 0 },
+	{ "GL_ARB_vertex_type_10f_11f_11f_rev", 4, 4 },
+	{ "GL_ARB_vertex_type_2_10_10_10_rev", 3, 3 },
+	{ "GL_ARB_viewport_array", 4, 1 },
+	{ "GL_ARB_window_pos", 1, 4 },
+	{ "GL_ARM_mali_program_binary", 0, 0 },
+	{ "GL_ARM_mali_shader_binary", 0, 0 },
+	{ "GL_ARM_rgba8", 0, 0 },
+	{ "GL_ATI_draw_buffers", 0, 0 },
+	{ "GL_ATI_element_array", 0, 0 },
+	{ "GL_ATI_envmap_bumpmap", 0, 0 },
+	{ "GL_ATI_fragment_shader", 0, 0 },
+	{ "GL_ATI_map_object_buffer", 0, 0 },
+	{ "GL_ATI_meminfo", 0, 0 },
+	{ "GL_ATI_pixel_format_float", 0, 0 },
+	{ "GL_ATI_pn_triangles", 0, 0 },
+	{ "GL_ATI_separate_stencil", 0, 0 },
+	{ "GL_ATI_text_fragment_shader", 0, 0 },
+	{ "GL_ATI_texture_env_combine3", 0, 0 },
+	{ "GL_ATI_texture_float", 0, 0 },
+	{ "GL_ATI_texture_mirror_once", 0, 0 },
+	{ "GL_ATI_vertex_array_object", 0, 0 },
+	{ "GL_ATI_vertex_attrib_array_object", 0, 0 },
+	{ "GL_ATI_vertex_streams", 0, 0 },
+	{ "GL_DMP_shader_binary", 0, 0 },
+	{ "GL_EXT_422_pixels", 0, 0 },
+	{ "GL_EXT_abgr", 0, 0 },
+	{ "GL_EXT_bgra", 0, 0 },
+	{ "GL_EXT_bindable_uniform", 0, 0 },
+	{ "GL_EXT_blend_color", 0, 0 },
+	{ "GL_EXT_blend_equation_separate", 0, 0 },
+	{ "GL_EXT_blend_func_separate", 0, 0 },
+	{ "GL_EXT_blend_logic_op", 0, 0 },
+	{ "GL_EXT_blend_minmax", 0, 0 },
+	{ "GL_EXT_blend_subtract", 0, 0 },
+	{ "GL_EXT_clip_volume_hint", 0, 0 },
+	{ "GL_EXT_cmyka", 0, 0 },
+	{ "GL_EXT_color_buffer_half_float", 0, 0 },
+	{ "GL_EXT_color_subtable", 0, 0 },
+	{ "GL_EXT_compiled_vertex_array", 0, 0 },
+	{ "GL_EXT_convolution", 0, 0 },
+	{ "GL_EXT_coordinate_frame", 0, 0 },
+	{ "GL_EXT_copy_texture", 0, 0 },
+	{ "GL_EXT_cull_vertex", 0, 0 },
+	{ "GL_EXT_debug_label", 0, 0 },
+	{ "GL_EXT_debug_marker", 0, 0 },
+	{ "GL_EXT_depth_bounds_test", 0, 0 },
+	{ "GL_EXT_direct_state_access", 0, 0 },
+	{ "GL_EXT_discard_framebuffer", 0, 0 },
+	{ "GL_EXT_disjoint_timer_query", 0, 0 },
+	{ "GL_EXT_draw_buffers", 0, 0 },
+	{ "GL_EXT_draw_buffers2", 0, 0 },
+	{ "GL_EXT_draw_instanced", 0, 0 },
+	{ "GL_EXT_draw_range_elements", 0, 0 },
+	{ "GL_EXT_fog_coord", 0, 0 },
+	{ "GL_EXT_framebuffer_blit", 0, 0 },
+	{ "GL_EXT_framebuffer_multisample", 0, 0 },
+	{ "GL_EXT_framebuffer_multisample_blit_scaled", 0, 0 },
+	{ "GL_EXT_framebuffer_object", 0, 0 },
+	{ "GL_EXT_framebuffer_sRGB", 0, 0 },
+	{ "GL_EXT_geometry_shader4", 0, 0 },
+	{ "GL_EXT_gpu_program_parameters", 0, 0 },
+	{ "GL_EXT_gpu_shader4", 0, 0 },
+	{ "GL_EXT_histogram", 0, 0 },
+	{ "GL_EXT_index_array_formats", 0, 0 },
+	{ "GL_EXT_index_func", 0, 0 },
+	{ "GL_EXT_index_material", 0, 0 },
+	{ "GL_EXT_index_texture", 0, 0 },
+	{ "GL_EXT_instanced_arrays", 0, 0 },
+	{ "GL_EXT_light_texture", 0, 0 },
+	{ "GL_EXT_map_buffer_range", 0, 0 },
+	{ "GL_EXT_misc_attribute", 0, 0 },
+	{ "GL_EXT_multi_draw_arrays", 0, 0 },
+	{ "GL_EXT_multisample", 0, 0 },
+	{ "GL_EXT_multisampled_render_to_texture", 0, 0 },
+	{ "GL_EXT_multiview_draw_buffers", 0, 0 },
+	{ "GL_EXT_occlusion_query_boolean", 0, 0 },
+	{ "GL_EXT_packed_depth_stencil", 0, 0 },
+	{ "GL_EXT_packed_float", 0, 0 },
+	{ "GL_EXT_packed_pixels", 0, 0 },
+	{ "GL_EXT_paletted_texture", 0, 0 },
+	{ "GL_EXT_pixel_buffer_object", 0, 0 },
+	{ "GL_EXT_pixel_transform", 0, 0 },
+	{ "GL_EXT_pixel_transform_color_table", 0, 0 },
+	{ "GL_EXT_point_parameters", 0, 0 },
+	{ "GL_EXT_polygon_offset", 0, 0 },
+	{ "GL_EXT_provoking_vertex", 0, 0 },
+	{ "GL_EXT_pvrtc_sRGB", 0, 0 },
+	{ "GL_EXT_read_format_bgra", 0, 0 },
+	{ "GL_EXT_rescale_normal", 0, 0 },
+	{ "GL_EXT_robustness", 0, 0 },
+	{ "GL_EXT_sRGB", 0, 0 },
+	{ "GL_EXT_sRGB_write_control", 0, 0 },
+	{ "GL_EXT_secondary_color", 0, 0 },
+	{ "GL_EXT_separate_shader_objects", 0, 0 },
+	{ "GL_EXT_separate_specular_color", 0, 0 },
+	{ "GL_EXT_shader_framebuffer_fetch", 0, 0 },
+	{ "GL_EXT_shader_image_load_store", 0, 0 },
+	{ "GL_EXT_shader_integer_mix", 0, 0 },
+	{ "GL_EXT_shader_texture_lod", 0, 0 },
+	{ "GL_EXT_shadow_funcs", 0, 0 },
+	{ "GL_EXT_shadow_samplers", 0, 0 },
+	{ "GL_EXT_shared_texture_palette", 0, 0 },
+	{ "GL_EXT_stencil_clear_tag", 0, 0 },
+	{ "GL_EXT_stencil_two_side", 0, 0 },
+	{ "GL_EXT_stencil_wrap", 0, 0 },
+	{ "GL_EXT_subtexture", 0, 0 },
+	{ "GL_EXT_texture", 0, 0 },
+	{ "GL_EXT_texture3D", 0, 0 },
+	{ "GL_EXT_texture_array", 0, 0 },
+	{ "GL_EXT_texture_buffer_object", 0, 0 },
+	{ "GL_EXT_texture_compression_dxt1", 0, 0 },
+	{ "GL_EXT_texture_compression_latc", 0, 0 },
+	{ "GL_EXT_texture_compression_rgtc", 0, 0 },
+	{ "GL_EXT_texture_compression_s3tc", 0, 0 },
+	{ "GL_EXT_texture_cube_map", 0, 0 },
+	{ "GL_EXT_texture_env_add", 0, 0 },
+	{ "GL_EXT_texture_env_combine", 0, 0 },
+	{ "GL_EXT_texture_env_dot3", 0, 0 },
+	{ "GL_EXT_texture_filter_anisotropic", 0, 0 },
+	{ "GL_EXT_texture_format_BGRA8888", 0, 0 },
+	{ "GL_EXT_texture_integer", 0, 0 },
+	{ "GL_EXT_texture_lod_bias", 0, 0 },
+	{ "GL_EXT_texture_mirror_clamp", 0, 0 },
+	{ "GL_EXT_texture_object", 0, 0 },
+	{ "GL_EXT_texture_perturb_normal", 0, 0 },
+	{ "GL_EXT_texture_rg", 0, 0 },
+	{ "GL_EXT_texture_sRGB", 0, 0 },
+	{ "GL_EXT_texture_sRGB_decode", 0, 0 },
+	{ "GL_EXT_texture_shared_exponent", 0, 0 },
+	{ "GL_EXT_texture_snorm", 0, 0 },
+	{ "GL_EXT_texture_storage", 0, 0 },
+	{ "GL_EXT_texture_swizzle", 0, 0 },
+	{ "GL_EXT_texture_type_2_10_10_10_REV", 0, 0 },
+	{ "GL_EXT_timer_query", 0, 0 },
+	{ "GL_EXT_transform_feedback", 0, 0 },
+	{ "GL_EXT_unpack_subimage", 0, 0 },
+	{ "GL_EXT_vertex_array", 0, 0 },
+	{ "GL_EXT_vertex_array_bgra", 1, 2 },
+	{ "GL_EXT_vertex_attrib_64bit", 0, 0 },
+	{ "GL_EXT_vertex_shader", 0, 0 },
+	{ "GL_EXT_vertex_weighting", 0, 0 },
+	{ "GL_EXT_x11_sync_object", 0, 0 },
+	{ "GL_FJ_shader_binary_GCCSO", 0, 0 },
+	{ "GL_GREMEDY_frame_terminator", 0, 0 },
+	{ "GL_GREMEDY_string_marker", 0, 0 },
+	{ "GL_HP_convolution_border_modes", 0, 0 },
+	{ "GL_HP_image_transform", 0, 0 },
+	{ "GL_HP_occlusion_test", 0, 0 },
+	{ "GL_HP_texture_lighting", 0, 0 },
+	{ "GL_IBM_cull_vertex", 0, 0 },
+	{ "GL_IBM_multimode_draw_arrays", 0, 0 },
+	{ "GL_IBM_rasterpos_clip", 0, 0 },
+	{ "GL_IBM_static_data", 0, 0 },
+	{ "GL_IBM_texture_mirrored_repeat", 0, 0 },
+	{ "GL_IBM_vertex_array_lists", 0, 0 },
+	{ "GL_IMG_multisampled_render_to_texture", 0, 0 },
+	{ "GL_IMG_program_binary", 0, 0 },
+	{ "GL_IMG_read_format", 0, 0 },
+	{ "GL_IMG_shader_binary", 0, 0 },
+	{ "GL_IMG_texture_compression_pvrtc", 0, 0 },
+	{ "GL_IMG_texture_compression_pvrtc2", 0, 0 },
+	{ "GL_IMG_texture_env_enhanced_fixed_function", 0, 0 },
+	{ "GL_IMG_user_clip_plane", 0, 0 },
+	{ "GL_INGR_blend_func_separate", 0, 0 },
+	{ "GL_INGR_color_clamp", 0, 0 },
+	{ "GL_INGR_interlace_read", 0, 0 },
+	{ "GL_INTEL_fragment_shader_ordering", 0, 0 },
+	{ "GL_INTEL_map_texture", 0, 0 },
+	{ "GL_INTEL_parallel_arrays", 0, 0 },
+	{ "GL_INTEL_performance_query", 0, 0 },
+	{ "GL_KHR_debug", 0, 0 },
+	{ "GL_KHR_texture_compression_astc_hdr", 0, 0 },
+	{ "GL_KHR_texture_compression_astc_ldr", 0, 0 },
+	{ "GL_MESAX_texture_stack", 0, 0 },
+	{ "GL_MESA_pack_invert", 0, 0 },
+	{ "GL_MESA_resize_buffers", 0, 0 },
+	{ "GL_MESA_window_pos", 0, 0 },
+	{ "GL_MESA_ycbcr_texture", 0, 0 },
+	{ "GL_NVX_conditional_render", 0, 0 },
+	{ "GL_NVX_gpu_memory_info", 0, 0 },
+	{ "GL_NV_bindless_multi_draw_indirect", 0, 0 },
+	{ "GL_NV_bindless_texture", 0, 0 },
+	{ "GL_NV_blend_equation_advanced", 0, 0 },
+	{ "GL_NV_blend_equation_advanced_coherent", 0, 0 },
+	{ "GL_NV_blend_square", 0, 0 },
+	{ "GL_NV_compute_program5", 0, 0 },
+	{ "GL_NV_conditional_render", 0, 0 },
+	{ "GL_NV_copy_buffer", 0, 0 },
+	{ "GL_NV_copy_depth_to_color", 0, 0 },
+	{ "GL_NV_copy_image", 0, 0 },
+	{ "GL_NV_coverage_sample", 0, 0 },
+	{ "GL_NV_deep_texture3D", 0, 0 },
+	{ "GL_NV_depth_buffer_float", 0, 0 },
+	{ "GL_NV_depth_clamp", 0, 0 },
+	{ "GL_NV_depth_nonlinear", 0, 0 },
+	{ "GL_NV_draw_buffers", 0, 0 },
+	{ "GL_NV_draw_instanced", 0, 0 },
+	{ "GL_NV_draw_texture", 0, 0 },
+	{ "GL_NV_evaluators", 0, 0 },
+	{ "GL_NV_explicit_attrib_location", 0, 0 },
+	{ "GL_NV_explicit_multisample", 0, 0 },
+	{ "GL_NV_fbo_color_attachments", 0, 0 },
+	{ "GL_NV_fence", 0, 0 },
+	{ "GL_NV_float_buffer", 0, 0 },
+	{ "GL_NV_fog_distance", 0, 0 },
+	{ "GL_NV_fragment_program", 0, 0 },
+	{ "GL_NV_fragment_program2", 0, 0 },
+	{ "GL_NV_fragment_program4", 0, 0 },
+	{ "GL_NV_fragment_program_option", 0, 0 },
+	{ "GL_NV_framebuffer_blit", 0, 0 },
+	{ "GL_NV_framebuffer_multisample", 0, 0 },
+	{ "GL_NV_framebuffer_multisample_coverage", 0, 0 },
+	{ "GL_NV_generate_mipmap_sRGB", 0, 0 },
+	{ "GL_NV_geometry_program4", 0, 0 },
+	{ "GL_NV_geometry_shader4", 0, 0 },
+	{ "GL_NV_gpu_program4", 0, 0 },
+	{ "GL_NV_gpu_program5", 0, 0 },
+	{ "GL_NV_gpu_program5_mem_extended", 0, 0 },
+	{ "GL_NV_gpu_shader5", 0, 0 },
+	{ "GL_NV_half_float", 0, 0 },
+	{ "GL_NV_instanced_arrays", 0, 0 },
+	{ "GL_NV_light_max_exponent", 0, 0 },
+	{ "GL_NV_multisample_coverage", 0, 0 },
+	{ "GL_NV_multisample_filter_hint", 0, 0 },
+	{ "GL_NV_non_square_matrices", 0, 0 },
+	{ "GL_NV_occlusion_query", 0, 0 },
+	{ "GL_NV_packed_depth_stencil", 0, 0 },
+	{ "GL_NV_parameter_buffer_object", 0, 0 },
+	{ "GL_NV_parameter_buffer_object2", 0, 0 },
+	{ "GL_NV_path_rendering", 0, 0 },
+	{ "GL_NV_pixel_data_range", 0, 0 },
+	{ "GL_NV_point_sprite", 0, 0 },
+	{ "GL_NV_present_video", 0, 0 },
+	{ "GL_NV_primitive_restart", 0, 0 },
+	{ "GL_NV_read_buffer", 0, 0 },
+	{ "GL_NV_read_buffer_front", 0, 0 },
+	{ "GL_NV_read_depth", 0, 0 },
+	{ "GL_NV_read_depth_stencil", 0, 0 },
+	{ "GL_NV_read_stencil", 0, 0 },
+	{ "GL_NV_register_combiners", 0, 0 },
+	{ "GL_NV_register_combiners2", 0, 0 },
+	{ "GL_NV_sRGB_formats", 0, 0 },
+	{ "GL_NV_shader_atomic_counters", 0, 0 },
+	{ "GL_NV_shader_atomic_float", 0, 0 },
+	{ "GL_NV_shader_buffer_load", 0, 0 },
+	{ "GL_NV_shader_buffer_store", 0, 0 },
+	{ "GL_NV_shader_storage_buffer_object", 0, 0 },
+	{ "GL_NV_shadow_samplers_array", 0, 0 },
+	{ "GL_NV_shadow_samplers_cube", 0, 0 },
+	{ "GL_NV_tessellation_program5", 0, 0 },
+	{ "GL_NV_texgen_emboss", 0, 0 },
+	{ "GL_NV_texgen_reflection", 0, 0 },
+	{ "GL_NV_texture_barrier", 0, 0 },
+	{ "GL_NV_texture_border_clamp", 0, 0 },
+	{ "GL_NV_texture_compression_s3tc_update", 0, 0 },
+	{ "GL_NV_texture_compression_vtc", 0, 0 },
+	{ "GL_NV_texture_env_combine4", 0, 0 },
+	{ "GL_NV_texture_expand_normal", 0, 0 },
+	{ "GL_NV_texture_multisample", 0, 0 },
+	{ "GL_NV_texture_npot_2D_mipmap", 0, 0 },
+	{ "GL_NV_texture_rectangle", 0, 0 },
+	{ "GL_NV_texture_shader", 0, 0 },
+	{ "GL_NV_texture_shader2", 0, 0 },
+	{ "GL_NV_texture_shader3", 0, 0 },
+	{ "GL_NV_transform_feedback", 0, 0 },
+	{ "GL_NV_transform_feedback2", 0, 0 },
+	{ "GL_NV_vdpau_interop", 0, 0 },
+	{ "GL_NV_vertex_array_range", 0, 0 },
+	{ "GL_NV_vertex_array_range2", 0, 0 },
+	{ "GL_NV_vertex_attrib_integer_64bit", 0, 0 },
+	{ "GL_NV_vertex_buffer_unified_memory", 0, 0 },
+	{ "GL_NV_vertex_program", 0, 0 },
+	{ "GL_NV_vertex_program1_1", 0, 0 },
+	{ "GL_NV_vertex_program2", 0, 0 },
+	{ "GL_NV_vertex_program2_option", 0, 0 },
+	{ "GL_NV_vertex_program3", 2, 0 },
+	{ "GL_NV_vertex_program4", 0, 0 },
+	{ "GL_NV_video_capture", 0, 0 },
+	{ "GL_OES_EGL_image", 0, 0 },
+	{ "GL_OES_EGL_image_external", 0, 0 },
+	{ "GL_OES_blend_equation_separate", 0, 0 },
+	{ "GL_OES_blend_func_separate", 0, 0 },
+	{ "GL_OES_blend_subtract", 0, 0 },
+	{ "GL_OES_byte_coordinates", 0, 0 },
+	{ "GL_OES_compressed_ETC1_RGB8_texture", 0, 0 },
+	{ "GL_OES_compressed_paletted_texture", 0, 0 },
+	{ "GL_OES_depth24", 0, 0 },
+	{ "GL_OES_depth32", 0, 0 },
+	{ "GL_OES_depth_texture", 1, 1 },
+	{ "GL_OES_draw_texture", 0, 0 },
+	{ "GL_OES_element_index_uint", 1, 1 },
+	{ "GL_OES_extended_matrix_palette", 0, 0 },
+	{ "GL_OES_fbo_render_mipmap", 0, 0 },
+	{ "GL_OES_fixed_point", 0, 0 },
+	{ "GL_OES_fragment_precision_high", 0, 0 },
+	{ "GL_OES_framebuffer_object", 0, 0 },
+	{ "GL_OES_get_program_binary", 0, 0 },
+	{ "GL_OES_mapbuffer", 0, 0 },
+	{ "GL_OES_matrix_get", 0, 0 },
+	{ "GL_OES_matrix_palette", 0, 0 },
+	{ "GL_OES_packed_depth_stencil", 0, 0 },
+	{ "GL_OES_point_size_array", 0, 0 },
+	{ "GL_OES_point_sprite", 0, 0 },
+	{ "GL_OES_query_matrix", 0, 0 },
+	{ "GL_OES_read_format", 0, 0 },
+	{ "GL_OES_required_internalformat", 0, 0 },
+	{ "GL_OES_rgb8_rgba8", 0, 0 },
+	{ "GL_OES_single_precision", 0, 0 },
+	{ "GL_OES_standard_derivatives", 0, 0 },
+	{ "GL_OES_stencil1", 0, 0 },
+	{ "GL_OES_stencil4", 0, 0 },
+	{ "GL_OES_stencil8", 0, 0 },
+	{ "GL_OES_stencil_wrap", 0, 0 },
+	{ "GL_OES_surfaceless_context", 0, 0 },
+	{ "GL_OES_texture_3D", 0, 0 },
+	{ "GL_OES_texture_compression_astc", 0, 0 },
+	{ "GL_OES_texture_cube_map", 0, 0 },
+	{ "GL_OES_texture_env_crossbar", 0, 0 },
+	{ "GL_OES_texture_float", 1, 1 },
+	{ "GL_OES_texture_float_linear", 0, 0 },
+	{ "GL_OES_texture_half_float", 0, 0 },
+	{ "GL_OES_texture_half_float_linear", 0, 0 },
+	{ "GL_OES_texture_mirrored_repeat", 0, 0 },
+	{ "GL_OES_texture_npot", 0, 0 },
+	{ "GL_OES_vertex_array_object", 0, 0 },
+	{ "GL_OES_vertex_half_float", 0, 0 },
+	{ "GL_OES_vertex_type_10_10_10_2", 0, 0 },
+	{ "GL_OML_interlace", 0, 0 },
+	{ "GL_OML_resample", 0, 0 },
+	{ "GL_OML_subsample", 0, 0 },
+	{ "GL_PGI_misc_hints", 0, 0 },
+	{ "GL_PGI_vertex_hints", 0, 0 },
+	{ "GL_QCOM_alpha_test", 0, 0 },
+	{ "GL_QCOM_binning_control", 0, 0 },
+	{ "GL_QCOM_driver_control", 0, 0 },
+	{ "GL_QCOM_extended_get", 0, 0 },
+	{ "GL_QCOM_extended_get2", 0, 0 },
+	{ "GL_QCOM_perfmon_global_mode", 0, 0 },
+	{ "GL_QCOM_tiled_rendering", 0, 0 },
+	{ "GL_QCOM_writeonly_rendering", 0, 0 },
+	{ "GL_REND_screen_coordinates", 0, 0 },
+	{ "GL_S3_s3tc", 0, 0 },
+	{ "GL_SGIS_detail_texture", 0, 0 },
+	{ "GL_SGIS_fog_function", 0, 0 },
+	{ "GL_SGIS_generate_mipmap", 0, 0 },
+	{ "GL_SGIS_multisample", 0, 0 },
+	{ "GL_SGIS_pixel_texture", 0, 0 },
+	{ "GL_SGIS_point_line_texgen", 0, 0 },
+	{ "GL_SGIS_point_parameters", 0, 0 },
+	{ "GL_SGIS_sharpen_texture", 0, 0 },
+	{ "GL_SGIS_texture4D", 0, 0 },
+	{ "GL_SGIS_texture_border_clamp", 0, 0 },
+	{ "GL_SGIS_texture_color_mask", 0, 0 },
+	{ "GL_SGIS_texture_edge_clamp", 0, 0 },
+	{ "GL_SGIS_texture_filter4", 0, 0 },
+	{ "GL_SGIS_texture_lod", 0, 0 },
+	{ "GL_SGIS_texture_select", 0, 0 },
+	{ "GL_SGIX_async", 0, 0 },
+	{ "GL_SGIX_async_histogram", 0, 0 },
+	{ "GL_SGIX_async_pixel", 0, 0 },
+	{ "GL_SGIX_blend_alpha_minmax", 0, 0 },
+	{ "GL_SGIX_calligraphic_fragment", 0, 0 },
+	{ "GL_SGIX_clipmap", 0, 0 },
+	{ "GL_SGIX_convolution_accuracy", 0, 0 },
+	{ "GL_SGIX_depth_pass_instrument", 0, 0 },
+	{ "GL_SGIX_depth_texture", 0, 0 },
+	{ "GL_SGIX_flush_raster", 0, 0 },
+	{ "GL_SGIX_fog_offset", 0, 0 },
+	{ "GL_SGIX_fragment_lighting", 0, 0 },
+	{ "GL_SGIX_framezoom", 0, 0 },
+	{ "GL_SGIX_igloo_interface", 0, 0 },
+	{ "GL_SGIX_instruments", 0, 0 },
+	{ "GL_SGIX_interlace", 0, 0 },
+	{ "GL_SGIX_ir_instrument1", 0, 0 },
+	{ "GL_SGIX_list_priority", 0, 0 },
+	{ "GL_SGIX_pixel_texture", 0, 0 },
+	{ "GL_SGIX_pixel_tiles", 0, 0 },
+	{ "GL_SGIX_polynomial_ffd", 0, 0 },
+	{ "GL_SGIX_reference_plane", 0, 0 },
+	{ "GL_SGIX_resample", 0, 0 },
+	{ "GL_SGIX_scalebias_hint", 0, 0 },
+	{ "GL_SGIX_shadow", 0, 0 },
+	{ "GL_SGIX_shadow_ambient", 0, 0 },
+	{ "GL_SGIX_sprite", 0, 0 },
+	{ "GL_SGIX_subsample", 0, 0 },
+	{ "GL_SGIX_tag_sample_buffer", 0, 0 },
+	{ "GL_SGIX_texture_add_env", 0, 0 },
+	{ "GL_SGIX_texture_coordinate_clamp", 0, 0 },
+	{ "GL_SGIX_texture_lod_bias", 0, 0 },
+	{ "GL_SGIX_texture_multi_buffer", 0, 0 },
+	{ "GL_SGIX_texture_scale_bias", 0, 0 },
+	{ "GL_SGIX_vertex_preclip", 0, 0 },
+	{ "GL_SGIX_ycrcb", 0, 0 },
+	{ "GL_SGIX_ycrcb_subsample", 0, 0 },
+	{ "GL_SGIX_ycrcba", 0, 0 },
+	{ "GL_SGI_color_matrix", 0, 0 },
+	{ "GL_SGI_color_table", 0, 0 },
+	{ "GL_SGI_texture_color_table", 0, 0 },
+	{ "GL_SUNX_constant_data", 0, 0 },
+	{ "GL_SUN_convolution_border_modes", 0, 0 },
+	{ "GL_SUN_global_alpha", 0, 0 },
+	{ "GL_SUN_mesh_array", 0, 0 },
+	{ "GL_SUN_slice_accum", 0, 0 },
+	{ "GL_SUN_triangle_list", 0, 0 },
+	{ "GL_SUN_vertex", 0, 0 },
+	{ "GL_VIV_shader_binary", 0, 0 },
+	{ "GL_WIN_phong_shading", 0, 0 },
+	{ "GL_WIN_specular_fog", 0, 0 },
+};
+
+// Sorted by name for binary search.
+CONSTEXPR const ExtensionName extensionNames[] = {
 	{ "GL_3DFX_multisample", glow::GLOW_3DFX_multisample },
 	{ "GL_3DFX_tbuffer", glow::GLOW_3DFX_tbuffer },
 	{ "GL_3DFX_texture_compression_FXT1", glow::GLOW_3DFX_texture_compression_FXT1 },
@@ -1226,105 +1244,6 @@ const std::unordered_map<std::string, glow::Extension> extensions = {
 	{ "GL_WIN_specular_fog", glow::GLOW_WIN_specular_fog },
 };
 
-const std::unordered_map<glow::Extension, glow::Version, std::hash<unsigned int>> extensionVersions = {
-	{ glow::GLOW_AMD_seamless_cubemap_per_texture, glow::Version(3, 2) },
-	{ glow::GLOW_ARB_ES2_compatibility, glow::Version(4, 1) },
-	{ glow::GLOW_ARB_ES3_compatibility, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_base_instance, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_blend_func_extended, glow::Version(3, 3) },
-	{ glow::GLOW_ARB_buffer_storage, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_clear_buffer_object, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_clear_texture, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_compressed_texture_pixel_storage, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_copy_image, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_debug_output, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_depth_buffer_float, glow::Version(3, 0) },
-	{ glow::GLOW_ARB_depth_clamp, glow::Version(3, 2) },
-	{ glow::GLOW_ARB_depth_texture, glow::Version(1, 4) },
-	{ glow::GLOW_ARB_draw_buffers, glow::Version(2, 0) },
-	{ glow::GLOW_ARB_draw_buffers_blend, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_draw_elements_base_vertex, glow::Version(3, 2) },
-	{ glow::GLOW_ARB_draw_indirect, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_draw_instanced, glow::Version(3, 1) },
-	{ glow::GLOW_ARB_enhanced_layouts, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_explicit_uniform_location, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_fragment_shader, glow::Version(2, 0) },
-	{ glow::GLOW_ARB_framebuffer_no_attachments, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_framebuffer_object, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_framebuffer_sRGB, glow::Version(3, 0) },
-	{ glow::GLOW_ARB_get_program_binary, glow::Version(4, 1) },
-	{ glow::GLOW_ARB_gpu_shader5, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_gpu_shader_fp64, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_half_float_pixel, glow::Version(3, 0) },
-	{ glow::GLOW_ARB_half_float_vertex, glow::Version(3, 0) },
-	{ glow::GLOW_ARB_instanced_arrays, glow::Version(3, 3) },
-	{ glow::GLOW_ARB_internalformat_query, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_invalidate_subdata, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_map_buffer_alignment, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_map_buffer_range, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_multi_bind, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_multi_draw_indirect, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_multisample, glow::Version(1, 3) },
-	{ glow::GLOW_ARB_multitexture, glow::Version(1, 3) },
-	{ glow::GLOW_ARB_occlusion_query, glow::Version(1, 5) },
-	{ glow::GLOW_ARB_occlusion_query2, glow::Version(3, 3) },
-	{ glow::GLOW_ARB_pixel_buffer_object, glow::Version(2, 1) },
-	{ glow::GLOW_ARB_point_parameters, glow::Version(1, 4) },
-	{ glow::GLOW_ARB_point_sprite, glow::Version(2, 0) },
-	{ glow::GLOW_ARB_program_interface_query, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_provoking_vertex, glow::Version(3, 2) },
-	{ glow::GLOW_ARB_query_buffer_object, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_sample_shading, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_sampler_objects, glow::Version(3, 3) },
-	{ glow::GLOW_ARB_seamless_cube_map, glow::Version(3, 2) },
-	{ glow::GLOW_ARB_seamless_cubemap_per_texture, glow::Version(3, 2) },
-	{ glow::GLOW_ARB_separate_shader_objects, glow::Version(4, 1) },
-	{ glow::GLOW_ARB_shader_atomic_counters, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_shader_image_load_store, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_shader_storage_buffer_object, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_shader_subroutine, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_shading_language_100, glow::Version(2, 0) },
-	{ glow::GLOW_ARB_shadow, glow::Version(1, 4) },
-	{ glow::GLOW_ARB_stencil_texturing, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_sync, glow::Version(3, 2) },
-	{ glow::GLOW_ARB_tessellation_shader, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_texture_border_clamp, glow::Version(1, 3) },
-	{ glow::GLOW_ARB_texture_buffer_object_rgb32, glow::Version(3, 0) },
-	{ glow::GLOW_ARB_texture_buffer_range, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_texture_compression, glow::Version(1, 3) },
-	{ glow::GLOW_ARB_texture_compression_bptc, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_texture_compression_rgtc, glow::Version(3, 0) },
-	{ glow::GLOW_ARB_texture_cube_map, glow::Version(1, 3) },
-	{ glow::GLOW_ARB_texture_cube_map_array, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_texture_env_combine, glow::Version(1, 3) },
-	{ glow::GLOW_ARB_texture_env_dot3, glow::Version(1, 3) },
-	{ glow::GLOW_ARB_texture_mirror_clamp_to_edge, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_texture_mirrored_repeat, glow::Version(1, 4) },
-	{ glow::GLOW_ARB_texture_multisample, glow::Version(3, 2) },
-	{ glow::GLOW_ARB_texture_rectangle, glow::Version(3, 1) },
-	{ glow::GLOW_ARB_texture_rg, glow::Version(3, 0) },
-	{ glow::GLOW_ARB_texture_rgb10_a2ui, glow::Version(3, 3) },
-	{ glow::GLOW_ARB_texture_stencil8, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_texture_storage, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_texture_storage_multisample, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_texture_swizzle, glow::Version(3, 3) },
-	{ glow::GLOW_ARB_texture_view, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_timer_query, glow::Version(3, 3) },
-	{ glow::GLOW_ARB_transform_feedback3, glow::Version(4, 0) },
-	{ glow::GLOW_ARB_transform_feedback_instanced, glow::Version(4, 2) },
-	{ glow::GLOW_ARB_transpose_matrix, glow::Version(1, 3) },
-	{ glow::GLOW_ARB_vertex_array_bgra, glow::Version(1, 2) },
-	{ glow::GLOW_ARB_vertex_array_object, glow::Version(3, 0) },
-	{ glow::GLOW_ARB_vertex_attrib_64bit, glow::Version(4, 1) },
-	{ glow::GLOW_ARB_vertex_attrib_binding, glow::Version(4, 3) },
-	{ glow::GLOW_ARB_vertex_buffer_object, glow::Version(1, 5) },
-	{ glow::GLOW_ARB_vertex_type_10f_11f_11f_rev, glow::Version(4, 4) },
-	{ glow::GLOW_ARB_vertex_type_2_10_10_10_rev, glow::Version(3, 3) },
-	{ glow::GLOW_ARB_viewport_array, glow::Version(4, 1) },
-	{ glow::GLOW_ARB_window_pos, glow::Version(1, 4) },
-	{ glow::GLOW_EXT_vertex_array_bgra, glow::Version(1, 2) },
-	{ glow::GLOW_NV_vertex_program3, glow::Version(2, 0) },
-	{ glow::GLOW_OES_depth_texture, glow::Version(1, 1) },
-	{ glow::GLOW_OES_element_index_uint, glow::Version(1, 1) },
-	{ glow::GLOW_OES_texture_float, glow::Version(1, 1) },
-};
+CONSTEXPR const unsigned int extensionNameCount = sizeof(extensionNames) / sizeof(ExtensionName);
+
+} // namespace glow
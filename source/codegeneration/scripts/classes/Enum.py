@@ -1,8 +1,31 @@
 import sys
 
+# Vendor suffixes in order of preference, used to choose the name of enums sharing a value
+extensionPriorities = [
+	"ARB",
+	"EXT",
+	"NV",
+	"AMD",
+	"ATI",
+	"KHR",
+	"SGIS",
+	"SGIX",
+	"IBM",
+	"INGR",
+	"APPLE",
+	"PGI",
+	"QCOM",
+	"OES",
+	"INTEL",
+	"IMG",
+	"WEBGL"
+]
+
 class Enum:
 	def __init__(self, xml):
 		self.name = xml.attrib["name"]
+		self.value = int(xml.attrib["value"], 0)
+		self.api = xml.attrib.get("api", "")
 		
 	def __str__(self):
 		return "Enum(%s)" % self.name
@@ -10,6 +33,15 @@ class Enum:
 	def __lt__(self, other):
 		return self.name < other.name
 		
+	def extensionPriority(self):
+		suffix = self.name.rsplit("_", 1)[-1]
+		if suffix == self.name or not suffix in extensionPriorities:
+			return -1
+		return extensionPriorities.index(suffix)
+		
+	def preference(self):
+		return (self.extensionPriority(), len(self.name), self.name)
+		
 		
 def parseEnums(xml):
 	enums = set()
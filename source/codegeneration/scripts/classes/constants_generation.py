@@ -2,23 +2,41 @@ import xml.etree.ElementTree as ET
 from Enum import *
 
 pre = \
-"""#include <GL/glew.h>
-#include <unordered_map>
+"""#pragma once
 
-const std::unordered_multimap<GLuint64, const char*> GLconstants = {
+#include <GL/glew.h>
+
+#include <glow/glow.h>
+
+namespace glow {
+
+struct GLconstant
+{
+	GLenum value;
+	const char * name;
+};
+
+// Sorted by value; names sharing a value are sorted by preference, i.e., the first one is returned by enumName().
+CONSTEXPR const GLconstant GLconstants[] = {
+"""
+post = \
+"""};
+
+CONSTEXPR const unsigned int GLconstantCount = sizeof(GLconstants) / sizeof(GLconstant);
+
+} // namespace glow
 """
-post = "};\n"
 
 def generateConstantsHeader(inputfile, outputfile):
 	tree = ET.parse(inputfile)
 	registry = tree.getroot()
 
-	enums = sorted(parseEnums(registry))
+	# GLenum is an unsigned 32 bit value, and enums of other APIs (e.g., gles2) may conflict with the GL ones
+	enums = [enum for enum in parseEnums(registry) if enum.api in ("", "gl") and 0 <= enum.value <= 0xFFFFFFFF]
+	enums = sorted(enums, key = lambda enum: (enum.value, enum.preference()))
 
 	with open(outputfile, 'w') as file:
 		file.write(pre)
 		for enum in enums:
-			file.write("#ifdef %s\n" % enum.name)
-			file.write('\t{ %s, "%s" },\n' % (enum.name, enum.name))
-			file.write("#endif\n")
-		file.write(post)
\ No newline at end of file
+			file.write('\t{ 0x%04X, "%s" },\n' % (enum.value, enum.name))
+		file.write(post)
@@ -54,21 +54,24 @@ def generateExtensionFiles(inputfile, outputfile, outputfile2):
 	findExtensionVersions(extensions, features)
 	
 	enumDecl = "enum Extension\n{\n"
-	namesMap = "const std::unordered_map<glow::Extension, std::string, std::hash<unsigned int>> extensionStrings = {\n"
-	extensionMap = "const std::unordered_map<std::string, glow::Extension> extensions = {\n"
-	incoreMap = "const std::unordered_map<glow::Extension, glow::Version, std::hash<unsigned int>> extensionVersions = {\n"
+	infoTable = "// Indexed by glow::Extension; extensions that are not part of any core profile have version 0.0.\n"
+	infoTable += "CONSTEXPR const ExtensionInfo extensionInfos[] = {\n"
+	extensionTable = "// Sorted by name for binary search.\n"
+	extensionTable += "CONSTEXPR const ExtensionName extensionNames[] = {\n"
 
 	for e in extensions:
 		enumDecl += "\t%s,\n" % e.enumName()
-		namesMap += '\t{ glow::%s, "%s" },\n' % (e.enumName(), e.name)
-		extensionMap += '\t{ "%s", glow::%s },\n' % (e.name, e.enumName())
 		if e.incore:
-			incoreMap += "\t{ glow::%s, glow::Version(%s, %s) },\n" % (e.enumName(), e.incore.major, e.incore.minor)
+			infoTable += '\t{ "%s", %s, %s },\n' % (e.name, e.incore.major, e.incore.minor)
+		else:
+			infoTable += '\t{ "%s", 0, 0 },\n' % (e.name)
+		
+	for e in sorted(extensions, key = lambda e: e.name):
+		extensionTable += '\t{ "%s", glow::%s },\n' % (e.name, e.enumName())
 		
 	enumDecl += "\tGLOW_Unknown_Extension\n};"
-	namesMap += "};\n"
-	extensionMap += "};\n"
-	incoreMap += "};\n"
+	infoTable += "};\n"
+	extensionTable += "};\n"
 			
 	pre = \
 """#pragma once
@@ -88,21 +91,40 @@ namespace glow {
 		file.write(post)
 		
 	pre = \
-"""#include <string>
-#include <unordered_map>
+"""#pragma once
 
+#include <GL/glew.h>
+
+#include <glow/glow.h>
 #include <glow/Extension.h>
-#include <glow/Version.h>
+
+namespace glow {
+
+struct ExtensionInfo
+{
+	const char * name;
+	GLint majorVersion;
+	GLint minorVersion;
+};
+
+struct ExtensionName
+{
+	const char * name;
+	glow::Extension extension;
+};
 
 """
-	post = ""
+	post = \
+"""
+CONSTEXPR const unsigned int extensionNameCount = sizeof(extensionNames) / sizeof(ExtensionName);
+
+} // namespace glow
+"""
 			
 	with open(outputfile2, 'w') as file:
 		file.write(pre)
-		file.write(namesMap)
-		file.write("\n")
-		file.write(extensionMap)
+		file.write(infoTable)
 		file.write("\n")
-		file.write(incoreMap)
+		file.write(extensionTable)
 		file.write(post)
 			
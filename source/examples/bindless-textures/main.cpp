@@ -13,6 +13,7 @@
 #include <glow/Capability.h>
 #include <glow/Texture.h>
 #include <glow/Program.h>
+#include <glow/UniformBlock.h>
 #include <glow/Shader.h>
 #include <glow/VertexArrayObject.h>
 #include <glow/VertexAttributeBinding.h>
@@ -28,6 +29,7 @@
 #include <glowutils/AbstractCoordinateProvider.h>
 #include <glowutils/WorldInHandNavigation.h>
 #include <glowutils/VertexDrawable.h>
+#include <glowutils/TextureResidencyManager.h>
 
 #include <glowwindow/ContextFormat.h>
 #include <glowwindow/Context.h>
@@ -85,12 +87,13 @@ public:
             glowutils::createShaderFromFile(GL_FRAGMENT_SHADER, "data/bindless-textures/shader.frag")
         );
 
-        std::array<glow::TextureHandle, std::tuple_size<decltype(m_textures)>::value> handles;
+        // the handle table is a uniform buffer indexed by side, textures become resident when used
+        m_residency = new glowutils::TextureResidencyManager(0, glowutils::TextureResidencyManager::Std140);
         for (unsigned i = 0; i < m_textures.size(); ++i)
         {
-            handles[i] = m_textures[i]->makeResident();
+            m_residency->setTexture(i, m_textures[i]);
         }
-        m_program->setUniform("textures", handles);
+        m_program->uniformBlock("Textures")->setBinding(0);
 
         window.addTimer(0, 0);
     }
@@ -113,6 +116,13 @@ public:
 
         m_program->setUniform("projection", m_camera.viewProjection());
 
+        for (unsigned i = 0; i < m_textures.size(); ++i)
+        {
+            m_residency->use(i);
+        }
+        m_residency->update();
+        m_residency->handleTable()->bindBase(GL_UNIFORM_BUFFER, 0);
+
         m_program->use();
         m_drawable->draw();
         m_program->release();
@@ -221,6 +231,7 @@ protected:
     glowutils::AxisAlignedBoundingBox m_aabb;
 
     std::array<glow::ref_ptr<glow::Texture>, 4> m_textures;
+    glow::ref_ptr<glowutils::TextureResidencyManager> m_residency;
     glow::ref_ptr<glow::Program> m_program;
     glow::ref_ptr<glowutils::VertexDrawable> m_drawable;
 };
@@ -231,7 +242,7 @@ protected:
 int main(int /*argc*/, char* /*argv*/[])
 {
     ContextFormat format;
-    format.setVersion(3, 0);
+    format.setVersion(3, 1);
 
     Window window;
 
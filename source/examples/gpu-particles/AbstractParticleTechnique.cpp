@@ -23,3 +23,7 @@ AbstractParticleTechnique::AbstractParticleTechnique(
 AbstractParticleTechnique::~AbstractParticleTechnique()
 {
 }
+
+void AbstractParticleTechnique::updateForces()
+{
+}
@@ -33,6 +33,9 @@ public:
     virtual void initialize() = 0;
     virtual void reset() = 0;
 
+    /** Called after the force field was respecified, e.g., by resetting it. */
+    virtual void updateForces();
+
     virtual void step(float elapsed) = 0;
     virtual void draw(float elapsed) = 0;
 
@@ -0,0 +1,594 @@
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include <glow/Error.h>
+#include <glow/Extension.h>
+#include <glow/Program.h>
+#include <glow/Shader.h>
+#include <glow/Buffer.h>
+#include <glow/VertexArrayObject.h>
+#include <glow/VertexAttributeBinding.h>
+#include <glow/FrameBufferObject.h>
+#include <glow/Texture.h>
+
+#include <glowutils/ScreenAlignedQuad.h>
+#include <glowutils/Camera.h>
+#include <glowutils/global.h>
+
+#include "CPUParticles.h"
+
+#if defined(__AVX__)
+    #define PARTICLES_AVX
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define PARTICLES_SSE
+    #include <emmintrin.h>
+#endif
+
+
+using namespace glow;
+using namespace glm;
+
+namespace
+{
+
+// constants of particleMovement.inc
+const float gravity = 1.f;
+const float friction = 0.2f;
+
+/** Maps particle positions to cells of the force field like texture(forces, p * 0.2 + 0.5) with
+    linear filtering and GL_CLAMP_TO_EDGE does: the texel coordinate p * 0.2 * size + 0.5 * size - 0.5
+    is clamped to the first and last texel center.
+*/
+struct Field
+{
+    const float * cells; // 8 corners of 4 floats per cell
+    int cellCount[3];
+    float scale[3];
+    float bias[3];
+    float maximum[3];
+};
+
+/** Cell index and weights of the cell's second corner along each axis */
+inline int locate(const Field & field, const float p[3], float weights[3])
+{
+    int cell[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const float s = std::min(std::max(p[i] * field.scale[i] + field.bias[i], 0.f), field.maximum[i]);
+        cell[i] = std::min(static_cast<int>(s), field.cellCount[i] - 1);
+        weights[i] = s - static_cast<float>(cell[i]);
+    }
+    return (cell[2] * field.cellCount[1] + cell[1]) * field.cellCount[0] + cell[0];
+}
+
+inline float mix(float a, float b, float t)
+{
+    return a + (b - a) * t;
+}
+
+void integrateScalar(const Field & field, float * const p[3], float * const v[3], unsigned int i, float t, vec4 * positions, vec4 * velocities)
+{
+    const float position[3] = { p[0][i], p[1][i], p[2][i] };
+
+    float w[3];
+    const float * c = field.cells + 32 * locate(field, position, w);
+
+    for (int k = 0; k < 3; ++k)
+    {
+        const float force = mix(
+            mix(mix(c[k], c[4 + k], w[0]), mix(c[8 + k], c[12 + k], w[0]), w[1])
+        ,   mix(mix(c[16 + k], c[20 + k], w[0]), mix(c[24 + k], c[28 + k], w[0]), w[1]), w[2]);
+
+        const float x = position[k];
+        const float velocity = v[k][i];
+
+        const float g = -x * std::abs(x); // sign(-p) * (p * p)
+        const float f = (g * gravity + force) - (velocity * friction);
+
+        p[k][i] = x + (velocity * t) + (0.5f * f * t * t);
+        v[k][i] = velocity + (f * t);
+    }
+
+    positions[i] = vec4(p[0][i], p[1][i], p[2][i], 1.f);
+    velocities[i] = vec4(v[0][i], v[1][i], v[2][i], 1.f);
+}
+
+#if defined(PARTICLES_SSE)
+
+const unsigned int VectorWidth = 4;
+
+inline __m128 mix(__m128 a, __m128 b, __m128 t)
+{
+    return _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), t));
+}
+
+inline __m128 gather(const float * cells, const int * index, int offset)
+{
+    return _mm_set_ps(cells[index[3] + offset], cells[index[2] + offset], cells[index[1] + offset], cells[index[0] + offset]);
+}
+
+inline void stream(__m128 x, __m128 y, __m128 z, vec4 * target)
+{
+    __m128 w = _mm_set1_ps(1.f);
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    float * t = reinterpret_cast<float *>(target);
+    _mm_stream_ps(t, x);
+    _mm_stream_ps(t + 4, y);
+    _mm_stream_ps(t + 8, z);
+    _mm_stream_ps(t + 12, w);
+}
+
+void integrateSSE(const Field & field, float * const p[3], float * const v[3], unsigned int i, float elapsed, vec4 * positions, vec4 * velocities)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 t = _mm_set1_ps(elapsed);
+    const __m128 halfTT = _mm_set1_ps(0.5f * elapsed * elapsed);
+    const __m128 signMask = _mm_set1_ps(-0.f);
+
+    __m128 position[3];
+    __m128 weight[3];
+    __m128 cell[3];
+
+    for (int k = 0; k < 3; ++k)
+    {
+        position[k] = _mm_loadu_ps(p[k] + i);
+
+        const __m128 s = _mm_min_ps(_mm_max_ps(_mm_add_ps(_mm_mul_ps(position[k], _mm_set1_ps(field.scale[k])), _mm_set1_ps(field.bias[k])), zero), _mm_set1_ps(field.maximum[k]));
+        cell[k] = _mm_min_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(s)), _mm_set1_ps(static_cast<float>(field.cellCount[k] - 1)));
+        weight[k] = _mm_sub_ps(s, cell[k]);
+    }
+
+    // cell indices are small integers, so computing them in floating point is exact
+    const __m128 cellIndex = _mm_add_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(cell[2], _mm_set1_ps(static_cast<float>(field.cellCount[1]))), cell[1])
+        , _mm_set1_ps(static_cast<float>(field.cellCount[0]))), cell[0]);
+
+    alignas(16) int index[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(index), _mm_slli_epi32(_mm_cvttps_epi32(cellIndex), 5));
+
+    __m128 newPosition[3];
+    __m128 newVelocity[3];
+
+    for (int k = 0; k < 3; ++k)
+    {
+        const __m128 force = mix(
+            mix(mix(gather(field.cells, index, k), gather(field.cells, index, 4 + k), weight[0]), mix(gather(field.cells, index, 8 + k), gather(field.cells, index, 12 + k), weight[0]), weight[1])
+        ,   mix(mix(gather(field.cells, index, 16 + k), gather(field.cells, index, 20 + k), weight[0]), mix(gather(field.cells, index, 24 + k), gather(field.cells, index, 28 + k), weight[0]), weight[1]), weight[2]);
+
+        const __m128 x = position[k];
+        const __m128 velocity = _mm_loadu_ps(v[k] + i);
+
+        const __m128 g = _mm_xor_ps(_mm_mul_ps(x, _mm_andnot_ps(signMask, x)), signMask);
+        const __m128 f = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(g, _mm_set1_ps(gravity)), force), _mm_mul_ps(velocity, _mm_set1_ps(friction)));
+
+        newPosition[k] = _mm_add_ps(_mm_add_ps(x, _mm_mul_ps(velocity, t)), _mm_mul_ps(f, halfTT));
+        newVelocity[k] = _mm_add_ps(velocity, _mm_mul_ps(f, t));
+
+        _mm_storeu_ps(p[k] + i, newPosition[k]);
+        _mm_storeu_ps(v[k] + i, newVelocity[k]);
+    }
+
+    stream(newPosition[0], newPosition[1], newPosition[2], positions + i);
+    stream(newVelocity[0], newVelocity[1], newVelocity[2], velocities + i);
+}
+
+#endif
+
+#if defined(PARTICLES_AVX)
+
+const unsigned int VectorWidth = 8;
+
+inline __m256 mix(__m256 a, __m256 b, __m256 t)
+{
+    return _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), t));
+}
+
+#if defined(__AVX2__)
+
+inline __m256 gather(const float * cells, __m256i index, int offset)
+{
+    return _mm256_i32gather_ps(cells + offset, index, 4);
+}
+
+#else
+
+inline __m256 gather(const float * cells, const int * index, int offset)
+{
+    return _mm256_set_ps(cells[index[7] + offset], cells[index[6] + offset], cells[index[5] + offset], cells[index[4] + offset]
+        , cells[index[3] + offset], cells[index[2] + offset], cells[index[1] + offset], cells[index[0] + offset]);
+}
+
+#endif
+
+inline void stream(__m128 x, __m128 y, __m128 z, vec4 * target)
+{
+    __m128 w = _mm_set1_ps(1.f);
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    float * t = reinterpret_cast<float *>(target);
+    _mm_stream_ps(t, x);
+    _mm_stream_ps(t + 4, y);
+    _mm_stream_ps(t + 8, z);
+    _mm_stream_ps(t + 12, w);
+}
+
+inline void stream(__m256 x, __m256 y, __m256 z, vec4 * target)
+{
+    stream(_mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z), target);
+    stream(_mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1), target + 4);
+}
+
+void integrateAVX(const Field & field, float * const p[3], float * const v[3], unsigned int i, float elapsed, vec4 * positions, vec4 * velocities)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 t = _mm256_set1_ps(elapsed);
+    const __m256 halfTT = _mm256_set1_ps(0.5f * elapsed * elapsed);
+    const __m256 signMask = _mm256_set1_ps(-0.f);
+
+    __m256 position[3];
+    __m256 weight[3];
+    __m256 cell[3];
+
+    for (int k = 0; k < 3; ++k)
+    {
+        position[k] = _mm256_loadu_ps(p[k] + i);
+
+        const __m256 s = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(_mm256_mul_ps(position[k], _mm256_set1_ps(field.scale[k])), _mm256_set1_ps(field.bias[k])), zero), _mm256_set1_ps(field.maximum[k]));
+        cell[k] = _mm256_min_ps(_mm256_floor_ps(s), _mm256_set1_ps(static_cast<float>(field.cellCount[k] - 1)));
+        weight[k] = _mm256_sub_ps(s, cell[k]);
+    }
+
+    // cell indices are small integers, so computing them in floating point is exact
+    const __m256 cellIndex = _mm256_add_ps(_mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(cell[2], _mm256_set1_ps(static_cast<float>(field.cellCount[1]))), cell[1])
+        , _mm256_set1_ps(static_cast<float>(field.cellCount[0]))), cell[0]);
+
+#if defined(__AVX2__)
+    const __m256i index = _mm256_slli_epi32(_mm256_cvttps_epi32(cellIndex), 5);
+#else
+    alignas(32) int index[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(index), _mm256_cvttps_epi32(_mm256_mul_ps(cellIndex, _mm256_set1_ps(32.f))));
+#endif
+
+    __m256 newPosition[3];
+    __m256 newVelocity[3];
+
+    for (int k = 0; k < 3; ++k)
+    {
+        const __m256 force = mix(
+            mix(mix(gather(field.cells, index, k), gather(field.cells, index, 4 + k), weight[0]), mix(gather(field.cells, index, 8 + k), gather(field.cells, index, 12 + k), weight[0]), weight[1])
+        ,   mix(mix(gather(field.cells, index, 16 + k), gather(field.cells, index, 20 + k), weight[0]), mix(gather(field.cells, index, 24 + k), gather(field.cells, index, 28 + k), weight[0]), weight[1]), weight[2]);
+
+        const __m256 x = position[k];
+        const __m256 velocity = _mm256_loadu_ps(v[k] + i);
+
+        const __m256 g = _mm256_xor_ps(_mm256_mul_ps(x, _mm256_andnot_ps(signMask, x)), signMask);
+        const __m256 f = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(g, _mm256_set1_ps(gravity)), force), _mm256_mul_ps(velocity, _mm256_set1_ps(friction)));
+
+        newPosition[k] = _mm256_add_ps(_mm256_add_ps(x, _mm256_mul_ps(velocity, t)), _mm256_mul_ps(f, halfTT));
+        newVelocity[k] = _mm256_add_ps(velocity, _mm256_mul_ps(f, t));
+
+        _mm256_storeu_ps(p[k] + i, newPosition[k]);
+        _mm256_storeu_ps(v[k] + i, newVelocity[k]);
+    }
+
+    stream(newPosition[0], newPosition[1], newPosition[2], positions + i);
+    stream(newVelocity[0], newVelocity[1], newVelocity[2], velocities + i);
+}
+
+#endif
+
+#if !defined(PARTICLES_SSE) && !defined(PARTICLES_AVX)
+
+const unsigned int VectorWidth = 1;
+
+#endif
+
+}
+
+
+CPUParticles::CPUParticles(
+    const std::vector<vec4> & positions
+,   const std::vector<vec4> & velocities
+,   const Texture & forces
+,   const std::vector<vec3> & forceField
+,   const ivec3 & forceFieldSize
+,   const glowutils::Camera & camera
+,   const unsigned int threadCount)
+: AbstractParticleTechnique(positions, velocities, forces, camera)
+, m_forceField(forceField)
+, m_forceFieldSize(forceFieldSize)
+, m_threads(threadCount)
+, m_mapped(nullptr)
+, m_frame(0)
+{
+    m_fences.fill(nullptr);
+
+    // padding allows loading full vectors for the last particles
+    const size_t padded = (m_numParticles + VectorWidth - 1) / VectorWidth * VectorWidth;
+
+    for (int k = 0; k < 3; ++k)
+    {
+        m_p[k].resize(padded, 0.f);
+        m_v[k].resize(padded, 0.f);
+    }
+}
+
+CPUParticles::~CPUParticles()
+{
+    for (GLsync & fence : m_fences)
+    {
+        if (fence)
+            glDeleteSync(fence);
+    }
+}
+
+const char * CPUParticles::vectorExtension()
+{
+#if defined(PARTICLES_AVX) && defined(__AVX2__)
+    return "AVX2";
+#elif defined(PARTICLES_AVX)
+    return "AVX";
+#elif defined(PARTICLES_SSE)
+    return "SSE2";
+#else
+    return "none";
+#endif
+}
+
+void CPUParticles::initialize()
+{
+    m_drawProgram = new Program();
+    m_drawProgram->attach(
+        glowutils::createShaderFromFile(GL_VERTEX_SHADER, "data/gpu-particles/points.vert")
+    ,   glowutils::createShaderFromFile(GL_GEOMETRY_SHADER, "data/gpu-particles/points.geom")
+    ,   glowutils::createShaderFromFile(GL_FRAGMENT_SHADER, "data/gpu-particles/points.frag"));
+
+    // positions and velocities of each frame
+
+    const GLsizeiptr frameSize = static_cast<GLsizeiptr>(2 * sizeof(vec4) * m_numParticles);
+
+    m_buffer = new Buffer(GL_ARRAY_BUFFER);
+
+    if (hasExtension(GLOW_ARB_buffer_storage))
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        m_buffer->setStorage(frameSize * FrameCount, nullptr, flags);
+        m_mapped = static_cast<vec4 *>(m_buffer->mapRange(0, frameSize * FrameCount, flags));
+    }
+
+    if (!m_mapped)
+    {
+        m_buffer->setData(frameSize, nullptr, GL_STREAM_DRAW);
+        m_staging.resize(2 * m_numParticles);
+    }
+
+    m_vao = new VertexArrayObject();
+    m_vao->bind();
+
+    auto positionsBinding = m_vao->binding(0);
+    positionsBinding->setAttribute(0);
+    positionsBinding->setBuffer(m_buffer, 0, sizeof(vec4));
+    positionsBinding->setFormat(4, GL_FLOAT, GL_FALSE, 0);
+    m_vao->enable(0);
+
+    auto velocitiesBinding = m_vao->binding(1);
+    velocitiesBinding->setAttribute(1);
+    velocitiesBinding->setBuffer(m_buffer, static_cast<GLintptr>(m_numParticles * sizeof(vec4)), sizeof(vec4));
+    velocitiesBinding->setFormat(4, GL_FLOAT, GL_FALSE, 0);
+    m_vao->enable(1);
+
+    m_vao->unbind();
+
+    updateForces();
+    reset();
+
+    // setup fbo
+
+    m_fbo = new FrameBufferObject();
+
+    m_color = new Texture(GL_TEXTURE_2D);
+    m_color->setParameter(GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    m_color->setParameter(GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    m_color->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    m_color->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    m_color->setParameter(GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+
+    m_fbo->attachTexture2D(GL_COLOR_ATTACHMENT0, m_color);
+    m_fbo->setDrawBuffers({ GL_COLOR_ATTACHMENT0 });
+    m_fbo->unbind();
+
+    m_quad = new glowutils::ScreenAlignedQuad(m_color);
+    m_clear = new glowutils::ScreenAlignedQuad(
+        glowutils::createShaderFromFile(GL_FRAGMENT_SHADER, "data/gpu-particles/clear.frag"));
+}
+
+void CPUParticles::reset()
+{
+    for (unsigned int i = 0; i < m_numParticles; ++i)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            m_p[k][i] = m_positions[i][k];
+            m_v[k][i] = m_velocities[i][k];
+        }
+    }
+
+    // writes the initial state for drawing
+    step(0.f);
+}
+
+void CPUParticles::updateForces()
+{
+    const ivec3 size = m_forceFieldSize;
+    const ivec3 cellCount = max(size - 1, ivec3(1));
+
+    assert(m_forceField.size() == static_cast<size_t>(size.x * size.y * size.z));
+
+    m_cells.resize(static_cast<size_t>(cellCount.x * cellCount.y * cellCount.z));
+
+    for (int z = 0; z < cellCount.z; ++z)
+    for (int y = 0; y < cellCount.y; ++y)
+    for (int x = 0; x < cellCount.x; ++x)
+    {
+        Cell & cell = m_cells[(z * cellCount.y + y) * cellCount.x + x];
+
+        for (int corner = 0; corner < 8; ++corner)
+        {
+            const ivec3 texel = min(ivec3(x + (corner & 1), y + ((corner >> 1) & 1), z + (corner >> 2)), size - 1);
+            const vec3 & force = m_forceField[(texel.z * size.y + texel.y) * size.x + texel.x];
+
+            cell.corners[corner][0] = force.x;
+            cell.corners[corner][1] = force.y;
+            cell.corners[corner][2] = force.z;
+            cell.corners[corner][3] = 0.f;
+        }
+    }
+}
+
+vec4 * CPUParticles::frame(const unsigned int index)
+{
+    return m_mapped ? m_mapped + 2 * static_cast<std::size_t>(m_numParticles) * index : m_staging.data();
+}
+
+void CPUParticles::waitForFrame(const unsigned int index)
+{
+    GLsync & fence = m_fences[index];
+
+    if (!fence)
+        return;
+
+    GLenum status;
+    do
+    {
+        status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        CheckGLError();
+    }
+    while (status == GL_TIMEOUT_EXPIRED);
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+void CPUParticles::step(const float elapsed)
+{
+    // the frame written by the simulation may still be read by the draw calls of a previous frame
+    waitForFrame(m_frame);
+
+    vec4 * positions = frame(m_frame);
+    vec4 * velocities = positions + m_numParticles;
+
+    // ranges of full vectors, the last range also takes the remaining particles
+    const unsigned int vectorCount = (m_numParticles + VectorWidth - 1) / VectorWidth;
+    const unsigned int rangeSize = (vectorCount + m_threads.size() - 1) / m_threads.size() * VectorWidth;
+
+    m_threads.run([&](const unsigned int index)
+    {
+        const unsigned int begin = std::min(index * rangeSize, m_numParticles);
+        const unsigned int end = std::min(begin + rangeSize, m_numParticles);
+
+        if (begin < end)
+            integrate(begin, end, elapsed, positions, velocities);
+    });
+}
+
+void CPUParticles::integrate(const unsigned int begin, const unsigned int end, const float elapsed, vec4 * positions, vec4 * velocities)
+{
+    const ivec3 size = m_forceFieldSize;
+
+    Field field;
+    field.cells = &m_cells[0].corners[0][0];
+
+    for (int k = 0; k < 3; ++k)
+    {
+        field.cellCount[k] = std::max(size[k] - 1, 1);
+        field.scale[k] = 0.2f * static_cast<float>(size[k]);
+        field.bias[k] = 0.5f * static_cast<float>(size[k]) - 0.5f;
+        field.maximum[k] = static_cast<float>(size[k] - 1);
+    }
+
+    float * const p[3] = { m_p[0].data(), m_p[1].data(), m_p[2].data() };
+    float * const v[3] = { m_v[0].data(), m_v[1].data(), m_v[2].data() };
+
+    unsigned int i = begin;
+
+#if defined(PARTICLES_AVX)
+    for (; i + VectorWidth <= end; i += VectorWidth)
+        integrateAVX(field, p, v, i, elapsed, positions, velocities);
+#elif defined(PARTICLES_SSE)
+    for (; i + VectorWidth <= end; i += VectorWidth)
+        integrateSSE(field, p, v, i, elapsed, positions, velocities);
+#endif
+
+    for (; i < end; ++i)
+        integrateScalar(field, p, v, i, elapsed, positions, velocities);
+
+#if defined(PARTICLES_AVX) || defined(PARTICLES_SSE)
+    // streaming stores are weakly ordered, they have to be visible before drawing
+    _mm_sfence();
+#endif
+}
+
+void CPUParticles::draw(const float elapsed)
+{
+    const GLintptr frameOffset = static_cast<GLintptr>(2 * sizeof(vec4) * m_numParticles * (m_mapped ? m_frame : 0));
+
+    if (!m_mapped)
+        m_buffer->setData(static_cast<GLsizeiptr>(m_staging.size() * sizeof(vec4)), m_staging.data(), GL_STREAM_DRAW);
+
+    glDisable(GL_DEPTH_TEST);
+
+    m_fbo->bind();
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
+    m_clear->program()->setUniform("elapsed", elapsed);
+    m_clear->draw();
+
+
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+
+    m_drawProgram->setUniform("viewProjection", m_camera.viewProjection());
+    m_drawProgram->use();
+
+    m_vao->bind();
+    m_vao->binding(0)->setBuffer(m_buffer, frameOffset, sizeof(vec4));
+    m_vao->binding(1)->setBuffer(m_buffer, frameOffset + static_cast<GLintptr>(m_numParticles * sizeof(vec4)), sizeof(vec4));
+    m_vao->drawArrays(GL_POINTS, 0, m_numParticles);
+    m_vao->unbind();
+
+    m_drawProgram->release();
+
+    glDisable(GL_BLEND);
+
+    m_fbo->unbind();
+
+    m_quad->draw();
+
+    glEnable(GL_DEPTH_TEST);
+
+    if (m_mapped)
+    {
+        m_fences[m_frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        CheckGLError();
+
+        m_frame = (m_frame + 1) % FrameCount;
+    }
+}
+
+void CPUParticles::resize()
+{
+    m_drawProgram->setUniform("aspect", m_camera.aspectRatio());
+
+    m_color->image2D(0, GL_RGB16F, m_camera.viewport().x, m_camera.viewport().y, 0, GL_RGB, GL_FLOAT, nullptr);
+
+    m_fbo->bind();
+
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    m_fbo->unbind();
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+
+#include <glow/ref_ptr.h>
+
+#include "AbstractParticleTechnique.h"
+#include "ThreadPool.h"
+
+namespace glow
+{
+    class Program;
+    class Buffer;
+    class FrameBufferObject;
+    class Texture;
+    class VertexArrayObject;
+}
+
+namespace glowutils
+{
+    class ScreenAlignedQuad;
+}
+
+/** Simulates the particles on the CPU as a baseline for the GPU techniques.
+
+    The integration of particleMovement.inc, including the trilinear lookup of the force field,
+    runs on all cores with SSE or AVX, depending on the compiler flags (e.g., -mavx or -mavx2).
+    Particles are stored as separate components for the simulation and are streamed into a
+    persistently mapped buffer (ARB_buffer_storage) as interleaved vec4s for drawing. The buffer
+    holds three frames, each guarded by a fence, so the simulation never waits for drawing.
+    Without ARB_buffer_storage, the particles are uploaded once per frame.
+*/
+class CPUParticles : public AbstractParticleTechnique
+{
+public:
+    CPUParticles(
+        const std::vector<glm::vec4> & positions
+    ,   const std::vector<glm::vec4> & velocities
+    ,   const glow::Texture & forces
+    ,   const std::vector<glm::vec3> & forceField
+    ,   const glm::ivec3 & forceFieldSize
+    ,   const glowutils::Camera & camera
+    ,   unsigned int threadCount = 0);
+    virtual ~CPUParticles();
+
+    virtual void initialize() override;
+    virtual void reset() override;
+    virtual void updateForces() override;
+
+    virtual void step(float elapsed) override;
+    virtual void draw(float elapsed) override;
+
+    virtual void resize() override;
+
+    static const char * vectorExtension();
+
+protected:
+    static const unsigned int FrameCount = 3;
+
+    /** Cells of the force field with their eight corners, so a lookup reads contiguous memory */
+    struct Cell
+    {
+        float corners[8][4];
+    };
+
+    void integrate(unsigned int begin, unsigned int end, float elapsed, glm::vec4 * positions, glm::vec4 * velocities);
+
+    glm::vec4 * frame(unsigned int index);
+    void waitForFrame(unsigned int index);
+
+protected:
+    const std::vector<glm::vec3> & m_forceField;
+    const glm::ivec3 m_forceFieldSize;
+
+    std::vector<Cell> m_cells;
+
+    // separate components, each padded to a multiple of the vector width
+    std::array<std::vector<float>, 3> m_p;
+    std::array<std::vector<float>, 3> m_v;
+
+    ThreadPool m_threads;
+
+    glow::ref_ptr<glow::Buffer> m_buffer;
+    glm::vec4 * m_mapped;
+    std::vector<glm::vec4> m_staging; // without persistent mapping
+
+    std::array<GLsync, FrameCount> m_fences;
+    unsigned int m_frame;
+
+    glow::ref_ptr<glow::Program> m_drawProgram;
+
+    glow::ref_ptr<glow::VertexArrayObject> m_vao;
+
+    glow::ref_ptr<glow::FrameBufferObject> m_fbo;
+    glow::ref_ptr<glow::Texture> m_color;
+
+    glow::ref_ptr<glowutils::ScreenAlignedQuad> m_quad;
+    glow::ref_ptr<glowutils::ScreenAlignedQuad> m_clear;
+};
@@ -6,6 +6,7 @@
 
 #include <glowutils/Camera.h>
 #include <glowutils/File.h>
+#include <glowutils/SamplerCache.h>
 #include <glowutils/ScreenAlignedQuad.h>
 #include <glowutils/global.h>
 
@@ -34,20 +35,11 @@ FragmentShaderParticles::~FragmentShaderParticles()
 
 void FragmentShaderParticles::initialize()
 {
-    // Create textures to store the particle data
+    // Create textures to store the particle data, both are sampled through one shared sampler
     m_texPositions = new glow::Texture(GL_TEXTURE_2D);
-    m_texPositions->setParameter(GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    m_texPositions->setParameter(GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    m_texPositions->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    m_texPositions->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    m_texPositions->setParameter(GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-
     m_texVelocities = new glow::Texture(GL_TEXTURE_2D);
-    m_texVelocities->setParameter(GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    m_texVelocities->setParameter(GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    m_texVelocities->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    m_texVelocities->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    m_texVelocities->setParameter(GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+
+    m_samplers = new SamplerCache();
 
     // Fill buffers with data
     reset();
@@ -116,9 +108,13 @@ void FragmentShaderParticles::step(const float elapsed)
     // Simulate particles via fragment shader
     // Use positions and velocities textures for both input and output at the same time
 
+    const SamplerCache::Description unfiltered(GL_NEAREST, GL_CLAMP_TO_EDGE);
+
     m_fboUpdate->bind();
     m_texPositions->bindActive(GL_TEXTURE0);
+    m_samplers->bind(0, unfiltered);
     m_texVelocities->bindActive(GL_TEXTURE1);
+    m_samplers->bind(1, unfiltered);
     m_forces.bindActive(GL_TEXTURE2);
     m_quadUpdate->program()->setUniform("elapsed", elapsed);
 
@@ -146,10 +142,14 @@ void FragmentShaderParticles::draw(const float elapsed)
     // Draw particles
     glBlendFunc(GL_SRC_ALPHA, GL_ONE);
 
+    const SamplerCache::Description unfiltered(GL_NEAREST, GL_CLAMP_TO_EDGE);
+
     m_drawProgram->setUniform("viewProjection", m_camera.viewProjection());
     m_texPositions->bindActive(GL_TEXTURE0);
+    m_samplers->bind(0, unfiltered);
     m_drawProgram->setUniform("vertices", 0);
     m_texVelocities->bindActive(GL_TEXTURE1);
+    m_samplers->bind(1, unfiltered);
     m_drawProgram->setUniform("velocities", 1);
     m_drawProgram->setUniform("texWidth", m_width);
     m_drawProgram->use();
@@ -160,6 +160,10 @@ void FragmentShaderParticles::draw(const float elapsed)
 
     m_texPositions->unbind();
 
+    // the color buffer is drawn with its own parameters
+    m_samplers->unbind(0);
+    m_samplers->unbind(1);
+
     m_drawProgram->release();
 
     glDisable(GL_BLEND);
@@ -13,6 +13,7 @@ namespace glow
 }
 namespace glowutils
 {
+    class SamplerCache;
     class ScreenAlignedQuad;
 }
 
@@ -41,6 +42,7 @@ protected:
     glow::ref_ptr<glow::Texture>                m_texVelocities;
     int                                         m_width;
     int                                         m_height;
+    glow::ref_ptr<glowutils::SamplerCache>      m_samplers;
 
     // Update of particles
     glow::ref_ptr<glow::FrameBufferObject>      m_fboUpdate;
@@ -0,0 +1,88 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+: m_function(nullptr)
+, m_generation(0)
+, m_pending(0)
+, m_quit(false)
+{
+    const unsigned int count = threadCount > 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned int i = 1; i < count; ++i)
+        m_threads.push_back(std::thread(&ThreadPool::work, this, i));
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_quit = true;
+    }
+    m_start.notify_all();
+
+    for (std::thread & thread : m_threads)
+        thread.join();
+}
+
+unsigned int ThreadPool::size() const
+{
+    return static_cast<unsigned int>(m_threads.size()) + 1;
+}
+
+void ThreadPool::run(const std::function<void(unsigned int)> & function)
+{
+    if (m_threads.empty())
+    {
+        function(0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_function = &function;
+        m_pending = static_cast<unsigned int>(m_threads.size());
+        ++m_generation;
+    }
+    m_start.notify_all();
+
+    function(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_finished.wait(lock, [this]() { return m_pending == 0; });
+
+    m_function = nullptr;
+}
+
+void ThreadPool::work(const unsigned int index)
+{
+    unsigned long long generation = 0;
+
+    while (true)
+    {
+        const std::function<void(unsigned int)> * function;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_start.wait(lock, [&]() { return m_quit || m_generation != generation; });
+
+            if (m_quit)
+                return;
+
+            generation = m_generation;
+            function = m_function;
+        }
+
+        (*function)(index);
+
+        bool last;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            last = --m_pending == 0;
+        }
+
+        if (last)
+            m_finished.notify_one();
+    }
+}
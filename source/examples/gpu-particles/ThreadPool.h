@@ -0,0 +1,44 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+/** Runs a function once per thread of a fixed set of worker threads, e.g., once per simulation
+    step, without the cost of starting threads for every call.
+*/
+class ThreadPool
+{
+public:
+    /** @param threadCount threads including the calling thread, 0 uses the hardware concurrency */
+    ThreadPool(unsigned int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    unsigned int size() const;
+
+    /** Calls function(i) for every i in [0, size()), index 0 on the calling thread.
+        Returns when all calls are finished.
+    */
+    void run(const std::function<void(unsigned int)> & function);
+
+protected:
+    void work(unsigned int index);
+
+protected:
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_start;
+    std::condition_variable m_finished;
+
+    const std::function<void(unsigned int)> * m_function;
+    unsigned long long m_generation;
+    unsigned int m_pending;
+    bool m_quit;
+};
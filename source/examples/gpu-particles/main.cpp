@@ -6,6 +6,10 @@
 #include <vector>
 #include <random>
 #include <ctime>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -29,10 +33,12 @@
 #include <glowwindow/Window.h>
 #include <glowwindow/WindowEventHandler.h>
 #include <glowwindow/events.h>
+#include <glowwindow/OffscreenContext.h>
 
 #include "AbstractParticleTechnique.h"
 
 #include "ComputeShaderParticles.h"
+#include "CPUParticles.h"
 #include "FragmentShaderParticles.h"
 #include "TransformFeedbackParticles.h"
 
@@ -43,6 +49,122 @@ using namespace glowwindow;
 using namespace glm;
 
 
+namespace
+{
+
+enum ParticleTechnique
+{
+    ComputeShaderTechnique
+,   FragmentShaderTechnique
+,   TransformFeedbackTechnique
+,   CPUTechnique
+};
+
+using Techniques = std::map<ParticleTechnique, AbstractParticleTechnique *>;
+
+const ivec3 forceFieldSize(5, 5, 5); // this has center axises and allows for random rings etc..
+
+const char * techniqueName(const ParticleTechnique technique)
+{
+    switch (technique)
+    {
+    case ComputeShaderTechnique:
+        return "compute shader";
+    case FragmentShaderTechnique:
+        return "fragment shader";
+    case TransformFeedbackTechnique:
+        return "transform feedback";
+    case CPUTechnique:
+        return "cpu";
+    }
+    return "";
+}
+
+void initializeParticles(std::vector<vec4> & positions, std::vector<vec4> & velocities, const int count)
+{
+    positions.resize(count);
+    for (int i = 0; i < count; ++i)
+        positions[i] = vec4(glm::sphericalRand<float>(1.0), 1.f);
+
+    velocities.resize(count);
+    for (int i = 0; i < count; ++i)
+        velocities[i] = vec4(0.f);
+}
+
+glow::Texture * createForceTexture()
+{
+    glow::Texture * forces = new glow::Texture(GL_TEXTURE_3D);
+
+    forces->setParameter(GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    forces->setParameter(GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    forces->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    forces->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    forces->setParameter(GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+
+    return forces;
+}
+
+// initialize 3D Force Field (3D Texture)
+void resetForceField(glow::Texture * texture, std::vector<vec3> & forces)
+{
+    const ivec3 & fdim = forceFieldSize;
+
+    forces.resize(fdim.x * fdim.y * fdim.z);
+
+    srand(static_cast<unsigned int>(time(0)));
+
+    for (int z = 0; z < fdim.z; ++z)
+    for (int y = 0; y < fdim.y; ++y)
+    for (int x = 0; x < fdim.x; ++x)
+    {
+        const int i = z *  fdim.x * fdim.y + y * fdim.x + x;
+        const vec3 f(glm::sphericalRand<float>(1.0));
+
+        forces[i] = f * (1.f - length(vec3(x, y, z)) / std::sqrt(3.f));
+    }
+
+    texture->image3D(0, GL_RGB32F, fdim.x, fdim.y, fdim.z, 0, GL_RGB, GL_FLOAT, forces.data());
+}
+
+Techniques createTechniques(
+    const std::vector<vec4> & positions
+,   const std::vector<vec4> & velocities
+,   const glow::Texture & forces
+,   const std::vector<vec3> & forceField
+,   const glowutils::Camera & camera)
+{
+    // Initialize shader includes
+
+    glow::createNamedString("/glow/data/gpu-particles/particleMovement.inc", new glowutils::File("data/gpu-particles/particleMovement.inc"));
+
+    Techniques techniques;
+
+    // TODO: Implement a better way to check if a feature is supported
+    if (GLEW_ARB_compute_shader) {
+        techniques[ComputeShaderTechnique] = new ComputeShaderParticles(
+            positions, velocities, forces, camera);
+    }
+    if (GLEW_ARB_transform_feedback3) {
+        techniques[TransformFeedbackTechnique] = new TransformFeedbackParticles(
+            positions, velocities, forces, camera);
+    }
+
+    techniques[FragmentShaderTechnique] = new FragmentShaderParticles(
+        positions, velocities, forces, camera);
+
+    techniques[CPUTechnique] = new CPUParticles(
+        positions, velocities, forces, forceField, forceFieldSize, camera);
+
+    for (auto technique : techniques)
+        technique.second->initialize();
+
+    return techniques;
+}
+
+}
+
+
 class EventHandler : public ExampleWindowEventHandler, glowutils::AbstractCoordinateProvider
 {
 public:
@@ -58,13 +180,7 @@ public:
 
         // Initialize Particle Positions and Attributes
 
-        m_positions.resize(m_numParticles);
-        for (int i = 0; i < m_numParticles; ++i)
-            m_positions[i] = vec4(glm::sphericalRand<float>(1.0), 1.f);
-
-        m_velocities.resize(m_numParticles);
-        for (int i = 0; i < m_numParticles; ++i)
-            m_velocities[i] = vec4(0.f);
+        initializeParticles(m_positions, m_velocities, m_numParticles);
 
         //m_attributes.resize(m_numParticles);
         //Attribute attribute;
@@ -87,19 +203,9 @@ public:
     {
         glow::debugmessageoutput::enable();
 
-        m_forces = new glow::Texture(GL_TEXTURE_3D);
+        m_forces = createForceTexture();
+        resetForceField(m_forces, m_forceField);
 
-        m_forces->setParameter(GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        m_forces->setParameter(GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        
-        m_forces->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-        m_forces->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-        m_forces->setParameter(GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-
-        // Initialize shader includes
-
-        glow::createNamedString("/glow/data/gpu-particles/particleMovement.inc", new glowutils::File("data/gpu-particles/particleMovement.inc"));
-        
         // initialize camera
 
         m_camera = new glowutils::Camera(vec3(0.f, 1.f, -3.f));
@@ -112,22 +218,7 @@ public:
         
         // initialize techniques
 
-        // TODO: Implement a better way to check if a feature is supported
-        if (GLEW_ARB_compute_shader) {
-            m_techniques[ComputeShaderTechnique] = new ComputeShaderParticles(
-                m_positions, m_velocities, *m_forces, *m_camera);
-        }
-        if (GLEW_ARB_transform_feedback3) {
-            m_techniques[TransformFeedbackTechnique] = new TransformFeedbackParticles(
-                m_positions, m_velocities, *m_forces, *m_camera);
-        }
-
-        m_techniques[FragmentShaderTechnique] = new FragmentShaderParticles(
-            m_positions, m_velocities, *m_forces, *m_camera);
-
-        for (auto technique : m_techniques)
-            if (technique.second)
-                technique.second->initialize();
+        m_techniques = createTechniques(m_positions, m_velocities, *m_forces, m_forceField, *m_camera);
 
         reset();
     }
@@ -174,26 +265,10 @@ public:
 
     void reset(const bool particles = true)
     {
-        // initialize 3D Force Field (3D Texture)
-
-        static const ivec3 fdim(5, 5, 5); // this has center axises and allows for random rings etc..
-
-        std::vector<vec3> forces;
-        forces.resize(fdim.x * fdim.y * fdim.z);
-
-        srand(static_cast<unsigned int>(time(0)));
-
-        for (int z = 0; z < fdim.z; ++z)
-        for (int y = 0; y < fdim.y; ++y)
-        for (int x = 0; x < fdim.x; ++x)
-        {
-            const int i = z *  fdim.x * fdim.y + y * fdim.x + x;
-            const vec3 f(glm::sphericalRand<float>(1.0));
-
-            forces[i] = f * (1.f - length(vec3(x, y, z)) / std::sqrt(3.f));
-        }
+        resetForceField(m_forces, m_forceField);
 
-        m_forces->image3D(0, GL_RGB32F, fdim.x, fdim.y, fdim.z, 0, GL_RGB, GL_FLOAT, forces.data());
+        for (auto technique : m_techniques)
+            technique.second->updateForces();
 
         if (!particles)
             return;
@@ -212,13 +287,13 @@ public:
         switch (event.key())
         {
         case GLFW_KEY_C:
-            if (m_techniques[ComputeShaderTechnique]) {
+            if (m_techniques.count(ComputeShaderTechnique)) {
                 glow::debug() << "switch to compute shader technique";
                 m_technique = ComputeShaderTechnique;
             } else glow::debug() << "compute shader technique not available";
             break;
         case GLFW_KEY_T:
-            if (m_techniques[TransformFeedbackTechnique]) {
+            if (m_techniques.count(TransformFeedbackTechnique)) {
                 glow::debug() << "switch to transform feedback technique";
                 m_technique = TransformFeedbackTechnique;
             } else glow::debug() << "transform feedback technique not available";
@@ -227,6 +302,10 @@ public:
             glow::debug() << "switch to fragment shader technique";
             m_technique = FragmentShaderTechnique;
             break;
+        case GLFW_KEY_M:
+            glow::debug() << "switch to cpu technique (" << CPUParticles::vectorExtension() << ")";
+            m_technique = CPUTechnique;
+            break;
 
         case GLFW_KEY_P:       
             if (m_timer.paused())
@@ -325,16 +404,8 @@ public:
 
 
 protected:
-    
-    enum ParticleTechnique
-    {
-        ComputeShaderTechnique
-    ,   FragmentShaderTechnique
-    ,   TransformFeedbackTechnique
-    };
-
     ParticleTechnique m_technique;
-    std::map<ParticleTechnique, AbstractParticleTechnique *> m_techniques;
+    Techniques m_techniques;
 
     glowutils::Timer m_timer;
 
@@ -354,16 +425,103 @@ protected:
     };
     std::vector<Attribute> m_attributes;
 
+    std::vector<vec3> m_forceField;
     glow::ref_ptr<glow::Texture> m_forces;
 };
 
 
+/** Runs every available technique for stepCount steps in an offscreen context and reports the
+    steps per second, e.g., to compare the techniques on different hardware or without a GPU.
+*/
+int runHeadless(const int stepCount, const int particleCount)
+{
+    if (!OffscreenContext::isSupported())
+    {
+        std::cerr << "Offscreen contexts are not supported." << std::endl;
+        return 1;
+    }
+
+    ContextFormat format;
+    format.setVersion(3, 2);
+    format.setProfile(ContextFormat::CoreProfile);
+
+    OffscreenContext context;
+    if (!context.create(format, 1280, 720))
+    {
+        std::cerr << "Could not create an offscreen context." << std::endl;
+        return 1;
+    }
+
+    context.makeCurrent();
+
+    std::vector<vec4> positions;
+    std::vector<vec4> velocities;
+    initializeParticles(positions, velocities, particleCount);
+
+    std::vector<vec3> forceField;
+    glow::ref_ptr<glow::Texture> forces = createForceTexture();
+    resetForceField(forces, forceField);
+
+    glowutils::Camera camera(vec3(0.f, 1.f, -3.f));
+    camera.setViewport(context.width(), context.height());
+
+    Techniques techniques = createTechniques(positions, velocities, *forces, forceField, camera);
+
+    const float delta = 1.f / 60.f;
+
+    std::cout << particleCount << " particles, " << stepCount << " steps (" << glow::renderer()
+        << ", cpu: " << CPUParticles::vectorExtension() << ")" << std::endl;
 
+    for (auto technique : techniques)
+    {
+        technique.second->resize();
+        technique.second->reset();
+
+        // the first step may include lazy initialization, e.g., shader compilation
+        technique.second->step(delta);
+        glFinish();
+
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        for (int i = 0; i < stepCount; ++i)
+            technique.second->step(delta);
 
-/** This example shows ... .
+        // the gpu techniques only issue their steps
+        glFinish();
+
+        const auto end = std::chrono::high_resolution_clock::now();
+        const double seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start).count();
+
+        std::cout << techniqueName(technique.first) << ": " << static_cast<double>(stepCount) / seconds << " steps/s" << std::endl;
+    }
+
+    for (auto technique : techniques)
+        delete technique.second;
+
+    forces = nullptr;
+    context.doneCurrent();
+
+    return 0;
+}
+
+
+
+
+/** This example simulates particles in a force field with different techniques, switched by
+    the keys C (compute shader), T (transform feedback), F (fragment shader) and M (cpu).
+
+    Usage: gpu-particles [--headless [steps] [particles]]
 */
-int main(int /*argc*/, char* /*argv*/[])
+int main(int argc, char* argv[])
 {
+    if (argc > 1 && std::strcmp(argv[1], "--headless") == 0)
+    {
+        const int stepCount = argc > 2 ? std::max(1, std::atoi(argv[2])) : 100;
+        const int particleCount = argc > 3 ? std::max(1, std::atoi(argv[3])) : 1000000;
+
+        return runHeadless(stepCount, particleCount);
+    }
+
     ContextFormat format;
     format.setVersion(3, 2); // minimum required version is 3.2 due to particle drawing using geometry shader.
     //format.setProfile(ContextFormat::CoreProfile);
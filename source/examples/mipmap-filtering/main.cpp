@@ -87,7 +87,9 @@ public:
         m_program->setUniform("R", R);
         m_program->setUniform("S", m_scale);
 
+        m_texture->bindActive(GL_TEXTURE0);
         m_quad->draw();
+        m_texture->unbindActive(GL_TEXTURE0);
     }
 
     virtual void idle(Window & window) override
@@ -167,8 +169,8 @@ void EventHandler::createAndSetupTexture()
     if (!raw.isValid())
         return;
 
-    m_texture->compressedImage2D(0, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, glm::ivec2(256, 256), 0, static_cast<GLsizei>(raw.size()), raw.data());   
-    glGenerateMipmap(GL_TEXTURE_2D);
+    m_texture->compressedImage2D(0, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, glm::ivec2(256, 256), 0, static_cast<GLsizei>(raw.size()), raw.data());
+    m_texture->generateMipmap();
 }
 
 void EventHandler::createAndSetupGeometry()
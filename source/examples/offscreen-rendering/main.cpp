@@ -0,0 +1,112 @@
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/Error.h>
+#include <glow/global.h>
+#include <glow/Program.h>
+#include <glow/Shader.h>
+#include <glow/ref_ptr.h>
+
+#include <glowutils/ScreenAlignedQuad.h>
+
+#include <glowwindow/ContextFormat.h>
+#include <glowwindow/OffscreenContext.h>
+
+using namespace glowwindow;
+
+namespace
+{
+
+const char * fragmentShaderSource = R"(
+#version 140
+#extension GL_ARB_explicit_attrib_location : require
+
+uniform float frame;
+
+layout (location = 0) out vec4 fragColor;
+
+in vec2 v_uv;
+
+void main()
+{
+    fragColor = vec4(fract(v_uv * 8.0 + frame * 0.01), 0.5, 1.0);
+}
+)";
+
+void render(const ContextFormat & format, int index, int frameCount, int width, int height)
+{
+    OffscreenContext context;
+    if (!context.create(format, width, height))
+        return;
+
+    context.makeCurrent();
+
+    glViewport(0, 0, width, height);
+    CheckGLError();
+
+    glow::ref_ptr<glowutils::ScreenAlignedQuad> quad = new glowutils::ScreenAlignedQuad(
+        glow::Shader::fromString(GL_FRAGMENT_SHADER, fragmentShaderSource));
+
+    std::vector<unsigned char> image(static_cast<size_t>(width * height * 4));
+
+    const auto start = std::chrono::high_resolution_clock::now();
+
+    for (int frame = 0; frame < frameCount; ++frame)
+    {
+        quad->program()->setUniform("frame", static_cast<float>(frame));
+        quad->draw();
+
+        // a batch renderer would store or stream the image here
+        glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, image.data());
+        CheckGLError();
+
+        context.swap();
+    }
+
+    const auto end = std::chrono::high_resolution_clock::now();
+    const double seconds = std::chrono::duration_cast<std::chrono::duration<double>>(end - start).count();
+
+    std::cout << "context " << index << ": " << frameCount << " frames in " << seconds << "s ("
+        << static_cast<double>(frameCount) / seconds << " fps, " << glow::renderer() << ")" << std::endl;
+
+    quad = nullptr;
+    context.doneCurrent();
+}
+
+}
+
+/** This example renders without window and window system using offscreen contexts (EGL),
+    e.g., for batch rendering on servers. Each thread renders into its own context.
+
+    Usage: offscreen-rendering [contexts] [frames]
+*/
+int main(int argc, char* argv[])
+{
+    const int contextCount = argc > 1 ? std::max(1, std::atoi(argv[1])) : 2;
+    const int frameCount = argc > 2 ? std::max(1, std::atoi(argv[2])) : 100;
+
+    if (!OffscreenContext::isSupported())
+    {
+        std::cerr << "Offscreen contexts are not supported." << std::endl;
+        return 1;
+    }
+
+    ContextFormat format;
+    format.setVersion(3, 2);
+    format.setProfile(ContextFormat::CoreProfile);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < contextCount; ++i)
+        threads.emplace_back(render, format, i, frameCount, 640, 480);
+
+    for (std::thread & thread : threads)
+        thread.join();
+
+    return 0;
+}
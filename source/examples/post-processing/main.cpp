@@ -17,7 +17,6 @@
 #include <glow/logging.h>
 #include <glow/VertexArrayObject.h>
 #include <glow/FrameBufferObject.h>
-#include <glow/RenderBufferObject.h>
 #include <glow/Texture.h>
 #include <glow/debugmessageoutput.h>
 
@@ -32,6 +31,8 @@
 #include <glowutils/Timer.h>
 #include <glowutils/global.h>
 #include <glowutils/StringTemplate.h>
+#include <glowutils/SamplerCache.h>
+#include <glowutils/RenderTargetPool.h>
 
 #include <glowwindow/ContextFormat.h>
 #include <glowwindow/Context.h>
@@ -49,7 +50,8 @@ class EventHandler : public ExampleWindowEventHandler
 {
 public:
 	EventHandler()
-    :   m_camera(vec3(0.f, 1.f, 4.0f))
+    :   m_depthFormat(GL_DEPTH_COMPONENT24)
+    ,   m_camera(vec3(0.f, 1.f, 4.0f))
 	{
 	}
 
@@ -68,30 +70,11 @@ public:
 		glClearColor(1.0f, 1.0f, 1.0f, 0.f);
         CheckGLError();
 
-		m_fbo = new glow::FrameBufferObject();
+		// the G-buffer is acquired from the pool per frame, so resizing allocates nothing up front
+		m_targets = new glowutils::RenderTargetPool();
 
-		m_normal = new glow::Texture(GL_TEXTURE_2D);
-		m_normal->setParameter(GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		m_normal->setParameter(GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		m_normal->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		m_normal->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		m_normal->setParameter(GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-
-		m_geom = new glow::Texture(GL_TEXTURE_2D);
-		m_geom->setParameter(GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		m_geom->setParameter(GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		m_geom->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-		m_geom->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-		m_geom->setParameter(GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-
-		m_depth = new glow::RenderBufferObject();
-
-		m_fbo->attachTexture2D(GL_COLOR_ATTACHMENT0, m_normal);
-		m_fbo->attachTexture2D(GL_COLOR_ATTACHMENT1, m_geom);
-		m_fbo->attachRenderBuffer(GL_DEPTH_ATTACHMENT, m_depth);
-
-		// ToDo: this could be done automatically by default..
-		m_fbo->setDrawBuffers({ GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 });
+		// both G-buffer textures are sampled through one shared sampler
+		m_samplers = new glowutils::SamplerCache();
 
                 
         glowutils::StringTemplate* sphereVertexShader = new glowutils::StringTemplate(new glowutils::File("data/post-processing/sphere.vert"));
@@ -140,11 +123,8 @@ public:
 
         m_camera.setViewport(width, height);
 
-		m_normal->image2D(0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, nullptr);
-		m_geom->image2D(0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, nullptr);
-
         int result = glow::FrameBufferObject::defaultFBO()->getAttachmentParameter(GL_DEPTH, GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE);
-        m_depth->storage(result == 16 ? GL_DEPTH_COMPONENT16 : GL_DEPTH_COMPONENT, width, height);
+        m_depthFormat = result == 16 ? GL_DEPTH_COMPONENT16 : GL_DEPTH_COMPONENT24;
 	}
 
     virtual void paintEvent(PaintEvent &) override
@@ -157,7 +137,14 @@ public:
         m_phong->setUniform("transformi", m_camera.viewProjectionInverted());
 
 
-		m_fbo->bind();
+        m_targets->nextFrame();
+
+        // textures of former sizes are deleted by the pool once they are unused for a few frames
+        const glowutils::RenderTargetPool::Target gbuffer = m_targets->acquire(m_camera.viewport(), { GL_RGBA32F, GL_RGBA32F, m_depthFormat });
+        glow::Texture * normal = gbuffer.textures[0];
+        glow::Texture * geom = gbuffer.textures[1];
+
+		gbuffer.fbo->bind();
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         CheckGLError();
 
@@ -165,7 +152,7 @@ public:
 		m_icosahedron->draw();
 		m_sphere->release();
 
-		m_fbo->unbind();
+		gbuffer.fbo->unbind();
 
 		glDisable(GL_DEPTH_TEST);
         CheckGLError();
@@ -174,13 +161,20 @@ public:
 
 		m_phong->setUniform("normal", 0);
 		m_phong->setUniform("geom", 1);
-        m_normal->bindActive(GL_TEXTURE0);
-        m_geom->bindActive(GL_TEXTURE1);
+
+        const glowutils::SamplerCache::Description linear(GL_LINEAR, GL_CLAMP_TO_EDGE);
+
+        m_samplers->bind(0, linear);
+        normal->bindActive(GL_TEXTURE0);
+        m_samplers->bind(1, linear);
+        geom->bindActive(GL_TEXTURE1);
 
 		m_quad->draw();
 
-        m_geom->unbindActive(GL_TEXTURE1);
-        m_normal->unbindActive(GL_TEXTURE0);
+        geom->unbindActive(GL_TEXTURE1);
+        normal->unbindActive(GL_TEXTURE0);
+        m_samplers->unbind(1);
+        m_samplers->unbind(0);
 
 		glEnable(GL_DEPTH_TEST);
         CheckGLError();
@@ -190,13 +184,14 @@ public:
 		// use the fbo's depth buffer as default depth buffer ;)
 		// Note: this requires the depth formats to match exactly.
 
-		glBindFramebuffer(GL_READ_FRAMEBUFFER, m_fbo->id());
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, gbuffer.fbo->id());
 		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
         glBlitFramebuffer(0, 0, m_camera.viewport().x, m_camera.viewport().y, 0, 0, m_camera.viewport().x, m_camera.viewport().y,
 			GL_DEPTH_BUFFER_BIT, GL_NEAREST);
 
 		m_agrid->draw();
-		
+
+        m_targets->release(gbuffer);
 	}
     virtual void idle(Window & window) override
     {
@@ -222,10 +217,10 @@ protected:
 
     glow::ref_ptr<glowutils::ScreenAlignedQuad> m_quad;
 
-    glow::ref_ptr<glow::FrameBufferObject> m_fbo;
-    glow::ref_ptr<glow::Texture> m_normal;
-    glow::ref_ptr<glow::Texture> m_geom;
-    glow::ref_ptr<glow::RenderBufferObject> m_depth;
+    glow::ref_ptr<glowutils::RenderTargetPool> m_targets;
+    GLenum m_depthFormat;
+
+    glow::ref_ptr<glowutils::SamplerCache> m_samplers;
 
     glowutils::Camera m_camera;
     glowutils::Timer m_time;
@@ -237,7 +232,7 @@ protected:
 int main(int /*argc*/, char* /*argv*/[])
 {
 	ContextFormat format;
-    format.setVersion(3, 0);
+    format.setVersion(3, 3);
     format.setDepthBufferSize(16);
 
 	Window window;
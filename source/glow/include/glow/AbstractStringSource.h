@@ -6,6 +6,7 @@
 #include <glow/glow.h>
 #include <glow/Referenced.h>
 #include <glow/Changeable.h>
+#include <glow/StringChunk.h>
 
 namespace glow
 {
@@ -15,8 +16,11 @@ class CompositeStringSource;
 /** \brief Superclass for all types of static and dynamic strings, e.g. for the use as Shader code.
  *
  * The current string can be queried using string().
+ * The content can also be queried as a list of immutable, shared chunks using chunks(),
+ * which avoids copying the string data, and hashed using hash().
  *
  * \see Shader
+ * \see StringChunk
  */
 class GLOW_API AbstractStringSource : public Referenced, public Changeable
 {
@@ -26,7 +30,14 @@ public:
     std::vector<AbstractStringSource*> flatten() const;
     virtual void flattenInto(std::vector<AbstractStringSource*>& vector) const;
 
+    std::vector<StringChunk> chunks() const;
+    virtual void chunksInto(std::vector<StringChunk>& vector) const;
+
+    virtual std::size_t hash() const;
+
     virtual std::string shortInfo() const;
+protected:
+    static std::size_t combinedHash(const std::vector<StringChunk> & chunks);
 };
 
 } // namespace glow
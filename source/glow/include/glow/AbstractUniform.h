@@ -68,8 +68,6 @@ protected:
 protected:
     LocationIdentity m_identity;
 	std::set<Program *> m_programs;
-    bool m_directStateAccess;
-    bool m_cacheDSA;
 };
 
 } // namespace glow
@@ -254,11 +254,6 @@ protected:
      */
     GLenum m_target;
 
-    /**
-      * Cached boolean whether direct state access is available or not
-      */
-    bool m_directStateAccess; // TODO: move to per context cache
-
     /**
      * Wraps the OpenGL function glGenBuffers.
      * @return id of a newly created OpenGL buffer
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glow/glow.h>
+
+namespace glow
+{
+
+class Changeable;
+class ChangeListener;
+
+/** \brief Defers change propagation of Changeables during its lifetime and propagates each change once.
+
+    Without a batch, Changeable::changed() notifies all listeners immediately, which forward the
+    change to their listeners and so on. If several sources change, e.g., files sharing an include,
+    listeners reachable from more than one of them are notified (and update) once per path.
+
+    Within a batch, changed() only records the Changeable. When the outermost batch of the thread
+    ends, all listeners reachable from the recorded Changeables are notified in topological order,
+    i.e., after all listeners they depend on, once per changed subject. Changes signaled by
+    notified listeners are recorded as well, so a listener depending on several changed
+    Changeables signals a single change to its dependents. Listeners that do not signal a change
+    do not cause notifications of their dependents.
+
+    \code{.cpp}
+
+        {
+            ChangeBatch batch;
+            for (File * file : modified)
+                file->reload();
+        } // each shader and program depending on any of the files is updated once
+
+    \endcode
+
+    Listeners that are Changeables themselves have to return themselves in
+    ChangeListener::propagatesTo() to be ordered before their dependents.
+    Batches are per thread, changes in other threads are not deferred.
+ */
+class GLOW_API ChangeBatch
+{
+    friend class Changeable;
+    friend class ChangeListener;
+
+public:
+    ChangeBatch();
+    ~ChangeBatch();
+
+    ChangeBatch(const ChangeBatch &) = delete;
+    ChangeBatch & operator=(const ChangeBatch &) = delete;
+
+    /** \return true if a batch is active in the calling thread
+     */
+    static bool isActive();
+
+protected:
+    static bool defer(Changeable * changeable);
+    static void forget(Changeable * changeable);
+    static void forget(ChangeListener * listener);
+
+    void propagate();
+    void order(const std::vector<Changeable *> & sources);
+
+protected:
+    struct Node
+    {
+        std::vector<Changeable *> subjects; ///< subjects within the graph
+        Changeable * propagatesTo;
+        unsigned int pendingListeners; ///< listeners propagating to the subjects that are not ordered yet
+    };
+
+    std::vector<Changeable *> m_changed;
+    std::unordered_set<Changeable *> m_changedSet;
+
+    // graph of the current propagation
+    std::unordered_map<ChangeListener *, Node> m_nodes;
+    std::unordered_set<Changeable *> m_reached;
+    std::unordered_map<Changeable *, std::vector<ChangeListener *>> m_dependents; ///< listeners having the Changeable as subject
+    std::unordered_map<Changeable *, std::vector<ChangeListener *>> m_propagators; ///< listeners whose propagatesTo() is the Changeable
+    std::vector<ChangeListener *> m_order;
+};
+
+} // namespace glow
@@ -13,17 +13,25 @@ class Changeable;
     
     If a Changeable this ChangeListener is registered on signals a change, the 
     notifyChanged() method is called. This class implements the observer pattern.
+    Listeners that signal changes themselves on notification return their Changeable in
+    propagatesTo(), so a ChangeBatch notifies them before their dependents.
     
     \see Changeable
  */
 class GLOW_API ChangeListener
 {
     friend class Changeable;
+    friend class ChangeBatch;
 public:
     virtual ~ChangeListener();
 
     virtual void notifyChanged(Changeable * sender);
 
+protected:
+    /** \return the Changeable signaling changes in response to notifyChanged(), nullptr by default
+     */
+    virtual Changeable * propagatesTo();
+
 private:
     std::set<Changeable*> m_subjects;
 
@@ -13,12 +13,16 @@ class ChangeListener;
     
     It implements the observer pattern. Listeners to the subclass change can be
     registered using registerListener() and deregistered using deregisterListener().
+    Within a ChangeBatch, changes are propagated when the batch ends.
     
     \see ChangeListener
  */
 class GLOW_API Changeable
 {
+    friend class ChangeBatch;
 public:
+    ~Changeable();
+
 	void changed();
 
 	void registerListener(ChangeListener * listener);
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <glow/glow.h>
+#include <glow/FunctionCall.h>
+
+namespace glow
+{
+
+class Buffer;
+class FrameBufferObject;
+class Program;
+class Texture;
+class VertexArrayObject;
+
+/** \brief Records GL commands without a context for later execution in the context's thread.
+
+    Commands are encoded as plain data into a linear buffer that keeps its memory across
+    reset(), so a list per worker thread allocates only until it reached its working size.
+    Objects are referenced by their GL names, which are read when recording, hence recording
+    requires no context and lists can be recorded in parallel, one thread per list.
+    Objects have to outlive the execution of all lists referencing them. Binding nullptr unbinds,
+    for textures the GL_TEXTURE_2D binding of the unit.
+
+    \code{.cpp}
+
+        // worker threads, e.g., one list per culled range of the scene
+        list.reset();
+        list.useProgram(program);
+        for (const Drawable & drawable : visible)
+        {
+            list.setUniform(modelLocation, drawable.model);
+            list.bindVertexArray(drawable.vao);
+            list.drawElements(GL_TRIANGLES, drawable.count, GL_UNSIGNED_INT);
+        }
+
+        // context thread, in order
+        for (const CommandList & list : lists)
+            list.execute();
+
+    \endcode
+
+    Uniforms are set by location for the program in use at execution, so locations have to be
+    queried beforehand (e.g., Program::getUniformLocation()). Arbitrary functions can be
+    deferred with call(), like FunctionCall is used for StateSetting.
+ */
+class GLOW_API CommandList
+{
+public:
+    CommandList();
+    ~CommandList();
+
+    CommandList(const CommandList &) = delete;
+    CommandList & operator=(const CommandList &) = delete;
+
+    void useProgram(const Program * program);
+    void bindVertexArray(const VertexArrayObject * vao);
+    void bindBuffer(GLenum target, const Buffer * buffer);
+    void bindBufferBase(GLenum target, GLuint index, const Buffer * buffer);
+    void bindBufferRange(GLenum target, GLuint index, const Buffer * buffer, GLintptr offset, GLsizeiptr size);
+    void bindTexture(GLuint unit, const Texture * texture);
+    void bindFramebuffer(GLenum target, const FrameBufferObject * fbo);
+
+    void setUniform(GLint location, GLint value);
+    void setUniform(GLint location, GLuint value);
+    void setUniform(GLint location, GLfloat value);
+    void setUniform(GLint location, const glm::vec2 & value);
+    void setUniform(GLint location, const glm::vec3 & value);
+    void setUniform(GLint location, const glm::vec4 & value);
+    void setUniform(GLint location, const glm::ivec2 & value);
+    void setUniform(GLint location, const glm::ivec3 & value);
+    void setUniform(GLint location, const glm::ivec4 & value);
+    void setUniform(GLint location, const glm::mat3 & value);
+    void setUniform(GLint location, const glm::mat4 & value);
+
+    /** Sets count values of the given uniform type (e.g., GL_FLOAT_VEC3) from data, which is copied.
+     Supports float, int and unsigned int scalars and vectors as well as mat3 and mat4.
+     */
+    void setUniform(GLint location, GLenum type, GLsizei count, const void * data);
+
+    void enable(GLenum capability);
+    void disable(GLenum capability);
+    void blendFunc(GLenum sourceFactor, GLenum destinationFactor);
+    void depthFunc(GLenum function);
+    void depthMask(GLboolean flag);
+    void cullFace(GLenum mode);
+    void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+    void clearColor(const glm::vec4 & color);
+    void clear(GLbitfield mask);
+
+    void drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount = 1);
+    void drawElements(GLenum mode, GLsizei count, GLenum type, GLintptr offset = 0, GLsizei instanceCount = 1, GLint baseVertex = 0);
+
+    /** Defers the call, taking ownership of functionCall. */
+    void call(AbstractFunctionCall * functionCall);
+
+    template <typename... Arguments>
+    void call(void (*function)(Arguments...), Arguments... arguments);
+
+    /** Executes all commands in order of recording, requires a current context. */
+    void execute() const;
+
+    /** Removes all commands, keeping the allocated memory. */
+    void reset();
+
+    bool isEmpty() const;
+    unsigned int commandCount() const;
+
+    /** \return size of the encoded commands in bytes */
+    std::size_t size() const;
+    /** \return allocated size for encoded commands in bytes */
+    std::size_t capacity() const;
+
+protected:
+    void * append(unsigned int opcode, std::size_t size);
+
+    template <typename Command>
+    void append(unsigned int opcode, const Command & command);
+
+protected:
+    std::vector<unsigned char> m_data;
+    std::vector<std::unique_ptr<AbstractFunctionCall>> m_calls;
+    unsigned int m_commandCount;
+};
+
+} // namespace glow
+
+#include <glow/CommandList.hpp>
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <glow/CommandList.h>
+
+namespace glow
+{
+
+template <typename... Arguments>
+void CommandList::call(void (*function)(Arguments...), Arguments... arguments)
+{
+    call(new FunctionCall<Arguments...>(function, arguments...));
+}
+
+} // namespace glow
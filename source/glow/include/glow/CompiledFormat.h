@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <glow/glow.h>
+
+namespace glow
+{
+
+/** \brief A format string in formatString syntax, parsed once into a list of tokens.
+
+    Rendering appends straight into a string that can be reused across calls. Numbers,
+    characters, strings, and pointers are converted without iostreams; other types are
+    written using their operator<< on a std::ostream.
+
+    The output equals the one of streamprintf for the same format and arguments, including
+    fill character and precision carrying over to subsequent specifiers.
+
+    \code{.cpp}
+
+        static const glow::CompiledFormat format("frame %; took %f.2; ms");
+
+        std::string line;
+        format.append(line, frame, milliseconds);
+
+    \endcode
+
+    Formats passed to formatString are compiled on first use and cached by their address,
+    see appendFormatted().
+
+    \see formatString
+ */
+class GLOW_API CompiledFormat
+{
+public:
+    struct GLOW_API Specifier
+    {
+        enum Adjustment { DefaultAdjustment, Left, Right, Internal };
+        enum FloatField { DefaultFloatField, Fixed, Scientific };
+        enum Base { Decimal, Octal, Hexadecimal };
+
+        Specifier();
+
+        Adjustment adjustment;
+        bool boolAlpha;
+        bool showPos;
+        bool showBase;
+        bool upperCase;
+        bool showPoint;
+        FloatField floatField;
+        char fill; // 0 keeps the current fill character
+        int width;
+        int precision; // 0 keeps the current precision
+        Base base;
+    };
+
+    /** \brief A type-erased argument, constructed implicitly from the values to render.
+     */
+    class GLOW_API Argument
+    {
+    public:
+        enum Kind { Signed, Unsigned, Boolean, Character, Floating, LongFloating, String, Pointer, Custom };
+
+        Argument(bool value);
+        Argument(char value);
+        Argument(signed char value);
+        Argument(unsigned char value);
+        Argument(short value);
+        Argument(unsigned short value);
+        Argument(int value);
+        Argument(unsigned int value);
+        Argument(long value);
+        Argument(unsigned long value);
+        Argument(long long value);
+        Argument(unsigned long long value);
+        Argument(float value);
+        Argument(double value);
+        Argument(long double value);
+        Argument(const char * value);
+        Argument(const std::string & value);
+        Argument(const void * value);
+
+        template <typename T>
+        Argument(const T & value);
+
+        Kind kind;
+
+        long long integer;
+        unsigned long long bits; // integer converted to the unsigned type of its size, for octal and hexadecimal
+        long double floating;
+        const char * string;
+        std::size_t length;
+        const void * pointer;
+        void (*write)(std::ostream & stream, const void * value);
+
+    protected:
+        void setSigned(long long value, unsigned long long bits);
+        void setUnsigned(unsigned long long value);
+
+        template <typename T>
+        static void writeValue(std::ostream & stream, const void * value);
+    };
+
+public:
+    CompiledFormat(const char * format);
+    CompiledFormat(const std::string & format);
+
+    const std::string & source() const;
+    std::size_t specifierCount() const;
+    const Specifier & specifier(std::size_t index) const;
+
+    template <typename... Arguments>
+    void append(std::string & buffer, Arguments... arguments) const;
+    void appendArguments(std::string & buffer, const Argument * arguments, std::size_t count) const;
+
+    template <typename... Arguments>
+    std::string operator()(Arguments... arguments) const;
+
+    /** Appends using the cached compilation of format, compiling it on first use.
+        Formats are cached by address and content, formats that changed since caching are compiled per call.
+     */
+    static void appendCached(std::string & buffer, const char * format, const Argument * arguments, std::size_t count);
+
+    static std::size_t cacheSize();
+
+protected:
+    struct Token
+    {
+        std::size_t literalBegin;
+        std::size_t literalEnd;
+        std::size_t sourceEnd;
+        Specifier specifier;
+    };
+
+    void compile();
+
+    static void parseSpecifier(const char *& format, Specifier & specifier);
+
+protected:
+    std::string m_source;
+    std::string m_literals;
+    std::vector<Token> m_tokens;
+    std::size_t m_tailBegin;
+};
+
+} // namespace glow
+
+#include <glow/CompiledFormat.hpp>
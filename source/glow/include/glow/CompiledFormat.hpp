@@ -0,0 +1,48 @@
+#pragma once
+
+#include <glow/CompiledFormat.h>
+
+namespace glow
+{
+
+template <typename T>
+CompiledFormat::Argument::Argument(const T & value)
+: kind(Custom)
+, integer(0)
+, bits(0)
+, floating(0)
+, string(nullptr)
+, length(0)
+, pointer(&value)
+, write(&writeValue<T>)
+{
+}
+
+template <typename T>
+void CompiledFormat::Argument::writeValue(std::ostream & stream, const void * value)
+{
+    stream << *static_cast<const T *>(value);
+}
+
+template <typename... Arguments>
+void CompiledFormat::append(std::string & buffer, Arguments... arguments) const
+{
+    const Argument converted[] = { Argument(arguments)... };
+    appendArguments(buffer, converted, sizeof...(Arguments));
+}
+
+template <>
+inline void CompiledFormat::append<>(std::string & buffer) const
+{
+    appendArguments(buffer, nullptr, 0);
+}
+
+template <typename... Arguments>
+std::string CompiledFormat::operator()(Arguments... arguments) const
+{
+    std::string buffer;
+    append(buffer, arguments...);
+    return buffer;
+}
+
+} // namespace glow
@@ -7,10 +7,17 @@
 #include <glow/ref_ptr.h>
 #include <glow/AbstractStringSource.h>
 #include <glow/ChangeListener.h>
+#include <glow/StringChunk.h>
 
 namespace glow
 {
 
+/** \brief Concatenation of multiple string sources.
+
+    The chunks of all sources are gathered lazily after a change of any source.
+    Since chunks are shared, this only copies references and never the string data itself.
+    The combined hash is updated along with the chunks.
+ */
 class GLOW_API CompositeStringSource : public AbstractStringSource, protected ChangeListener
 {
 public:
@@ -24,15 +31,19 @@ public:
     virtual std::string string() const override;
     virtual std::vector<std::string> strings() const override;
     virtual void flattenInto(std::vector<AbstractStringSource*>& vector) const override;
+    virtual void chunksInto(std::vector<StringChunk>& vector) const override;
+    virtual std::size_t hash() const override;
 
     virtual std::string shortInfo() const override;
 protected:
     virtual void notifyChanged(Changeable * changeable) override;
+    virtual Changeable * propagatesTo() override;
     void update() const;
 protected:
     std::vector<ref_ptr<AbstractStringSource>> m_sources;
     mutable bool m_dirty;
-    mutable std::vector<std::string> m_strings;
+    mutable std::vector<StringChunk> m_chunks;
+    mutable std::size_t m_hash;
 };
 
 } // namespace glow
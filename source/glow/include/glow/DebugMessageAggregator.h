@@ -0,0 +1,168 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/glow.h>
+
+namespace glow
+{
+
+class DebugMessage;
+
+/** \brief Aggregates debug messages without formatting or logging them on the GL thread.
+
+    Messages are deduplicated by (source, type, id): every distinct message is counted and its
+    first and last occurrence are recorded. Only the first occurrence and at most one repeat per
+    repeatInterval() are copied (raw, truncated to MaxMessageLength characters) into a lock-free
+    queue. A background thread, started by start(), or flush() turns queued messages into
+    DebugMessages and passes them to the handler, along with the number of repeats suppressed
+    since the last report of the same message.
+
+    The handling on the calling thread is lock-free and does not allocate, so debug output can
+    stay enabled even with drivers that emit per-draw performance warnings. Messages that arrive
+    while the queue is full are counted, but dropped.
+
+    \code{.cpp}
+
+        DebugMessageAggregator aggregator;
+        aggregator.start();
+
+        debugmessageoutput::enable(false, false);
+        debugmessageoutput::setAggregator(&aggregator);
+
+        // ... on shutdown
+        debugmessageoutput::setAggregator(nullptr);
+        aggregator.printReport();
+
+    \endcode
+
+    By default, errors are still handled by the callbacks of debugmessageoutput as well.
+
+    \see debugmessageoutput::setAggregator
+ */
+class GLOW_API DebugMessageAggregator
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /** Called for reported messages with the number of suppressed repeats since the last report.
+    */
+    using Handler = std::function<void(const DebugMessage & message, unsigned long long suppressedCount)>;
+
+    static const std::size_t MaxMessageLength = 512;
+
+    struct Summary
+    {
+        GLenum source;
+        GLenum type;
+        GLuint id;
+        GLenum severity;
+        unsigned long long count;
+        Clock::time_point first;
+        Clock::time_point last;
+        std::string message; ///< text of the first reported occurrence, empty if not yet reported
+    };
+
+public:
+    DebugMessageAggregator(std::size_t queueCapacity = 1024, std::size_t maxDistinctMessages = 1024);
+    ~DebugMessageAggregator();
+
+    DebugMessageAggregator(const DebugMessageAggregator &) = delete;
+    DebugMessageAggregator & operator=(const DebugMessageAggregator &) = delete;
+
+    /** The default handler logs errors as warnings and all other messages as debug messages.
+    */
+    void setHandler(Handler handler);
+
+    Clock::duration repeatInterval() const;
+    void setRepeatInterval(Clock::duration interval);
+
+    bool forwardsErrors() const;
+    void setForwardErrors(bool forward);
+
+    /** Records a message, thread-safe and lock-free.
+        \return false if the message should additionally be handled by the regular callbacks
+    */
+    bool aggregate(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const char * message);
+
+    /** Starts the background thread that reports queued messages. */
+    void start();
+    /** Stops the background thread after reporting all queued messages. */
+    void stop();
+    bool isRunning() const;
+
+    /** Reports all queued messages on the calling thread.
+    */
+    void flush();
+
+    unsigned long long messageCount() const;
+    unsigned long long reportedCount() const;
+    unsigned long long droppedCount() const;
+    std::size_t distinctCount() const;
+
+    /** \return all distinct messages, most frequent first
+    */
+    std::vector<Summary> summary() const;
+
+    std::string report() const;
+    void printReport() const;
+
+protected:
+    struct Entry;
+    struct Record;
+    struct Cell;
+
+    Entry * entry(unsigned long long key);
+
+    bool push(const Record & record);
+    bool pop(Record & record);
+
+    void report(const Record & record);
+    void run();
+
+    static unsigned long long key(GLenum source, GLenum type, GLuint id);
+    static void defaultHandler(const DebugMessage & message, unsigned long long suppressedCount);
+
+protected:
+    std::unique_ptr<Entry[]> m_entries;
+    std::size_t m_entryMask;
+
+    std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_cellMask;
+    std::atomic<std::size_t> m_enqueuePosition;
+    std::atomic<std::size_t> m_dequeuePosition;
+
+    std::atomic<Clock::rep> m_repeatInterval;
+    std::atomic<bool> m_forwardErrors;
+
+    std::atomic<unsigned long long> m_messageCount;
+    std::atomic<unsigned long long> m_reportedCount;
+    std::atomic<unsigned long long> m_droppedCount;
+    std::atomic<std::size_t> m_distinctCount;
+
+    // consumer side: handler and texts of reported messages
+
+    std::mutex m_reportMutex;
+    Handler m_handler;
+    std::unordered_map<unsigned long long, std::string> m_texts;
+    mutable std::mutex m_textsMutex;
+
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+};
+
+} // namespace glow
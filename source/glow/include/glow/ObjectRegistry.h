@@ -11,7 +11,8 @@ class Object;
 
 /** \brief Tracks all wrapped OpenGL objects in glow.
     
-    To obtain all wrapped objects use objects().
+    To obtain all wrapped objects use objects(), which returns a snapshot, since objects
+    may be created and deleted concurrently by other threads (e.g., using shared contexts).
     The other methods are not meant to be called by the user.
 */
 class GLOW_API ObjectRegistry
@@ -20,7 +21,7 @@ private:
 	ObjectRegistry();
 
 public:
-	static const std::set<Object *> & objects();
+	static std::set<Object *> objects();
 
 	static void registerObject(Object * object);
 	static void deregisterObject(Object * object);
@@ -12,6 +12,8 @@
 #include <glow/ref_ptr.h>
 #include <glow/LocationIdentity.h>
 #include <glow/UniformBlock.h>
+#include <glow/UniformName.h>
+#include <glow/UniformNameTable.h>
 
 namespace glow
 {
@@ -125,12 +127,25 @@ public:
     template<typename T>
     void setUniform(GLint location, const T & value);
 
+    /** Sets the value of the uniform named <name>, using the precomputed hash of the name for
+        the lookup. On repeated access with the same type, no RTTI based cast is performed in
+        release builds.
+    */
+    template<typename T>
+    void setUniform(const UniformName & name, const T & value);
+    template<typename T, std::size_t N>
+    void setUniform(const char (&name)[N], const T & value);
+
 	/** Retrieves the existing or creates a new typed uniform, named <name>.
 	*/
 	template<typename T>
 	Uniform<T> * getUniform(const std::string & name);
     template<typename T>
     Uniform<T> * getUniform(GLint location);
+    template<typename T>
+    Uniform<T> * getUniform(const UniformName & name);
+    template<typename T, std::size_t N>
+    Uniform<T> * getUniform(const char (&name)[N]);
 
 	/** Adds the uniform to the internal list of named uniforms. If an equally
 		named uniform already exists, this program derigisters itself and the uniform
@@ -167,6 +182,8 @@ protected:
     void setUniformByIdentity(const LocationIdentity & identity, const T & value);
     template<typename T>
     Uniform<T> * getUniformByIdentity(const LocationIdentity & identity);
+    template<typename T>
+    Uniform<T> * getUniformByName(const char * name, std::size_t length, std::uint64_t hash);
 
     UniformBlock * getUniformBlockByIdentity(const LocationIdentity & identity);
 
@@ -174,6 +191,7 @@ protected:
 	std::set<ref_ptr<Shader>> m_shaders;
     ref_ptr<ProgramBinary> m_binary;
     std::unordered_map<LocationIdentity, ref_ptr<AbstractUniform>> m_uniforms;
+    UniformNameTable m_uniformNames; ///< Non-owning index of the named uniforms in m_uniforms.
     std::unordered_map<LocationIdentity, UniformBlock> m_uniformBlocks;
 
 	bool m_linked;
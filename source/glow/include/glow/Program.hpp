@@ -29,14 +29,49 @@ void Program::setUniformByIdentity(const LocationIdentity & identity, const T &
 template<typename T>
 Uniform<T> * Program::getUniformByIdentity(const LocationIdentity & identity)
 {
+    if (identity.isName())
+        return getUniformByName<T>(identity.name().data(), identity.name().size(), UniformName::hash(identity.name().data(), identity.name().size()));
+
     if (m_uniforms.count(identity))
         return m_uniforms[identity]->as<T>();
 
+    // create new uniform if none at <location> exists
+
+    Uniform<T> * uniform = new Uniform<T>(identity.location());
+
+    m_uniforms[uniform->identity()] = uniform;
+    uniform->registerProgram(this);
+
+    return uniform;
+}
+
+template<typename T>
+Uniform<T> * Program::getUniformByName(const char * name, std::size_t length, std::uint64_t hash)
+{
+    UniformNameTable::Entry * entry = m_uniformNames.find(name, length, hash);
+
+    if (entry)
+    {
+        // the type tag is only recorded after a successful cast, so a matching tag guarantees the type
+        if (entry->type == Uniform<T>::typeTag())
+        {
+            assert(dynamic_cast<Uniform<T> *>(entry->uniform) != nullptr);
+            return static_cast<Uniform<T> *>(entry->uniform);
+        }
+
+        Uniform<T> * uniform = entry->uniform->as<T>();
+        if (uniform)
+            entry->type = Uniform<T>::typeTag();
+
+        return uniform;
+    }
+
     // create new uniform if none named <name> exists
 
-    Uniform<T> * uniform = identity.isName() ? new Uniform<T>(identity.name()) : new Uniform<T>(identity.location());
+    Uniform<T> * uniform = new Uniform<T>(std::string(name, length));
 
     m_uniforms[uniform->identity()] = uniform;
+    m_uniformNames.insert(uniform, Uniform<T>::typeTag());
     uniform->registerProgram(this);
 
     return uniform;
@@ -55,6 +90,26 @@ void Program::setUniform(GLint location, const T & value)
     setUniformByIdentity(location, value);
 }
 
+template<typename T>
+void Program::setUniform(const UniformName & name, const T & value)
+{
+    Uniform<T> * uniform = getUniformByName<T>(name.data(), name.length(), name.hash());
+    if (!uniform)
+    {
+        warning() << "Uniform type mismatch on set uniform. Uniform will be replaced.";
+
+        addUniform(new Uniform<T>(name.string(), value));
+        return;
+    }
+    uniform->set(value);
+}
+
+template<typename T, std::size_t N>
+void Program::setUniform(const char (&name)[N], const T & value)
+{
+    setUniform(UniformName(name), value);
+}
+
 template<typename T>
 Uniform<T> * Program::getUniform(const std::string & name)
 {
@@ -67,6 +122,18 @@ Uniform<T> * Program::getUniform(GLint location)
     return getUniformByIdentity<T>(location);
 }
 
+template<typename T>
+Uniform<T> * Program::getUniform(const UniformName & name)
+{
+    return getUniformByName<T>(name.data(), name.length(), name.hash());
+}
+
+template<typename T, std::size_t N>
+Uniform<T> * Program::getUniform(const char (&name)[N])
+{
+    return getUniform<T>(UniformName(name));
+}
+
 template <class ...Shaders>
 void Program::attach(Shader * shader, Shaders... shaders)
 {
@@ -34,6 +34,8 @@ public:
 
      virtual void notifyChanged(Changeable* sender) override;
 protected:
+    virtual Changeable * propagatesTo() override;
+
     GLenum m_binaryFormat;
     ref_ptr<AbstractStringSource> m_dataSource;
 
@@ -70,6 +70,7 @@ public:
 
 protected:
     virtual void notifyChanged(Changeable * changebale) override;
+    virtual Changeable * propagatesTo() override;
 
 
 protected:
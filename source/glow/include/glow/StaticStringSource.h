@@ -22,10 +22,12 @@ public:
 
     virtual std::string shortInfo() const override;
     virtual std::string string() const override;
+    virtual void chunksInto(std::vector<StringChunk>& vector) const override;
+    virtual std::size_t hash() const override;
 
     void setString(const std::string& string);
 protected:
-    std::string m_string;
+    StringChunk m_string;
 };
 
 } // namespace glow
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <memory>
+
+#include <glow/glow.h>
+
+namespace glow
+{
+
+/** \brief Immutable, shareable piece of the content of an AbstractStringSource.
+
+    Copying a StringChunk only copies a reference to the underlying characters, so chunks
+    can be collected from nested string sources and passed on (e.g., to glShaderSource)
+    without copying any string data. data() and length() stay valid as long as any copy of the
+    chunk exists. The content hash is computed once on construction.
+
+    \see AbstractStringSource::chunks()
+ */
+class GLOW_API StringChunk
+{
+public:
+    StringChunk();
+    StringChunk(const std::string & string);
+    StringChunk(std::string && string);
+    StringChunk(const char * data, size_t length);
+
+    const std::string & string() const;
+    const char * data() const;
+    size_t length() const;
+    bool empty() const;
+
+    std::size_t hash() const;
+
+    static std::size_t combineHash(std::size_t seed, std::size_t hash);
+protected:
+    std::shared_ptr<const std::string> m_string;
+    std::size_t m_hash;
+};
+
+} // namespace glow
@@ -19,11 +19,34 @@ class Buffer;
  * binding and bindless texture. Bindless textures are only available if the
  * graphics driver supports them (NV extension).
  *
+ * If available, textures are edited without binding them (EXT_direct_state_access).
+ * Target, levels, size and internal format are recorded whenever the storage is
+ * defined, so size queries, e.g., for sizing getImage(), need no driver round trip.
+ *
  * \see http://www.opengl.org/wiki/Texture
  * \see http://www.opengl.org/registry/specs/NV/bindless_texture.txt
  */
 class GLOW_API Texture : public Object
 {
+public:
+    /** \brief Client-side record of a texture's storage.
+     * Textures wrapped by id and storage defined elsewhere are unspecified.
+     */
+    struct GLOW_API Description
+    {
+        Description(GLenum target = GL_TEXTURE_2D);
+
+        bool isSpecified() const;
+        glm::ivec3 levelSize(GLint level) const;
+
+        GLenum target;
+        GLenum internalFormat;
+        glm::ivec3 size;
+        GLsizei levels;
+        GLsizei samples;
+        bool immutable;
+    };
+
 public:
     Texture(GLenum target = GL_TEXTURE_2D);
     Texture(GLuint id, GLenum target, bool ownsGLObject = true);
@@ -50,8 +73,25 @@ public:
     void getCompressedImage(GLint lod, GLvoid * image);
     std::vector<unsigned char> getCompressedImage(GLint lod = 0);
 
+    /** Reads the image into packBuffer at offset. The call returns without waiting for the
+        transfer, the buffer's data is available once the commands issued so far completed.
+        \see TextureReadback
+    */
+    void getImage(GLint level, GLenum format, GLenum type, Buffer * packBuffer, GLintptr offset);
+    void getCompressedImage(GLint lod, Buffer * packBuffer, GLintptr offset);
+
+    /** Size in bytes of the image returned by getImage(), images of 3D and array textures are consecutive. */
+    GLsizeiptr imageSize(GLint level, GLenum format, GLenum type);
+    GLsizeiptr compressedImageSize(GLint lod = 0);
+
     GLenum target() const;
 
+    const Description & description() const;
+
+    /** Size of the given level, read from the description if specified and queried otherwise. */
+    glm::ivec3 size(GLint level = 0);
+    GLenum internalFormat();
+
     void image1D(GLint level, GLenum internalFormat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid * data);
     void compressedImage1D(GLint level, GLenum internalFormat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data);
     void subImage1D(GLint level, GLint xOffset, GLsizei width, GLenum format, GLenum type, const GLvoid * data);
@@ -116,8 +156,12 @@ public:
 protected:
     static GLuint genTexture();
 
+    void specify(GLint level, GLenum internalFormat, const glm::ivec3 & size, GLsizei samples = 0);
+    void specifyStorage(GLsizei levels, GLenum internalFormat, const glm::ivec3 & size);
+
 protected:
     GLenum m_target;
+    Description m_description;
 };
 
 } // namespace glow
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/glow.h>
+#include <glow/Referenced.h>
+#include <glow/ref_ptr.h>
+
+namespace glow
+{
+
+class Buffer;
+class Texture;
+
+/** \brief Reads texture images back asynchronously through a pool of pixel pack buffers.
+
+    Each request copies the image into a staging buffer (GL_PIXEL_PACK_BUFFER) and inserts a fence,
+    so the call returns immediately instead of stalling until the GPU has finished the texture.
+    The data is mapped once the fence is signaled, typically a frame or two later. Released
+    requests return their staging buffer to the pool, so repeated readbacks of equally sized
+    images allocate no buffers after the first few frames.
+
+    \code{.cpp}
+
+        ref_ptr<TextureReadback> readback = new TextureReadback();
+
+        // per frame
+        requests.push_back(readback->getImage(result, 0, GL_RGBA, GL_FLOAT));
+
+        while (!requests.empty() && requests.front()->isReady())
+        {
+            const glm::vec4 * texels = requests.front()->map<glm::vec4>();
+            // ...
+            requests.pop_front(); // unmaps and recycles the staging buffer
+        }
+
+    \endcode
+
+    \see Texture::getImage
+ */
+class GLOW_API TextureReadback : public Referenced
+{
+public:
+    /** \brief A pending readback holding its staging buffer and fence.
+    */
+    class GLOW_API Request : public Referenced
+    {
+        friend class TextureReadback;
+
+    public:
+        /** Polls the fence without blocking. */
+        bool isReady();
+        /** Blocks until the data is available or timeout (in nanoseconds) expired.
+            \return true if the data is available
+        */
+        bool wait(GLuint64 timeout = GL_TIMEOUT_IGNORED);
+
+        /** Maps the data for reading, waits if it is not yet available. */
+        const void * map();
+        template <typename T>
+        const T * map();
+        void unmap();
+        bool isMapped() const;
+
+        GLsizeiptr size() const;
+        Buffer * buffer();
+
+    protected:
+        Request(TextureReadback * readback, Buffer * buffer, GLsizeiptr capacity, GLsizeiptr size);
+        virtual ~Request();
+
+        void insertFence();
+
+    protected:
+        ref_ptr<TextureReadback> m_readback;
+        ref_ptr<Buffer> m_buffer;
+        GLsizeiptr m_capacity;
+        GLsizeiptr m_size;
+
+        GLsync m_fence;
+        bool m_flushed;
+        const void * m_data;
+    };
+
+    struct Statistics
+    {
+        unsigned int requestCount;
+        unsigned int allocationCount; ///< staging buffers created
+        unsigned int reuseCount; ///< requests served by a pooled staging buffer
+    };
+
+public:
+    /** @param maxPooledBuffers number of released staging buffers kept for reuse
+    */
+    TextureReadback(unsigned int maxPooledBuffers = 8);
+
+    ref_ptr<Request> getImage(Texture * texture, GLint level, GLenum format, GLenum type);
+    ref_ptr<Request> getCompressedImage(Texture * texture, GLint lod = 0);
+
+    /** Deletes all pooled staging buffers. */
+    void clear();
+
+    unsigned int pooledCount() const;
+    const Statistics & statistics() const;
+
+    /** Staging buffers are allocated in power of two sizes of at least 4 KiB, so images of
+        similar size share buffers.
+    */
+    static GLsizeiptr capacity(GLsizeiptr size);
+
+protected:
+    virtual ~TextureReadback();
+
+    Request * request(GLsizeiptr size);
+    void recycle(Buffer * buffer, GLsizeiptr capacity);
+
+    /** Creates a staging buffer of the given capacity, used whenever the pool has none to reuse. */
+    virtual Buffer * createBuffer(GLsizeiptr capacity);
+
+protected:
+    struct Staging
+    {
+        ref_ptr<Buffer> buffer;
+        GLsizeiptr capacity;
+    };
+
+    std::vector<Staging> m_pool;
+    unsigned int m_maxPooledBuffers;
+
+    Statistics m_statistics;
+};
+
+template <typename T>
+const T * TextureReadback::Request::map()
+{
+    return static_cast<const T *>(map());
+}
+
+} // namespace glow
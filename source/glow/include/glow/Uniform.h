@@ -43,6 +43,11 @@ public:
 
     const T & value() const;
 
+    /** Returns an address unique to this Uniform type, used by Program to avoid RTTI
+        based casts for repeated typed uniform access.
+    */
+    static const void * typeTag();
+
 protected:
     virtual void setValueAt(GLint location) override;
     virtual void setValueAt(Program* program, GLint location) override;
@@ -46,6 +46,13 @@ const T & Uniform<T>::value() const
 	return m_value;
 }
 
+template<typename T>
+const void * Uniform<T>::typeTag()
+{
+    static const char tag = 0;
+    return &tag;
+}
+
 template<typename T>
 void Uniform<T>::setValueAt(GLint location)
 {
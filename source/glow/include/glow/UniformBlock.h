@@ -7,6 +7,7 @@
 
 #include <glow/glow.h>
 #include <glow/LocationIdentity.h>
+#include <glow/UniformBlockLayout.h>
 
 namespace glow {
 
@@ -30,6 +31,11 @@ public:
 
     std::vector<GLint> getActiveUniformIndices();
 
+    /** Queries offsets and strides of all active members from the linked program.
+        Array members are named without the trailing "[0]".
+    */
+    UniformBlockLayout layout();
+
     std::string getName();
 protected:
     Program * m_program;
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <glow/glow.h>
+
+namespace glow
+{
+
+/** \brief CPU-side memory layout of a uniform (or shader storage) block.
+
+    A layout maps member names to their offsets and strides within the block's buffer memory and
+    writes typed values accordingly. Layouts are either computed from the member declarations
+    following the std140 or std430 packing rules, or queried from a linked program using
+    UniformBlock::layout(), which also covers the shared and packed layouts.
+
+    \code{.cpp}
+
+        UniformBlockLayout layout(UniformBlockLayout::Std140);
+        layout.add("transform", GL_FLOAT_MAT4);
+        layout.add("color", GL_FLOAT_VEC3);
+        layout.addArray("weights", GL_FLOAT, 4);
+
+        std::vector<char> data(layout.dataSize());
+        layout.write(data.data(), "color", glm::vec3(1.f, 0.f, 0.f));
+        layout.write(data.data(), "weights", .5f, 2);
+
+    \endcode
+
+    Structs are not resolved when computing layouts; their members can be added with their
+    qualified names in declaration order, which matches the packing rules for structs that
+    consist of vec4 aligned members only.
+
+    \see UniformBlock::layout
+    \see UniformBufferArena
+    \see http://www.opengl.org/registry/specs/ARB/uniform_buffer_object.txt
+ */
+class GLOW_API UniformBlockLayout
+{
+public:
+    enum Packing
+    {
+        Std140
+    ,   Std430
+    };
+
+    struct Member
+    {
+        GLenum type;
+        GLint offset;
+        GLint arraySize;
+        GLint arrayStride; ///< 0 for non-array members
+        GLint matrixStride; ///< 0 for non-matrix members
+    };
+
+public:
+    UniformBlockLayout(Packing packing = Std140);
+
+    Packing packing() const;
+
+    /** Appends a member of the given GLSL type (e.g., GL_FLOAT_VEC3) using the packing rules.
+        @return the member's offset in bytes, or -1 for types not allowed in blocks
+    */
+    GLint add(const std::string & name, GLenum type);
+    /** Appends an array member, laid out as array even for a single element (e.g., float a[1],
+        whose stride is rounded up to 16 bytes under std140).
+        @return the member's offset in bytes, or -1 for types not allowed in blocks
+    */
+    GLint addArray(const std::string & name, GLenum type, GLint arraySize);
+    /** Adds a member with an explicit layout, e.g., as queried from a program.
+    */
+    void add(const std::string & name, const Member & member);
+
+    const Member * member(const std::string & name) const;
+    const std::unordered_map<std::string, Member> & members() const;
+
+    /** Size of the block in bytes, including trailing padding.
+    */
+    GLint dataSize() const;
+    void setDataSize(GLint size);
+
+    /** Writes the value of the member <name> (at array element <index>) into the block memory.
+        @return false if the block has no such member, e.g., since it was optimized out
+    */
+    template <typename T>
+    bool write(void * block, const std::string & name, const T & value, GLint index = 0) const;
+    template <typename T>
+    static void write(void * block, const Member & member, const T & value, GLint index = 0);
+
+protected:
+    GLint add(const std::string & name, GLenum type, GLint arraySize, bool isArray);
+
+    template <typename T>
+    static void writeValue(char * destination, GLint matrixStride, const T & value);
+    static void writeValue(char * destination, GLint matrixStride, bool value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::bvec2 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::bvec3 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::bvec4 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat2 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat3 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat4 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat2x3 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat2x4 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat3x2 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat3x4 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat4x2 & value);
+    static void writeValue(char * destination, GLint matrixStride, const glm::mat4x3 & value);
+
+protected:
+    Packing m_packing;
+    std::unordered_map<std::string, Member> m_members;
+
+    GLint m_size; ///< end of the last member added by type
+    GLint m_alignment; ///< largest base alignment of the members added by type
+    GLint m_dataSize; ///< explicit data size, -1 if derived from the members
+};
+
+} // namespace glow
+
+#include <glow/UniformBlockLayout.hpp>
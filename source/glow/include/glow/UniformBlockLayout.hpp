@@ -0,0 +1,36 @@
+#pragma once
+
+#include <glow/UniformBlockLayout.h>
+
+#include <cassert>
+#include <cstring>
+
+namespace glow
+{
+
+template <typename T>
+bool UniformBlockLayout::write(void * block, const std::string & name, const T & value, GLint index) const
+{
+    const Member * m = member(name);
+    if (!m)
+        return false;
+
+    write(block, *m, value, index);
+    return true;
+}
+
+template <typename T>
+void UniformBlockLayout::write(void * block, const Member & member, const T & value, GLint index)
+{
+    assert(index >= 0 && index < member.arraySize);
+
+    writeValue(static_cast<char *>(block) + member.offset + index * member.arrayStride, member.matrixStride, value);
+}
+
+template <typename T>
+void UniformBlockLayout::writeValue(char * destination, GLint /*matrixStride*/, const T & value)
+{
+    std::memcpy(destination, &value, sizeof(T));
+}
+
+} // namespace glow
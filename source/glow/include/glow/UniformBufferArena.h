@@ -0,0 +1,102 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/glow.h>
+#include <glow/ref_ptr.h>
+#include <glow/UniformBlockLayout.h>
+
+namespace glow
+{
+
+class Buffer;
+
+/** \brief Stages the uniform block data of a frame and uploads it into a single uniform buffer.
+
+    Blocks are allocated in CPU memory (respecting GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT) and filled
+    using their UniformBlockLayout. upload() then transfers all blocks with a single mapping of
+    the buffer, and bind() binds each block's range to its binding index.
+
+    \code{.cpp}
+
+        UniformBufferArena arena;
+        UniformBlockLayout layout = program->uniformBlock("Transforms")->layout();
+
+        // per frame
+        arena.clear();
+        for (Object & object : objects)
+        {
+            object.range = arena.allocate(layout);
+            arena.write(object.range, layout, "model", object.model);
+        }
+        arena.upload();
+
+        for (Object & object : objects)
+        {
+            arena.bind(object.range, 0);
+            // draw call
+        }
+
+    \endcode
+
+    \see UniformBlockLayout
+    \see UniformBlock::setBinding
+ */
+class GLOW_API UniformBufferArena
+{
+public:
+    struct Range
+    {
+        GLintptr offset;
+        GLsizeiptr size;
+    };
+
+public:
+    /** @param offsetAlignment alignment of allocated ranges, 0 to query GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT
+    */
+    UniformBufferArena(GLint offsetAlignment = 0);
+    virtual ~UniformBufferArena();
+
+    Range allocate(GLsizeiptr size);
+    Range allocate(const UniformBlockLayout & layout);
+
+    /** Returns the staging memory of the range. The pointer is invalidated by subsequent allocations.
+    */
+    void * data(const Range & range);
+
+    template <typename T>
+    bool write(const Range & range, const UniformBlockLayout & layout, const std::string & name, const T & value, GLint index = 0);
+
+    /** Copies all staged blocks into the buffer, which is orphaned and grown if required.
+    */
+    void upload();
+    void bind(const Range & range, GLuint bindingIndex);
+
+    /** Discards all allocations, e.g., at the beginning of a frame.
+    */
+    void clear();
+
+    GLsizeiptr size() const;
+    GLint offsetAlignment();
+
+    Buffer * buffer();
+
+protected:
+    std::vector<char> m_staging;
+    GLsizeiptr m_size;
+    GLint m_offsetAlignment;
+
+    ref_ptr<Buffer> m_buffer;
+    GLsizeiptr m_capacity;
+};
+
+template <typename T>
+bool UniformBufferArena::write(const Range & range, const UniformBlockLayout & layout, const std::string & name, const T & value, GLint index)
+{
+    return layout.write(data(range), name, value, index);
+}
+
+} // namespace glow
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <glow/glow.h>
+
+namespace glow
+{
+
+/** \brief Pre-hashed name of a uniform for fast uniform lookups in Program.
+
+    Constructed from a string literal, a UniformName only references the literal's characters
+    and its 64 bit FNV-1a hash is computed at compile time when used in a constant expression.
+    Constructed from a std::string, the characters are interned once into a process-wide pool,
+    so the name stays valid independent of the string's lifetime.
+
+    \code{.cpp}
+
+        static CONSTEXPR glow::UniformName modelView("modelView");
+        ...
+        program->setUniform(modelView, matrix);
+
+    \endcode
+
+    \see Program::setUniform
+ */
+class GLOW_API UniformName
+{
+public:
+    template <std::size_t N>
+    CONSTEXPR UniformName(const char (&name)[N]);
+    explicit UniformName(const std::string & name);
+
+    CONSTEXPR const char * data() const;
+    CONSTEXPR std::size_t length() const;
+    CONSTEXPR std::uint64_t hash() const;
+
+    std::string string() const;
+
+    bool operator==(const UniformName & name) const;
+    bool operator!=(const UniformName & name) const;
+
+    static CONSTEXPR std::uint64_t hash(const char * data, std::size_t length, std::uint64_t seed = 14695981039346656037ull);
+    static CONSTEXPR std::size_t length(const char * data, std::size_t offset = 0);
+
+protected:
+    const char * m_data;
+    std::size_t m_length;
+    std::uint64_t m_hash;
+};
+
+} // namespace glow
+
+#include <glow/UniformName.hpp>
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <glow/UniformName.h>
+
+namespace glow
+{
+
+template <std::size_t N>
+inline CONSTEXPR UniformName::UniformName(const char (&name)[N])
+: m_data(name)
+, m_length(length(name))
+, m_hash(hash(name, length(name)))
+{
+}
+
+inline CONSTEXPR const char * UniformName::data() const
+{
+    return m_data;
+}
+
+inline CONSTEXPR std::size_t UniformName::length() const
+{
+    return m_length;
+}
+
+inline CONSTEXPR std::uint64_t UniformName::hash() const
+{
+    return m_hash;
+}
+
+inline CONSTEXPR std::uint64_t UniformName::hash(const char * data, std::size_t length, std::uint64_t seed)
+{
+    // FNV-1a, recursive for C++11 constexpr
+    return length == 0 ? seed : hash(data + 1, length - 1, (seed ^ static_cast<unsigned char>(*data)) * 1099511628211ull);
+}
+
+inline CONSTEXPR std::size_t UniformName::length(const char * data, std::size_t offset)
+{
+    return data[offset] == '\0' ? offset : length(data, offset + 1);
+}
+
+} // namespace glow
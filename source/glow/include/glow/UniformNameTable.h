@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glow/glow.h>
+
+namespace glow
+{
+
+class AbstractUniform;
+
+/** \brief Flat hash table of named uniforms, keyed by the FNV-1a hash of their names.
+
+    Entries are stored in a single array with open addressing (linear probing), so a lookup
+    usually touches one cache line and compares one name. Each entry additionally caches a type
+    tag of the uniform, which allows Program to skip RTTI based casts for repeated typed access.
+
+    \see UniformName
+    \see Program
+ */
+class GLOW_API UniformNameTable
+{
+public:
+    struct Entry
+    {
+        std::uint64_t hash;
+        AbstractUniform * uniform;
+        const void * type; ///< type tag of the uniform, nullptr if not yet known
+    };
+
+public:
+    UniformNameTable();
+
+    Entry * find(const char * name, std::size_t length, std::uint64_t hash);
+
+    /** Inserts the uniform by its name or replaces an equally named uniform.
+    */
+    Entry * insert(AbstractUniform * uniform, const void * type = nullptr);
+
+    std::size_t size() const;
+    void clear();
+
+protected:
+    Entry * slot(const char * name, std::size_t length, std::uint64_t hash);
+    void grow();
+
+protected:
+    std::vector<Entry> m_entries;
+    std::size_t m_size;
+};
+
+} // namespace glow
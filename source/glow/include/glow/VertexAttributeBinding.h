@@ -28,7 +28,7 @@ public:
 	void setAttribute(GLint attributeIndex);
 	void setBuffer(
         Buffer * vbo
-    ,   GLint baseoffset
+    ,   GLintptr baseoffset
     ,   GLint stride);
 
 	void setFormat(
@@ -10,6 +10,10 @@
 namespace glow {
 
 GLOW_API std::string enumName(GLenum param);
+/** Same as enumName(), but returns the static name entry without allocating.
+    \return "UNKNOWN_GL_ENUM" for unknown values, never nullptr
+ */
+GLOW_API const char * enumNameCStr(GLenum param);
 GLOW_API std::vector<std::string> enumNames(GLenum param);
 	
 } // namespace glow
@@ -12,6 +12,7 @@ namespace glow
 {
 
 class DebugMessage;
+class DebugMessageAggregator;
 
 /** \brief Handles occuring OpenGL errors.
     
@@ -61,6 +62,14 @@ GLOW_API void disable();
 GLOW_API void setCallback(Callback callback);
 GLOW_API void addCallback(Callback callback);
 
+/** Passes the debug messages of the current context to aggregator first, which handles all but
+    (optionally) errors off the calling thread. Set nullptr to remove it, the aggregator has to
+    outlive its use. Combine with enable(false) to not stall the driver on every message.
+
+    \see DebugMessageAggregator
+*/
+GLOW_API void setAggregator(DebugMessageAggregator * aggregator);
+
 GLOW_API void setSynchronous(bool synchronous);
 
 GLOW_API void insertMessage(
@@ -4,6 +4,7 @@
 #include <string>
 
 #include <glow/glow.h>
+#include <glow/CompiledFormat.h>
 
 namespace glow 
 {
@@ -75,11 +76,20 @@ void streamprintf(std::ostream& stream, const char* format, const T& value, Args
  * Note: To end a format specifier, you have to add a semicolon.
  * `%%` will escape a % character.
  *
+ * Formats are compiled once and cached by their address (see CompiledFormat),
+ * the output equals the one of streamprintf.
+ *
  * \see http://www.cplusplus.com/reference/ios/ios_base/fmtflags/
  */
 template <typename... Args>
 std::string formatString(const char* format, Args... args);
 
+/**
+ * Like formatString, but appends to buffer, which can be reused to avoid allocations.
+ */
+template <typename... Args>
+void appendFormatted(std::string & buffer, const char* format, Args... args);
+
 } // namespace glow
 
 #include <glow/formatString.hpp>
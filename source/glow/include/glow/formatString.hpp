@@ -31,12 +31,27 @@ void streamprintf(std::ostream& stream, const char* format, const T& value, Args
 
 template <typename... Args>
 std::string formatString(const char* format, Args... args)
+{
+    std::string buffer;
+    appendFormatted(buffer, format, args...);
+    return buffer;
+}
+
+template <typename... Args>
+void appendFormatted(std::string & buffer, const char* format, Args... args)
+{
+    assert(format != nullptr);
+
+    const CompiledFormat::Argument arguments[] = { CompiledFormat::Argument(args)... };
+    CompiledFormat::appendCached(buffer, format, arguments, sizeof...(Args));
+}
+
+template <>
+inline void appendFormatted<>(std::string & buffer, const char* format)
 {
     assert(format != nullptr);
 
-	std::stringstream ss;
-	streamprintf(ss, format, args...);
-	return ss.str();
+    CompiledFormat::appendCached(buffer, format, nullptr, 0);
 }
 
 } // namespace glow
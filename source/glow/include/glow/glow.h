@@ -42,6 +42,15 @@
 #	endif
 #endif
 
+// MSVC 2013 does not support constexpr, constant initialization is used instead
+#ifndef CONSTEXPR
+#	if defined(_MSC_VER) && _MSC_VER < 1900
+#		define CONSTEXPR
+#	else
+#		define CONSTEXPR constexpr
+#	endif
+#endif
+
 #ifndef GL_VERSION_3_0
 #define GL_NUM_EXTENSIONS                       0x821D
 #define GL_CONTEXT_FLAGS                        0x821E
@@ -6,7 +6,12 @@ namespace glow
 std::vector<std::string> AbstractStringSource::strings() const
 {
     std::vector<std::string> stringList;
-    stringList.push_back(string());
+
+    for (const StringChunk & chunk : chunks())
+    {
+        stringList.push_back(chunk.string());
+    }
+
     return stringList;
 }
 
@@ -29,4 +34,35 @@ void AbstractStringSource::flattenInto(std::vector<AbstractStringSource*>& vecto
     vector.push_back(const_cast<AbstractStringSource*>(this));
 }
 
+std::vector<StringChunk> AbstractStringSource::chunks() const
+{
+    std::vector<StringChunk> list;
+
+    chunksInto(list);
+
+    return list;
+}
+
+void AbstractStringSource::chunksInto(std::vector<StringChunk>& vector) const
+{
+    vector.push_back(StringChunk(string()));
+}
+
+std::size_t AbstractStringSource::hash() const
+{
+    return combinedHash(chunks());
+}
+
+std::size_t AbstractStringSource::combinedHash(const std::vector<StringChunk> & chunks)
+{
+    std::size_t seed = chunks.size();
+
+    for (const StringChunk & chunk : chunks)
+    {
+        seed = StringChunk::combineHash(seed, chunk.hash());
+    }
+
+    return seed;
+}
+
 } // namespace glow
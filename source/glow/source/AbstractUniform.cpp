@@ -3,7 +3,8 @@
 #include <cassert>
 
 #include <glow/Program.h>
-#include <glow/Extension.h>
+
+#include "directstateaccess.h"
 
 namespace glow
 {
@@ -15,8 +16,6 @@ AbstractUniform::AbstractUniform(GLint location)
 
 AbstractUniform::AbstractUniform(const std::string & name)
 : m_identity(name)
-, m_directStateAccess(false)
-, m_cacheDSA(false)
 {
 }
 
@@ -76,14 +75,7 @@ void AbstractUniform::update(Program * program)
         return;
     }
 
-    if (!m_cacheDSA) // TODO: move caching to a per context caching
-    {
-        m_cacheDSA = true;
-
-        m_directStateAccess = hasExtension(GLOW_EXT_direct_state_access);
-    }
-
-    if (m_directStateAccess)
+    if (hasDirectStateAccess())
     {
 		setValueAt(program, locationFor(program));
     }
@@ -3,30 +3,28 @@
 #include <cassert>
 
 #include <glow/Error.h>
-#include <glow/Extension.h>
 #include <glow/ObjectVisitor.h>
 
+#include "directstateaccess.h"
+
 namespace glow
 {
 
 Buffer::Buffer()
 : Object(genBuffer())
 , m_target(0)
-, m_directStateAccess(hasExtension(GLOW_EXT_direct_state_access))
 {
 }
 
 Buffer::Buffer(GLenum target)
 : Object(genBuffer())
 , m_target(target)
-, m_directStateAccess(hasExtension(GLOW_EXT_direct_state_access))
 {
 }
 
 Buffer::Buffer(GLuint id, GLenum target)
 : Object(id, false)
 , m_target(target)
-, m_directStateAccess(hasExtension(GLOW_EXT_direct_state_access))
 {
 }
 
@@ -80,7 +78,7 @@ void Buffer::unbind(GLenum target)
 
 void* Buffer::map(GLenum access)
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess())
     {
         void* result = glMapNamedBufferEXT(m_id, access);
         CheckGLError();
@@ -99,7 +97,7 @@ void* Buffer::map(GLenum access)
 
 void* Buffer::mapRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess())
     {
         void* result = glMapNamedBufferRangeEXT(m_id, offset, length, access);
         CheckGLError();
@@ -117,7 +115,7 @@ void* Buffer::mapRange(GLintptr offset, GLsizeiptr length, GLbitfield access)
 
 bool Buffer::unmap()
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess())
     {
         GLboolean success = glUnmapNamedBufferEXT(m_id);
         CheckGLError();
@@ -137,7 +135,7 @@ bool Buffer::unmap()
 
 void Buffer::setData(GLsizeiptr size, const GLvoid* data, GLenum usage)
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess())
     {
         glNamedBufferDataEXT(m_id, size, data, usage);
     }
@@ -151,7 +149,7 @@ void Buffer::setData(GLsizeiptr size, const GLvoid* data, GLenum usage)
     
 void Buffer::setSubData(GLintptr offset, GLsizeiptr size, const GLvoid* data)
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess())
     {
         glNamedBufferSubDataEXT(m_id, offset, size, data);
         CheckGLError();
@@ -166,7 +164,7 @@ void Buffer::setSubData(GLintptr offset, GLsizeiptr size, const GLvoid* data)
 
 void Buffer::setStorage(GLsizeiptr size, const GLvoid * data, GLbitfield flags)
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess(GLOW_ARB_buffer_storage))
     {
         glNamedBufferStorageEXT(m_id, size, data, flags);
         CheckGLError();
@@ -181,7 +179,7 @@ void Buffer::setStorage(GLsizeiptr size, const GLvoid * data, GLbitfield flags)
 
 GLint Buffer::getParameter(GLenum pname)
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess())
     {
         GLint value = 0;
 
@@ -253,7 +251,7 @@ void Buffer::copySubData(glow::Buffer* buffer, GLintptr readOffset, GLintptr wri
 {
     assert(buffer != nullptr);
 
-    if (m_directStateAccess)
+    if (hasDirectStateAccess())
     {
         glNamedCopyBufferSubDataEXT(m_id, buffer->id(), readOffset, writeOffset, size);
         CheckGLError();
@@ -287,7 +285,7 @@ void Buffer::copyData(glow::Buffer* buffer, GLsizeiptr size, GLenum usage)
 
 void Buffer::clearData(GLenum internalformat, GLenum format, GLenum type, const void* data)
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess(GLOW_ARB_clear_buffer_object))
     {
         glClearNamedBufferDataEXT(m_id, internalformat, format, type, data);
         CheckGLError();
@@ -303,7 +301,7 @@ void Buffer::clearData(GLenum internalformat, GLenum format, GLenum type, const
 
 void Buffer::clearSubData(GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void* data)
 {
-    if (m_directStateAccess)
+    if (hasDirectStateAccess(GLOW_ARB_clear_buffer_object))
     {
         glClearNamedBufferSubDataEXT(m_id, internalformat, offset, size, format, type, data);
         CheckGLError();
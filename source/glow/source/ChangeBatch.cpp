@@ -0,0 +1,235 @@
+#include <glow/ChangeBatch.h>
+
+#include <algorithm>
+#include <deque>
+
+#include <glow/Changeable.h>
+#include <glow/ChangeListener.h>
+
+namespace
+{
+
+// outermost batch of the thread, the pointer is thread local (MSVC 2013 lacks thread_local)
+#ifdef _MSC_VER
+__declspec(thread) glow::ChangeBatch * t_batch = nullptr;
+#else
+thread_local glow::ChangeBatch * t_batch = nullptr;
+#endif
+
+}
+
+namespace glow
+{
+
+ChangeBatch::ChangeBatch()
+{
+    if (!t_batch)
+        t_batch = this;
+}
+
+ChangeBatch::~ChangeBatch()
+{
+    if (t_batch != this)
+        return;
+
+    // the batch stays active while propagating, so changes signaled by listeners are recorded
+    propagate();
+
+    t_batch = nullptr;
+}
+
+bool ChangeBatch::isActive()
+{
+    return t_batch != nullptr;
+}
+
+bool ChangeBatch::defer(Changeable * changeable)
+{
+    if (!t_batch)
+        return false;
+
+    if (t_batch->m_changedSet.insert(changeable).second)
+        t_batch->m_changed.push_back(changeable);
+
+    return true;
+}
+
+void ChangeBatch::forget(Changeable * changeable)
+{
+    if (!t_batch)
+        return;
+
+    if (t_batch->m_changedSet.erase(changeable) > 0)
+        std::replace(t_batch->m_changed.begin(), t_batch->m_changed.end(), changeable, static_cast<Changeable *>(nullptr));
+
+    t_batch->m_reached.erase(changeable);
+
+    auto dependents = t_batch->m_dependents.find(changeable);
+    if (dependents != t_batch->m_dependents.end())
+    {
+        for (ChangeListener * listener : dependents->second)
+        {
+            std::vector<Changeable *> & subjects = t_batch->m_nodes.at(listener).subjects;
+            std::replace(subjects.begin(), subjects.end(), changeable, static_cast<Changeable *>(nullptr));
+        }
+        t_batch->m_dependents.erase(dependents);
+    }
+
+    auto propagators = t_batch->m_propagators.find(changeable);
+    if (propagators != t_batch->m_propagators.end())
+    {
+        for (ChangeListener * listener : propagators->second)
+            t_batch->m_nodes.at(listener).propagatesTo = nullptr;
+
+        t_batch->m_propagators.erase(propagators);
+    }
+}
+
+void ChangeBatch::forget(ChangeListener * listener)
+{
+    if (!t_batch)
+        return;
+
+    auto node = t_batch->m_nodes.find(listener);
+    if (node == t_batch->m_nodes.end())
+        return;
+
+    // keep the edge indices free of destroyed listeners
+    for (Changeable * subject : node->second.subjects)
+    {
+        if (!subject)
+            continue;
+
+        std::vector<ChangeListener *> & dependents = t_batch->m_dependents[subject];
+        dependents.erase(std::remove(dependents.begin(), dependents.end(), listener), dependents.end());
+    }
+
+    if (node->second.propagatesTo)
+    {
+        std::vector<ChangeListener *> & propagators = t_batch->m_propagators[node->second.propagatesTo];
+        propagators.erase(std::remove(propagators.begin(), propagators.end(), listener), propagators.end());
+    }
+
+    t_batch->m_nodes.erase(node);
+}
+
+void ChangeBatch::propagate()
+{
+    while (!m_changed.empty())
+    {
+        std::vector<Changeable *> sources;
+        sources.swap(m_changed);
+        sources.erase(std::remove(sources.begin(), sources.end(), nullptr), sources.end());
+
+        order(sources);
+
+        for (ChangeListener * listener : m_order)
+        {
+            // listeners and subjects destroyed during propagation are removed by forget()
+            auto node = m_nodes.find(listener);
+            if (node == m_nodes.end())
+                continue;
+
+            const std::vector<Changeable *> subjects = node->second.subjects;
+            for (Changeable * subject : subjects)
+            {
+                if (subject && m_changedSet.count(subject) > 0 && m_nodes.count(listener) > 0)
+                    listener->notifyChanged(subject);
+            }
+        }
+
+        // changes within the graph are propagated, others (e.g., of unrelated Changeables) start another round
+        m_changed.erase(std::remove_if(m_changed.begin(), m_changed.end(), [this](Changeable * changeable)
+        {
+            return !changeable || m_reached.count(changeable) > 0;
+        }), m_changed.end());
+
+        m_changedSet = std::unordered_set<Changeable *>(m_changed.begin(), m_changed.end());
+
+        m_nodes.clear();
+        m_reached.clear();
+        m_dependents.clear();
+        m_propagators.clear();
+        m_order.clear();
+    }
+}
+
+void ChangeBatch::order(const std::vector<Changeable *> & sources)
+{
+    std::deque<Changeable *> queue(sources.begin(), sources.end());
+    m_reached.insert(sources.begin(), sources.end());
+
+    while (!queue.empty())
+    {
+        Changeable * changeable = queue.front();
+        queue.pop_front();
+
+        for (ChangeListener * listener : changeable->m_listeners)
+        {
+            auto inserted = m_nodes.insert(std::make_pair(listener, Node{ {}, nullptr, 0 }));
+            Node & node = inserted.first->second;
+
+            node.subjects.push_back(changeable);
+            m_dependents[changeable].push_back(listener);
+
+            if (!inserted.second)
+                continue;
+
+            node.propagatesTo = listener->propagatesTo();
+            if (!node.propagatesTo)
+                continue;
+
+            m_propagators[node.propagatesTo].push_back(listener);
+
+            if (m_reached.insert(node.propagatesTo).second)
+                queue.push_back(node.propagatesTo);
+        }
+    }
+
+    // Kahn's algorithm, a listener is ready when the listeners propagating to its subjects are ordered;
+    // its in-degree counts each propagating listener once per subject, matching the decrements below
+    std::vector<ChangeListener *> ready;
+    for (std::pair<ChangeListener * const, Node> & node : m_nodes)
+    {
+        node.second.pendingListeners = 0;
+        for (Changeable * subject : node.second.subjects)
+        {
+            auto propagators = m_propagators.find(subject);
+            if (propagators != m_propagators.end())
+                node.second.pendingListeners += static_cast<unsigned int>(propagators->second.size());
+        }
+
+        if (node.second.pendingListeners == 0)
+            ready.push_back(node.first);
+    }
+
+    while (!ready.empty())
+    {
+        ChangeListener * listener = ready.back();
+        ready.pop_back();
+
+        m_order.push_back(listener);
+
+        Changeable * propagatesTo = m_nodes.at(listener).propagatesTo;
+        if (!propagatesTo)
+            continue;
+
+        for (ChangeListener * dependent : m_dependents[propagatesTo])
+        {
+            if (--m_nodes.at(dependent).pendingListeners == 0)
+                ready.push_back(dependent);
+        }
+    }
+
+    // cycles are not ordered, their listeners are appended in any order
+    if (m_order.size() < m_nodes.size())
+    {
+        for (std::pair<ChangeListener * const, Node> & node : m_nodes)
+        {
+            if (node.second.pendingListeners > 0)
+                m_order.push_back(node.first);
+        }
+    }
+}
+
+} // namespace glow
@@ -1,5 +1,6 @@
 #include <glow/ChangeListener.h>
 
+#include <glow/ChangeBatch.h>
 #include <glow/Changeable.h>
 
 namespace glow
@@ -7,7 +8,11 @@ namespace glow
 
 ChangeListener::~ChangeListener()
 {
-    for (Changeable * subject : m_subjects)
+    ChangeBatch::forget(this);
+
+    // deregistering removes the subject from m_subjects
+    const std::set<Changeable *> subjects = m_subjects;
+    for (Changeable * subject : subjects)
     {
         subject->deregisterListener(this);
     }
@@ -17,6 +22,11 @@ void ChangeListener::notifyChanged(Changeable *)
 {
 }
 
+Changeable * ChangeListener::propagatesTo()
+{
+    return nullptr;
+}
+
 void ChangeListener::addSubject(Changeable * subject)
 {
     m_subjects.insert(subject);
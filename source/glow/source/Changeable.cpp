@@ -2,13 +2,22 @@
 
 #include <cassert>
 
+#include <glow/ChangeBatch.h>
 #include <glow/ChangeListener.h>
 
 namespace glow
 {
 
+Changeable::~Changeable()
+{
+    ChangeBatch::forget(this);
+}
+
 void Changeable::changed()
 {
+    if (ChangeBatch::defer(this))
+        return;
+
 	for (ChangeListener * listener: m_listeners)
 	{
 		listener->notifyChanged(this);
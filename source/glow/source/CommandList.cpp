@@ -0,0 +1,560 @@
+#include <glow/CommandList.h>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <glow/Buffer.h>
+#include <glow/Error.h>
+#include <glow/FrameBufferObject.h>
+#include <glow/Program.h>
+#include <glow/Texture.h>
+#include <glow/VertexArrayObject.h>
+
+namespace
+{
+
+enum Opcode
+{
+    UseProgram
+,   BindVertexArray
+,   BindBuffer
+,   BindBufferBase
+,   BindBufferRange
+,   BindTexture
+,   BindFramebuffer
+,   SetUniform
+,   Enable
+,   Disable
+,   BlendFunc
+,   DepthFunc
+,   DepthMask
+,   CullFace
+,   Viewport
+,   ClearColor
+,   Clear
+,   DrawArrays
+,   DrawElements
+,   Call
+};
+
+// Every command is a header followed by its payload, both padded to the alignment, so
+// payloads (e.g., uniform values) can be passed to GL without copying.
+const std::size_t alignment = 8;
+
+struct Header
+{
+    std::uint32_t opcode;
+    std::uint32_t size; ///< of the payload including padding
+};
+
+struct NameCommand
+{
+    GLenum target;
+    GLuint name;
+};
+
+struct BufferRangeCommand
+{
+    GLenum target;
+    GLuint index;
+    GLuint name;
+    GLintptr offset;
+    GLsizeiptr size;
+};
+
+struct TextureCommand
+{
+    GLuint unit;
+    GLenum target;
+    GLuint name;
+};
+
+struct UniformCommand
+{
+    GLint location;
+    GLenum type;
+    GLsizei count;
+    GLuint padding; ///< the values follow aligned
+};
+
+struct BlendFuncCommand
+{
+    GLenum sourceFactor;
+    GLenum destinationFactor;
+};
+
+struct ViewportCommand
+{
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+struct DrawArraysCommand
+{
+    GLenum mode;
+    GLint first;
+    GLsizei count;
+    GLsizei instanceCount;
+};
+
+struct DrawElementsCommand
+{
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    GLsizei instanceCount;
+    GLintptr offset;
+    GLint baseVertex;
+};
+
+std::size_t padded(std::size_t size)
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+GLuint nameOf(const glow::Object * object)
+{
+    return object ? object->id() : 0;
+}
+
+template <typename Command>
+Command read(const unsigned char * payload)
+{
+    Command command;
+    std::memcpy(&command, payload, sizeof(Command));
+    return command;
+}
+
+std::size_t uniformSize(GLenum type)
+{
+    switch (type)
+    {
+    case GL_FLOAT:
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+        return 4;
+    case GL_FLOAT_VEC2:
+    case GL_INT_VEC2:
+    case GL_UNSIGNED_INT_VEC2:
+        return 8;
+    case GL_FLOAT_VEC3:
+    case GL_INT_VEC3:
+    case GL_UNSIGNED_INT_VEC3:
+        return 12;
+    case GL_FLOAT_VEC4:
+    case GL_INT_VEC4:
+    case GL_UNSIGNED_INT_VEC4:
+        return 16;
+    case GL_FLOAT_MAT3:
+        return 36;
+    case GL_FLOAT_MAT4:
+        return 64;
+    default:
+        return 0;
+    }
+}
+
+void applyUniform(const UniformCommand & command, const void * data)
+{
+    const GLfloat * f = static_cast<const GLfloat *>(data);
+    const GLint * i = static_cast<const GLint *>(data);
+    const GLuint * u = static_cast<const GLuint *>(data);
+
+    switch (command.type)
+    {
+    case GL_FLOAT:             glUniform1fv(command.location, command.count, f); break;
+    case GL_FLOAT_VEC2:        glUniform2fv(command.location, command.count, f); break;
+    case GL_FLOAT_VEC3:        glUniform3fv(command.location, command.count, f); break;
+    case GL_FLOAT_VEC4:        glUniform4fv(command.location, command.count, f); break;
+    case GL_INT:               glUniform1iv(command.location, command.count, i); break;
+    case GL_INT_VEC2:          glUniform2iv(command.location, command.count, i); break;
+    case GL_INT_VEC3:          glUniform3iv(command.location, command.count, i); break;
+    case GL_INT_VEC4:          glUniform4iv(command.location, command.count, i); break;
+    case GL_UNSIGNED_INT:      glUniform1uiv(command.location, command.count, u); break;
+    case GL_UNSIGNED_INT_VEC2: glUniform2uiv(command.location, command.count, u); break;
+    case GL_UNSIGNED_INT_VEC3: glUniform3uiv(command.location, command.count, u); break;
+    case GL_UNSIGNED_INT_VEC4: glUniform4uiv(command.location, command.count, u); break;
+    case GL_FLOAT_MAT3:        glUniformMatrix3fv(command.location, command.count, GL_FALSE, f); break;
+    case GL_FLOAT_MAT4:        glUniformMatrix4fv(command.location, command.count, GL_FALSE, f); break;
+    default:
+        break;
+    }
+}
+
+}
+
+namespace glow
+{
+
+CommandList::CommandList()
+: m_commandCount(0)
+{
+}
+
+CommandList::~CommandList()
+{
+}
+
+void * CommandList::append(unsigned int opcode, std::size_t size)
+{
+    const std::size_t offset = m_data.size();
+    const Header header = { static_cast<std::uint32_t>(opcode), static_cast<std::uint32_t>(padded(size)) };
+
+    // grows geometrically, so recording into a reset list does not allocate once it reached its size
+    m_data.resize(offset + padded(sizeof(Header)) + header.size);
+    std::memcpy(&m_data[offset], &header, sizeof(Header));
+
+    ++m_commandCount;
+
+    return &m_data[offset + padded(sizeof(Header))];
+}
+
+template <typename Command>
+void CommandList::append(unsigned int opcode, const Command & command)
+{
+    std::memcpy(append(opcode, sizeof(Command)), &command, sizeof(Command));
+}
+
+void CommandList::useProgram(const Program * program)
+{
+    append(UseProgram, NameCommand{ GL_NONE, nameOf(program) });
+}
+
+void CommandList::bindVertexArray(const VertexArrayObject * vao)
+{
+    append(BindVertexArray, NameCommand{ GL_NONE, nameOf(vao) });
+}
+
+void CommandList::bindBuffer(GLenum target, const Buffer * buffer)
+{
+    append(BindBuffer, NameCommand{ target, nameOf(buffer) });
+}
+
+void CommandList::bindBufferBase(GLenum target, GLuint index, const Buffer * buffer)
+{
+    append(BindBufferBase, BufferRangeCommand{ target, index, nameOf(buffer), 0, 0 });
+}
+
+void CommandList::bindBufferRange(GLenum target, GLuint index, const Buffer * buffer, GLintptr offset, GLsizeiptr size)
+{
+    append(BindBufferRange, BufferRangeCommand{ target, index, nameOf(buffer), offset, size });
+}
+
+void CommandList::bindTexture(GLuint unit, const Texture * texture)
+{
+    append(BindTexture, TextureCommand{ unit, texture ? texture->target() : GL_TEXTURE_2D, nameOf(texture) });
+}
+
+void CommandList::bindFramebuffer(GLenum target, const FrameBufferObject * fbo)
+{
+    append(BindFramebuffer, NameCommand{ target, nameOf(fbo) });
+}
+
+void CommandList::setUniform(GLint location, GLint value)
+{
+    setUniform(location, GL_INT, 1, &value);
+}
+
+void CommandList::setUniform(GLint location, GLuint value)
+{
+    setUniform(location, GL_UNSIGNED_INT, 1, &value);
+}
+
+void CommandList::setUniform(GLint location, GLfloat value)
+{
+    setUniform(location, GL_FLOAT, 1, &value);
+}
+
+void CommandList::setUniform(GLint location, const glm::vec2 & value)
+{
+    setUniform(location, GL_FLOAT_VEC2, 1, glm::value_ptr(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::vec3 & value)
+{
+    setUniform(location, GL_FLOAT_VEC3, 1, glm::value_ptr(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::vec4 & value)
+{
+    setUniform(location, GL_FLOAT_VEC4, 1, glm::value_ptr(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::ivec2 & value)
+{
+    setUniform(location, GL_INT_VEC2, 1, glm::value_ptr(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::ivec3 & value)
+{
+    setUniform(location, GL_INT_VEC3, 1, glm::value_ptr(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::ivec4 & value)
+{
+    setUniform(location, GL_INT_VEC4, 1, glm::value_ptr(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::mat3 & value)
+{
+    setUniform(location, GL_FLOAT_MAT3, 1, glm::value_ptr(value));
+}
+
+void CommandList::setUniform(GLint location, const glm::mat4 & value)
+{
+    setUniform(location, GL_FLOAT_MAT4, 1, glm::value_ptr(value));
+}
+
+void CommandList::setUniform(GLint location, GLenum type, GLsizei count, const void * data)
+{
+    const std::size_t size = uniformSize(type) * static_cast<std::size_t>(count);
+    assert(size > 0);
+
+    unsigned char * payload = static_cast<unsigned char *>(append(SetUniform, sizeof(UniformCommand) + size));
+
+    const UniformCommand command = { location, type, count, 0 };
+    std::memcpy(payload, &command, sizeof(UniformCommand));
+    std::memcpy(payload + sizeof(UniformCommand), data, size);
+}
+
+void CommandList::enable(GLenum capability)
+{
+    append(Enable, capability);
+}
+
+void CommandList::disable(GLenum capability)
+{
+    append(Disable, capability);
+}
+
+void CommandList::blendFunc(GLenum sourceFactor, GLenum destinationFactor)
+{
+    append(BlendFunc, BlendFuncCommand{ sourceFactor, destinationFactor });
+}
+
+void CommandList::depthFunc(GLenum function)
+{
+    append(DepthFunc, function);
+}
+
+void CommandList::depthMask(GLboolean flag)
+{
+    append(DepthMask, static_cast<GLuint>(flag));
+}
+
+void CommandList::cullFace(GLenum mode)
+{
+    append(CullFace, mode);
+}
+
+void CommandList::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    append(Viewport, ViewportCommand{ x, y, width, height });
+}
+
+void CommandList::clearColor(const glm::vec4 & color)
+{
+    append(ClearColor, color);
+}
+
+void CommandList::clear(GLbitfield mask)
+{
+    append(Clear, mask);
+}
+
+void CommandList::drawArrays(GLenum mode, GLint first, GLsizei count, GLsizei instanceCount)
+{
+    append(DrawArrays, DrawArraysCommand{ mode, first, count, instanceCount });
+}
+
+void CommandList::drawElements(GLenum mode, GLsizei count, GLenum type, GLintptr offset, GLsizei instanceCount, GLint baseVertex)
+{
+    append(DrawElements, DrawElementsCommand{ mode, count, type, instanceCount, offset, baseVertex });
+}
+
+void CommandList::call(AbstractFunctionCall * functionCall)
+{
+    assert(functionCall != nullptr);
+
+    append(Call, static_cast<GLuint>(m_calls.size()));
+    m_calls.emplace_back(functionCall);
+}
+
+void CommandList::execute() const
+{
+    const unsigned char * data = m_data.data();
+    const unsigned char * end = data + m_data.size();
+
+    while (data < end)
+    {
+        const Header header = read<Header>(data);
+        const unsigned char * payload = data + padded(sizeof(Header));
+
+        switch (header.opcode)
+        {
+        case UseProgram:
+            glUseProgram(read<NameCommand>(payload).name);
+            break;
+
+        case BindVertexArray:
+            glBindVertexArray(read<NameCommand>(payload).name);
+            break;
+
+        case BindBuffer:
+        {
+            const NameCommand command = read<NameCommand>(payload);
+            glBindBuffer(command.target, command.name);
+            break;
+        }
+
+        case BindBufferBase:
+        {
+            const BufferRangeCommand command = read<BufferRangeCommand>(payload);
+            glBindBufferBase(command.target, command.index, command.name);
+            break;
+        }
+
+        case BindBufferRange:
+        {
+            const BufferRangeCommand command = read<BufferRangeCommand>(payload);
+            glBindBufferRange(command.target, command.index, command.name, command.offset, command.size);
+            break;
+        }
+
+        case BindTexture:
+        {
+            const TextureCommand command = read<TextureCommand>(payload);
+            glActiveTexture(GL_TEXTURE0 + command.unit);
+            glBindTexture(command.target, command.name);
+            break;
+        }
+
+        case BindFramebuffer:
+        {
+            const NameCommand command = read<NameCommand>(payload);
+            glBindFramebuffer(command.target, command.name);
+            break;
+        }
+
+        case SetUniform:
+            applyUniform(read<UniformCommand>(payload), payload + sizeof(UniformCommand));
+            break;
+
+        case Enable:
+            glEnable(read<GLenum>(payload));
+            break;
+
+        case Disable:
+            glDisable(read<GLenum>(payload));
+            break;
+
+        case BlendFunc:
+        {
+            const BlendFuncCommand command = read<BlendFuncCommand>(payload);
+            glBlendFunc(command.sourceFactor, command.destinationFactor);
+            break;
+        }
+
+        case DepthFunc:
+            glDepthFunc(read<GLenum>(payload));
+            break;
+
+        case DepthMask:
+            glDepthMask(static_cast<GLboolean>(read<GLuint>(payload)));
+            break;
+
+        case CullFace:
+            glCullFace(read<GLenum>(payload));
+            break;
+
+        case Viewport:
+        {
+            const ViewportCommand command = read<ViewportCommand>(payload);
+            glViewport(command.x, command.y, command.width, command.height);
+            break;
+        }
+
+        case ClearColor:
+        {
+            const glm::vec4 color = read<glm::vec4>(payload);
+            glClearColor(color.r, color.g, color.b, color.a);
+            break;
+        }
+
+        case Clear:
+            glClear(read<GLbitfield>(payload));
+            break;
+
+        case DrawArrays:
+        {
+            const DrawArraysCommand command = read<DrawArraysCommand>(payload);
+            if (command.instanceCount == 1)
+                glDrawArrays(command.mode, command.first, command.count);
+            else
+                glDrawArraysInstanced(command.mode, command.first, command.count, command.instanceCount);
+            break;
+        }
+
+        case DrawElements:
+        {
+            const DrawElementsCommand command = read<DrawElementsCommand>(payload);
+            const void * indices = reinterpret_cast<const void *>(command.offset);
+
+            if (command.baseVertex != 0)
+                glDrawElementsInstancedBaseVertex(command.mode, command.count, command.type, indices, command.instanceCount, command.baseVertex);
+            else if (command.instanceCount != 1)
+                glDrawElementsInstanced(command.mode, command.count, command.type, indices, command.instanceCount);
+            else
+                glDrawElements(command.mode, command.count, command.type, indices);
+            break;
+        }
+
+        case Call:
+            (*m_calls[read<GLuint>(payload)])();
+            break;
+
+        default:
+            assert(false);
+            break;
+        }
+
+        data = payload + header.size;
+    }
+
+    // checked once per list, as checking every command would synchronize with the driver
+    CheckGLError();
+}
+
+void CommandList::reset()
+{
+    m_data.clear();
+    m_calls.clear();
+    m_commandCount = 0;
+}
+
+bool CommandList::isEmpty() const
+{
+    return m_commandCount == 0;
+}
+
+unsigned int CommandList::commandCount() const
+{
+    return m_commandCount;
+}
+
+std::size_t CommandList::size() const
+{
+    return m_data.size();
+}
+
+std::size_t CommandList::capacity() const
+{
+    return m_data.capacity();
+}
+
+} // namespace glow
@@ -0,0 +1,704 @@
+#include <glow/CompiledFormat.h>
+
+#include <cassert>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <glow/formatString.h>
+
+namespace
+{
+
+// compiled formats are never removed, so the cache is bounded for formats built at runtime
+const std::size_t s_maxCacheSize = 4096;
+
+std::mutex s_cacheMutex;
+std::unordered_map<const char *, std::unique_ptr<glow::CompiledFormat>> s_cache;
+
+/** \brief Formatting state carried over between specifiers, like fill and precision of a stream.
+ */
+struct State
+{
+    State()
+    : fill(' ')
+    , precision(6)
+    {
+    }
+
+    char fill;
+    int precision;
+};
+
+// prefix is the number of leading characters (sign, base) internal adjustment pads after
+void appendPadded(std::string & buffer, const char * value, std::size_t length, std::size_t prefix, const glow::CompiledFormat::Specifier & specifier, char fill)
+{
+    const std::size_t width = specifier.width > 0 ? static_cast<std::size_t>(specifier.width) : 0;
+
+    if (width <= length)
+    {
+        buffer.append(value, length);
+        return;
+    }
+
+    const std::size_t padding = width - length;
+
+    switch (specifier.adjustment)
+    {
+    case glow::CompiledFormat::Specifier::Left:
+        buffer.append(value, length);
+        buffer.append(padding, fill);
+        break;
+
+    case glow::CompiledFormat::Specifier::Internal:
+        buffer.append(value, prefix);
+        buffer.append(padding, fill);
+        buffer.append(value + prefix, length - prefix);
+        break;
+
+    default:
+        buffer.append(padding, fill);
+        buffer.append(value, length);
+    }
+}
+
+void appendString(std::string & buffer, const char * value, std::size_t length, const glow::CompiledFormat::Specifier & specifier, char fill)
+{
+    // internal adjustment applies to numbers only
+    appendPadded(buffer, value, length, 0, specifier, fill);
+}
+
+void appendInteger(std::string & buffer, bool isSigned, long long value, unsigned long long bits, const glow::CompiledFormat::Specifier & specifier, char fill)
+{
+    char digits[32];
+    char * end = digits + sizeof(digits);
+    char * begin = end;
+
+    std::size_t prefix = 0;
+
+    if (specifier.base == glow::CompiledFormat::Specifier::Decimal)
+    {
+        const bool negative = isSigned && value < 0;
+        unsigned long long magnitude = !isSigned ? bits
+            : negative ? 0ull - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+
+        do
+        {
+            *--begin = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        }
+        while (magnitude > 0);
+
+        if (negative || (isSigned && specifier.showPos))
+        {
+            *--begin = negative ? '-' : '+';
+            prefix = 1;
+        }
+    }
+    else
+    {
+        const bool hexadecimal = specifier.base == glow::CompiledFormat::Specifier::Hexadecimal;
+        const char * numerals = specifier.upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+        const unsigned int radix = hexadecimal ? 16 : 8;
+
+        unsigned long long magnitude = bits;
+        do
+        {
+            *--begin = numerals[magnitude % radix];
+            magnitude /= radix;
+        }
+        while (magnitude > 0);
+
+        if (specifier.showBase && bits != 0)
+        {
+            if (hexadecimal)
+            {
+                *--begin = specifier.upperCase ? 'X' : 'x';
+                *--begin = '0';
+                prefix = 2;
+            }
+            else
+            {
+                *--begin = '0';
+            }
+        }
+    }
+
+    appendPadded(buffer, begin, static_cast<std::size_t>(end - begin), prefix, specifier, fill);
+}
+
+void appendFloating(std::string & buffer, long double value, bool isLong, const glow::CompiledFormat::Specifier & specifier, const State & state)
+{
+    char conversion[16];
+    char * c = conversion;
+
+    *c++ = '%';
+    if (specifier.showPos)
+        *c++ = '+';
+    if (specifier.showPoint)
+        *c++ = '#';
+    *c++ = '.';
+    *c++ = '*';
+    if (isLong)
+        *c++ = 'L';
+
+    switch (specifier.floatField)
+    {
+    case glow::CompiledFormat::Specifier::Fixed:
+        *c++ = specifier.upperCase ? 'F' : 'f';
+        break;
+    case glow::CompiledFormat::Specifier::Scientific:
+        *c++ = specifier.upperCase ? 'E' : 'e';
+        break;
+    default:
+        *c++ = specifier.upperCase ? 'G' : 'g';
+    }
+    *c = '\0';
+
+    char digits[64];
+    int length = isLong
+        ? std::snprintf(digits, sizeof(digits), conversion, state.precision, value)
+        : std::snprintf(digits, sizeof(digits), conversion, state.precision, static_cast<double>(value));
+
+    if (length < 0)
+        return;
+
+    std::size_t prefix = digits[0] == '-' || digits[0] == '+' ? 1 : 0;
+
+    if (static_cast<std::size_t>(length) < sizeof(digits))
+    {
+        appendPadded(buffer, digits, static_cast<std::size_t>(length), prefix, specifier, state.fill);
+        return;
+    }
+
+    // large fixed values
+    std::vector<char> large(static_cast<std::size_t>(length) + 1);
+    if (isLong)
+        std::snprintf(large.data(), large.size(), conversion, state.precision, value);
+    else
+        std::snprintf(large.data(), large.size(), conversion, state.precision, static_cast<double>(value));
+
+    appendPadded(buffer, large.data(), static_cast<std::size_t>(length), prefix, specifier, state.fill);
+}
+
+void appendPointer(std::string & buffer, const void * value, const glow::CompiledFormat::Specifier & specifier, char fill)
+{
+    if (!value)
+    {
+        appendPadded(buffer, "0", 1, 0, specifier, fill);
+        return;
+    }
+
+    // like std::ostream, pointers are written in lowercase hexadecimal with base
+    glow::CompiledFormat::Specifier hexadecimal = specifier;
+    hexadecimal.base = glow::CompiledFormat::Specifier::Hexadecimal;
+    hexadecimal.showBase = true;
+    hexadecimal.upperCase = false;
+
+    const unsigned long long bits = static_cast<unsigned long long>(reinterpret_cast<std::uintptr_t>(value));
+    appendInteger(buffer, false, 0, bits, hexadecimal, fill);
+}
+
+void appendCustom(std::string & buffer, const glow::CompiledFormat::Argument & argument, const glow::CompiledFormat::Specifier & specifier, const State & state)
+{
+    std::ostringstream stream;
+
+    std::ios_base::fmtflags flags = std::ios_base::dec | std::ios_base::skipws;
+
+    switch (specifier.adjustment)
+    {
+    case glow::CompiledFormat::Specifier::Left:
+        flags |= std::ios_base::left;
+        break;
+    case glow::CompiledFormat::Specifier::Right:
+        flags |= std::ios_base::right;
+        break;
+    case glow::CompiledFormat::Specifier::Internal:
+        flags |= std::ios_base::internal;
+        break;
+    default:
+        break;
+    }
+
+    if (specifier.boolAlpha)
+        flags |= std::ios_base::boolalpha;
+    if (specifier.showPos)
+        flags |= std::ios_base::showpos;
+    if (specifier.showBase)
+        flags |= std::ios_base::showbase;
+    if (specifier.upperCase)
+        flags |= std::ios_base::uppercase;
+    if (specifier.showPoint)
+        flags |= std::ios_base::showpoint;
+
+    if (specifier.floatField == glow::CompiledFormat::Specifier::Fixed)
+        flags |= std::ios_base::fixed;
+    else if (specifier.floatField == glow::CompiledFormat::Specifier::Scientific)
+        flags |= std::ios_base::scientific;
+
+    if (specifier.base != glow::CompiledFormat::Specifier::Decimal)
+    {
+        flags &= ~std::ios_base::dec;
+        flags |= specifier.base == glow::CompiledFormat::Specifier::Octal ? std::ios_base::oct : std::ios_base::hex;
+    }
+
+    stream.flags(flags);
+    stream.fill(state.fill);
+    stream.precision(state.precision);
+    stream.width(specifier.width);
+
+    argument.write(stream, argument.pointer);
+
+    buffer += stream.str();
+}
+
+void appendArgument(std::string & buffer, const glow::CompiledFormat::Argument & argument, const glow::CompiledFormat::Specifier & specifier, State & state)
+{
+    if (specifier.fill != '\0')
+        state.fill = specifier.fill;
+    if (specifier.precision > 0)
+        state.precision = specifier.precision;
+
+    switch (argument.kind)
+    {
+    case glow::CompiledFormat::Argument::Signed:
+        appendInteger(buffer, true, argument.integer, argument.bits, specifier, state.fill);
+        break;
+
+    case glow::CompiledFormat::Argument::Unsigned:
+        appendInteger(buffer, false, 0, argument.bits, specifier, state.fill);
+        break;
+
+    case glow::CompiledFormat::Argument::Boolean:
+        if (!specifier.boolAlpha)
+            appendInteger(buffer, true, argument.integer, argument.bits, specifier, state.fill);
+        else if (argument.integer)
+            appendString(buffer, "true", 4, specifier, state.fill);
+        else
+            appendString(buffer, "false", 5, specifier, state.fill);
+        break;
+
+    case glow::CompiledFormat::Argument::Character:
+        {
+            const char character = static_cast<char>(argument.integer);
+            appendString(buffer, &character, 1, specifier, state.fill);
+        }
+        break;
+
+    case glow::CompiledFormat::Argument::Floating:
+    case glow::CompiledFormat::Argument::LongFloating:
+        appendFloating(buffer, argument.floating, argument.kind == glow::CompiledFormat::Argument::LongFloating, specifier, state);
+        break;
+
+    case glow::CompiledFormat::Argument::String:
+        appendString(buffer, argument.string, argument.length, specifier, state.fill);
+        break;
+
+    case glow::CompiledFormat::Argument::Pointer:
+        appendPointer(buffer, argument.pointer, specifier, state.fill);
+        break;
+
+    case glow::CompiledFormat::Argument::Custom:
+        appendCustom(buffer, argument, specifier, state);
+        break;
+    }
+}
+
+}
+
+namespace glow
+{
+
+CompiledFormat::Specifier::Specifier()
+: adjustment(DefaultAdjustment)
+, boolAlpha(false)
+, showPos(false)
+, showBase(false)
+, upperCase(false)
+, showPoint(false)
+, floatField(DefaultFloatField)
+, fill('\0')
+, width(0)
+, precision(0)
+, base(Decimal)
+{
+}
+
+CompiledFormat::Argument::Argument(bool value)
+: kind(Boolean)
+, integer(value ? 1 : 0)
+, bits(value ? 1 : 0)
+, floating(0)
+, string(nullptr)
+, length(0)
+, pointer(nullptr)
+, write(nullptr)
+{
+}
+
+CompiledFormat::Argument::Argument(char value)
+: kind(Character)
+, integer(value)
+, bits(0)
+, floating(0)
+, string(nullptr)
+, length(1)
+, pointer(nullptr)
+, write(nullptr)
+{
+}
+
+CompiledFormat::Argument::Argument(signed char value)
+: Argument(static_cast<char>(value))
+{
+}
+
+CompiledFormat::Argument::Argument(unsigned char value)
+: Argument(static_cast<char>(value))
+{
+}
+
+CompiledFormat::Argument::Argument(short value)
+: Argument(0)
+{
+    setSigned(value, static_cast<unsigned short>(value));
+}
+
+CompiledFormat::Argument::Argument(unsigned short value)
+: Argument(0)
+{
+    setUnsigned(value);
+}
+
+CompiledFormat::Argument::Argument(int value)
+: kind(Signed)
+, integer(0)
+, bits(0)
+, floating(0)
+, string(nullptr)
+, length(0)
+, pointer(nullptr)
+, write(nullptr)
+{
+    setSigned(value, static_cast<unsigned int>(value));
+}
+
+CompiledFormat::Argument::Argument(unsigned int value)
+: Argument(0)
+{
+    setUnsigned(value);
+}
+
+CompiledFormat::Argument::Argument(long value)
+: Argument(0)
+{
+    setSigned(value, static_cast<unsigned long>(value));
+}
+
+CompiledFormat::Argument::Argument(unsigned long value)
+: Argument(0)
+{
+    setUnsigned(value);
+}
+
+CompiledFormat::Argument::Argument(long long value)
+: Argument(0)
+{
+    setSigned(value, static_cast<unsigned long long>(value));
+}
+
+CompiledFormat::Argument::Argument(unsigned long long value)
+: Argument(0)
+{
+    setUnsigned(value);
+}
+
+CompiledFormat::Argument::Argument(float value)
+: Argument(static_cast<double>(value))
+{
+}
+
+CompiledFormat::Argument::Argument(double value)
+: Argument(0)
+{
+    kind = Floating;
+    floating = value;
+}
+
+CompiledFormat::Argument::Argument(long double value)
+: Argument(0)
+{
+    kind = LongFloating;
+    floating = value;
+}
+
+CompiledFormat::Argument::Argument(const char * value)
+: Argument(0)
+{
+    // like std::ostream, null strings are not written
+    kind = String;
+    string = value ? value : "";
+    length = value ? std::strlen(value) : 0;
+}
+
+CompiledFormat::Argument::Argument(const std::string & value)
+: Argument(0)
+{
+    kind = String;
+    string = value.data();
+    length = value.size();
+}
+
+CompiledFormat::Argument::Argument(const void * value)
+: Argument(0)
+{
+    kind = Pointer;
+    pointer = value;
+}
+
+void CompiledFormat::Argument::setSigned(long long value, unsigned long long bits)
+{
+    this->kind = Signed;
+    this->integer = value;
+    this->bits = bits;
+}
+
+void CompiledFormat::Argument::setUnsigned(unsigned long long value)
+{
+    this->kind = Unsigned;
+    this->integer = 0;
+    this->bits = value;
+}
+
+CompiledFormat::CompiledFormat(const char * format)
+: m_source(format)
+, m_tailBegin(0)
+{
+    assert(format != nullptr);
+
+    compile();
+}
+
+CompiledFormat::CompiledFormat(const std::string & format)
+: m_source(format)
+, m_tailBegin(0)
+{
+    compile();
+}
+
+const std::string & CompiledFormat::source() const
+{
+    return m_source;
+}
+
+std::size_t CompiledFormat::specifierCount() const
+{
+    return m_tokens.size();
+}
+
+const CompiledFormat::Specifier & CompiledFormat::specifier(std::size_t index) const
+{
+    return m_tokens.at(index).specifier;
+}
+
+void CompiledFormat::compile()
+{
+    const char * begin = m_source.c_str();
+    const char * format = begin;
+
+    std::size_t literalBegin = 0;
+
+    // mirrors the scanning of streamprintf: "%%" is an escaped %, any other % starts a specifier
+    while (*format)
+    {
+        if (*format == '%' && *++format != '%')
+        {
+            Token token;
+            token.literalBegin = literalBegin;
+            token.literalEnd = m_literals.size();
+
+            parseSpecifier(format, token.specifier);
+
+            token.sourceEnd = static_cast<std::size_t>(format - begin);
+            m_tokens.push_back(token);
+
+            literalBegin = m_literals.size();
+        }
+        else
+        {
+            m_literals += *format++;
+        }
+    }
+
+    m_tailBegin = literalBegin;
+}
+
+void CompiledFormat::parseSpecifier(const char *& format, Specifier & specifier)
+{
+    // see parseFormat for the reference implementation on streams
+
+    while (*format == 'l' || *format == 'r' || *format == 'i')
+    {
+        switch (*format++)
+        {
+        case 'l':
+            specifier.adjustment = Specifier::Left;
+            break;
+        case 'r':
+            specifier.adjustment = Specifier::Right;
+            break;
+        default:
+            specifier.adjustment = Specifier::Internal;
+        }
+    }
+
+    while (*format && std::strchr("a+ #up0", std::tolower(static_cast<unsigned char>(*format))))
+    {
+        // uppercase variants are accepted but have no effect
+        switch (*format++)
+        {
+        case 'a':
+            specifier.boolAlpha = true;
+            break;
+        case '+':
+            specifier.showPos = true;
+            break;
+        case '#':
+            specifier.showBase = true;
+            break;
+        case 'u':
+            specifier.upperCase = true;
+            break;
+        case 'p':
+            specifier.showPoint = true;
+            break;
+        case '0':
+            specifier.fill = '0';
+            break;
+        default:
+            break;
+        }
+    }
+
+    const char floatField = static_cast<char>(std::tolower(static_cast<unsigned char>(*format)));
+    if (*format && (floatField == 'f' || floatField == 'e'))
+    {
+        if (std::isupper(static_cast<unsigned char>(*format)))
+            specifier.upperCase = true;
+
+        specifier.floatField = floatField == 'f' ? Specifier::Fixed : Specifier::Scientific;
+        ++format;
+    }
+
+    if (*format == '?' && format[1])
+    {
+        specifier.fill = format[1];
+        format += 2;
+    }
+
+    int width;
+    format += readInt(format, width);
+    specifier.width = width;
+
+    if (*format == '.')
+    {
+        int precision;
+        ++format;
+        format += readInt(format, precision);
+        specifier.precision = precision;
+    }
+
+    // bases are lowercase only
+    switch (*format)
+    {
+    case 'd':
+        specifier.base = Specifier::Decimal;
+        ++format;
+        break;
+    case 'o':
+        specifier.base = Specifier::Octal;
+        ++format;
+        break;
+    case 'x':
+        specifier.base = Specifier::Hexadecimal;
+        ++format;
+        break;
+    default:
+        break;
+    }
+
+    while (*format && *format++ != ';');
+}
+
+void CompiledFormat::appendArguments(std::string & buffer, const Argument * arguments, std::size_t count) const
+{
+    if (count == 0)
+    {
+        buffer += m_source;
+        return;
+    }
+
+    State state;
+
+    const std::size_t rendered = count < m_tokens.size() ? count : m_tokens.size();
+
+    for (std::size_t i = 0; i < rendered; ++i)
+    {
+        const Token & token = m_tokens[i];
+
+        buffer.append(m_literals, token.literalBegin, token.literalEnd - token.literalBegin);
+        appendArgument(buffer, arguments[i], token.specifier, state);
+    }
+
+    // like streamprintf, the rest is written verbatim once the arguments are exhausted,
+    // and only scanned for escapes if arguments are left
+    if (count <= m_tokens.size())
+        buffer.append(m_source, m_tokens[count - 1].sourceEnd, std::string::npos);
+    else
+        buffer.append(m_literals, m_tailBegin, std::string::npos);
+}
+
+void CompiledFormat::appendCached(std::string & buffer, const char * format, const Argument * arguments, std::size_t count)
+{
+    assert(format != nullptr);
+
+    const CompiledFormat * compiled = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(s_cacheMutex);
+
+        auto i = s_cache.find(format);
+        if (i != s_cache.end())
+        {
+            if (i->second->source() == format)
+                compiled = i->second.get();
+        }
+        else if (s_cache.size() < s_maxCacheSize)
+        {
+            std::unique_ptr<CompiledFormat> & entry = s_cache[format];
+            entry.reset(new CompiledFormat(format));
+            compiled = entry.get();
+        }
+    }
+
+    // compiled formats are never removed, so they can be used without lock
+    if (compiled)
+        compiled->appendArguments(buffer, arguments, count);
+    else
+        CompiledFormat(format).appendArguments(buffer, arguments, count);
+}
+
+std::size_t CompiledFormat::cacheSize()
+{
+    std::lock_guard<std::mutex> lock(s_cacheMutex);
+
+    return s_cache.size();
+}
+
+} // namespace glow
@@ -8,14 +8,21 @@ namespace glow
 
 CompositeStringSource::CompositeStringSource()
 : m_dirty(true)
+, m_hash(0)
 {
 }
 
 CompositeStringSource::CompositeStringSource(const std::vector<AbstractStringSource*> & sources)
 : m_dirty(true)
+, m_hash(0)
 {
     for (AbstractStringSource * source : sources)
+    {
+        assert(source != nullptr);
+
         m_sources.push_back(source);
+        source->registerListener(this);
+    }
 }
 
 CompositeStringSource::~CompositeStringSource()
@@ -41,16 +48,32 @@ void CompositeStringSource::notifyChanged(Changeable *)
     changed();
 }
 
+Changeable * CompositeStringSource::propagatesTo()
+{
+    return this;
+}
+
 std::string CompositeStringSource::string() const
 {
-    std::stringstream source;
+    if (m_dirty)
+        update();
 
-    for (const std::string & str : strings())
+    size_t length = 0;
+    for (const StringChunk & chunk : m_chunks)
     {
-        source << str << std::endl;
+        length += chunk.length() + 1;
     }
 
-    return source.str();
+    std::string source;
+    source.reserve(length);
+
+    for (const StringChunk & chunk : m_chunks)
+    {
+        source.append(chunk.data(), chunk.length());
+        source.push_back('\n');
+    }
+
+    return source;
 }
 
 std::vector<std::string> CompositeStringSource::strings() const
@@ -58,7 +81,31 @@ std::vector<std::string> CompositeStringSource::strings() const
     if (m_dirty)
         update();
 
-    return m_strings;
+    std::vector<std::string> stringList;
+    stringList.reserve(m_chunks.size());
+
+    for (const StringChunk & chunk : m_chunks)
+    {
+        stringList.push_back(chunk.string());
+    }
+
+    return stringList;
+}
+
+void CompositeStringSource::chunksInto(std::vector<StringChunk>& vector) const
+{
+    if (m_dirty)
+        update();
+
+    vector.insert(vector.end(), m_chunks.begin(), m_chunks.end());
+}
+
+std::size_t CompositeStringSource::hash() const
+{
+    if (m_dirty)
+        update();
+
+    return m_hash;
 }
 
 void CompositeStringSource::flattenInto(std::vector<AbstractStringSource*>& vector) const
@@ -71,16 +118,15 @@ void CompositeStringSource::flattenInto(std::vector<AbstractStringSource*>& vect
 
 void CompositeStringSource::update() const
 {
-    m_strings.clear();
+    m_chunks.clear();
 
     for (const ref_ptr<AbstractStringSource>& source : m_sources)
     {
-        for (const std::string & str : source->strings())
-        {
-            m_strings.push_back(str);
-        }
+        source->chunksInto(m_chunks);
     }
 
+    m_hash = combinedHash(m_chunks);
+
     m_dirty = false;
 }
 
@@ -0,0 +1,491 @@
+#include <glow/DebugMessageAggregator.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+#include <glow/DebugMessage.h>
+#include <glow/logging.h>
+
+namespace
+{
+
+const glow::DebugMessageAggregator::Clock::rep never = std::numeric_limits<glow::DebugMessageAggregator::Clock::rep>::min();
+
+std::size_t powerOfTwo(std::size_t value)
+{
+    std::size_t result = 2;
+    while (result < value)
+        result <<= 1;
+
+    return result;
+}
+
+std::size_t hash(unsigned long long key)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+
+    return static_cast<std::size_t>(key);
+}
+
+}
+
+namespace glow
+{
+
+const std::size_t DebugMessageAggregator::MaxMessageLength;
+
+struct DebugMessageAggregator::Entry
+{
+    std::atomic<unsigned long long> key; // 0 for unused entries
+    std::atomic<GLenum> severity;
+    std::atomic<unsigned long long> count;
+    std::atomic<unsigned long long> queuedCount; // count at the last queued occurrence
+    std::atomic<Clock::rep> first;
+    std::atomic<Clock::rep> last;
+    std::atomic<Clock::rep> lastQueued;
+};
+
+struct DebugMessageAggregator::Record
+{
+    unsigned long long key;
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    GLenum severity;
+    unsigned long long suppressedCount;
+    std::size_t length;
+    char text[MaxMessageLength];
+};
+
+// cell of a bounded multi-producer multi-consumer queue, see
+// http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+struct DebugMessageAggregator::Cell
+{
+    std::atomic<std::size_t> sequence;
+    Record record;
+};
+
+DebugMessageAggregator::DebugMessageAggregator(std::size_t queueCapacity, std::size_t maxDistinctMessages)
+: m_entries(new Entry[powerOfTwo(maxDistinctMessages * 2)])
+, m_entryMask(powerOfTwo(maxDistinctMessages * 2) - 1)
+, m_cells(new Cell[powerOfTwo(queueCapacity)])
+, m_cellMask(powerOfTwo(queueCapacity) - 1)
+, m_enqueuePosition(0)
+, m_dequeuePosition(0)
+, m_repeatInterval(std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)).count())
+, m_forwardErrors(true)
+, m_messageCount(0)
+, m_reportedCount(0)
+, m_droppedCount(0)
+, m_distinctCount(0)
+, m_handler(&DebugMessageAggregator::defaultHandler)
+, m_running(false)
+{
+    for (std::size_t i = 0; i <= m_entryMask; ++i)
+    {
+        Entry & entry = m_entries[i];
+        entry.key = 0;
+        entry.severity = 0;
+        entry.count = 0;
+        entry.queuedCount = 0;
+        entry.first = never;
+        entry.last = never;
+        entry.lastQueued = never;
+    }
+
+    for (std::size_t i = 0; i <= m_cellMask; ++i)
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+DebugMessageAggregator::~DebugMessageAggregator()
+{
+    stop();
+}
+
+void DebugMessageAggregator::setHandler(Handler handler)
+{
+    std::lock_guard<std::mutex> lock(m_reportMutex);
+    m_handler = handler ? handler : Handler(&DebugMessageAggregator::defaultHandler);
+}
+
+DebugMessageAggregator::Clock::duration DebugMessageAggregator::repeatInterval() const
+{
+    return Clock::duration(m_repeatInterval.load());
+}
+
+void DebugMessageAggregator::setRepeatInterval(Clock::duration interval)
+{
+    m_repeatInterval = interval.count();
+}
+
+bool DebugMessageAggregator::forwardsErrors() const
+{
+    return m_forwardErrors;
+}
+
+void DebugMessageAggregator::setForwardErrors(bool forward)
+{
+    m_forwardErrors = forward;
+}
+
+unsigned long long DebugMessageAggregator::key(GLenum source, GLenum type, GLuint id)
+{
+    // sources are never 0, hence neither are keys
+    return (static_cast<unsigned long long>(source & 0xffff) << 48) | (static_cast<unsigned long long>(type & 0xffff) << 32) | id;
+}
+
+DebugMessageAggregator::Entry * DebugMessageAggregator::entry(unsigned long long key)
+{
+    // open addressing with linear probing, entries are never removed
+
+    for (std::size_t probe = 0, i = hash(key) & m_entryMask; probe <= m_entryMask; ++probe, i = (i + 1) & m_entryMask)
+    {
+        Entry & entry = m_entries[i];
+
+        unsigned long long current = entry.key.load(std::memory_order_acquire);
+        if (current == key)
+            return &entry;
+
+        if (current != 0)
+            continue;
+
+        // the table is kept at most half full
+        if (m_distinctCount.load(std::memory_order_relaxed) > m_entryMask / 2)
+            return nullptr;
+
+        if (entry.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+        {
+            ++m_distinctCount;
+            return &entry;
+        }
+
+        if (current == key)
+            return &entry;
+    }
+    return nullptr;
+}
+
+bool DebugMessageAggregator::aggregate(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const char * message)
+{
+    const Clock::rep now = Clock::now().time_since_epoch().count();
+    const unsigned long long messageKey = key(source, type, id);
+
+    ++m_messageCount;
+
+    const bool handled = !(type == GL_DEBUG_TYPE_ERROR && m_forwardErrors);
+
+    Record record;
+    record.key = messageKey;
+    record.source = source;
+    record.type = type;
+    record.id = id;
+    record.severity = severity;
+    record.suppressedCount = 0;
+
+    Entry * entry = this->entry(messageKey);
+
+    // without a free entry, messages are queued without deduplication
+    if (entry)
+    {
+        const unsigned long long count = entry->count.fetch_add(1) + 1;
+
+        entry->severity.store(severity, std::memory_order_relaxed);
+        entry->last.store(now, std::memory_order_relaxed);
+
+        Clock::rep expected = never;
+        entry->first.compare_exchange_strong(expected, now, std::memory_order_relaxed);
+
+        // at most one occurrence per repeat interval is queued
+        Clock::rep lastQueued = entry->lastQueued.load(std::memory_order_relaxed);
+        if (lastQueued != never && now - lastQueued < m_repeatInterval.load(std::memory_order_relaxed))
+            return handled;
+
+        if (!entry->lastQueued.compare_exchange_strong(lastQueued, now, std::memory_order_relaxed))
+            return handled;
+
+        record.suppressedCount = count - 1 - entry->queuedCount.exchange(count);
+    }
+
+    if (!message)
+        length = 0;
+    else if (length < 0)
+        length = static_cast<GLsizei>(std::strlen(message));
+
+    record.length = std::min(static_cast<std::size_t>(length), MaxMessageLength);
+    if (record.length > 0)
+        std::memcpy(record.text, message, record.length);
+
+    if (!push(record))
+        ++m_droppedCount;
+
+    return handled;
+}
+
+bool DebugMessageAggregator::push(const Record & record)
+{
+    Cell * cell;
+    std::size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        cell = &m_cells[position & m_cellMask];
+
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+
+        if (difference == 0)
+        {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            return false; // full
+        }
+        else
+        {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    Record & target = cell->record;
+    target.key = record.key;
+    target.source = record.source;
+    target.type = record.type;
+    target.id = record.id;
+    target.severity = record.severity;
+    target.suppressedCount = record.suppressedCount;
+    target.length = record.length;
+    std::memcpy(target.text, record.text, record.length);
+
+    cell->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool DebugMessageAggregator::pop(Record & record)
+{
+    Cell * cell;
+    std::size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        cell = &m_cells[position & m_cellMask];
+
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+
+        if (difference == 0)
+        {
+            if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            return false; // empty
+        }
+        else
+        {
+            position = m_dequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    const Record & source = cell->record;
+    record.key = source.key;
+    record.source = source.source;
+    record.type = source.type;
+    record.id = source.id;
+    record.severity = source.severity;
+    record.suppressedCount = source.suppressedCount;
+    record.length = source.length;
+    std::memcpy(record.text, source.text, source.length);
+
+    cell->sequence.store(position + m_cellMask + 1, std::memory_order_release);
+
+    return true;
+}
+
+void DebugMessageAggregator::flush()
+{
+    std::lock_guard<std::mutex> lock(m_reportMutex);
+
+    Record record;
+    while (pop(record))
+        report(record);
+}
+
+void DebugMessageAggregator::report(const Record & record)
+{
+    const DebugMessage message(record.source, record.type, record.id, record.severity, std::string(record.text, record.length));
+
+    {
+        std::lock_guard<std::mutex> lock(m_textsMutex);
+        if (m_texts.find(record.key) == m_texts.end())
+            m_texts[record.key] = message.message;
+    }
+
+    ++m_reportedCount;
+
+    m_handler(message, record.suppressedCount);
+}
+
+void DebugMessageAggregator::start()
+{
+    if (m_running)
+        return;
+
+    m_running = true;
+    m_thread = std::thread(&DebugMessageAggregator::run, this);
+}
+
+void DebugMessageAggregator::stop()
+{
+    if (m_running)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+            m_running = false;
+        }
+        m_wake.notify_one();
+
+        m_thread.join();
+    }
+
+    flush();
+}
+
+bool DebugMessageAggregator::isRunning() const
+{
+    return m_running;
+}
+
+void DebugMessageAggregator::run()
+{
+    // producers never signal the thread, which would require a lock on their side, it polls instead
+
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+
+    while (m_running)
+    {
+        lock.unlock();
+        flush();
+        lock.lock();
+
+        m_wake.wait_for(lock, std::chrono::milliseconds(10), [this]() { return !m_running; });
+    }
+}
+
+unsigned long long DebugMessageAggregator::messageCount() const
+{
+    return m_messageCount;
+}
+
+unsigned long long DebugMessageAggregator::reportedCount() const
+{
+    return m_reportedCount;
+}
+
+unsigned long long DebugMessageAggregator::droppedCount() const
+{
+    return m_droppedCount;
+}
+
+std::size_t DebugMessageAggregator::distinctCount() const
+{
+    return m_distinctCount;
+}
+
+std::vector<DebugMessageAggregator::Summary> DebugMessageAggregator::summary() const
+{
+    std::vector<Summary> result;
+
+    for (std::size_t i = 0; i <= m_entryMask; ++i)
+    {
+        const Entry & entry = m_entries[i];
+
+        const unsigned long long entryKey = entry.key.load(std::memory_order_acquire);
+        if (entryKey == 0)
+            continue;
+
+        Summary summary;
+        summary.source = static_cast<GLenum>(entryKey >> 48);
+        summary.type = static_cast<GLenum>((entryKey >> 32) & 0xffff);
+        summary.id = static_cast<GLuint>(entryKey & 0xffffffff);
+        summary.severity = entry.severity;
+        summary.count = entry.count;
+        summary.first = Clock::time_point(Clock::duration(entry.first.load()));
+        summary.last = Clock::time_point(Clock::duration(entry.last.load()));
+
+        {
+            std::lock_guard<std::mutex> lock(m_textsMutex);
+
+            auto it = m_texts.find(entryKey);
+            if (it != m_texts.end())
+                summary.message = it->second;
+        }
+
+        result.push_back(summary);
+    }
+
+    std::sort(result.begin(), result.end(), [](const Summary & a, const Summary & b) { return a.count > b.count; });
+
+    return result;
+}
+
+std::string DebugMessageAggregator::report() const
+{
+    std::stringstream stream;
+
+    stream << "Debug messages: " << messageCount() << " total, " << distinctCount() << " distinct, "
+        << reportedCount() << " reported, " << droppedCount() << " dropped";
+
+    for (const Summary & summary : this->summary())
+    {
+        const double seconds = std::chrono::duration<double>(summary.last - summary.first).count();
+
+        stream << std::endl << "  " << summary.count << "x " << DebugMessage::typeString(summary.type)
+            << " 0x" << std::hex << summary.id << std::dec
+            << " (" << DebugMessage::sourceString(summary.source) << ", " << DebugMessage::severityString(summary.severity) << " severity)"
+            << " over " << seconds << " s";
+
+        if (!summary.message.empty())
+            stream << ": " << summary.message.substr(0, summary.message.find('\n'));
+    }
+
+    return stream.str();
+}
+
+void DebugMessageAggregator::printReport() const
+{
+    std::stringstream stream(report());
+
+    std::string line;
+    while (std::getline(stream, line))
+        info() << line;
+}
+
+void DebugMessageAggregator::defaultHandler(const DebugMessage & message, unsigned long long suppressedCount)
+{
+    if (message.type == GL_DEBUG_TYPE_ERROR)
+    {
+        if (suppressedCount > 0)
+            warning() << message.toString() << " (" << suppressedCount << " repeats suppressed)";
+        else
+            warning() << message.toString();
+    }
+    else
+    {
+        if (suppressedCount > 0)
+            debug() << message.toString() << " (" << suppressedCount << " repeats suppressed)";
+        else
+            debug() << message.toString();
+    }
+}
+
+} // namespace glow
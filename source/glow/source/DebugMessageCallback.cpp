@@ -11,6 +11,7 @@ namespace glow
 
 DebugMessageCallback::DebugMessageCallback()
 : m_registered(false)
+, m_aggregator(nullptr)
 {
 }
 
@@ -46,6 +47,16 @@ void DebugMessageCallback::clearCallbacks()
     m_callbacks.clear();
 }
 
+DebugMessageAggregator * DebugMessageCallback::aggregator() const
+{
+    return m_aggregator;
+}
+
+void DebugMessageCallback::setAggregator(DebugMessageAggregator * aggregator)
+{
+    m_aggregator = aggregator;
+}
+
 void DebugMessageCallback::callCallbacks(const DebugMessage & message)
 {
     for (auto& callback: m_callbacks)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <functional>
 
@@ -7,6 +8,8 @@
 
 namespace glow {
 
+class DebugMessageAggregator;
+
 class DebugMessageCallback
 {
 public:
@@ -21,6 +24,9 @@ public:
 
     void addCallback(Callback callback);
     void clearCallbacks();
+
+    DebugMessageAggregator * aggregator() const;
+    void setAggregator(DebugMessageAggregator * aggregator);
 protected:
     void callCallbacks(const DebugMessage & message);
     void defaultAction(const DebugMessage & message);
@@ -30,6 +36,7 @@ protected:
 protected:
     std::vector<Callback> m_callbacks;
     bool m_registered;
+    std::atomic<DebugMessageAggregator *> m_aggregator; // messages can arrive on driver threads
 };
 
 } // namespace glow
@@ -1,22 +1,62 @@
 #include <glow/Extension.h>
 
 #include <set>
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 
 #include <glow/global.h>
 #include <glow/gl_extension_info.h>
 
+#include "contextid.h"
+#include "directstateaccess.h"
+
 
 namespace {
 
-std::set<glow::Extension> availableExtensions;
-std::set<std::string> additionalAvailableExtensions;
+struct Extensions
+{
+    std::set<glow::Extension> available;
+    std::set<std::string> additionalAvailable;
+    bool directStateAccess;
+};
+
+// extensions per context, contexts may be used concurrently in multiple threads
+std::unordered_map<long long, Extensions> extensionsByContext;
+std::mutex extensionsMutex;
+
+// extensions of the context last used by the thread, avoids locking for repeated queries (MSVC 2013 lacks thread_local)
+#ifdef _MSC_VER
+__declspec(thread) long long t_contextId = 0;
+__declspec(thread) const Extensions * t_extensions = nullptr;
+#else
+thread_local long long t_contextId = 0;
+thread_local const Extensions * t_extensions = nullptr;
+#endif
+
+const Extensions & currentExtensions()
+{
+    const long long contextId = glow::getContextId();
 
-bool extensionInitialized = false;
+    if (t_extensions && t_contextId == contextId)
+        return *t_extensions;
 
-void initializeExtensions()
-{
-    if (extensionInitialized)
-        return;
+    {
+        std::lock_guard<std::mutex> lock(extensionsMutex);
+
+        auto it = extensionsByContext.find(contextId);
+        if (it != extensionsByContext.end())
+        {
+            t_contextId = contextId;
+            t_extensions = &it->second;
+
+            return it->second;
+        }
+    }
+
+    // query without holding the lock, the current context is used by this thread only
+    Extensions extensions;
 
     for (const std::string & extensionName : glow::getExtensions())
     {
@@ -24,15 +64,24 @@ void initializeExtensions()
 
         if (extension != glow::GLOW_Unknown_Extension)
         {
-            availableExtensions.insert(extension);
+            extensions.available.insert(extension);
         }
         else
         {
-            additionalAvailableExtensions.insert(extensionName);
+            extensions.additionalAvailable.insert(extensionName);
         }
     }
 
-    extensionInitialized = true;
+    extensions.directStateAccess = extensions.available.find(glow::GLOW_EXT_direct_state_access) != extensions.available.end()
+        || glow::isInCoreProfile(glow::GLOW_EXT_direct_state_access);
+
+    // references to elements of an unordered_map stay valid on insertion
+    std::lock_guard<std::mutex> lock(extensionsMutex);
+
+    t_contextId = contextId;
+    t_extensions = &extensionsByContext.insert(std::make_pair(contextId, std::move(extensions))).first->second;
+
+    return *t_extensions;
 }
 
 }
@@ -41,18 +90,15 @@ namespace glow {
 
 bool hasExtension(Extension extension)
 {
-    initializeExtensions();
-
     if (isInCoreProfile(extension))
         return true;
 
-    return availableExtensions.find(extension) != availableExtensions.end();
+    const Extensions & extensions = currentExtensions();
+    return extensions.available.find(extension) != extensions.available.end();
 }
 
 bool hasExtension(const std::string & extensionName)
 {
-    initializeExtensions();
-
     Extension extension = extensionFromString(extensionName);
 
     if (extension != glow::GLOW_Unknown_Extension)
@@ -61,35 +107,51 @@ bool hasExtension(const std::string & extensionName)
     }
     else
     {
-        return additionalAvailableExtensions.find(extensionName) != additionalAvailableExtensions.end();
+        const Extensions & extensions = currentExtensions();
+        return extensions.additionalAvailable.find(extensionName) != extensions.additionalAvailable.end();
     }
 }
 
+bool hasDirectStateAccess()
+{
+    return currentExtensions().directStateAccess;
+}
+
+bool hasDirectStateAccess(Extension extension)
+{
+    return hasDirectStateAccess() && hasExtension(extension);
+}
+
 bool isInCoreProfile(Extension extension)
 {
-    auto it = extensionVersions.find(extension);
-    if (it == extensionVersions.end())
+    if (extension < 0 || extension >= GLOW_Unknown_Extension)
         return false;
 
-    return it->second <= Version::current();
+    const ExtensionInfo & info = extensionInfos[extension];
+    if (info.majorVersion == 0)
+        return false;
+
+    return Version(info.majorVersion, info.minorVersion) <= Version::current();
 }
 
 std::string extensionString(Extension extension)
 {
-    auto it = extensionStrings.find(extension);
-    if (it == extensionStrings.end())
+    if (extension < 0 || extension >= GLOW_Unknown_Extension)
         return "UnknownExtension";
 
-    return it->second;
+    return extensionInfos[extension].name;
 }
 
 Extension extensionFromString(const std::string & extensionName)
 {
-    auto it = extensions.find(extensionName);
-    if (it == extensions.end())
+    const ExtensionName * end = extensionNames + extensionNameCount;
+    const ExtensionName * it = std::lower_bound(extensionNames, end, extensionName.c_str(),
+        [](const ExtensionName & entry, const char * name) { return std::strcmp(entry.name, name) < 0; });
+
+    if (it == end || std::strcmp(it->name, extensionName.c_str()) != 0)
         return GLOW_Unknown_Extension;
 
-    return it->second;
+    return it->extension;
 }
 
 } // namespace glow
@@ -11,8 +11,26 @@
 #include <glow/Buffer.h>
 #include <glow/RenderBufferObject.h>
 #include <glow/Texture.h>
+
+#include "directstateaccess.h"
 #include "pixelformat.h"
 
+namespace
+{
+
+// the default framebuffer has no name to be edited by
+bool directStateAccess(GLuint id)
+{
+    return id != 0 && glow::hasDirectStateAccess();
+}
+
+bool directStateAccess(GLuint id, glow::Extension extension)
+{
+    return id != 0 && glow::hasDirectStateAccess(extension);
+}
+
+}
+
 namespace glow
 {
 
@@ -86,20 +104,36 @@ void FrameBufferObject::unbind(GLenum target)
 
 void FrameBufferObject::setParameter(GLenum pname, GLint param)
 {
-	bind();
+    if (directStateAccess(m_id, GLOW_ARB_framebuffer_no_attachments))
+    {
+        glNamedFramebufferParameteriEXT(m_id, pname, param);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-	glFramebufferParameteri(m_target, pname, param);
-	CheckGLError();
+        glFramebufferParameteri(m_target, pname, param);
+        CheckGLError();
+    }
 }
 
 int FrameBufferObject::getAttachmentParameter(GLenum attachment, GLenum pname)
 {
-    bind();
-
     int result = 0;
 
-    glGetFramebufferAttachmentParameteriv(m_target, attachment, pname, &result);
-    CheckGLError();
+    if (directStateAccess(m_id))
+    {
+        glGetNamedFramebufferAttachmentParameterivEXT(m_id, attachment, pname, &result);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
+
+        glGetFramebufferAttachmentParameteriv(m_target, attachment, pname, &result);
+        CheckGLError();
+    }
 
     return result;
 }
@@ -108,10 +142,18 @@ void FrameBufferObject::attachTexture(GLenum attachment, Texture* texture, GLint
 {
     assert(texture != nullptr);
 
-	bind();
+    if (directStateAccess(m_id))
+    {
+        glNamedFramebufferTextureEXT(m_id, attachment, texture->id(), level);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-	glFramebufferTexture(m_target, attachment, texture->id(), level);
-	CheckGLError();
+        glFramebufferTexture(m_target, attachment, texture->id(), level);
+        CheckGLError();
+    }
 
     attach(new TextureAttachment(texture, attachment, level));
 }
@@ -120,10 +162,18 @@ void FrameBufferObject::attachTexture1D(GLenum attachment, Texture* texture, GLi
 {
     assert(texture != nullptr);
 
-	bind();
+    if (directStateAccess(m_id))
+    {
+        glNamedFramebufferTexture1DEXT(m_id, attachment, texture->target(), texture->id(), level);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-	glFramebufferTexture1D(m_target, attachment, texture->target(), texture->id(), level);
-	CheckGLError();
+        glFramebufferTexture1D(m_target, attachment, texture->target(), texture->id(), level);
+        CheckGLError();
+    }
 
     attach(new TextureAttachment(texture, attachment, level));
 }
@@ -132,10 +182,18 @@ void FrameBufferObject::attachTexture2D(GLenum attachment, Texture* texture, GLi
 {
     assert(texture != nullptr);
 
-	bind();
+    if (directStateAccess(m_id))
+    {
+        glNamedFramebufferTexture2DEXT(m_id, attachment, texture->target(), texture->id(), level);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-	glFramebufferTexture2D(m_target, attachment, texture->target(), texture->id(), level);
-	CheckGLError();
+        glFramebufferTexture2D(m_target, attachment, texture->target(), texture->id(), level);
+        CheckGLError();
+    }
 
     attach(new TextureAttachment(texture, attachment, level));
 }
@@ -144,10 +202,18 @@ void FrameBufferObject::attachTexture3D(GLenum attachment, Texture * texture, GL
 {
     assert(texture != nullptr);
 
-    bind();
+    if (directStateAccess(m_id))
+    {
+        glNamedFramebufferTexture3DEXT(m_id, attachment, texture->target(), texture->id(), level, layer);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glFramebufferTexture3D(m_target, attachment, texture->target(), texture->id(), level, layer);
-    CheckGLError();
+        glFramebufferTexture3D(m_target, attachment, texture->target(), texture->id(), level, layer);
+        CheckGLError();
+    }
 
     attach(new TextureAttachment(texture, attachment, level));
 }
@@ -156,10 +222,18 @@ void FrameBufferObject::attachTextureLayer(GLenum attachment, Texture* texture,
 {
     assert(texture != nullptr);
 
-	bind();
+    if (directStateAccess(m_id))
+    {
+        glNamedFramebufferTextureLayerEXT(m_id, attachment, texture->id(), level, layer);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-	glFramebufferTextureLayer(m_target, attachment, texture->id(), level, layer);
-	CheckGLError();
+        glFramebufferTextureLayer(m_target, attachment, texture->id(), level, layer);
+        CheckGLError();
+    }
 
     attach(new TextureAttachment(texture, attachment, level, layer));
 }
@@ -168,11 +242,19 @@ void FrameBufferObject::attachRenderBuffer(GLenum attachment, RenderBufferObject
 {
     assert(renderBuffer != nullptr);
 
-	bind();
-	renderBuffer->bind();
+    if (directStateAccess(m_id))
+    {
+        glNamedFramebufferRenderbufferEXT(m_id, attachment, GL_RENDERBUFFER, renderBuffer->id());
+        CheckGLError();
+    }
+    else
+    {
+        bind();
+        renderBuffer->bind();
 
-	glFramebufferRenderbuffer(m_target, attachment, GL_RENDERBUFFER, renderBuffer->id());
-	CheckGLError();
+        glFramebufferRenderbuffer(m_target, attachment, GL_RENDERBUFFER, renderBuffer->id());
+        CheckGLError();
+    }
 
 	attach(new RenderBufferAttachment(renderBuffer, attachment));
 }
@@ -185,25 +267,35 @@ void FrameBufferObject::detach(GLenum attachment)
 
     m_attachments.erase(attachment);
 
-    bind();
+    if (!directStateAccess(m_id))
+        bind();
 
     if (fAttachment->isTextureAttachment())
     {
         TextureAttachment * tAttachment = fAttachment->asTextureAttachment();
         if (tAttachment->hasLayer())
         {
-            glFramebufferTextureLayer(m_target, attachment, 0, tAttachment->level(), tAttachment->layer());
+            if (directStateAccess(m_id))
+                glNamedFramebufferTextureLayerEXT(m_id, attachment, 0, tAttachment->level(), tAttachment->layer());
+            else
+                glFramebufferTextureLayer(m_target, attachment, 0, tAttachment->level(), tAttachment->layer());
             CheckGLError();
         }
         else
         {
-            glFramebufferTexture(m_target, attachment, 0, tAttachment->level());
+            if (directStateAccess(m_id))
+                glNamedFramebufferTextureEXT(m_id, attachment, 0, tAttachment->level());
+            else
+                glFramebufferTexture(m_target, attachment, 0, tAttachment->level());
             CheckGLError();
         }
     }
     else if (fAttachment->isRenderBufferAttachment())
     {
-        glFramebufferRenderbuffer(m_target, attachment, GL_RENDERBUFFER, 0);
+        if (directStateAccess(m_id))
+            glNamedFramebufferRenderbufferEXT(m_id, attachment, GL_RENDERBUFFER, 0);
+        else
+            glFramebufferRenderbuffer(m_target, attachment, GL_RENDERBUFFER, 0);
         CheckGLError();
     }
 }
@@ -217,28 +309,52 @@ void FrameBufferObject::attach(FrameBufferAttachment* attachment)
 
 void FrameBufferObject::setReadBuffer(GLenum mode)
 {
-	bind(GL_READ_FRAMEBUFFER);
+    if (directStateAccess(m_id))
+    {
+        glFramebufferReadBufferEXT(m_id, mode);
+        CheckGLError();
+    }
+    else
+    {
+        bind(GL_READ_FRAMEBUFFER);
 
-	glReadBuffer(mode);
-	CheckGLError();
+        glReadBuffer(mode);
+        CheckGLError();
+    }
 }
 
 void FrameBufferObject::setDrawBuffer(GLenum mode)
 {
-	bind(GL_DRAW_FRAMEBUFFER);
+    if (directStateAccess(m_id))
+    {
+        glFramebufferDrawBufferEXT(m_id, mode);
+        CheckGLError();
+    }
+    else
+    {
+        bind(GL_DRAW_FRAMEBUFFER);
 
-	glDrawBuffer(mode);
-	CheckGLError();
+        glDrawBuffer(mode);
+        CheckGLError();
+    }
 }
 
 void FrameBufferObject::setDrawBuffers(GLsizei n, const GLenum* modes)
 {
     assert(modes != nullptr || n == 0);
 
-	bind(GL_DRAW_FRAMEBUFFER);
+    if (directStateAccess(m_id))
+    {
+        glFramebufferDrawBuffersEXT(m_id, n, modes);
+        CheckGLError();
+    }
+    else
+    {
+        bind(GL_DRAW_FRAMEBUFFER);
 
-	glDrawBuffers(n, modes);
-	CheckGLError();
+        glDrawBuffers(n, modes);
+        CheckGLError();
+    }
 }
 
 void FrameBufferObject::setDrawBuffers(const std::vector<GLenum>& modes)
@@ -413,11 +529,20 @@ void FrameBufferObject::blit(const std::array<GLint, 4> & srcRect, const std::ar
 
 GLenum FrameBufferObject::checkStatus()
 {
-	bind();
+    if (directStateAccess(m_id))
+    {
+        GLenum result = glCheckNamedFramebufferStatusEXT(m_id, m_target);
+        CheckGLError();
+        return result;
+    }
+    else
+    {
+        bind();
 
-	GLenum result = glCheckFramebufferStatus(m_target);
-	CheckGLError();
-	return result;
+        GLenum result = glCheckFramebufferStatus(m_target);
+        CheckGLError();
+        return result;
+    }
 }
 
 std::string FrameBufferObject::statusString()
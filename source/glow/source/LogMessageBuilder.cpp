@@ -102,7 +102,6 @@ LogMessageBuilder::LogMessageBuilder(LogMessage::Level level, AbstractLogHandler
 , m_handler(handler)
 , m_stream(new std::stringstream)
 {
-    assert(handler != nullptr);
 }
 
 LogMessageBuilder::LogMessageBuilder(const LogMessageBuilder& builder)
@@ -192,6 +191,12 @@ LogMessageBuilder& LogMessageBuilder::operator<<(unsigned long ul)
 	return *this;
 }
 
+LogMessageBuilder& LogMessageBuilder::operator<<(unsigned long long ull)
+{
+    *m_stream << ull;
+    return *this;
+}
+
 LogMessageBuilder& LogMessageBuilder::operator<<(unsigned char uc)
 {
     *m_stream << uc;
@@ -1,16 +1,26 @@
 #include <glow/ObjectRegistry.h>
 
 #include <cassert>
+#include <mutex>
 
 #include <glow/Object.h>
 
+namespace
+{
+
+// objects are created and deleted concurrently when using shared contexts in multiple threads
+std::mutex mutex;
+
+}
+
 namespace glow 
 {
 
 std::set<Object*> ObjectRegistry::s_objects;
 
-const std::set<Object*> & ObjectRegistry::objects()
+std::set<Object*> ObjectRegistry::objects()
 {
+    std::lock_guard<std::mutex> lock(mutex);
 	return s_objects;
 }
 
@@ -21,6 +31,7 @@ void ObjectRegistry::registerObject(Object* object)
 	if (object->id() == 0)
         return;
 
+    std::lock_guard<std::mutex> lock(mutex);
 	s_objects.insert(object);
 }
 
@@ -31,6 +42,7 @@ void ObjectRegistry::deregisterObject(Object* object)
     if (object->id() == 0)
         return;
 
+    std::lock_guard<std::mutex> lock(mutex);
     s_objects.erase(object);
 }
 
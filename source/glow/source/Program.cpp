@@ -341,6 +341,9 @@ void Program::addUniform(AbstractUniform * uniform)
 
 	uniformReference = uniform;
 
+    if (uniform->identity().isName())
+        m_uniformNames.insert(uniform);
+
 	uniform->registerProgram(this);
 
 	if (m_linked)
@@ -55,6 +55,11 @@ void ProgramBinary::notifyChanged(Changeable *)
     changed();
 }
 
+Changeable * ProgramBinary::propagatesTo()
+{
+    return this;
+}
+
 void ProgramBinary::validate() const
 {
     if (m_valid)
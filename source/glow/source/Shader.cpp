@@ -7,6 +7,7 @@
 #include <glow/logging.h>
 #include <glow/AbstractStringSource.h>
 #include <glow/StaticStringSource.h>
+#include <glow/StringChunk.h>
 #include <glow/Error.h>
 #include <glow/ObjectVisitor.h>
 #include <glow/Version.h>
@@ -18,7 +19,7 @@
 namespace
 {
 
-std::vector<const char*> collectCStrings(std::vector<std::string> & strings)
+std::vector<const char*> collectCStrings(const std::vector<std::string> & strings)
 {
     std::vector<const char*> cStrings;
 
@@ -127,27 +128,40 @@ void Shader::notifyChanged(Changeable *)
 	updateSource();
 }
 
+Changeable * Shader::propagatesTo()
+{
+    return this;
+}
+
 void Shader::updateSource()
 {
-    std::vector<std::string> sources;
+    std::vector<StringChunk> chunks;
 
     if (m_source)
     {
         if (glow::hasExtension(GLOW_ARB_shading_language_include) && !forceFallbackIncludeProcessor)
         {
-            sources = m_source->strings();
+            m_source->chunksInto(chunks);
         }
         else
         {
             ref_ptr<AbstractStringSource> resolvedSource = IncludeProcessor::resolveIncludes(m_source, m_includePaths);
 
-            sources = resolvedSource->strings();
+            resolvedSource->chunksInto(chunks);
         }
     }
 
-    std::vector<const char*> cStrings = collectCStrings(sources);
+    // the chunks keep the string data alive until glShaderSource has copied it
+    std::vector<const char*> cStrings(chunks.size());
+    std::vector<GLint> lengths(chunks.size());
+
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+        cStrings[i] = chunks[i].data();
+        lengths[i] = static_cast<GLint>(chunks[i].length());
+    }
 
-    glShaderSource(m_id, static_cast<GLint>(cStrings.size()), cStrings.data(), nullptr);
+    glShaderSource(m_id, static_cast<GLint>(cStrings.size()), cStrings.data(), lengths.data());
     CheckGLError();
 
     invalidate();
@@ -20,7 +20,18 @@ std::string StaticStringSource::shortInfo() const
 
 std::string StaticStringSource::string() const
 {
-    return m_string;
+    return m_string.string();
+}
+
+void StaticStringSource::chunksInto(std::vector<StringChunk>& vector) const
+{
+    vector.push_back(m_string);
+}
+
+std::size_t StaticStringSource::hash() const
+{
+    // equals combinedHash() of the single chunk
+    return StringChunk::combineHash(1, m_string.hash());
 }
 
 void StaticStringSource::setString(const std::string& string)
@@ -0,0 +1,74 @@
+#include <glow/StringChunk.h>
+
+#include <functional>
+
+namespace
+{
+
+const std::shared_ptr<const std::string> & emptyString()
+{
+    static const std::shared_ptr<const std::string> s_empty = std::make_shared<const std::string>();
+    return s_empty;
+}
+
+}
+
+namespace glow
+{
+
+StringChunk::StringChunk()
+: m_string(emptyString())
+, m_hash(std::hash<std::string>()(*m_string))
+{
+}
+
+StringChunk::StringChunk(const std::string & string)
+: m_string(std::make_shared<const std::string>(string))
+, m_hash(std::hash<std::string>()(*m_string))
+{
+}
+
+StringChunk::StringChunk(std::string && string)
+: m_string(std::make_shared<const std::string>(std::move(string)))
+, m_hash(std::hash<std::string>()(*m_string))
+{
+}
+
+StringChunk::StringChunk(const char * data, size_t length)
+: m_string(std::make_shared<const std::string>(data, length))
+, m_hash(std::hash<std::string>()(*m_string))
+{
+}
+
+const std::string & StringChunk::string() const
+{
+    return *m_string;
+}
+
+const char * StringChunk::data() const
+{
+    return m_string->data();
+}
+
+size_t StringChunk::length() const
+{
+    return m_string->size();
+}
+
+bool StringChunk::empty() const
+{
+    return m_string->empty();
+}
+
+std::size_t StringChunk::hash() const
+{
+    return m_hash;
+}
+
+std::size_t StringChunk::combineHash(std::size_t seed, std::size_t hash)
+{
+    // boost::hash_combine
+    return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+} // namespace glow
@@ -1,6 +1,7 @@
 #include <glow/Texture.h>
 
 #include <algorithm>
+#include <cassert>
 
 #include <glm/gtc/type_ptr.hpp>
 
@@ -8,20 +9,52 @@
 #include <glow/Buffer.h>
 #include <glow/ObjectVisitor.h>
 
+#include "directstateaccess.h"
 #include "pixelformat.h"
 
 namespace glow
 {
 
+Texture::Description::Description(GLenum target)
+: target(target)
+, internalFormat(0)
+, size(0)
+, levels(0)
+, samples(0)
+, immutable(false)
+{
+}
+
+bool Texture::Description::isSpecified() const
+{
+    return internalFormat != 0;
+}
+
+glm::ivec3 Texture::Description::levelSize(GLint level) const
+{
+    glm::ivec3 result = size;
+
+    // layers of array textures are not reduced
+    result.x = std::max(1, size.x >> level);
+    if (target != GL_TEXTURE_1D_ARRAY)
+        result.y = std::max(1, size.y >> level);
+    if (target == GL_TEXTURE_3D)
+        result.z = std::max(1, size.z >> level);
+
+    return result;
+}
+
 Texture::Texture(GLenum  target)
 : Object(genTexture())
 , m_target(target)
+, m_description(target)
 {
 }
 
 Texture::Texture(GLuint id, GLenum  target, bool ownsGLObject)
 : Object(id, ownsGLObject)
 , m_target(target)
+, m_description(target)
 {
 }
 
@@ -81,115 +114,266 @@ GLenum Texture::target() const
     return m_target;
 }
 
+const Texture::Description & Texture::description() const
+{
+    return m_description;
+}
+
+glm::ivec3 Texture::size(GLint level)
+{
+    if (m_description.isSpecified() && level < m_description.levels && m_description.size.x > 0)
+        return m_description.levelSize(level);
+
+    return glm::ivec3(
+        getLevelParameter(level, GL_TEXTURE_WIDTH)
+    ,   getLevelParameter(level, GL_TEXTURE_HEIGHT)
+    ,   getLevelParameter(level, GL_TEXTURE_DEPTH));
+}
+
+GLenum Texture::internalFormat()
+{
+    if (m_description.isSpecified())
+        return m_description.internalFormat;
+
+    return static_cast<GLenum>(getLevelParameter(0, GL_TEXTURE_INTERNAL_FORMAT));
+}
+
+void Texture::specify(GLint level, GLenum internalFormat, const glm::ivec3 & size, GLsizei samples)
+{
+    if (m_description.immutable)
+        return;
+
+    m_description.levels = std::max(m_description.levels, level + 1);
+
+    // the base level defines format and size, other levels are expected to be consistent
+    if (level != 0)
+        return;
+
+    m_description.internalFormat = internalFormat;
+    m_description.size = size;
+    m_description.samples = samples;
+}
+
+void Texture::specifyStorage(GLsizei levels, GLenum internalFormat, const glm::ivec3 & size)
+{
+    m_description.internalFormat = internalFormat;
+    m_description.size = size;
+    m_description.levels = levels;
+    m_description.samples = 0;
+    m_description.immutable = true;
+}
+
 void Texture::setParameter(GLenum name, GLint value)
 {
-	bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureParameteriEXT(m_id, m_target, name, value);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexParameteri(m_target, name, value);
-	CheckGLError();
+        glTexParameteri(m_target, name, value);
+        CheckGLError();
+    }
 }
 
 void Texture::setParameter(GLenum name, GLfloat value)
 {
-	bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureParameterfEXT(m_id, m_target, name, value);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexParameterf(m_target, name, value);
-	CheckGLError();
+        glTexParameterf(m_target, name, value);
+        CheckGLError();
+    }
 }
 
 GLint Texture::getParameter(GLenum pname)
 {
-	bind();
-
 	GLint value = 0;
 
-    glGetTexParameteriv(m_target, pname, &value);
-	CheckGLError();
+    if (hasDirectStateAccess())
+    {
+        glGetTextureParameterivEXT(m_id, m_target, pname, &value);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
+
+        glGetTexParameteriv(m_target, pname, &value);
+        CheckGLError();
+    }
 
 	return value;
 }
 
 GLint Texture::getLevelParameter(GLint level, GLenum pname)
 {
-	bind();
-
 	GLint value = 0;
 
-    glGetTexLevelParameteriv(m_target, level, pname, &value);
-	CheckGLError();
+    if (hasDirectStateAccess())
+    {
+        glGetTextureLevelParameterivEXT(m_id, m_target, level, pname, &value);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
+
+        glGetTexLevelParameteriv(m_target, level, pname, &value);
+        CheckGLError();
+    }
 
 	return value;
 }
 
 void Texture::getImage(GLint level, GLenum format, GLenum type, GLvoid * image)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glGetTextureImageEXT(m_id, m_target, level, format, type, image);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glGetTexImage(m_target, level, format, type, image);
-    CheckGLError();
+        glGetTexImage(m_target, level, format, type, image);
+        CheckGLError();
+    }
 }
 
 std::vector<unsigned char> Texture::getImage(GLint level, GLenum format, GLenum type)
 {
-    GLint width = getLevelParameter(level, GL_TEXTURE_WIDTH);
-    GLint height = getLevelParameter(level, GL_TEXTURE_HEIGHT);
-
-    int byteSize = imageSizeInBytes(width, height, format, type);
-
-    std::vector<unsigned char> data(byteSize);
+    std::vector<unsigned char> data(static_cast<std::size_t>(imageSize(level, format, type)));
     getImage(level, format, type, data.data());
 
     return data;
 }
 
+void Texture::getImage(GLint level, GLenum format, GLenum type, Buffer * packBuffer, GLintptr offset)
+{
+    assert(packBuffer != nullptr);
+
+    // with a pixel pack buffer bound, the image pointer is an offset into the buffer
+    packBuffer->bind(GL_PIXEL_PACK_BUFFER);
+
+    getImage(level, format, type, reinterpret_cast<GLvoid *>(offset));
+
+    Buffer::unbind(GL_PIXEL_PACK_BUFFER);
+}
+
+GLsizeiptr Texture::imageSize(GLint level, GLenum format, GLenum type)
+{
+    const glm::ivec3 levelSize = size(level);
+
+    // images of 3D and array textures are returned consecutively, like rows
+    return imageSizeInBytes(levelSize.x, levelSize.y * std::max(levelSize.z, 1), format, type);
+}
+
 void Texture::getCompressedImage(GLint lod, GLvoid * image)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glGetCompressedTextureImageEXT(m_id, m_target, lod, image);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glGetCompressedTexImage(m_target, lod, image);
-    CheckGLError();
+        glGetCompressedTexImage(m_target, lod, image);
+        CheckGLError();
+    }
 }
 
 std::vector<unsigned char> Texture::getCompressedImage(GLint lod)
 {
-    GLint size = getLevelParameter(lod, GL_TEXTURE_COMPRESSED_IMAGE_SIZE);
-
-    std::vector<unsigned char> data(size);
+    std::vector<unsigned char> data(static_cast<std::size_t>(compressedImageSize(lod)));
     getCompressedImage(lod, data.data());
 
     return data;
 }
 
+void Texture::getCompressedImage(GLint lod, Buffer * packBuffer, GLintptr offset)
+{
+    assert(packBuffer != nullptr);
+
+    packBuffer->bind(GL_PIXEL_PACK_BUFFER);
+
+    getCompressedImage(lod, reinterpret_cast<GLvoid *>(offset));
+
+    Buffer::unbind(GL_PIXEL_PACK_BUFFER);
+}
+
+GLsizeiptr Texture::compressedImageSize(GLint lod)
+{
+    return getLevelParameter(lod, GL_TEXTURE_COMPRESSED_IMAGE_SIZE);
+}
+
 void Texture::image1D(GLint level, GLenum internalFormat, GLsizei width, GLint border, GLenum format, GLenum type, const GLvoid* data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureImage1DEXT(m_id, m_target, level, internalFormat, width, border, format, type, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexImage1D(m_target, level, internalFormat, width, border, format, type, data);
-    CheckGLError();
+        glTexImage1D(m_target, level, internalFormat, width, border, format, type, data);
+        CheckGLError();
+    }
+
+    specify(level, internalFormat, glm::ivec3(width, 1, 1));
 }
 
 void Texture::compressedImage1D(GLint level, GLenum internalFormat, GLsizei width, GLint border, GLsizei imageSize, const GLvoid * data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glCompressedTextureImage1DEXT(m_id, m_target, level, internalFormat, width, border, imageSize, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glCompressedTexImage1D(m_target, level, internalFormat, width, border, imageSize, data);
-    CheckGLError();
+        glCompressedTexImage1D(m_target, level, internalFormat, width, border, imageSize, data);
+        CheckGLError();
+    }
+
+    specify(level, internalFormat, glm::ivec3(width, 1, 1));
 }
 
 void Texture::subImage1D(GLint level, GLint xOffset, GLsizei width, GLenum format, GLenum type, const GLvoid * data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureSubImage1DEXT(m_id, m_target, level, xOffset, width, format, type, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexSubImage1D(m_target, level, xOffset, width, format, type, data);
-    CheckGLError();
+        glTexSubImage1D(m_target, level, xOffset, width, format, type, data);
+        CheckGLError();
+    }
 }
 
 void Texture::image2D(GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid* data)
 {
-	bind();
-
-    glTexImage2D(m_target, level, internalFormat, width, height, border, format, type, data);
-	CheckGLError();
+    image2D(m_target, level, internalFormat, width, height, border, format, type, data);
 }
 
 void Texture::image2D(GLint level, GLenum internalFormat, const glm::ivec2 & size, GLint border, GLenum format, GLenum type, const GLvoid* data)
@@ -199,10 +383,21 @@ void Texture::image2D(GLint level, GLenum internalFormat, const glm::ivec2 & siz
 
 void Texture::image2D(GLenum target, GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const GLvoid* data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureImage2DEXT(m_id, target, level, internalFormat, width, height, border, format, type, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexImage2D(target, level, internalFormat, width, height, border, format, type, data);
-    CheckGLError();
+        glTexImage2D(target, level, internalFormat, width, height, border, format, type, data);
+        CheckGLError();
+    }
+
+    // cube map faces share their size and format
+    specify(level, internalFormat, glm::ivec3(width, height, 1));
 }
 
 void Texture::image2D(GLenum target, GLint level, GLenum internalFormat, const glm::ivec2 & size, GLint border, GLenum format, GLenum type, const GLvoid* data)
@@ -212,10 +407,20 @@ void Texture::image2D(GLenum target, GLint level, GLenum internalFormat, const g
 
 void Texture::compressedImage2D(GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glCompressedTextureImage2DEXT(m_id, m_target, level, internalFormat, width, height, border, imageSize, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glCompressedTexImage2D(m_target, level, internalFormat, width, height, border, imageSize, data);
-    CheckGLError();
+        glCompressedTexImage2D(m_target, level, internalFormat, width, height, border, imageSize, data);
+        CheckGLError();
+    }
+
+    specify(level, internalFormat, glm::ivec3(width, height, 1));
 }
 
 void Texture::compressedImage2D(GLint level, GLenum internalFormat, const glm::ivec2 & size, GLint border, GLsizei imageSize, const GLvoid * data)
@@ -225,10 +430,18 @@ void Texture::compressedImage2D(GLint level, GLenum internalFormat, const glm::i
 
 void Texture::subImage2D(GLint level, GLint xOffset, GLint yOffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid * data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureSubImage2DEXT(m_id, m_target, level, xOffset, yOffset, width, height, format, type, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexSubImage2D(m_target, level, xOffset, yOffset, width, height, format, type, data);
-    CheckGLError();
+        glTexSubImage2D(m_target, level, xOffset, yOffset, width, height, format, type, data);
+        CheckGLError();
+    }
 }
 
 void Texture::subImage2D(GLint level, const glm::ivec2& offset, const glm::ivec2& size, GLenum format, GLenum type, const GLvoid * data)
@@ -238,10 +451,20 @@ void Texture::subImage2D(GLint level, const glm::ivec2& offset, const glm::ivec2
 
 void Texture::image3D(GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid* data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureImage3DEXT(m_id, m_target, level, internalFormat, width, height, depth, border, format, type, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexImage3D(m_target, level, internalFormat, width, height, depth, border, format, type, data);
-    CheckGLError();
+        glTexImage3D(m_target, level, internalFormat, width, height, depth, border, format, type, data);
+        CheckGLError();
+    }
+
+    specify(level, internalFormat, glm::ivec3(width, height, depth));
 }
 
 void Texture::image3D(GLint level, GLenum internalFormat, const glm::ivec3 & size, GLint border, GLenum format, GLenum type, const GLvoid* data)
@@ -251,10 +474,20 @@ void Texture::image3D(GLint level, GLenum internalFormat, const glm::ivec3 & siz
 
 void Texture::compressedImage3D(GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glCompressedTextureImage3DEXT(m_id, m_target, level, internalFormat, width, height, depth, border, imageSize, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glCompressedTexImage3D(m_target, level, internalFormat, width, height, depth, border, imageSize, data);
-    CheckGLError();
+        glCompressedTexImage3D(m_target, level, internalFormat, width, height, depth, border, imageSize, data);
+        CheckGLError();
+    }
+
+    specify(level, internalFormat, glm::ivec3(width, height, depth));
 }
 
 void Texture::compressedImage3D(GLint level, GLenum internalFormat, const glm::ivec3 & size, GLint border, GLsizei imageSize, const GLvoid * data)
@@ -264,10 +497,18 @@ void Texture::compressedImage3D(GLint level, GLenum internalFormat, const glm::i
 
 void Texture::subImage3D(GLint level, GLint xOffset, GLint yOffset, GLint zOffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const GLvoid * data)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureSubImage3DEXT(m_id, m_target, level, xOffset, yOffset, zOffset, width, height, depth, format, type, data);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexSubImage3D(m_target, level, xOffset, yOffset, zOffset, width, height, depth, format, type, data);
-    CheckGLError();
+        glTexSubImage3D(m_target, level, xOffset, yOffset, zOffset, width, height, depth, format, type, data);
+        CheckGLError();
+    }
 }
 
 void Texture::subImage3D(GLint level, const glm::ivec3& offset, const glm::ivec3& size, GLenum format, GLenum type, const GLvoid * data)
@@ -277,10 +518,13 @@ void Texture::subImage3D(GLint level, const glm::ivec3& offset, const glm::ivec3
 
 void Texture::image2DMultisample(GLsizei samples, GLenum internalFormat, GLsizei width, GLsizei height, GLboolean fixedSamplesLocations)
 {
+    // EXT_direct_state_access has no equivalent for mutable multisample images
     bind();
 
     glTexImage2DMultisample(m_target, samples, internalFormat, width, height, fixedSamplesLocations);
     CheckGLError();
+
+    specify(0, internalFormat, glm::ivec3(width, height, 1), samples);
 }
 
 void Texture::image2DMultisample(GLsizei samples, GLenum internalFormat, const glm::ivec2 & size, GLboolean fixedSamplesLocations)
@@ -294,6 +538,8 @@ void Texture::image3DMultisample(GLsizei samples, GLenum internalFormat, GLsizei
 
     glTexImage3DMultisample(m_target, samples, internalFormat, width, height, depth, fixedSamplesLocations);
     CheckGLError();
+
+    specify(0, internalFormat, glm::ivec3(width, height, depth), samples);
 }
 
 void Texture::image3DMultisample(GLsizei samples, GLenum internalFormat, const glm::ivec3 & size, GLboolean fixedSamplesLocations)
@@ -303,18 +549,38 @@ void Texture::image3DMultisample(GLsizei samples, GLenum internalFormat, const g
 
 void Texture::storage1D(GLsizei levels, GLenum internalFormat, GLsizei width)
 {
-    bind();
+    if (hasDirectStateAccess(GLOW_ARB_texture_storage))
+    {
+        glTextureStorage1DEXT(m_id, m_target, levels, internalFormat, width);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexStorage1D(m_target, levels, internalFormat, width);
-    CheckGLError();
+        glTexStorage1D(m_target, levels, internalFormat, width);
+        CheckGLError();
+    }
+
+    specifyStorage(levels, internalFormat, glm::ivec3(width, 1, 1));
 }
 
 void Texture::storage2D(GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height)
 {
-	bind();
+    if (hasDirectStateAccess(GLOW_ARB_texture_storage))
+    {
+        glTextureStorage2DEXT(m_id, m_target, levels, internalFormat, width, height);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexStorage2D(m_target, levels, internalFormat, width, height);
-	CheckGLError();
+        glTexStorage2D(m_target, levels, internalFormat, width, height);
+        CheckGLError();
+    }
+
+    specifyStorage(levels, internalFormat, glm::ivec3(width, height, 1));
 }
 
 void Texture::storage2D(GLsizei levels, GLenum internalFormat, const glm::ivec2 & size)
@@ -324,10 +590,20 @@ void Texture::storage2D(GLsizei levels, GLenum internalFormat, const glm::ivec2
 
 void Texture::storage3D(GLsizei levels, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth)
 {
-    bind();
+    if (hasDirectStateAccess(GLOW_ARB_texture_storage))
+    {
+        glTextureStorage3DEXT(m_id, m_target, levels, internalFormat, width, height, depth);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexStorage3D(m_target, levels, internalFormat, width, height, depth);
-    CheckGLError();
+        glTexStorage3D(m_target, levels, internalFormat, width, height, depth);
+        CheckGLError();
+    }
+
+    specifyStorage(levels, internalFormat, glm::ivec3(width, height, depth));
 }
 
 void Texture::storage3D(GLsizei levels, GLenum internalFormat, const glm::ivec3 & size)
@@ -339,14 +615,28 @@ void Texture::textureView(GLuint originalTexture, GLenum internalFormat, GLuint
 {
     glTextureView(m_id, m_target, originalTexture, internalFormat, minLevel, numLevels, minLayer, numLayers);
     CheckGLError();
+
+    // the size depends on the original texture and is queried on demand
+    specifyStorage(static_cast<GLsizei>(numLevels), internalFormat, glm::ivec3(0));
 }
 
 void Texture::texBuffer(GLenum internalFormat, Buffer * buffer)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glTextureBufferEXT(m_id, m_target, internalFormat, buffer ? buffer->id() : 0);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexBuffer(m_target, internalFormat, buffer ? buffer->id() : 0);
-    CheckGLError();
+        glTexBuffer(m_target, internalFormat, buffer ? buffer->id() : 0);
+        CheckGLError();
+    }
+
+    m_description.internalFormat = internalFormat;
+    m_description.levels = 1;
 }
 
 void Texture::texBuffer(GLenum activeTexture, GLenum internalFormat, Buffer * buffer)
@@ -357,10 +647,21 @@ void Texture::texBuffer(GLenum activeTexture, GLenum internalFormat, Buffer * bu
 
 void Texture::texBufferRange(GLenum internalFormat, Buffer * buffer, GLintptr offset, GLsizeiptr size)
 {
-    bind();
+    if (hasDirectStateAccess(GLOW_ARB_texture_buffer_range))
+    {
+        glTextureBufferRangeEXT(m_id, m_target, internalFormat, buffer ? buffer->id() : 0, offset, size);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glTexBufferRange(m_target, internalFormat, buffer ? buffer->id() : 0, offset, size);
-    CheckGLError();
+        glTexBufferRange(m_target, internalFormat, buffer ? buffer->id() : 0, offset, size);
+        CheckGLError();
+    }
+
+    m_description.internalFormat = internalFormat;
+    m_description.levels = 1;
 }
 
 void Texture::texBufferRange(GLenum activeTexture, GLenum internalFormat, Buffer * buffer, GLintptr offset, GLsizeiptr size)
@@ -426,10 +727,33 @@ void Texture::bindImageTexture(GLuint unit, GLint level, GLboolean layered, GLin
 
 void Texture::generateMipmap()
 {
-	bind();
+    if (hasDirectStateAccess())
+    {
+        glGenerateTextureMipmapEXT(m_id, m_target);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-    glGenerateMipmap(m_target);
-	CheckGLError();
+        glGenerateMipmap(m_target);
+        CheckGLError();
+    }
+
+    if (!m_description.isSpecified() || m_description.immutable)
+        return;
+
+    GLint extent = m_description.size.x;
+    if (m_target != GL_TEXTURE_1D_ARRAY)
+        extent = std::max(extent, m_description.size.y);
+    if (m_target == GL_TEXTURE_3D)
+        extent = std::max(extent, m_description.size.z);
+
+    GLsizei levels = 1;
+    while (extent >> levels)
+        ++levels;
+
+    m_description.levels = levels;
 }
 
 void Texture::accept(ObjectVisitor& visitor)
@@ -470,10 +794,18 @@ void Texture::makeNonResident()
 
 void Texture::pageCommitment(GLint level, GLint xOffset, GLint yOffset, GLint zOffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
 {
-    bind();
-
-    glTexPageCommitmentARB(m_target, level, xOffset, yOffset, zOffset, width, height, depth, commit);
-    CheckGLError();
+    if (hasDirectStateAccess(GLOW_ARB_sparse_texture))
+    {
+        glTexturePageCommitmentEXT(m_id, level, xOffset, yOffset, zOffset, width, height, depth, commit);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
+
+        glTexPageCommitmentARB(m_target, level, xOffset, yOffset, zOffset, width, height, depth, commit);
+        CheckGLError();
+    }
 }
 
 void Texture::pageCommitment(GLint level, const glm::ivec3& offset, const glm::ivec3& size, GLboolean commit)
@@ -0,0 +1,225 @@
+#include <glow/TextureReadback.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+#include <glow/Buffer.h>
+#include <glow/Error.h>
+#include <glow/Texture.h>
+
+namespace
+{
+
+const GLsizeiptr MinimumCapacity = 4096;
+
+}
+
+namespace glow
+{
+
+TextureReadback::Request::Request(TextureReadback * readback, Buffer * buffer, GLsizeiptr capacity, GLsizeiptr size)
+: m_readback(readback)
+, m_buffer(buffer)
+, m_capacity(capacity)
+, m_size(size)
+, m_fence(nullptr)
+, m_flushed(false)
+, m_data(nullptr)
+{
+}
+
+TextureReadback::Request::~Request()
+{
+    if (m_data)
+        unmap();
+
+    if (m_fence)
+    {
+        glDeleteSync(m_fence);
+        CheckGLError();
+    }
+
+    m_readback->recycle(m_buffer, m_capacity);
+}
+
+void TextureReadback::Request::insertFence()
+{
+    m_fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    CheckGLError();
+}
+
+bool TextureReadback::Request::isReady()
+{
+    return wait(0);
+}
+
+bool TextureReadback::Request::wait(GLuint64 timeout)
+{
+    if (!m_fence)
+        return true;
+
+    // the first wait flushes, otherwise the fence may never reach the GPU
+    const GLenum status = glClientWaitSync(m_fence, m_flushed ? 0 : GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+    CheckGLError();
+
+    m_flushed = true;
+
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        return false;
+
+    glDeleteSync(m_fence);
+    CheckGLError();
+
+    m_fence = nullptr;
+
+    return true;
+}
+
+const void * TextureReadback::Request::map()
+{
+    if (m_data)
+        return m_data;
+
+    wait();
+
+    m_data = m_buffer->mapRange(0, m_size, GL_MAP_READ_BIT);
+
+    // without direct state access, mapping binds the buffer to the pack target it was read into
+    Buffer::unbind(GL_PIXEL_PACK_BUFFER);
+
+    return m_data;
+}
+
+void TextureReadback::Request::unmap()
+{
+    if (!m_data)
+        return;
+
+    m_buffer->unmap();
+    Buffer::unbind(GL_PIXEL_PACK_BUFFER);
+
+    m_data = nullptr;
+}
+
+bool TextureReadback::Request::isMapped() const
+{
+    return m_data != nullptr;
+}
+
+GLsizeiptr TextureReadback::Request::size() const
+{
+    return m_size;
+}
+
+Buffer * TextureReadback::Request::buffer()
+{
+    return m_buffer;
+}
+
+TextureReadback::TextureReadback(unsigned int maxPooledBuffers)
+: m_maxPooledBuffers(maxPooledBuffers)
+, m_statistics()
+{
+}
+
+TextureReadback::~TextureReadback()
+{
+}
+
+ref_ptr<TextureReadback::Request> TextureReadback::getImage(Texture * texture, GLint level, GLenum format, GLenum type)
+{
+    assert(texture != nullptr);
+
+    ref_ptr<Request> request = this->request(texture->imageSize(level, format, type));
+
+    texture->getImage(level, format, type, request->buffer(), 0);
+    request->insertFence();
+
+    return request;
+}
+
+ref_ptr<TextureReadback::Request> TextureReadback::getCompressedImage(Texture * texture, GLint lod)
+{
+    assert(texture != nullptr);
+
+    ref_ptr<Request> request = this->request(texture->compressedImageSize(lod));
+
+    texture->getCompressedImage(lod, request->buffer(), 0);
+    request->insertFence();
+
+    return request;
+}
+
+TextureReadback::Request * TextureReadback::request(GLsizeiptr size)
+{
+    ++m_statistics.requestCount;
+
+    const GLsizeiptr requiredCapacity = capacity(size);
+
+    // most recently released first, its pages are the most likely to be resident
+    for (auto it = m_pool.rbegin(); it != m_pool.rend(); ++it)
+    {
+        if (it->capacity != requiredCapacity)
+            continue;
+
+        Buffer * buffer = it->buffer;
+        Request * request = new Request(this, buffer, requiredCapacity, size);
+
+        m_pool.erase(std::next(it).base());
+        ++m_statistics.reuseCount;
+
+        return request;
+    }
+
+    Buffer * buffer = createBuffer(requiredCapacity);
+    ++m_statistics.allocationCount;
+
+    return new Request(this, buffer, requiredCapacity, size);
+}
+
+Buffer * TextureReadback::createBuffer(GLsizeiptr capacity)
+{
+    Buffer * buffer = new Buffer(GL_PIXEL_PACK_BUFFER);
+    buffer->setData(capacity, nullptr, GL_STREAM_READ);
+
+    return buffer;
+}
+
+void TextureReadback::recycle(Buffer * buffer, GLsizeiptr capacity)
+{
+    if (m_maxPooledBuffers == 0)
+        return;
+
+    if (m_pool.size() >= m_maxPooledBuffers)
+        m_pool.erase(m_pool.begin());
+
+    m_pool.push_back({ buffer, capacity });
+}
+
+void TextureReadback::clear()
+{
+    m_pool.clear();
+}
+
+unsigned int TextureReadback::pooledCount() const
+{
+    return static_cast<unsigned int>(m_pool.size());
+}
+
+const TextureReadback::Statistics & TextureReadback::statistics() const
+{
+    return m_statistics;
+}
+
+GLsizeiptr TextureReadback::capacity(GLsizeiptr size)
+{
+    GLsizeiptr capacity = MinimumCapacity;
+
+    while (capacity < size)
+        capacity *= 2;
+
+    return capacity;
+}
+
+} // namespace glow
@@ -73,6 +73,34 @@ std::vector<GLint> UniformBlock::getActiveUniformIndices()
     return getActive(GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, getActive(GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS));
 }
 
+UniformBlockLayout UniformBlock::layout()
+{
+    const std::vector<GLint> indices = getActiveUniformIndices();
+
+    const std::vector<GLint> types = m_program->getActiveUniforms(indices, GL_UNIFORM_TYPE);
+    const std::vector<GLint> sizes = m_program->getActiveUniforms(indices, GL_UNIFORM_SIZE);
+    const std::vector<GLint> offsets = m_program->getActiveUniforms(indices, GL_UNIFORM_OFFSET);
+    const std::vector<GLint> arrayStrides = m_program->getActiveUniforms(indices, GL_UNIFORM_ARRAY_STRIDE);
+    const std::vector<GLint> matrixStrides = m_program->getActiveUniforms(indices, GL_UNIFORM_MATRIX_STRIDE);
+
+    UniformBlockLayout layout;
+
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        // the queried name contains the null terminator
+        std::string name = m_program->getActiveUniformName(static_cast<GLuint>(indices[i])).c_str();
+
+        if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+            name.resize(name.size() - 3);
+
+        layout.add(name, UniformBlockLayout::Member{ static_cast<GLenum>(types[i]), offsets[i], sizes[i], arrayStrides[i], matrixStrides[i] });
+    }
+
+    layout.setDataSize(getActive(GL_UNIFORM_BLOCK_DATA_SIZE));
+
+    return layout;
+}
+
 std::string UniformBlock::getName()
 {
     if (m_identity.isName())
@@ -0,0 +1,283 @@
+#include <glow/UniformBlockLayout.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <glow/logging.h>
+
+namespace
+{
+
+struct TypeInfo
+{
+    GLint componentSize;
+    GLint rows; ///< components per column vector
+    GLint columns; ///< 1 for scalars and vectors
+};
+
+bool typeInfo(GLenum type, TypeInfo & info)
+{
+    switch (type)
+    {
+    case GL_FLOAT:
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+    case GL_BOOL:
+        info = TypeInfo{ 4, 1, 1 }; return true;
+    case GL_FLOAT_VEC2:
+    case GL_INT_VEC2:
+    case GL_UNSIGNED_INT_VEC2:
+    case GL_BOOL_VEC2:
+        info = TypeInfo{ 4, 2, 1 }; return true;
+    case GL_FLOAT_VEC3:
+    case GL_INT_VEC3:
+    case GL_UNSIGNED_INT_VEC3:
+    case GL_BOOL_VEC3:
+        info = TypeInfo{ 4, 3, 1 }; return true;
+    case GL_FLOAT_VEC4:
+    case GL_INT_VEC4:
+    case GL_UNSIGNED_INT_VEC4:
+    case GL_BOOL_VEC4:
+        info = TypeInfo{ 4, 4, 1 }; return true;
+    case GL_DOUBLE:
+        info = TypeInfo{ 8, 1, 1 }; return true;
+    case GL_DOUBLE_VEC2:
+        info = TypeInfo{ 8, 2, 1 }; return true;
+    case GL_DOUBLE_VEC3:
+        info = TypeInfo{ 8, 3, 1 }; return true;
+    case GL_DOUBLE_VEC4:
+        info = TypeInfo{ 8, 4, 1 }; return true;
+    case GL_FLOAT_MAT2:
+        info = TypeInfo{ 4, 2, 2 }; return true;
+    case GL_FLOAT_MAT3:
+        info = TypeInfo{ 4, 3, 3 }; return true;
+    case GL_FLOAT_MAT4:
+        info = TypeInfo{ 4, 4, 4 }; return true;
+    case GL_FLOAT_MAT2x3:
+        info = TypeInfo{ 4, 3, 2 }; return true;
+    case GL_FLOAT_MAT2x4:
+        info = TypeInfo{ 4, 4, 2 }; return true;
+    case GL_FLOAT_MAT3x2:
+        info = TypeInfo{ 4, 2, 3 }; return true;
+    case GL_FLOAT_MAT3x4:
+        info = TypeInfo{ 4, 4, 3 }; return true;
+    case GL_FLOAT_MAT4x2:
+        info = TypeInfo{ 4, 2, 4 }; return true;
+    case GL_FLOAT_MAT4x3:
+        info = TypeInfo{ 4, 3, 4 }; return true;
+    case GL_DOUBLE_MAT2:
+        info = TypeInfo{ 8, 2, 2 }; return true;
+    case GL_DOUBLE_MAT3:
+        info = TypeInfo{ 8, 3, 3 }; return true;
+    case GL_DOUBLE_MAT4:
+        info = TypeInfo{ 8, 4, 4 }; return true;
+    case GL_DOUBLE_MAT2x3:
+        info = TypeInfo{ 8, 3, 2 }; return true;
+    case GL_DOUBLE_MAT2x4:
+        info = TypeInfo{ 8, 4, 2 }; return true;
+    case GL_DOUBLE_MAT3x2:
+        info = TypeInfo{ 8, 2, 3 }; return true;
+    case GL_DOUBLE_MAT3x4:
+        info = TypeInfo{ 8, 4, 3 }; return true;
+    case GL_DOUBLE_MAT4x2:
+        info = TypeInfo{ 8, 2, 4 }; return true;
+    case GL_DOUBLE_MAT4x3:
+        info = TypeInfo{ 8, 3, 4 }; return true;
+    default:
+        return false;
+    }
+}
+
+GLint roundUp(GLint value, GLint alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// std140 rounds the alignment of arrays and matrix columns up to the alignment of a vec4
+const GLint std140Alignment = 16;
+
+template <typename Matrix>
+void writeColumns(char * destination, GLint matrixStride, const Matrix & matrix, int columns)
+{
+    for (int i = 0; i < columns; ++i)
+        std::memcpy(destination + i * matrixStride, &matrix[i], sizeof(matrix[i]));
+}
+
+template <typename Vector>
+void writeBools(char * destination, const Vector & vector, int components)
+{
+    // GLSL booleans occupy 4 bytes each
+    for (int i = 0; i < components; ++i)
+    {
+        const GLuint value = vector[i] ? 1u : 0u;
+        std::memcpy(destination + i * sizeof(GLuint), &value, sizeof(GLuint));
+    }
+}
+
+}
+
+namespace glow
+{
+
+UniformBlockLayout::UniformBlockLayout(Packing packing)
+: m_packing(packing)
+, m_size(0)
+, m_alignment(1)
+, m_dataSize(-1)
+{
+}
+
+UniformBlockLayout::Packing UniformBlockLayout::packing() const
+{
+    return m_packing;
+}
+
+GLint UniformBlockLayout::add(const std::string & name, GLenum type)
+{
+    return add(name, type, 1, false);
+}
+
+GLint UniformBlockLayout::addArray(const std::string & name, GLenum type, GLint arraySize)
+{
+    return add(name, type, arraySize, true);
+}
+
+GLint UniformBlockLayout::add(const std::string & name, GLenum type, GLint arraySize, bool isArray)
+{
+    TypeInfo info;
+    if (!typeInfo(type, info) || arraySize < 1)
+    {
+        warning() << "Type " << type << " of uniform block member " << name << " is not supported.";
+        return -1;
+    }
+
+    // vec3 is aligned like vec4, matrices are stored as arrays of their column vectors
+    const GLint vectorAlignment = info.componentSize * (info.rows == 3 ? 4 : info.rows);
+    const GLint vectorSize = info.componentSize * info.rows;
+
+    GLint alignment = vectorAlignment;
+    GLint size = vectorSize;
+
+    Member member{ type, 0, arraySize, 0, 0 };
+
+    if (info.columns > 1)
+    {
+        member.matrixStride = m_packing == Std140 ? roundUp(vectorAlignment, std140Alignment) : vectorAlignment;
+
+        alignment = member.matrixStride;
+        size = info.columns * member.matrixStride;
+    }
+
+    if (isArray)
+    {
+        if (m_packing == Std140)
+            alignment = roundUp(alignment, std140Alignment);
+
+        member.arrayStride = roundUp(size, alignment);
+        size = arraySize * member.arrayStride;
+    }
+
+    member.offset = roundUp(m_size, alignment);
+
+    m_size = member.offset + size;
+    m_alignment = std::max(m_alignment, alignment);
+    m_members[name] = member;
+
+    return member.offset;
+}
+
+void UniformBlockLayout::add(const std::string & name, const Member & member)
+{
+    m_members[name] = member;
+}
+
+const UniformBlockLayout::Member * UniformBlockLayout::member(const std::string & name) const
+{
+    auto it = m_members.find(name);
+    return it != m_members.end() ? &it->second : nullptr;
+}
+
+const std::unordered_map<std::string, UniformBlockLayout::Member> & UniformBlockLayout::members() const
+{
+    return m_members;
+}
+
+GLint UniformBlockLayout::dataSize() const
+{
+    if (m_dataSize >= 0)
+        return m_dataSize;
+
+    return roundUp(m_size, m_packing == Std140 ? std::max(m_alignment, std140Alignment) : m_alignment);
+}
+
+void UniformBlockLayout::setDataSize(GLint size)
+{
+    m_dataSize = size;
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint, bool value)
+{
+    writeBools(destination, &value, 1);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint, const glm::bvec2 & value)
+{
+    writeBools(destination, value, 2);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint, const glm::bvec3 & value)
+{
+    writeBools(destination, value, 3);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint, const glm::bvec4 & value)
+{
+    writeBools(destination, value, 4);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat2 & value)
+{
+    writeColumns(destination, matrixStride, value, 2);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat3 & value)
+{
+    writeColumns(destination, matrixStride, value, 3);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat4 & value)
+{
+    writeColumns(destination, matrixStride, value, 4);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat2x3 & value)
+{
+    writeColumns(destination, matrixStride, value, 2);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat2x4 & value)
+{
+    writeColumns(destination, matrixStride, value, 2);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat3x2 & value)
+{
+    writeColumns(destination, matrixStride, value, 3);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat3x4 & value)
+{
+    writeColumns(destination, matrixStride, value, 3);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat4x2 & value)
+{
+    writeColumns(destination, matrixStride, value, 4);
+}
+
+void UniformBlockLayout::writeValue(char * destination, GLint matrixStride, const glm::mat4x3 & value)
+{
+    writeColumns(destination, matrixStride, value, 4);
+}
+
+} // namespace glow
@@ -0,0 +1,108 @@
+#include <glow/UniformBufferArena.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include <glow/Buffer.h>
+#include <glow/global.h>
+
+namespace glow
+{
+
+UniformBufferArena::UniformBufferArena(GLint offsetAlignment)
+: m_size(0)
+, m_offsetAlignment(offsetAlignment)
+, m_capacity(0)
+{
+}
+
+UniformBufferArena::~UniformBufferArena()
+{
+}
+
+GLint UniformBufferArena::offsetAlignment()
+{
+    if (m_offsetAlignment <= 0)
+        m_offsetAlignment = std::max(getInteger(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT), 1);
+
+    return m_offsetAlignment;
+}
+
+UniformBufferArena::Range UniformBufferArena::allocate(GLsizeiptr size)
+{
+    const GLsizeiptr alignment = offsetAlignment();
+
+    const Range range{ (m_size + alignment - 1) / alignment * alignment, size };
+
+    m_size = range.offset + size;
+    if (static_cast<GLsizeiptr>(m_staging.size()) < m_size)
+        m_staging.resize(std::max(static_cast<std::size_t>(m_size), 2 * m_staging.size()));
+
+    // unwritten members are zero instead of left overs from previous frames
+    std::memset(m_staging.data() + range.offset, 0, static_cast<std::size_t>(size));
+
+    return range;
+}
+
+UniformBufferArena::Range UniformBufferArena::allocate(const UniformBlockLayout & layout)
+{
+    return allocate(layout.dataSize());
+}
+
+void * UniformBufferArena::data(const Range & range)
+{
+    assert(range.offset + range.size <= m_size);
+
+    return m_staging.data() + range.offset;
+}
+
+void UniformBufferArena::upload()
+{
+    if (m_size == 0)
+        return;
+
+    if (!m_buffer)
+        m_buffer = new Buffer(GL_UNIFORM_BUFFER);
+
+    if (m_capacity < m_size)
+    {
+        m_capacity = std::max(m_size, 2 * m_capacity);
+        m_buffer->setData(m_capacity, nullptr, GL_STREAM_DRAW);
+    }
+
+    // invalidation lets the driver orphan the storage still in use by the previous frame
+    void * mapped = m_buffer->mapRange(0, m_size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (!mapped)
+    {
+        m_buffer->setSubData(0, m_size, m_staging.data());
+        return;
+    }
+
+    std::memcpy(mapped, m_staging.data(), static_cast<std::size_t>(m_size));
+    m_buffer->unmap();
+}
+
+void UniformBufferArena::bind(const Range & range, GLuint bindingIndex)
+{
+    assert(m_buffer);
+
+    m_buffer->bindRange(GL_UNIFORM_BUFFER, bindingIndex, range.offset, range.size);
+}
+
+void UniformBufferArena::clear()
+{
+    m_size = 0;
+}
+
+GLsizeiptr UniformBufferArena::size() const
+{
+    return m_size;
+}
+
+Buffer * UniformBufferArena::buffer()
+{
+    return m_buffer;
+}
+
+} // namespace glow
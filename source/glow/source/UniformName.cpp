@@ -0,0 +1,48 @@
+#include <glow/UniformName.h>
+
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+
+namespace
+{
+
+const char * intern(const std::string & name)
+{
+    // never freed, the interned names have to outlive all UniformNames referencing them
+    static std::unordered_set<std::string> * names = new std::unordered_set<std::string>();
+    static std::mutex mutex;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    return names->insert(name).first->c_str();
+}
+
+}
+
+namespace glow
+{
+
+UniformName::UniformName(const std::string & name)
+: m_data(intern(name))
+, m_length(name.size())
+, m_hash(hash(name.data(), name.size()))
+{
+}
+
+std::string UniformName::string() const
+{
+    return std::string(m_data, m_length);
+}
+
+bool UniformName::operator==(const UniformName & name) const
+{
+    return m_hash == name.m_hash && m_length == name.m_length
+        && (m_data == name.m_data || std::memcmp(m_data, name.m_data, m_length) == 0);
+}
+
+bool UniformName::operator!=(const UniformName & name) const
+{
+    return !(*this == name);
+}
+
+} // namespace glow
@@ -0,0 +1,94 @@
+#include <glow/UniformNameTable.h>
+
+#include <cassert>
+#include <cstring>
+
+#include <glow/AbstractUniform.h>
+#include <glow/UniformName.h>
+
+namespace glow
+{
+
+UniformNameTable::UniformNameTable()
+: m_entries(16, Entry{ 0, nullptr, nullptr })
+, m_size(0)
+{
+}
+
+UniformNameTable::Entry * UniformNameTable::slot(const char * name, std::size_t length, std::uint64_t hash)
+{
+    // capacity is a power of two and at most half of the entries are used, so probing terminates
+    const std::size_t mask = m_entries.size() - 1;
+
+    for (std::size_t i = static_cast<std::size_t>(hash) & mask; ; i = (i + 1) & mask)
+    {
+        Entry & entry = m_entries[i];
+
+        if (!entry.uniform)
+            return &entry;
+
+        if (entry.hash == hash)
+        {
+            const std::string & entryName = entry.uniform->name();
+            if (entryName.size() == length && std::memcmp(entryName.data(), name, length) == 0)
+                return &entry;
+        }
+    }
+}
+
+UniformNameTable::Entry * UniformNameTable::find(const char * name, std::size_t length, std::uint64_t hash)
+{
+    Entry * entry = slot(name, length, hash);
+    return entry->uniform ? entry : nullptr;
+}
+
+UniformNameTable::Entry * UniformNameTable::insert(AbstractUniform * uniform, const void * type)
+{
+    assert(uniform != nullptr);
+    assert(uniform->identity().isName());
+
+    if (2 * (m_size + 1) > m_entries.size())
+        grow();
+
+    const std::string & name = uniform->name();
+    const std::uint64_t hash = UniformName::hash(name.data(), name.size());
+
+    Entry * entry = slot(name.data(), name.size(), hash);
+    if (!entry->uniform)
+        ++m_size;
+
+    *entry = Entry{ hash, uniform, type };
+    return entry;
+}
+
+std::size_t UniformNameTable::size() const
+{
+    return m_size;
+}
+
+void UniformNameTable::clear()
+{
+    m_entries.assign(m_entries.size(), Entry{ 0, nullptr, nullptr });
+    m_size = 0;
+}
+
+void UniformNameTable::grow()
+{
+    std::vector<Entry> entries(m_entries.size() * 2, Entry{ 0, nullptr, nullptr });
+    entries.swap(m_entries);
+
+    const std::size_t mask = m_entries.size() - 1;
+    for (const Entry & entry : entries)
+    {
+        if (!entry.uniform)
+            continue;
+
+        std::size_t i = static_cast<std::size_t>(entry.hash) & mask;
+        while (m_entries[i].uniform)
+            i = (i + 1) & mask;
+
+        m_entries[i] = entry;
+    }
+}
+
+} // namespace glow
@@ -7,6 +7,7 @@
 #include <glow/VertexAttributeBinding.h>
 
 #include "container_helpers.hpp"
+#include "directstateaccess.h"
 
 namespace glow
 {
@@ -68,26 +69,50 @@ VertexAttributeBinding* VertexArrayObject::binding(GLuint bindingIndex)
 
 void VertexArrayObject::enable(GLint attributeIndex)
 {
-	bind();
+    if (hasDirectStateAccess())
+    {
+        glEnableVertexArrayAttribEXT(m_id, attributeIndex);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-	glEnableVertexAttribArray(attributeIndex);
-	CheckGLError();
+        glEnableVertexAttribArray(attributeIndex);
+        CheckGLError();
+    }
 }
 
 void VertexArrayObject::disable(GLint attributeIndex)
 {
-    bind();
+    if (hasDirectStateAccess())
+    {
+        glDisableVertexArrayAttribEXT(m_id, attributeIndex);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
 
-	glDisableVertexAttribArray(attributeIndex);
-	CheckGLError();
+        glDisableVertexAttribArray(attributeIndex);
+        CheckGLError();
+    }
 }
 
 void VertexArrayObject::setAttributeDivisor(GLint attributeIndex, GLuint divisor)
 {
-    bind();
-
-    glVertexAttribDivisor(attributeIndex, divisor);
-    CheckGLError();
+    if (hasDirectStateAccess(GLOW_ARB_instanced_arrays))
+    {
+        glVertexArrayVertexAttribDivisorEXT(m_id, attributeIndex, divisor);
+        CheckGLError();
+    }
+    else
+    {
+        bind();
+
+        glVertexAttribDivisor(attributeIndex, divisor);
+        CheckGLError();
+    }
 }
 
 std::vector<VertexAttributeBinding*> VertexArrayObject::bindings()
@@ -66,7 +66,7 @@ Buffer* VertexAttributeBinding::buffer() const
     return m_vbo;
 }
 
-void VertexAttributeBinding::setBuffer(Buffer* vbo, GLint baseoffset, GLint stride)
+void VertexAttributeBinding::setBuffer(Buffer* vbo, GLintptr baseoffset, GLint stride)
 {
     //assert(vbo != nullptr);
 
@@ -7,6 +7,8 @@
 #include <glow/VertexArrayObject.h>
 #include <glow/VertexAttributeBinding.h>
 
+#include "directstateaccess.h"
+
 namespace glow {
 
 VertexAttributeBindingImplementation::VertexAttributeBindingImplementation(VertexAttributeBinding* binding)
@@ -57,7 +59,7 @@ void VertexAttributeBinding_GL_3_0::bindAttribute(GLint /*attributeIndex*/)
     finishIfComplete();
 }
 
-void VertexAttributeBinding_GL_3_0::bindBuffer(Buffer* /*vbo*/, GLint baseoffset, GLint stride)
+void VertexAttributeBinding_GL_3_0::bindBuffer(Buffer* /*vbo*/, GLintptr baseoffset, GLint stride)
 {
     //assert(vbo != nullptr);
 
@@ -102,6 +104,33 @@ void VertexAttributeBinding_GL_3_0::finishIfComplete()
 
 void VertexAttributeBinding_GL_3_0::finish()
 {
+    const GLint attribute = attributeIndex();
+    const GLintptr offset = static_cast<GLintptr>(m_baseoffset + m_format.relativeoffset);
+
+    // the named 64 bit variant is defined by EXT_vertex_attrib_64bit
+    if (m_format.method == Format::L ? hasDirectStateAccess(GLOW_EXT_vertex_attrib_64bit) : hasDirectStateAccess())
+    {
+        const GLuint vaoId = vao()->id();
+        const GLuint vboId = vbo() ? vbo()->id() : 0;
+
+        switch (m_format.method)
+        {
+        case Format::I:
+            glVertexArrayVertexAttribIOffsetEXT(vaoId, vboId, attribute, m_format.size, m_format.type, m_stride, offset);
+            CheckGLError();
+            break;
+        case Format::L:
+            glVertexArrayVertexAttribLOffsetEXT(vaoId, vboId, attribute, m_format.size, m_format.type, m_stride, offset);
+            CheckGLError();
+            break;
+        default:
+            glVertexArrayVertexAttribOffsetEXT(vaoId, vboId, attribute, m_format.size, m_format.type, m_format.normalized, m_stride, offset);
+            CheckGLError();
+        }
+
+        return;
+    }
+
     vao()->bind();
     if (vbo())
     {
@@ -113,9 +142,6 @@ void VertexAttributeBinding_GL_3_0::finish()
         CheckGLError();
     }
 
-
-    const GLint attribute = attributeIndex();
-
     switch (m_format.method)
     {
     case Format::I:
@@ -159,44 +185,84 @@ VertexAttributeBinding_GL_4_3::VertexAttributeBinding_GL_4_3(VertexAttributeBind
 
 void VertexAttributeBinding_GL_4_3::bindAttribute(GLint attributeIndex)
 {
-    vao()->bind();
+    if (hasDirectStateAccess(GLOW_ARB_vertex_attrib_binding))
+    {
+        glVertexArrayVertexAttribBindingEXT(vao()->id(), attributeIndex, bindingIndex());
+        CheckGLError();
+    }
+    else
+    {
+        vao()->bind();
 
-    glVertexAttribBinding(attributeIndex, bindingIndex());
-    CheckGLError();
+        glVertexAttribBinding(attributeIndex, bindingIndex());
+        CheckGLError();
+    }
 }
 
-void VertexAttributeBinding_GL_4_3::bindBuffer(Buffer* vbo, GLint baseoffset, GLint stride)
+void VertexAttributeBinding_GL_4_3::bindBuffer(Buffer* vbo, GLintptr baseoffset, GLint stride)
 {
     //assert(vbo != nullptr);
 
-    vao()->bind();
+    if (hasDirectStateAccess(GLOW_ARB_vertex_attrib_binding))
+    {
+        glVertexArrayBindVertexBufferEXT(vao()->id(), bindingIndex(), vbo ? vbo->id() : 0, baseoffset, stride);
+        CheckGLError();
+    }
+    else
+    {
+        vao()->bind();
 
-    glBindVertexBuffer(bindingIndex(), vbo ? vbo->id() : 0, baseoffset, stride);
-    CheckGLError();
+        glBindVertexBuffer(bindingIndex(), vbo ? vbo->id() : 0, baseoffset, stride);
+        CheckGLError();
+    }
 }
 
 void VertexAttributeBinding_GL_4_3::setFormat(GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
 {
-    vao()->bind();
+    if (hasDirectStateAccess(GLOW_ARB_vertex_attrib_binding))
+    {
+        glVertexArrayVertexAttribFormatEXT(vao()->id(), attributeIndex(), size, type, normalized, relativeoffset);
+        CheckGLError();
+    }
+    else
+    {
+        vao()->bind();
 
-    glVertexAttribFormat(attributeIndex(), size, type, normalized, relativeoffset);
-    CheckGLError();
+        glVertexAttribFormat(attributeIndex(), size, type, normalized, relativeoffset);
+        CheckGLError();
+    }
 }
 
 void VertexAttributeBinding_GL_4_3::setIFormat(GLint size, GLenum type, GLuint relativeoffset)
 {
-    vao()->bind();
+    if (hasDirectStateAccess(GLOW_ARB_vertex_attrib_binding))
+    {
+        glVertexArrayVertexAttribIFormatEXT(vao()->id(), attributeIndex(), size, type, relativeoffset);
+        CheckGLError();
+    }
+    else
+    {
+        vao()->bind();
 
-    glVertexAttribIFormat(attributeIndex(), size, type, relativeoffset);
-    CheckGLError();
+        glVertexAttribIFormat(attributeIndex(), size, type, relativeoffset);
+        CheckGLError();
+    }
 }
 
 void VertexAttributeBinding_GL_4_3::setLFormat(GLint size, GLenum type, GLuint relativeoffset)
 {
-    vao()->bind();
+    if (hasDirectStateAccess(GLOW_ARB_vertex_attrib_binding))
+    {
+        glVertexArrayVertexAttribLFormatEXT(vao()->id(), attributeIndex(), size, type, relativeoffset);
+        CheckGLError();
+    }
+    else
+    {
+        vao()->bind();
 
-    glVertexAttribLFormat(attributeIndex(), size, type, relativeoffset);
-    CheckGLError();
+        glVertexAttribLFormat(attributeIndex(), size, type, relativeoffset);
+        CheckGLError();
+    }
 }
 
 } // namespace glow
@@ -25,7 +25,7 @@ public:
     virtual void bindAttribute(GLint attributeIndex) = 0;
     virtual void bindBuffer(
         Buffer * vbo
-    ,   GLint baseoffset
+    ,   GLintptr baseoffset
     ,   GLint stride) = 0;
 
     virtual void setFormat(
@@ -48,7 +48,7 @@ public:
     VertexAttributeBinding_GL_3_0(VertexAttributeBinding * binding);
 
     virtual void bindAttribute(GLint attributeIndex);
-    virtual void bindBuffer(Buffer* vbo, GLint baseoffset, GLint stride);
+    virtual void bindBuffer(Buffer* vbo, GLintptr baseoffset, GLint stride);
 
     virtual void setFormat(GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
     virtual void setIFormat(GLint size, GLenum type, GLuint relativeoffset);
@@ -85,7 +85,7 @@ protected:
     };
 
     Format m_format;
-    GLint m_baseoffset;
+    GLintptr m_baseoffset;
     GLint m_stride;
 
     bool m_hasFormat;
@@ -99,7 +99,7 @@ public:
     VertexAttributeBinding_GL_4_3(VertexAttributeBinding* binding);
 
     virtual void bindAttribute(GLint attributeIndex);
-    virtual void bindBuffer(Buffer * vbo, GLint baseoffset, GLint stride);
+    virtual void bindBuffer(Buffer * vbo, GLintptr baseoffset, GLint stride);
 
     virtual void setFormat(GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset);
     virtual void setIFormat(GLint size, GLenum type, GLuint relativeoffset);
@@ -6,52 +6,10 @@
 
 namespace {
 
-std::vector<std::string> extensions = {
-    "ARB",
-    "EXT",
-    "NV",
-    "AMD",
-    "ATI",
-    "KHR",
-    "SGIS",
-    "SGIX",
-    "IBM",
-    "INGR",
-    "APPLE",
-    "PGI",
-    "QCOM",
-    "OES",
-    "INTEL",
-    "IMG",
-    "WEBGL"
-};
-
-int extensionPriority(const std::string & name)
+const glow::GLconstant * lowerBound(GLenum param)
 {
-    std::size_t pos = name.find_last_of('_');
-    if (pos == std::string::npos)
-        return -1;
-
-    std::string extension = name.substr(pos+1);
-    auto it = std::find(extensions.begin(), extensions.end(), extension);
-    if (it == extensions.end())
-        return -1;
-
-    return static_cast<int>(it - extensions.begin());
-}
-
-void sortByExtension(std::vector<std::string> & names)
-{
-    std::sort(names.begin(), names.end(), [](const std::string& name1, const std::string& name2) {
-
-		int priority1 = extensionPriority(name1);
-		int priority2 = extensionPriority(name2);
-
-        if (priority1 == priority2)
-            return name1.size() < name2.size();
-
-        return priority1 < priority2;
-    });
+    return std::lower_bound(glow::GLconstants, glow::GLconstants + glow::GLconstantCount, param,
+        [](const glow::GLconstant & constant, GLenum value) { return constant.value < value; });
 }
 
 }
@@ -60,28 +18,31 @@ namespace glow {
 
 std::vector<std::string> enumNames(GLenum param)
 {
-    auto range = GLconstants.equal_range(static_cast<GLuint64>(param));
-
     std::vector<std::string> names;
-    for (auto it = range.first; it != range.second; ++it)
+
+    // names of equal value are already sorted by preference
+    for (const GLconstant * it = lowerBound(param); it != GLconstants + GLconstantCount && it->value == param; ++it)
     {
-        names.push_back(it->second);
+        names.push_back(it->name);
     }
 
-    sortByExtension(names);
-
     return names;
 }
 
 std::string enumName(GLenum param)
 {
-    std::vector<std::string> names = enumNames(param);
-    if (names.empty())
+    return enumNameCStr(param);
+}
+
+const char * enumNameCStr(GLenum param)
+{
+    const GLconstant * it = lowerBound(param);
+    if (it == GLconstants + GLconstantCount || it->value != param)
     {
         return "UNKNOWN_GL_ENUM";
     }
 
-    return names[0];
+    return it->name;
 }
 
 } // namespace glow
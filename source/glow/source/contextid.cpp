@@ -6,10 +6,30 @@
 //#include <...>
 #else
 #include <GL/glxew.h>
+#include <dlfcn.h>
 #endif
 
 #include "contextid.h"
 
+#if !defined(WIN32) && !defined(__APPLE__)
+
+namespace
+{
+
+// contexts created with EGL (e.g., offscreen contexts) are no GLX contexts, EGL is looked up
+// at runtime to avoid linking it
+using GetCurrentEGLContext = void * (*)();
+
+GetCurrentEGLContext getCurrentEGLContext()
+{
+    static const GetCurrentEGLContext function = reinterpret_cast<GetCurrentEGLContext>(dlsym(RTLD_DEFAULT, "eglGetCurrentContext"));
+    return function;
+}
+
+}
+
+#endif
+
 namespace glow {
 
 long long getContextId()
@@ -25,6 +45,9 @@ long long getContextId()
 #else
     const GLXContext context = glXGetCurrentContext();
     handle = reinterpret_cast<long long>(context);
+
+    if (!handle && getCurrentEGLContext())
+        handle = reinterpret_cast<long long>(getCurrentEGLContext()());
 #endif
 
     return handle;
@@ -1,10 +1,13 @@
 #include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <mutex>
 #include <unordered_map>
 
 #include <glow/logging.h>
 #include <glow/Error.h>
 #include <glow/DebugMessage.h>
+#include <glow/DebugMessageAggregator.h>
 #include <glow/global.h>
 #include <glow/Extension.h>
 
@@ -21,8 +24,11 @@
 
 namespace {
 
-bool manualErrorCheckFallbackEnabled = false;
+std::atomic<bool> manualErrorCheckFallbackEnabled(false);
+
+// callbacks per context, contexts may be used concurrently in multiple threads
 std::unordered_map<long long, glow::DebugMessageCallback> callbackStates;
+std::mutex callbackStatesMutex;
 
 }
 
@@ -33,6 +39,8 @@ DebugMessageCallback * currentDebugMessageCallback()
 {
     long long id = getContextId();
 
+    // references to elements of an unordered_map stay valid on insertion
+    std::lock_guard<std::mutex> lock(callbackStatesMutex);
     return &callbackStates[id];
 }
 
@@ -42,6 +50,12 @@ void APIENTRY debugMessageCallback(GLenum source, GLenum type, GLuint id, GLenum
         return;
 
     DebugMessageCallback & messageCallback = *reinterpret_cast<DebugMessageCallback*>(const_cast<void*>(param));
+
+    // the aggregator avoids building and handling a DebugMessage for every message
+    DebugMessageAggregator * aggregator = messageCallback.aggregator();
+    if (aggregator && aggregator->aggregate(source, type, id, severity, length, message))
+        return;
+
     messageCallback(glow::DebugMessage(source, type, id, severity, std::string(message, length)));
 }
 
@@ -77,6 +91,15 @@ void addCallback(Callback callback)
     registerDebugMessageCallback(messageCallback);
 }
 
+void setAggregator(DebugMessageAggregator * aggregator)
+{
+    DebugMessageCallback* messageCallback = currentDebugMessageCallback();
+    messageCallback->setAggregator(aggregator);
+
+    if (aggregator)
+        registerDebugMessageCallback(messageCallback);
+}
+
 
 void enable(bool synchronous, bool registerDefaultCallback)
 {
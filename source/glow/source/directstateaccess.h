@@ -0,0 +1,18 @@
+#pragma once
+
+#include <glow/gl_extensions.h>
+
+namespace glow {
+
+/** Returns whether EXT_direct_state_access is available in the current context.
+    The result is cached with the extensions of the context.
+ */
+bool hasDirectStateAccess();
+
+/** Returns whether EXT_direct_state_access and the given extension are available. Named entry
+    points of extensions beyond EXT_direct_state_access (e.g., glTextureStorage2DEXT of
+    ARB_texture_storage) are defined by their interaction and only exist if both are.
+ */
+bool hasDirectStateAccess(Extension extension);
+
+} // namespace glow
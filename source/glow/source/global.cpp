@@ -15,6 +15,13 @@ bool initializeGLEW(bool showWarnings)
     glewExperimental = GL_TRUE;
 
     GLenum result = glewInit();
+
+#ifdef GLEW_ERROR_NO_GLX_DISPLAY
+    // contexts created without GLX (e.g., using EGL) have no GLX display, GL is initialized nonetheless
+    if (result == GLEW_ERROR_NO_GLX_DISPLAY)
+        result = GLEW_OK;
+#endif
+
     if (result != GLEW_OK)
     {
         if (showWarnings)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <GL/glew.h>
+
 #include <glowutils/glowutils.h>
 #include <glowutils/AbstractTransparencyAlgorithm.h>
 
@@ -24,14 +26,33 @@ class ScreenAlignedQuad;
     abuffer.glsl			- defines functions used in different shaders
     abuffer.frag			- stores the transcluent fragments per pixel in the A-Buffer
     abuffer_post.frag		- combines the opaque and transcluent geometry by sorting and blending the a A-Buffer
+
+    The fragment pool of the A-Buffer is sized by demand instead of by the maximum number of
+    fragments per pixel: the number of fragments requested by a frame is read back without
+    stalling (usually one frame late) and the pool grows immediately if it overflowed and
+    shrinks if it stays largely unused for a while. Fragments of a frame that overflows the
+    pool are dropped.
 */
 class GLOWUTILS_API ABufferAlgorithm : public AbstractTransparencyAlgorithm {
 public:
+    ABufferAlgorithm();
+    virtual ~ABufferAlgorithm();
+
     virtual void initialize(const std::string & transparencyShaderFilePath, glow::Shader *vertexShader, glow::Shader *geometryShader) override;
     virtual void draw(const DrawFunction& drawFunction, glowutils::Camera* camera, int width, int height) override;
     virtual void resize(int width, int height) override;
     virtual glow::Texture* getOutput() override;
 
+    /** \return number of fragments the pool can hold */
+    unsigned int fragmentCapacity() const;
+    /** \return number of fragments requested by the last frame read back, might exceed fragmentCapacity() */
+    unsigned int fragmentCount() const;
+
+private:
+    void readBackFragmentCount();
+    void adaptFragmentCapacity();
+    void setFragmentCapacity(unsigned int capacity);
+
 private:
     // geometry pass
     glow::ref_ptr<glow::Program> m_program;
@@ -43,6 +64,15 @@ private:
     glow::ref_ptr<glow::Buffer> m_linkedListBuffer;
     glow::ref_ptr<glow::Buffer> m_headBuffer;
     glow::ref_ptr<glow::Buffer> m_counter;
+    glow::ref_ptr<glow::Buffer> m_counterReadback;
+    GLsync m_counterReadbackFence;
+
+    // fragment pool
+    unsigned int m_fragmentCapacity;
+    unsigned int m_minFragmentCapacity;
+    unsigned int m_maxFragmentCapacity;
+    unsigned int m_fragmentCount;
+    unsigned int m_underusedFrames;
 
     // post processing pass
     glow::ref_ptr<ScreenAlignedQuad> m_quad;
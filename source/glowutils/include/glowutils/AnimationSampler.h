@@ -0,0 +1,100 @@
+#pragma once
+
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glowutils/glowutils.h>
+
+namespace glow
+{
+
+class Buffer;
+
+}
+
+namespace glowutils
+{
+
+class AnimationTrackSet;
+
+/** \brief Evaluates all tracks of an AnimationTrackSet at once.
+
+    Tracks are processed in blocks: first the keyframe segment and eased weight of each track are
+    looked up, then the values of the block are blended either by a scalar loop or by a vectorized
+    kernel processing four (SSE) or eight (AVX) tracks at once. Which instruction set is used by
+    the vectorized kernel is decided at compile time (AVX requires, e.g., -mavx). Sets with at
+    least parallelThreshold() tracks are split into contiguous ranges evaluated by multiple threads.
+
+    The sampler remembers the last segment of every track, so the lookup for steadily advancing
+    times is nearly constant per track. Results match AnimationTrackSet::evaluate().
+
+    Values are written interleaved, one value per track, and can be written directly into mapped
+    buffer memory, e.g., as per instance attributes.
+
+    \code{.cpp}
+
+        AnimationSampler sampler;
+        sampler.sample(rotations, time, instanceRotations, 0, sizeof(Instance));
+
+    \endcode
+
+    \see AnimationTrackSet
+*/
+class GLOWUTILS_API AnimationSampler
+{
+public:
+    enum Kernel
+    {
+        Scalar
+    ,   Vectorized
+    };
+
+public:
+    AnimationSampler();
+    virtual ~AnimationSampler();
+
+    Kernel kernel() const;
+    void setKernel(Kernel kernel);
+
+    /** Maximum number of threads used for large sets, 0 (default) uses the hardware concurrency.
+    */
+    unsigned int threadCount() const;
+    void setThreadCount(unsigned int count);
+
+    unsigned int parallelThreshold() const;
+    void setParallelThreshold(unsigned int trackCount);
+
+    /** Writes the values of all tracks at time to output, each of tracks.componentCount() floats.
+        Values are stride bytes apart, 0 (default) packs them tightly.
+    */
+    void sample(const AnimationTrackSet & tracks, float time, float * output, unsigned int stride = 0);
+
+    /** Like above, with an individual time per track, e.g., for instances playing the same clip with different phases.
+    */
+    void sample(const AnimationTrackSet & tracks, const float * times, float * output, unsigned int stride = 0);
+
+    void sample(const AnimationTrackSet & tracks, float time, std::vector<float> & output);
+
+    /** Maps the range of all values starting at offset of buffer for writing and writes the values into it.
+        \return false if the buffer could not be mapped or unmapped
+    */
+    bool sample(const AnimationTrackSet & tracks, float time, glow::Buffer * buffer, GLintptr offset = 0, unsigned int stride = 0);
+
+    /** Name of the instruction set used by the vectorized kernel ("AVX", "SSE", or "none").
+    */
+    static const char * vectorExtension();
+
+protected:
+    void sampleTracks(const AnimationTrackSet & tracks, float time, const float * times, float * output, unsigned int stride);
+    void sampleRange(const AnimationTrackSet & tracks, float time, const float * times, unsigned int begin, unsigned int end, float * output, unsigned int stride);
+
+protected:
+    Kernel m_kernel;
+    unsigned int m_threadCount;
+    unsigned int m_parallelThreshold;
+
+    std::vector<unsigned int> m_segments; // last segment per track, the start for the next lookup
+};
+
+} // namespace glowutils
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <glowutils/glowutils.h>
+#include <glowutils/Interpolation.h>
+
+namespace glowutils
+{
+
+/** \brief Stores the keyframes of many animation tracks of one value type as structure of arrays.
+
+    A track is a time sorted list of keyframes of a float, vec3, or quaternion value. Each
+    keyframe defines the interpolation (see Interpolation.h) of the segment starting at it.
+    The keyframes of all tracks are kept in contiguous arrays of times, interpolations, and
+    values, and each track references its range by first key and key count. The components of
+    a value are stored together, so both keys of a segment are usually in one cache line.
+    Tracks are referenced by their index, which is returned on add.
+
+    Values are interpolated linearly with eased segment weights, quaternions are blended by
+    normalized linear interpolation along the shorter arc. Times outside a track clamp to its
+    first or last keyframe.
+
+    evaluate() is the scalar reference for a single track, AnimationSampler evaluates all
+    tracks of a set at once.
+
+    \code{.cpp}
+
+        AnimationTrackSet rotations(AnimationTrackSet::Quat);
+        rotations.add({
+            { 0.f, glm::quat(), SmoothStepInterpolation },
+            { 2.f, glm::angleAxis(glm::pi<float>(), glm::vec3(0.f, 1.f, 0.f)) } });
+
+    \endcode
+
+    \see AnimationSampler
+*/
+class GLOWUTILS_API AnimationTrackSet
+{
+public:
+    enum ValueType
+    {
+        Float = 1
+    ,   Vec3 = 3
+    ,   Quat = 4
+    };
+
+    template <typename T>
+    struct Keyframe
+    {
+        Keyframe(float time, const T & value, InterpolationType interpolation = LinearInterpolation)
+        : time(time), value(value), interpolation(interpolation) { }
+
+        float time;
+        T value;
+        InterpolationType interpolation;
+    };
+
+public:
+    AnimationTrackSet(ValueType valueType);
+    virtual ~AnimationTrackSet();
+
+    ValueType valueType() const;
+
+    /** Number of floats per value: 1, 3, or 4 (x, y, z, w for quaternions).
+    */
+    unsigned int componentCount() const;
+
+    unsigned int size() const;
+    bool empty() const;
+
+    unsigned int keyCount() const;
+
+    void reserve(unsigned int trackCount, unsigned int keyCount);
+    void clear();
+
+    /** Adds a track of at least one keyframe sorted by time, the value type has to match the set.
+    */
+    unsigned int add(const std::vector<Keyframe<float>> & keys);
+    unsigned int add(const std::vector<Keyframe<glm::vec3>> & keys);
+    unsigned int add(const std::vector<Keyframe<glm::quat>> & keys);
+
+    /** Adds a track from keyCount times and componentCount() interleaved floats per value.
+        Without interpolations all segments are interpolated linearly.
+    */
+    unsigned int add(unsigned int keyCount, const float * times, const float * values, const InterpolationType * interpolations = nullptr);
+
+    unsigned int firstKey(unsigned int track) const;
+    unsigned int keyCount(unsigned int track) const;
+
+    float startTime(unsigned int track) const;
+    float endTime(unsigned int track) const;
+
+    /** Scalar evaluation of a single track, the value is returned in the first componentCount() components.
+    */
+    glm::vec4 evaluate(unsigned int track, float time) const;
+
+    /** Contiguous per track first keys and key counts.
+    */
+    const unsigned int * firstKeys() const;
+    const unsigned int * keyCounts() const;
+
+    /** Contiguous key times, segment interpolations (as InterpolationType), and values (componentCount() floats per key) of all tracks.
+    */
+    const float * times() const;
+    const unsigned char * interpolations() const;
+    const float * values() const;
+
+protected:
+    unsigned int addTrack(unsigned int keyCount);
+
+protected:
+    ValueType m_valueType;
+
+    std::vector<unsigned int> m_firstKeys;
+    std::vector<unsigned int> m_keyCounts;
+
+    std::vector<float> m_times;
+    std::vector<unsigned char> m_interpolations;
+    std::vector<float> m_values;
+};
+
+} // namespace glowutils
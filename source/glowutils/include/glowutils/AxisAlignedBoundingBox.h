@@ -1,5 +1,8 @@
 ﻿#pragma once
 
+#include <cstddef>
+#include <vector>
+
 #include <glm/glm.hpp>
 
 #include <glowutils/glowutils.h>
@@ -25,6 +28,9 @@ namespace glowutils
             ...
 
             \endcode
+
+    For large vertex arrays, prefer the bulk extend overloads (\see boundingBox in bounds.h),
+    which update center and radius only once.
 */
 class GLOWUTILS_API AxisAlignedBoundingBox
 {
@@ -34,6 +40,13 @@ public:
     virtual ~AxisAlignedBoundingBox();
 
     bool extend(const glm::vec3 & vertex);
+    bool extend(const AxisAlignedBoundingBox & box);
+    bool extend(const std::vector<glm::vec3> & vertices);
+    bool extend(
+        const void * data
+    ,   unsigned int count
+    ,   std::size_t baseoffset = 0
+    ,   std::size_t stride = 0);
 
     const glm::vec3 & center() const;
     float radius() const;
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/glowutils.h>
+
+namespace glowutils
+{
+
+class AxisAlignedBoundingBox;
+
+/** \brief Stores many axis aligned bounding boxes as structure of arrays.
+
+    Each box is kept as center and half extent, with one contiguous float array per
+    component. This layout allows batch operations on the boxes (e.g., FrustumCulling)
+    to process several boxes per SIMD instruction. Boxes are referenced by their index,
+    which is returned on add.
+
+    \code{.cpp}
+
+        AxisAlignedBoundingBoxSet boxes;
+        for (const AxisAlignedBoundingBox & aabb : objectBounds)
+            boxes.add(aabb);
+
+    \endcode
+
+    \see FrustumCulling
+*/
+class GLOWUTILS_API AxisAlignedBoundingBoxSet
+{
+public:
+    AxisAlignedBoundingBoxSet();
+    virtual ~AxisAlignedBoundingBoxSet();
+
+    unsigned int size() const;
+    bool empty() const;
+
+    void reserve(unsigned int count);
+    void clear();
+
+    unsigned int add(const AxisAlignedBoundingBox & box);
+    unsigned int add(const glm::vec3 & llf, const glm::vec3 & urb);
+
+    void set(unsigned int index, const AxisAlignedBoundingBox & box);
+    void set(unsigned int index, const glm::vec3 & llf, const glm::vec3 & urb);
+
+    glm::vec3 center(unsigned int index) const;
+    glm::vec3 extent(unsigned int index) const;
+
+    glm::vec3 llf(unsigned int index) const;
+    glm::vec3 urb(unsigned int index) const;
+
+    /** Contiguous center and half extent components of all boxes, for axis 0 (x), 1 (y), or 2 (z).
+    */
+    const float * centers(unsigned int axis) const;
+    const float * extents(unsigned int axis) const;
+
+protected:
+    std::vector<float> m_centers[3];
+    std::vector<float> m_extents[3];
+};
+
+} // namespace glowutils
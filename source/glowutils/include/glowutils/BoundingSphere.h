@@ -0,0 +1,33 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <glowutils/glowutils.h>
+
+namespace glowutils
+{
+
+/** \brief Spherical bounding volume specified by center and radius.
+
+    A bounding sphere for a set of vertices can be retrieved via boundingSphere (\see bounds.h).
+    A default constructed sphere is empty and contains no vertex.
+*/
+class GLOWUTILS_API BoundingSphere
+{
+public:
+    BoundingSphere();
+    BoundingSphere(const glm::vec3 & center, float radius);
+    virtual ~BoundingSphere();
+
+    const glm::vec3 & center() const;
+    float radius() const;
+
+    bool inside(const glm::vec3 & vertex) const;
+    bool outside(const glm::vec3 & vertex) const;
+
+protected:
+    glm::vec3 m_center;
+    float m_radius;
+};
+
+} // namespace glowutils
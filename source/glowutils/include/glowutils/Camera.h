@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include <glm/glm.hpp>
 
 #include <glowutils/glowutils.h>
@@ -60,6 +62,10 @@ public:
 
     const glm::mat3 & normal() const;
 
+    /** Planes of the view frustum in order left, right, bottom, top, near, far (\see frustumPlanes in Plane3.h).
+    */
+    const std::array<glm::vec4, 6> & frustumPlanes() const;
+
     void update() const;
 
     virtual void changed() const;
@@ -89,6 +95,7 @@ protected:
     CachedValue<glm::mat4> m_viewProjection;
     CachedValue<glm::mat4> m_viewProjectionInverted;
     CachedValue<glm::mat3> m_normal;
+    CachedValue<std::array<glm::vec4, 6>> m_frustumPlanes;
 };
 
 } // namespace glowutils
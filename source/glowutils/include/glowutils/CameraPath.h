@@ -1,5 +1,7 @@
 #pragma once
 
+#include <iosfwd>
+#include <string>
 #include <vector>
 
 #include <glm/glm.hpp>
@@ -25,16 +27,40 @@ public:
     float fov;
 };
 
+/** \brief Sequence of camera states, e.g., recorded by a CameraPathRecorder and replayed by a CameraPathPlayer.
+
+    Paths can be stored in a compact binary format: a four byte signature "gcp1", the number
+    of points as 32 bit unsigned integer, followed by eye, center, up, and fov of each point as
+    32 bit floats, all in little endian byte order. Since the floats are stored without loss,
+    a loaded path replays exactly as recorded.
+
+    \code{.cpp}
+
+        recorder.path().save("flight.campath");
+        ...
+        CameraPath path;
+        if (path.load("flight.campath"))
+            player.setPath(path);
+
+    \endcode
+*/
 class GLOWUTILS_API CameraPath
 {
 public:
     CameraPath();
 
     void append(const CameraPathPoint& point);
+    void clear();
 
     CameraPath & operator<<(const CameraPathPoint& point);
 
     const std::vector<CameraPathPoint>& points() const;
+
+    bool save(const std::string & filePath) const;
+    bool load(const std::string & filePath);
+
+    bool write(std::ostream & stream) const;
+    bool read(std::istream & stream);
 protected:
     std::vector<CameraPathPoint> m_points;
 };
@@ -23,15 +23,41 @@ namespace glowutils
 
 class Camera;
 
+/** \brief Moves a camera along a CameraPath.
+
+    The eye positions of the path points are connected by cubic Bezier sections. On setPath, a
+    lookup table of the arc length along these sections is precomputed, so that the parameter t in
+    [0, 1] of play, point, and sample is proportional to the distance traveled by the eye, i.e.,
+    equidistant values of t result in constant camera speed.
+
+    For offline rendering, all frames can be evaluated at once:
+    \code{.cpp}
+
+        const std::vector<CameraPathPoint> frames = player.sample(frameCount);
+
+    \endcode
+*/
 class GLOWUTILS_API CameraPathPlayer
 {
 public:
     CameraPathPlayer(Camera & camera);
 
     void setPath(const CameraPath & path);
+    const CameraPath & path() const;
+
+    /** Arc length of the path of the eye.
+    */
+    float length() const;
 
     void play(float t);
 
+    CameraPathPoint point(float t) const;
+
+    /** Evaluates count points with equidistant t in [0, 1], including both ends of the path.
+    */
+    std::vector<CameraPathPoint> sample(unsigned int count) const;
+    void sample(unsigned int count, CameraPathPoint * points) const;
+
     void createVao();
     void draw(const glm::mat4& viewProjection);
     void freeVao();
@@ -50,6 +76,10 @@ protected:
     Camera& m_camera;
     CameraPath m_path;
     std::vector<PathSection> m_sections;
+
+    // section index + section t for equidistant arc lengths along the whole path
+    std::vector<float> m_arcLengthTable;
+    float m_length;
     glow::ref_ptr<glow::VertexArrayObject> m_vao;
     glow::ref_ptr<glow::Program> m_program;
     glow::ref_ptr<glow::Buffer> m_buffer;
@@ -57,9 +87,10 @@ protected:
 
     void prepare();
     void prepareControlPoints();
+    void prepareArcLengthTable();
 
-    PathSection& find(float t);
-    CameraPathPoint interpolate(const PathSection& section, float t);
+    glm::vec3 eye(const PathSection& section, float t) const;
+    CameraPathPoint interpolate(const PathSection& section, float t) const;
     void moveCamera(const CameraPathPoint& point);
 };
 
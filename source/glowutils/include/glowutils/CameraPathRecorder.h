@@ -14,6 +14,11 @@ public:
     CameraPathRecorder(Camera & camera);
 
     void record();
+    void clear();
+
+    /** Recorded path, e.g., for replay via CameraPathPlayer or for storage via CameraPath::save.
+    */
+    const CameraPath & path() const;
 protected:
     Camera& m_camera;
     CameraPath m_path;
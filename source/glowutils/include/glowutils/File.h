@@ -3,6 +3,7 @@
 #include <string>
 
 #include <glow/AbstractStringSource.h>
+#include <glow/StringChunk.h>
 
 #include <glowutils/glowutils.h>
 
@@ -29,6 +30,7 @@ public:
     virtual ~File();
 
     virtual std::string string() const override;
+    virtual void chunksInto(std::vector<glow::StringChunk>& vector) const override;
     virtual std::string shortInfo() const override;
 
 	const std::string & filePath() const;
@@ -38,7 +40,7 @@ public:
     static void reloadAll();
 protected:
     std::string m_filePath;
-    mutable std::string m_source;
+    mutable glow::StringChunk m_source;
     mutable bool m_valid;
 
     void loadFileContent() const;
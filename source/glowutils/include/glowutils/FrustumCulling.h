@@ -0,0 +1,96 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/glowutils.h>
+
+namespace glowutils
+{
+
+class AxisAlignedBoundingBox;
+class AxisAlignedBoundingBoxSet;
+class Camera;
+
+/** \brief Tests batches of axis aligned bounding boxes against a view frustum.
+
+    The boxes are provided as AxisAlignedBoundingBoxSet and tested against the six frustum
+    planes, either by a scalar loop or by a vectorized kernel processing four (SSE) or eight
+    (AVX) boxes at once. Which instruction set is used by the vectorized kernel is decided at
+    compile time (AVX requires, e.g., -mavx). Sets with at least parallelThreshold() boxes are
+    split into contiguous ranges culled by multiple threads.
+
+    The result is a compact, ascending list of the indices of all boxes intersecting or inside
+    the frustum. It can be written directly into mapped buffer memory, e.g., to be used as
+    instance or draw indices for indirect draws.
+
+    \code{.cpp}
+
+        FrustumCulling culling(camera);
+
+        std::vector<unsigned int> visible;
+        culling.cull(boxes, visible);
+
+        indexBuffer->setData(visible, GL_STREAM_DRAW);
+
+    \endcode
+
+    \see Camera::frustumPlanes()
+*/
+class GLOWUTILS_API FrustumCulling
+{
+public:
+    enum Kernel
+    {
+        Scalar
+    ,   Vectorized
+    };
+
+public:
+    FrustumCulling();
+    FrustumCulling(const Camera & camera);
+    FrustumCulling(const std::array<glm::vec4, 6> & planes);
+    virtual ~FrustumCulling();
+
+    const std::array<glm::vec4, 6> & planes() const;
+    void setPlanes(const std::array<glm::vec4, 6> & planes);
+    void setPlanes(const Camera & camera);
+
+    Kernel kernel() const;
+    void setKernel(Kernel kernel);
+
+    /** Maximum number of threads used for large sets, 0 (default) uses the hardware concurrency.
+    */
+    unsigned int threadCount() const;
+    void setThreadCount(unsigned int count);
+
+    unsigned int parallelThreshold() const;
+    void setParallelThreshold(unsigned int boxCount);
+
+    bool visible(const AxisAlignedBoundingBox & box) const;
+    bool visible(const glm::vec3 & center, const glm::vec3 & extent) const;
+
+    /** Writes the indices of all visible boxes to visibleIndices, which has to provide space for
+        boxes.size() indices, and returns the number of visible boxes.
+    */
+    unsigned int cull(const AxisAlignedBoundingBoxSet & boxes, unsigned int * visibleIndices) const;
+    void cull(const AxisAlignedBoundingBoxSet & boxes, std::vector<unsigned int> & visibleIndices) const;
+
+    /** Name of the instruction set used by the vectorized kernel ("AVX", "SSE", or "none").
+    */
+    static const char * vectorExtension();
+
+protected:
+    unsigned int cullRange(const AxisAlignedBoundingBoxSet & boxes, unsigned int begin, unsigned int end, unsigned int * visibleIndices) const;
+
+protected:
+    std::array<glm::vec4, 6> m_planes;
+
+    Kernel m_kernel;
+    unsigned int m_threadCount;
+    unsigned int m_parallelThreshold;
+};
+
+} // namespace glowutils
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <GL/glew.h>
+
 #include <glowutils/glowutils.h>
 #include <glowutils/AbstractTransparencyAlgorithm.h>
 
@@ -27,15 +29,27 @@ class ScreenAlignedQuad;
     hybrid_visibilityktab.comp	- computes the visibility of the k fragments stored for each pixel
     hybrid_color.frag			- renders the transcluent geometry
     hybrid_post.frag			- combines the transcluent and opaque geometry
+
+    The per pixel buffers (k-TABs and depth complexity) are only reallocated if the viewport
+    outgrows them or uses less than a quarter of them, each frame clears only the used range.
 */
 class GLOWUTILS_API HybridAlgorithm : public AbstractTransparencyAlgorithm {
 public:
+    HybridAlgorithm();
+
     virtual void initialize(const std::string & transparencyShaderFilePath, glow::Shader *vertexShader, glow::Shader *geometryShader) override;
     virtual void draw(const DrawFunction& drawFunction, Camera* camera, int width, int height) override;
     virtual void resize(int width, int height) override;
     virtual glow::Texture* getOutput() override;
 
 private:
+    void clearPixelBuffer(glow::Buffer * buffer, int valuesPerPixel, GLenum internalFormat, GLenum format, GLenum type, const void * value);
+
+private:
+    // number of pixels the per pixel buffers are allocated for, and used of them
+    int m_pixelCapacity;
+    int m_pixelCount;
+
     // shared
     glow::ref_ptr<glow::FrameBufferObject> m_prepassFbo;
     glow::ref_ptr<glow::RenderBufferObject> m_depthBuffer;
@@ -40,6 +40,13 @@ public:
     ,   std::vector<Face> & indices
     ,   unsigned char levels);
 
+    /** Reorders faces and vertices for the post-transform vertex cache and vertex fetch.
+        \see MeshOptimizer
+    */
+    static void optimize(
+        std::vector<glm::vec3> & vertices
+    ,   std::vector<Face> & indices);
+
 public:
     Icosahedron(
         GLsizei iterations = 0
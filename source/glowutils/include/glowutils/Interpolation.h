@@ -90,7 +90,7 @@ namespace glowutils
         {
             static_assert(std::is_arithmetic<T>::value, "T should be an arithmetic type");
 
-            return (std::exp(t * v) - 1) / (std::exp(v) - 1);
+            return (std::exp(t * static_cast<T>(v)) - 1) / (std::exp(static_cast<T>(v)) - 1);
         }
 
         template <typename T, typename V>
@@ -98,7 +98,7 @@ namespace glowutils
         {
             static_assert(std::is_arithmetic<T>::value, "T should be an arithmetic type");
 
-            return std::log(1 + (v - 1) * t) / std::log(v);
+            return std::log(1 + (static_cast<T>(v) - 1) * t) / std::log(static_cast<T>(v));
         }
 
         template <typename T>
@@ -122,7 +122,7 @@ namespace glowutils
         {
             static_assert(std::is_arithmetic<T>::value, "T should be an arithmetic type");
 
-            return 1 - 2 * std::abs(t - 0.5);
+            return 1 - 2 * std::abs(t - static_cast<T>(0.5));
         }
 
         template <typename T>
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/glowutils.h>
+#include <glowutils/VertexDrawable.h>
+
+namespace glowutils
+{
+
+/** \brief Optimizes indexed triangle meshes for the vertex pipeline before they are uploaded.
+
+    optimize() runs the following steps on a mesh of interleaved vertices and triangle list indices:
+    - duplicate vertices, compared bytewise, are merged through a hash table,
+    - triangles are reordered for the post-transform vertex cache (Tipsify, Sander et al. 2007),
+    - vertices are reordered by first use, so vertex fetch walks the buffer sequentially; vertices
+      not referenced by any triangle are removed.
+
+    The result is reported as average cache miss ratio (ACMR, transformed vertices per triangle)
+    of a simulated FIFO cache before and after, 0.5 being the optimum for large regular meshes and
+    3 the worst case. Multiple meshes are optimized in parallel.
+
+    quantize() additionally packs positions into 16 bit per component (relative to the bounds of
+    the mesh) and normals into two 16 bit octahedral coordinates, halving the vertex size. The
+    quantized attributes are read with quantizedFormats() and decoded in the vertex shader:
+
+    \code{.glsl}
+
+        uniform vec3 positionOffset;
+        uniform vec3 positionScale;
+
+        in vec3 a_position; // normalized unsigned short
+        in vec2 a_normal;   // normalized short
+
+        vec3 decodeNormal(vec2 e)
+        {
+            vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+            if (n.z < 0.0)
+                n.xy = (1.0 - abs(n.yx)) * mix(vec2(-1.0), vec2(1.0), step(0.0, n.xy));
+            return normalize(n);
+        }
+
+        vec3 position = positionOffset + a_position * positionScale;
+
+    \endcode
+
+    \code{.cpp}
+
+        MeshOptimizer::Mesh mesh;
+        mesh.setVertices(vertices);
+        mesh.indices = indices;
+
+        MeshOptimizer optimizer;
+        MeshOptimizer::Report report = optimizer.optimize(mesh);
+
+    \endcode
+*/
+class GLOWUTILS_API MeshOptimizer
+{
+public:
+    enum Step
+    {
+        RemoveDuplicates    = 0x1
+    ,   OptimizeVertexCache = 0x2
+    ,   OptimizeVertexFetch = 0x4
+    ,   AllSteps            = 0x7
+    };
+
+    struct GLOWUTILS_API Mesh
+    {
+        Mesh(unsigned int vertexSize = 0);
+
+        unsigned int vertexCount() const;
+
+        template <typename Vertex>
+        void setVertices(const std::vector<Vertex> & vertices);
+        template <typename Vertex>
+        std::vector<Vertex> vertexData() const;
+
+        std::vector<unsigned char> vertices; ///< interleaved, vertexSize bytes each
+        unsigned int vertexSize;
+        std::vector<GLuint> indices; ///< triangle list
+    };
+
+    struct Report
+    {
+        unsigned int triangleCount;
+        unsigned int vertexCountBefore;
+        unsigned int vertexCountAfter;
+        float acmrBefore;
+        float acmrAfter;
+    };
+
+    struct QuantizedVertex
+    {
+        GLushort position[3];
+        GLushort padding; ///< keeps the normal 4 byte aligned
+        GLshort normal[2];
+    };
+
+    /** position = offset + scale * normalized quantized position */
+    struct Quantization
+    {
+        glm::vec3 offset;
+        glm::vec3 scale;
+    };
+
+public:
+    MeshOptimizer();
+    virtual ~MeshOptimizer();
+
+    /** Combination of Steps to apply, AllSteps by default. */
+    unsigned int steps() const;
+    void setSteps(unsigned int steps);
+
+    /** Size of the simulated FIFO cache, used for optimization and reports. Defaults to 16. */
+    unsigned int cacheSize() const;
+    void setCacheSize(unsigned int size);
+
+    /** Maximum number of threads used for multiple meshes, 0 (default) uses the hardware concurrency. */
+    unsigned int threadCount() const;
+    void setThreadCount(unsigned int count);
+
+    Report optimize(Mesh & mesh) const;
+    std::vector<Report> optimize(std::vector<Mesh> & meshes) const;
+
+    /** Merges bytewise equal vertices, indices are remapped and vertices compacted.
+        \return the number of removed vertices
+    */
+    static unsigned int removeDuplicates(Mesh & mesh);
+    /** Reorders the triangles of indices for a FIFO vertex cache of cacheSize vertices (Tipsify). */
+    static void optimizeVertexCache(std::vector<GLuint> & indices, unsigned int vertexCount, unsigned int cacheSize);
+    /** Reorders the vertices by first use in the indices and removes unreferenced vertices. */
+    static void optimizeVertexFetch(Mesh & mesh);
+
+    /** Average number of vertices transformed per triangle with a FIFO cache of cacheSize vertices. */
+    static float acmr(const std::vector<GLuint> & indices, unsigned int vertexCount, unsigned int cacheSize);
+
+    static Quantization quantize(const std::vector<glm::vec3> & positions, const std::vector<glm::vec3> & normals, std::vector<QuantizedVertex> & vertices);
+    /** Formats of the quantized position and normal, matching QuantizedVertex. */
+    static std::vector<VertexDrawable::AttributeFormat> quantizedFormats();
+
+    /** Maps a unit vector onto the octahedron unfolded into [-1, 1]^2. */
+    static glm::vec2 encodeOctahedral(const glm::vec3 & normal);
+    static glm::vec3 decodeOctahedral(const glm::vec2 & encoded);
+
+protected:
+    unsigned int m_steps;
+    unsigned int m_cacheSize;
+    unsigned int m_threadCount;
+};
+
+template <typename Vertex>
+void MeshOptimizer::Mesh::setVertices(const std::vector<Vertex> & vertices)
+{
+    vertexSize = sizeof(Vertex);
+    this->vertices.resize(vertices.size() * sizeof(Vertex));
+
+    if (!vertices.empty())
+        std::memcpy(this->vertices.data(), vertices.data(), this->vertices.size());
+}
+
+template <typename Vertex>
+std::vector<Vertex> MeshOptimizer::Mesh::vertexData() const
+{
+    std::vector<Vertex> result(vertices.size() / sizeof(Vertex));
+
+    if (!result.empty())
+        std::memcpy(result.data(), vertices.data(), result.size() * sizeof(Vertex));
+
+    return result;
+}
+
+} // namespace glowutils
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include <glm/glm.hpp>
 
 #include <glowutils/glowutils.h>
@@ -27,4 +29,18 @@ const glm::vec3 GLOWUTILS_API intersection(
 ,	const glm::vec3 & rnear
 ,	const glm::vec3 & rfar);
 
+/** \brief Signed distance of a point to a plane given as (normal, distance) with normalized normal.
+*/
+float GLOWUTILS_API signedDistance(
+    const glm::vec4 & plane
+,   const glm::vec3 & point);
+
+/** \brief Extracts the six clipping planes of the view frustum specified by a view projection matrix.
+
+    The planes are returned in order left, right, bottom, top, near, and far, each as (normal, distance)
+    with a normalized normal pointing into the frustum. Hence, a point is inside the frustum if its
+    signedDistance to all planes is positive.
+*/
+const std::array<glm::vec4, 6> GLOWUTILS_API frustumPlanes(const glm::mat4 & viewProjection);
+
 } // namespace glowutils
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <glow/Referenced.h>
+#include <glow/ref_ptr.h>
+
+#include <glowutils/glowutils.h>
+
+namespace glow
+{
+
+class FrameBufferObject;
+class Texture;
+
+}
+
+namespace glowutils
+{
+
+/** \brief Pool of transient render targets that are reused across passes and frames.
+
+    Passes acquire textures (or complete framebuffers) for their duration and release them
+    afterwards. Released textures are handed out again to later passes requesting the same size,
+    internal format and sample count, so passes whose lifetimes do not overlap share memory.
+    Framebuffers are cached per attachment set. Textures that were not used for a number of
+    frames, e.g., after a resize, are deleted in nextFrame().
+
+    \code{.cpp}
+
+        // per frame
+        pool.nextFrame();
+
+        RenderTargetPool::Target gbuffer = pool.acquire(size, { GL_RGBA16F, GL_RGBA16F, GL_DEPTH_COMPONENT24 });
+        gbuffer.fbo->bind();
+        // render geometry
+
+        RenderTargetPool::Target lighting = pool.acquire(size, { GL_RGBA16F });
+        // shade using gbuffer.textures
+        pool.release(gbuffer);
+
+        RenderTargetPool::Target blur = pool.acquire(size, { GL_RGBA16F }); // reuses a gbuffer texture
+        ...
+
+    \endcode
+
+    Pooled textures keep their parameters (e.g., filtering) between acquisitions.
+ */
+class GLOWUTILS_API RenderTargetPool : public glow::Referenced
+{
+public:
+    struct Description
+    {
+        glm::ivec2 size;
+        GLenum internalFormat;
+        GLsizei samples; ///< 0 for non-multisampled textures
+
+        bool operator==(const Description & description) const;
+    };
+
+    struct Target
+    {
+        glow::FrameBufferObject * fbo;
+        std::vector<glow::Texture *> textures; ///< in order of the requested formats
+    };
+
+    struct Statistics
+    {
+        std::size_t allocatedBytes; ///< estimated memory of all textures of the pool
+        std::size_t peakAllocatedBytes;
+        std::size_t inUseBytes; ///< estimated memory of the acquired textures
+        std::size_t peakInUseBytes;
+        std::size_t frameRequestedBytes; ///< memory all acquisitions of the current frame would require without reuse
+        std::size_t peakFrameRequestedBytes;
+        unsigned int textureCount;
+        unsigned int framebufferCount;
+    };
+
+public:
+    RenderTargetPool();
+
+    glow::Texture * acquire(const Description & description);
+    glow::Texture * acquire(const glm::ivec2 & size, GLenum internalFormat, GLsizei samples = 0);
+
+    /** Acquires a texture per format and a framebuffer with these textures attached. Color formats
+        are attached to consecutive color attachments (which are also set as draw buffers), depth
+        and stencil formats to the respective depth/stencil attachment.
+    */
+    Target acquire(const glm::ivec2 & size, const std::vector<GLenum> & internalFormats, GLsizei samples = 0);
+
+    void release(glow::Texture * texture);
+    void release(const Target & target);
+
+    /** Starts a new frame and deletes all textures (and their framebuffers) that were not
+        acquired during the last maxIdleFrames() frames.
+    */
+    void nextFrame();
+
+    /** Deletes all textures that are not acquired.
+    */
+    void clear();
+
+    unsigned int maxIdleFrames() const;
+    void setMaxIdleFrames(unsigned int frames);
+
+    const Statistics & statistics() const;
+    void printReport() const;
+
+    /** Estimated memory of a texture, based on the size of the internal format.
+    */
+    static std::size_t byteSize(const Description & description);
+
+protected:
+    virtual ~RenderTargetPool();
+
+    glow::Texture * createTexture(const Description & description);
+    glow::FrameBufferObject * framebuffer(const std::vector<glow::Texture *> & textures, const std::vector<GLenum> & internalFormats);
+
+    void remove(std::size_t index);
+
+protected:
+    struct Entry
+    {
+        glow::ref_ptr<glow::Texture> texture;
+        Description description;
+        std::size_t byteSize;
+        bool inUse;
+        unsigned int lastUsedFrame;
+    };
+
+    // pools are small (a few dozen textures), a linear search is faster than any index
+    std::vector<Entry> m_entries;
+    std::map<std::vector<glow::Texture *>, glow::ref_ptr<glow::FrameBufferObject>> m_framebuffers;
+
+    unsigned int m_frame;
+    unsigned int m_maxIdleFrames;
+
+    Statistics m_statistics;
+};
+
+} // namespace glowutils
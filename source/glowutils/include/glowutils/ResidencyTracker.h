@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include <glowutils/glowutils.h>
+
+namespace glowutils
+{
+
+/** \brief Decides per frame which resources are resident, by their usage and a memory budget.
+
+    Resources are identified by an id and have a size. Resources used in a frame (use()) are
+    made resident at the end of the frame (update()). Resources that are not used anymore stay
+    resident until the resident size exceeds the budget, then the least recently used ones
+    are made non-resident. Resources used in the current frame are never evicted, so the
+    budget is exceeded if a single frame requires more.
+
+    The tracker only does the bookkeeping and reports the changes, applying them is up to the
+    caller, e.g., TextureResidencyManager for bindless textures.
+
+    \code{.cpp}
+
+        tracker.use(id); // for each resource needed in this frame
+
+        std::vector<unsigned int> madeResident;
+        std::vector<unsigned int> madeNonResident;
+        tracker.update(madeResident, madeNonResident);
+
+    \endcode
+ */
+class GLOWUTILS_API ResidencyTracker
+{
+public:
+    /** \param budget in bytes, 0 for no limit
+     */
+    ResidencyTracker(std::size_t budget = 0);
+    ~ResidencyTracker();
+
+    std::size_t budget() const;
+    void setBudget(std::size_t budget);
+
+    /** Adds a non-resident resource or changes the size of an existing one.
+     */
+    void insert(unsigned int id, std::size_t size);
+
+    /** Removes the resource, the caller has to make it non-resident if it was.
+        \return true if the resource was resident
+     */
+    bool remove(unsigned int id);
+
+    bool contains(unsigned int id) const;
+    bool isResident(unsigned int id) const;
+
+    /** Marks the resource as used in the current frame, unknown ids are ignored.
+     */
+    void use(unsigned int id);
+
+    /** Ends the frame, appending the ids of resources that have to be made resident or
+        non-resident to the given vectors.
+     */
+    void update(std::vector<unsigned int> & madeResident, std::vector<unsigned int> & madeNonResident);
+
+    /** Makes all resources non-resident, appending the resident ones to madeNonResident.
+     */
+    void evictAll(std::vector<unsigned int> & madeNonResident);
+
+    unsigned int frame() const;
+    unsigned int count() const;
+    std::size_t residentSize() const;
+    unsigned int residentCount() const;
+
+protected:
+    struct Entry
+    {
+        std::size_t size;
+        bool resident;
+        unsigned int lastUsedFrame;
+        std::list<unsigned int>::iterator lruPosition;
+    };
+
+    std::size_t m_budget;
+    unsigned int m_frame;
+
+    std::unordered_map<unsigned int, Entry> m_entries;
+    std::vector<unsigned int> m_used; ///< ids used in the current frame
+    std::list<unsigned int> m_lru; ///< resident ids, most recently used first
+
+    std::size_t m_residentSize;
+};
+
+} // namespace glowutils
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#include <glow/Referenced.h>
+#include <glow/ref_ptr.h>
+
+#include <glowutils/glowutils.h>
+
+namespace glow
+{
+
+class Sampler;
+
+}
+
+namespace glowutils
+{
+
+/** \brief Shares one sampler object per distinct sampler state and skips redundant sampler bindings.
+
+    Instead of configuring filtering and wrapping on every texture, textures are sampled through
+    samplers requested by a full description of their state. Equal descriptions return the same
+    sampler, so a scene typically gets by with a handful of sampler objects. Parameters that equal
+    the GL defaults are not set on creation.
+
+    bind() remembers the sampler bound to each texture unit and skips binding it again. The cache
+    assumes it is the only one binding samplers in its context, call invalidateBindings() after
+    samplers were bound otherwise, e.g., by glow::Sampler::bind().
+
+    \code{.cpp}
+
+        SamplerCache::Description nearest(GL_NEAREST, GL_CLAMP_TO_EDGE);
+
+        samplers->bind(0, nearest);
+        positions->bindActive(GL_TEXTURE0);
+
+        samplers->bind(1, SamplerCache::Description(GL_LINEAR_MIPMAP_LINEAR, GL_REPEAT, 8.f));
+        albedo->bindActive(GL_TEXTURE1);
+
+    \endcode
+ */
+class GLOWUTILS_API SamplerCache : public glow::Referenced
+{
+public:
+    struct GLOWUTILS_API Description
+    {
+        /** Uses filter as minification filter and its non-mipmapped variant as magnification filter.
+        */
+        Description(GLenum filter = GL_LINEAR, GLenum wrap = GL_REPEAT, GLfloat maxAnisotropy = 1.f);
+
+        bool operator==(const Description & description) const;
+        bool operator!=(const Description & description) const;
+
+        std::size_t hash() const;
+
+        GLenum minFilter;
+        GLenum magFilter;
+        GLenum wrapS;
+        GLenum wrapT;
+        GLenum wrapR;
+        GLfloat minLod;
+        GLfloat maxLod;
+        GLfloat lodBias;
+        GLfloat maxAnisotropy; ///< ignored without EXT_texture_filter_anisotropic
+        GLenum compareMode;
+        GLenum compareFunc;
+        glm::vec4 borderColor;
+    };
+
+    struct Statistics
+    {
+        unsigned int samplerCount;
+        unsigned int requestCount; ///< calls of sampler() and bind() with a description
+        unsigned int bindCount; ///< sampler bindings issued to GL
+        unsigned int skippedBindCount; ///< redundant bindings that were skipped
+    };
+
+public:
+    SamplerCache();
+
+    /** \return the shared sampler for description, created on first request
+    */
+    glow::Sampler * sampler(const Description & description);
+
+    void bind(GLuint unit, const Description & description);
+    void bind(GLuint unit, glow::Sampler * sampler);
+    void unbind(GLuint unit);
+
+    /** Forgets the bound samplers, the next bind() per unit is issued regardless.
+    */
+    void invalidateBindings();
+
+    /** Deletes all samplers that are only referenced by the cache.
+    */
+    void clear();
+
+    unsigned int size() const;
+
+    const Statistics & statistics() const;
+
+protected:
+    virtual ~SamplerCache();
+
+    void bind(GLuint unit, GLuint id);
+
+    static void configure(glow::Sampler * sampler, const Description & description);
+
+protected:
+    struct Hash
+    {
+        std::size_t operator()(const Description & description) const;
+    };
+
+    std::unordered_map<Description, glow::ref_ptr<glow::Sampler>, Hash> m_samplers;
+
+    std::vector<GLuint> m_boundSamplers; ///< per texture unit, GL_INVALID_INDEX if unknown
+
+    Statistics m_statistics;
+};
+
+} // namespace glowutils
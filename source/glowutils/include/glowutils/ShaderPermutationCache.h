@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/Referenced.h>
+#include <glow/ref_ptr.h>
+
+#include <glowutils/glowutils.h>
+
+namespace glow
+{
+
+class AbstractStringSource;
+class Program;
+class Shader;
+
+}
+
+namespace glowutils
+{
+
+/** \brief Shares compiled shaders and linked programs between all requesters of the same permutation.
+
+    A permutation is a base source and a set of defines, which are inserted after the #version
+    directive. Shaders are identified by the hash of their fully resolved source (type, defines
+    and base source), so all permutations resolving to the same source yield the same shader,
+    regardless of the requester or how the source was assembled (e.g., by separate
+    StringTemplate instances). Programs are identified by their set of shaders. Shaders are
+    compiled and programs are linked when they are first requested.
+
+    \code{.cpp}
+
+        glow::ref_ptr<ShaderPermutationCache> cache = new ShaderPermutationCache;
+        ShaderPermutationCache::Defines defines = { { "LIGHT_COUNT", "4" }, { "USE_SHADOWS", "" } };
+
+        glow::Program * program = cache->program({ { GL_VERTEX_SHADER, vertexSource }, { GL_FRAGMENT_SHADER, fragmentSource } }, defines);
+
+    \endcode
+
+    Declared permutations are compiled by precompile(). All methods are thread-safe, so
+    precompile() can run in a worker thread with a shared context (e.g., within a
+    glowwindow::ResourceLoader load) or be called with a budget once per frame.
+    Base sources are assumed to not change, i.e., changes are only picked up by new requests.
+ */
+class GLOWUTILS_API ShaderPermutationCache : public glow::Referenced
+{
+public:
+    /** Ordered, so equal sets yield equal sources regardless of how they were assembled. */
+    typedef std::map<std::string, std::string> Defines;
+
+    struct Stage
+    {
+        Stage(GLenum type, glow::AbstractStringSource * source);
+
+        GLenum type;
+        glow::ref_ptr<glow::AbstractStringSource> source;
+    };
+
+    struct Statistics
+    {
+        unsigned int shaderRequests;
+        unsigned int shaderHits;
+        unsigned int programRequests;
+        unsigned int programHits;
+    };
+
+public:
+    ShaderPermutationCache();
+
+    /** \return the compiled shader of the permutation, owned by the cache */
+    glow::Shader * shader(GLenum type, glow::AbstractStringSource * source, const Defines & defines = Defines());
+
+    /** \return the linked program of the permutation of all stages, owned by the cache */
+    glow::Program * program(const std::vector<Stage> & stages, const Defines & defines = Defines());
+
+    /** Declares a permutation for precompile(). */
+    void declare(const std::vector<Stage> & stages, const Defines & defines = Defines());
+
+    /** Compiles and links up to maxCount declared permutations (in order of declaration),
+     permutations requested already are skipped without counting.
+
+     \return number of declared permutations left
+     */
+    unsigned int precompile(unsigned int maxCount = ~0u);
+    unsigned int declaredCount() const;
+
+    /** Releases all shaders and programs not referenced outside the cache. */
+    void collect();
+    void clear();
+
+    unsigned int shaderCount() const;
+    unsigned int programCount() const;
+    Statistics statistics() const;
+
+    /** \return source with a #define line per define, inserted after the #version directive (if any) */
+    static std::string resolve(const std::string & source, const Defines & defines);
+
+    /** \return 64 bit FNV-1a hash of the given string */
+    static std::uint64_t hash(const std::string & string, std::uint64_t seed = 14695981039346656037ull);
+
+protected:
+    struct Declaration
+    {
+        std::vector<Stage> stages;
+        Defines defines;
+    };
+
+    virtual ~ShaderPermutationCache();
+
+    glow::Shader * obtainShader(GLenum type, const glow::AbstractStringSource * source, const Defines & defines, bool & created);
+    glow::Program * obtainProgram(const std::vector<Stage> & stages, const Defines & defines, bool & created);
+
+protected:
+    mutable std::mutex m_mutex;
+
+    std::unordered_map<std::uint64_t, glow::ref_ptr<glow::Shader>> m_shaders;
+    std::unordered_map<std::uint64_t, glow::ref_ptr<glow::Program>> m_programs;
+
+    std::deque<Declaration> m_declarations;
+    Statistics m_statistics;
+};
+
+} // namespace glowutils
@@ -18,6 +18,7 @@ public:
     virtual void update();
 protected:
     virtual void notifyChanged(Changeable * changeable) override;
+    virtual Changeable * propagatesTo() override;
 protected:
     glow::ref_ptr<glow::AbstractStringSource> m_internal;
 };
@@ -3,6 +3,8 @@
 #include <string>
 #include <map>
 
+#include <glow/StringChunk.h>
+
 #include <glowutils/glowutils.h>
 #include <glowutils/StringSourceDecorator.h>
 #include <glowutils/CachedValue.h>
@@ -17,6 +19,7 @@ public:
     virtual ~StringTemplate();
 
     virtual std::string string() const override;
+    virtual void chunksInto(std::vector<glow::StringChunk>& vector) const override;
     virtual void update() override;
 
     void replace(const std::string & original, const std::string & str);
@@ -25,10 +28,11 @@ public:
     void clearReplacements();
 
 protected:
-    CachedValue<std::string> m_modifiedSource;
+    CachedValue<glow::StringChunk> m_modifiedSource;
 	std::map<std::string, std::string> m_replacements;
 
     void invalidate();
+    const glow::StringChunk & modifiedSourceChunk() const;
     std::string modifiedSource() const;
 };
 
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/Referenced.h>
+#include <glow/ref_ptr.h>
+#include <glow/TextureHandle.h>
+
+#include <glowutils/glowutils.h>
+#include <glowutils/ResidencyTracker.h>
+
+namespace glow
+{
+
+class Buffer;
+class Texture;
+
+}
+
+namespace glowutils
+{
+
+/** \brief Manages the residency of bindless textures and provides their handles in a buffer indexed by material id.
+
+    Textures are registered per material id, several materials may share a texture. Each frame,
+    the materials to be drawn are marked as used, then update() makes their textures resident,
+    makes least recently used textures non-resident if the resident textures exceed the budget
+    (cf. ResidencyTracker) and uploads the handle table if it changed. Shaders index the table
+    by material id, so no textures are bound in the draw loop.
+
+    \code{.cpp}
+
+        manager->setTexture(material, texture); // once per material
+
+        // per frame
+        for (const Drawable & drawable : visible)
+            manager->use(drawable.material);
+        manager->update();
+
+        manager->handleTable()->bindBase(GL_SHADER_STORAGE_BUFFER, 0);
+        // draw, passing the material id, e.g., as vertex attribute or draw id
+
+    \endcode
+
+    \code{.glsl}
+
+        #extension GL_ARB_bindless_texture : require
+
+        layout (std430, binding = 0) buffer Materials
+        {
+            uvec2 textures[]; // sampler2D(textures[material])
+        };
+
+    \endcode
+
+    With the Std140 layout, e.g., for uniform buffers, each handle is padded to 16 bytes (uvec4,
+    of which xy is the handle). Handles of materials whose textures are not resident are
+    replaced by the handle of the fallback texture if one is set, as sampling them is undefined.
+    Requires GL_ARB_bindless_texture.
+ */
+class GLOWUTILS_API TextureResidencyManager : public glow::Referenced
+{
+public:
+    enum Layout
+    {
+        Std140,
+        Std430
+    };
+
+public:
+    /** \param budget of resident textures in bytes, 0 for no limit
+     */
+    TextureResidencyManager(std::size_t budget = 0, Layout layout = Std430);
+
+    /** Registers the texture for the material, replacing the previous one. If size is 0, the
+        size is estimated from the texture's first level.
+     */
+    void setTexture(unsigned int material, glow::Texture * texture, std::size_t size = 0);
+    void removeTexture(unsigned int material);
+    glow::Texture * texture(unsigned int material);
+
+    /** The fallback texture is resident as long as it is set.
+     */
+    void setFallback(glow::Texture * texture);
+    glow::Texture * fallback();
+
+    void use(unsigned int material);
+
+    /** Applies the residency changes of the frame and uploads the handle table if required.
+     */
+    void update();
+
+    /** Makes all textures but the fallback non-resident.
+     */
+    void evictAll();
+
+    /** \return buffer with a handle per material id up to the highest registered one
+     */
+    glow::Buffer * handleTable();
+
+    std::size_t budget() const;
+    void setBudget(std::size_t budget);
+
+    const ResidencyTracker & tracker() const;
+
+    /** Packs the handles in the given layout, i.e., interleaved with zeros for Std140.
+     */
+    static std::vector<glow::TextureHandle> packHandles(const std::vector<glow::TextureHandle> & handles, Layout layout);
+
+    /** Estimated memory of the texture's levels, based on the size of its first level.
+     */
+    static std::size_t estimateByteSize(glow::Texture * texture);
+
+protected:
+    virtual ~TextureResidencyManager();
+
+    void makeResident(GLuint texture);
+    void makeNonResident(GLuint texture);
+    void setHandle(unsigned int material, glow::TextureHandle handle);
+
+protected:
+    struct Entry
+    {
+        glow::ref_ptr<glow::Texture> texture;
+        glow::TextureHandle handle;
+        std::vector<unsigned int> materials;
+    };
+
+    Layout m_layout;
+    ResidencyTracker m_tracker; ///< tracks textures by their GL name, so shared textures count once
+
+    std::unordered_map<GLuint, Entry> m_entries;
+    std::vector<GLuint> m_materials; ///< texture per material, 0 if none
+
+    glow::ref_ptr<glow::Texture> m_fallback;
+    glow::TextureHandle m_fallbackHandle;
+
+    std::vector<glow::TextureHandle> m_handles; ///< per material, 0 if not resident
+    bool m_handlesChanged;
+    glow::ref_ptr<glow::Buffer> m_handleTable;
+
+    std::vector<unsigned int> m_madeResident;
+    std::vector<unsigned int> m_madeNonResident;
+};
+
+} // namespace glowutils
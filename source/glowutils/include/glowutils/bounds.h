@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/glowutils.h>
+#include <glowutils/AxisAlignedBoundingBox.h>
+#include <glowutils/BoundingSphere.h>
+
+namespace glowutils
+{
+
+/** \brief Computes the bounding box of count vertex positions given as three floats each.
+
+    The i-th position is read from data + baseoffset + i * stride (in bytes), matching the
+    parameters of glow::VertexAttributeBinding::setBuffer. As in OpenGL, a stride of 0 denotes
+    tightly packed positions. Positions do not need to be aligned. Minimum and maximum are
+    computed with SSE if available, and large arrays are reduced on multiple threads.
+    For count 0 an empty box is returned.
+*/
+const AxisAlignedBoundingBox GLOWUTILS_API boundingBox(
+    const void * data
+,   unsigned int count
+,   std::size_t baseoffset = 0
+,   std::size_t stride = 0);
+
+const AxisAlignedBoundingBox GLOWUTILS_API boundingBox(const std::vector<glm::vec3> & vertices);
+
+/** \brief Computes a bounding sphere of count vertex positions (\see boundingBox for the parameters).
+
+    The sphere is centered at the center of the bounding box, with the radius being the maximum
+    distance of any position to that center. This is not the minimal enclosing sphere, but both
+    passes are reduced in parallel for large arrays. For count 0 an empty sphere is returned.
+*/
+const BoundingSphere GLOWUTILS_API boundingSphere(
+    const void * data
+,   unsigned int count
+,   std::size_t baseoffset = 0
+,   std::size_t stride = 0);
+
+const BoundingSphere GLOWUTILS_API boundingSphere(const std::vector<glm::vec3> & vertices);
+
+} // namespace glowutils
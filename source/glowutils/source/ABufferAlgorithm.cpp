@@ -1,5 +1,7 @@
 #include <glowutils/ABufferAlgorithm.h>
 
+#include <algorithm>
+
 #include <glow/Program.h>
 #include <glow/FrameBufferObject.h>
 #include <glow/Texture.h>
@@ -20,6 +22,7 @@ struct ABufferEntry {
     glm::vec4 color;
     float z;
     int next;
+    int padding[2]; // std430 aligns the entries to their vec4 member
 };
 
 struct Head {
@@ -32,10 +35,43 @@ struct Head {
     }
 };
 
-const int ABUFFER_SIZE = 8;
+// maximum number of fragments sorted per pixel, independent of the size of the fragment pool
+const int ABUFFER_SIZE = 16;
+
+// initial and minimum pool size, in fragments per pixel
+const float INITIAL_FRAGMENTS_PER_PIXEL = 4.f;
+const float MIN_FRAGMENTS_PER_PIXEL = 1.f;
+
+// the pool grows by the overflow plus this fraction of the demand, to avoid growing every frame
+const float FRAGMENT_HEADROOM = .5f;
+
+// the pool shrinks, if less than this fraction was used for the given number of frames
+const float UNDERUSED_FRACTION = .25f;
+const unsigned int UNDERUSED_FRAMES = 120;
+
+unsigned int fragmentsForPixels(int width, int height, float fragmentsPerPixel)
+{
+    return static_cast<unsigned int>(static_cast<float>(width * height) * fragmentsPerPixel);
+}
 
 } // anonymous namespace
 
+ABufferAlgorithm::ABufferAlgorithm()
+: m_counterReadbackFence(nullptr)
+, m_fragmentCapacity(0)
+, m_minFragmentCapacity(0)
+, m_maxFragmentCapacity(0)
+, m_fragmentCount(0)
+, m_underusedFrames(0)
+{
+}
+
+ABufferAlgorithm::~ABufferAlgorithm()
+{
+    if (m_counterReadbackFence)
+        glDeleteSync(m_counterReadbackFence);
+}
+
 void ABufferAlgorithm::initialize(const std::string & transparencyShaderFilePath, glow::Shader *vertexShader, glow::Shader *geometryShader) {
     glow::createNamedString("/transparency/abuffer_definitions", "const int ABUFFER_SIZE = " + std::to_string(ABUFFER_SIZE) + ";");
     glow::createNamedString("/transparency/abuffer.glsl", new glowutils::File(transparencyShaderFilePath + "abuffer.glsl"));
@@ -61,6 +97,11 @@ void ABufferAlgorithm::initialize(const std::string & transparencyShaderFilePath
 
     m_counter = new glow::Buffer(GL_ATOMIC_COUNTER_BUFFER);
     m_counter->setName("A Buffer Counter");
+    m_counter->setData(static_cast<GLsizei>(sizeof(GLuint)), nullptr, GL_DYNAMIC_DRAW);
+
+    m_counterReadback = new glow::Buffer(GL_COPY_WRITE_BUFFER);
+    m_counterReadback->setName("A Buffer Counter Readback");
+    m_counterReadback->setData(static_cast<GLsizei>(sizeof(GLuint)), nullptr, GL_STREAM_READ);
 
 	m_quad = new glowutils::ScreenAlignedQuad(glowutils::createShaderFromFile(GL_FRAGMENT_SHADER, transparencyShaderFilePath +  "abuffer_post.frag"));
 
@@ -75,13 +116,13 @@ void ABufferAlgorithm::draw(const DrawFunction& drawFunction, glowutils::Camera*
     m_renderFbo->clear(GL_DEPTH_BUFFER_BIT);
     m_renderFbo->clearBuffer(GL_COLOR, 0, glm::vec4(1.0f, 1.0f, 1.0f, std::numeric_limits<float>::max()));
 
-    // reset head buffer & counter
+    readBackFragmentCount();
+
+    // reset head buffer & counter, without reallocating them
     static glm::ivec2 initialHead(-1, 0);
-    static int initialCounter = 0;
-    m_headBuffer->setData(static_cast<GLsizei>(width * height * sizeof(Head)), nullptr, GL_DYNAMIC_DRAW);
-    m_headBuffer->clearData(GL_RG32I, GL_RG, GL_INT, &initialHead);
-    m_counter->setData(static_cast<GLsizei>(sizeof(int)), nullptr, GL_DYNAMIC_DRAW);
-    m_counter->clearData(GL_R32I, GL_RED, GL_UNSIGNED_INT, &initialCounter);
+    static GLuint initialCounter = 0;
+    m_headBuffer->clearData(GL_RG32I, GL_RG_INTEGER, GL_INT, &initialHead);
+    m_counter->clearData(GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &initialCounter);
 
     // bind buffers
     m_linkedListBuffer->bindBase(GL_SHADER_STORAGE_BUFFER, 0);
@@ -91,15 +132,24 @@ void ABufferAlgorithm::draw(const DrawFunction& drawFunction, glowutils::Camera*
     m_program->setUniform("viewprojectionmatrix", camera->viewProjection());
     m_program->setUniform("normalmatrix", camera->normal());
     m_program->setUniform("screenSize", glm::ivec2(width, height));
+    m_program->setUniform("fragmentCapacity", m_fragmentCapacity);
     m_program->use();
 
     drawFunction(m_program);
 
     m_renderFbo->unbind();
 
-    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
     CheckGLError();
 
+    // at most one read back is in flight, its result is fetched as soon as the fence is signaled
+    if (!m_counterReadbackFence)
+    {
+        m_counter->copySubData(m_counterReadback, static_cast<GLsizeiptr>(sizeof(GLuint)));
+        m_counterReadbackFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        CheckGLError();
+    }
+
     m_postFbo->bind();
     m_postFbo->clear(GL_COLOR_BUFFER_BIT);
 
@@ -118,8 +168,17 @@ void ABufferAlgorithm::resize(int width, int height) {
     int depthBits = glow::FrameBufferObject::defaultFBO()->getAttachmentParameter(GL_DEPTH, GL_FRAMEBUFFER_ATTACHMENT_DEPTH_SIZE);
     m_opaqueBuffer->image2D(0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, nullptr);
     m_depthBuffer->storage(depthBits == 16 ? GL_DEPTH_COMPONENT16 : GL_DEPTH_COMPONENT, width, height);
-    m_linkedListBuffer->setData(static_cast<GLsizei>(width * height * ABUFFER_SIZE * sizeof(ABufferEntry)), nullptr, GL_DYNAMIC_DRAW);
+    m_headBuffer->setData(static_cast<GLsizeiptr>(width) * height * static_cast<GLsizeiptr>(sizeof(Head)), nullptr, GL_DYNAMIC_DRAW);
     m_colorBuffer->image2D(0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, nullptr);
+
+    const GLint maxBlockSize = glow::getInteger(GL_MAX_SHADER_STORAGE_BLOCK_SIZE);
+
+    m_maxFragmentCapacity = std::min(fragmentsForPixels(width, height, static_cast<float>(ABUFFER_SIZE))
+        , static_cast<unsigned int>(maxBlockSize) / static_cast<unsigned int>(sizeof(ABufferEntry)));
+    m_minFragmentCapacity = std::min(fragmentsForPixels(width, height, MIN_FRAGMENTS_PER_PIXEL), m_maxFragmentCapacity);
+
+    // keep the current pool within the new bounds, it adapts to the new demand within a few frames
+    setFragmentCapacity(m_fragmentCapacity > 0 ? m_fragmentCapacity : fragmentsForPixels(width, height, INITIAL_FRAGMENTS_PER_PIXEL));
 }
 
 glow::Texture* ABufferAlgorithm::getOutput()
@@ -127,4 +186,72 @@ glow::Texture* ABufferAlgorithm::getOutput()
     return m_colorBuffer;
 }
 
+unsigned int ABufferAlgorithm::fragmentCapacity() const
+{
+    return m_fragmentCapacity;
+}
+
+unsigned int ABufferAlgorithm::fragmentCount() const
+{
+    return m_fragmentCount;
+}
+
+void ABufferAlgorithm::readBackFragmentCount()
+{
+    if (!m_counterReadbackFence)
+        return;
+
+    const GLenum status = glClientWaitSync(m_counterReadbackFence, 0, 0);
+    CheckGLError();
+
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        return;
+
+    glDeleteSync(m_counterReadbackFence);
+    m_counterReadbackFence = nullptr;
+
+    const GLuint * count = reinterpret_cast<const GLuint *>(m_counterReadback->mapRange(0, sizeof(GLuint), GL_MAP_READ_BIT));
+    if (!count)
+        return;
+
+    m_fragmentCount = *count;
+    m_counterReadback->unmap();
+
+    adaptFragmentCapacity();
+}
+
+void ABufferAlgorithm::adaptFragmentCapacity()
+{
+    if (m_fragmentCount > m_fragmentCapacity)
+    {
+        m_underusedFrames = 0;
+        setFragmentCapacity(m_fragmentCount + static_cast<unsigned int>(static_cast<float>(m_fragmentCount) * FRAGMENT_HEADROOM));
+        return;
+    }
+
+    if (static_cast<float>(m_fragmentCount) >= static_cast<float>(m_fragmentCapacity) * UNDERUSED_FRACTION)
+    {
+        m_underusedFrames = 0;
+        return;
+    }
+
+    // counts read backs, not frames, which is the same unless read backs are delayed
+    if (++m_underusedFrames < UNDERUSED_FRAMES)
+        return;
+
+    m_underusedFrames = 0;
+    setFragmentCapacity(m_fragmentCount + static_cast<unsigned int>(static_cast<float>(m_fragmentCount) * FRAGMENT_HEADROOM));
+}
+
+void ABufferAlgorithm::setFragmentCapacity(unsigned int capacity)
+{
+    capacity = std::max(m_minFragmentCapacity, std::min(capacity, m_maxFragmentCapacity));
+
+    if (capacity == m_fragmentCapacity)
+        return;
+
+    m_fragmentCapacity = capacity;
+    m_linkedListBuffer->setData(static_cast<GLsizeiptr>(capacity) * static_cast<GLsizeiptr>(sizeof(ABufferEntry)), nullptr, GL_DYNAMIC_DRAW);
+}
+
 } // namespace glow
@@ -0,0 +1,394 @@
+#include <glowutils/AnimationSampler.h>
+
+#include <algorithm>
+#include <cassert>
+
+#include <glow/Buffer.h>
+
+#include <glowutils/AnimationTrackSet.h>
+
+#include "keyframes.h"
+#include "parallelfor.h"
+
+#if defined(__AVX__)
+    #define ANIMATION_AVX
+    #include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define ANIMATION_SSE
+    #include <xmmintrin.h>
+#endif
+
+namespace
+{
+
+// tracks are processed in blocks small enough for the gathered key values to stay in the L1 cache
+const unsigned int BlockSize = 256;
+
+struct Block
+{
+    float a[4][BlockSize]; // values of the first segment key, replaced by the blended values
+    float b[4][BlockSize]; // values of the second segment key
+    float weights[BlockSize];
+};
+
+// All kernels evaluate the expressions of lerp and nlerp (see keyframes.h) in the same order,
+// so they produce the same values as AnimationTrackSet::evaluate.
+
+template <unsigned int Components>
+void blendScalar(Block & block, unsigned int begin, unsigned int end)
+{
+    for (unsigned int j = begin; j < end; ++j)
+    {
+        if (Components == 4)
+        {
+            const float a[4] = { block.a[0][j], block.a[1][j], block.a[2][j], block.a[3][j] };
+            const float b[4] = { block.b[0][j], block.b[1][j], block.b[2][j], block.b[3][j] };
+            float result[4];
+
+            glowutils::nlerp(a, b, block.weights[j], result);
+
+            for (unsigned int c = 0; c < 4; ++c)
+                block.a[c][j] = result[c];
+        }
+        else
+        {
+            for (unsigned int c = 0; c < Components; ++c)
+                block.a[c][j] = glowutils::lerp(block.a[c][j], block.b[c][j], block.weights[j]);
+        }
+    }
+}
+
+#if defined(ANIMATION_SSE)
+
+template <unsigned int Components>
+void blendSSE(Block & block, unsigned int count)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 signBit = _mm_set1_ps(-0.f);
+
+    unsigned int j = 0;
+    for (; j + 4 <= count; j += 4)
+    {
+        const __m128 weight = _mm_loadu_ps(block.weights + j);
+
+        __m128 a[Components];
+        __m128 b[Components];
+        for (unsigned int c = 0; c < Components; ++c)
+        {
+            a[c] = _mm_loadu_ps(block.a[c] + j);
+            b[c] = _mm_loadu_ps(block.b[c] + j);
+        }
+
+        if (Components == 4)
+        {
+            const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_mul_ps(a[2], b[2])), _mm_mul_ps(a[3], b[3]));
+            const __m128 sign = _mm_and_ps(_mm_cmplt_ps(dot, zero), signBit);
+
+            for (unsigned int c = 0; c < Components; ++c)
+                b[c] = _mm_xor_ps(b[c], sign);
+        }
+
+        for (unsigned int c = 0; c < Components; ++c)
+            a[c] = _mm_add_ps(a[c], _mm_mul_ps(weight, _mm_sub_ps(b[c], a[c])));
+
+        if (Components == 4)
+        {
+            const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(a[0], a[0]), _mm_mul_ps(a[1], a[1])), _mm_mul_ps(a[2], a[2])), _mm_mul_ps(a[3], a[3])));
+            const __m128 inverseLength = _mm_div_ps(one, length);
+
+            for (unsigned int c = 0; c < Components; ++c)
+                a[c] = _mm_mul_ps(a[c], inverseLength);
+        }
+
+        for (unsigned int c = 0; c < Components; ++c)
+            _mm_storeu_ps(block.a[c] + j, a[c]);
+    }
+
+    blendScalar<Components>(block, j, count);
+}
+
+#endif
+
+#if defined(ANIMATION_AVX)
+
+template <unsigned int Components>
+void blendAVX(Block & block, unsigned int count)
+{
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 signBit = _mm256_set1_ps(-0.f);
+
+    unsigned int j = 0;
+    for (; j + 8 <= count; j += 8)
+    {
+        const __m256 weight = _mm256_loadu_ps(block.weights + j);
+
+        __m256 a[Components];
+        __m256 b[Components];
+        for (unsigned int c = 0; c < Components; ++c)
+        {
+            a[c] = _mm256_loadu_ps(block.a[c] + j);
+            b[c] = _mm256_loadu_ps(block.b[c] + j);
+        }
+
+        if (Components == 4)
+        {
+            const __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                _mm256_mul_ps(a[0], b[0]), _mm256_mul_ps(a[1], b[1])), _mm256_mul_ps(a[2], b[2])), _mm256_mul_ps(a[3], b[3]));
+            const __m256 sign = _mm256_and_ps(_mm256_cmp_ps(dot, zero, _CMP_LT_OQ), signBit);
+
+            for (unsigned int c = 0; c < Components; ++c)
+                b[c] = _mm256_xor_ps(b[c], sign);
+        }
+
+        for (unsigned int c = 0; c < Components; ++c)
+            a[c] = _mm256_add_ps(a[c], _mm256_mul_ps(weight, _mm256_sub_ps(b[c], a[c])));
+
+        if (Components == 4)
+        {
+            const __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                _mm256_mul_ps(a[0], a[0]), _mm256_mul_ps(a[1], a[1])), _mm256_mul_ps(a[2], a[2])), _mm256_mul_ps(a[3], a[3])));
+            const __m256 inverseLength = _mm256_div_ps(one, length);
+
+            for (unsigned int c = 0; c < Components; ++c)
+                a[c] = _mm256_mul_ps(a[c], inverseLength);
+        }
+
+        for (unsigned int c = 0; c < Components; ++c)
+            _mm256_storeu_ps(block.a[c] + j, a[c]);
+    }
+
+    blendScalar<Components>(block, j, count);
+}
+
+#endif
+
+template <unsigned int Components>
+void sampleBlock(const glowutils::AnimationTrackSet & tracks, float time, const float * times
+    , unsigned int begin, unsigned int end, unsigned int * segments, bool vectorized, Block & block, float * output, unsigned int stride)
+{
+    const unsigned int * firstKeys = tracks.firstKeys();
+    const unsigned int * keyCounts = tracks.keyCounts();
+    const float * keyTimes = tracks.times();
+    const unsigned char * interpolations = tracks.interpolations();
+
+    const float * values = tracks.values();
+
+    const unsigned int count = end - begin;
+
+    // lookup segments and gather their keys
+
+    for (unsigned int j = 0; j < count; ++j)
+    {
+        const unsigned int track = begin + j;
+        const unsigned int first = firstKeys[track];
+        const unsigned int keyCount = keyCounts[track];
+        const float t = times ? times[track] : time;
+
+        const unsigned int k = glowutils::findSegment(keyTimes + first, keyCount, t, segments[track]);
+        segments[track] = k;
+
+        block.weights[j] = glowutils::segmentWeight(keyTimes + first, interpolations + first, keyCount, k, t);
+
+        const float * a = values + (first + k) * Components;
+        const float * b = keyCount > 1 ? a + Components : a;
+
+        for (unsigned int c = 0; c < Components; ++c)
+        {
+            block.a[c][j] = a[c];
+            block.b[c][j] = b[c];
+        }
+    }
+
+    // blend
+
+#if defined(ANIMATION_AVX)
+    if (vectorized)
+        blendAVX<Components>(block, count);
+    else
+#elif defined(ANIMATION_SSE)
+    if (vectorized)
+        blendSSE<Components>(block, count);
+    else
+#endif
+        blendScalar<Components>(block, 0, count);
+
+    (void)vectorized;
+
+    // scatter into the interleaved output
+
+    char * destination = reinterpret_cast<char *>(output) + static_cast<size_t>(begin) * stride;
+    for (unsigned int j = 0; j < count; ++j, destination += stride)
+    {
+        float * value = reinterpret_cast<float *>(destination);
+        for (unsigned int c = 0; c < Components; ++c)
+            value[c] = block.a[c][j];
+    }
+}
+
+}
+
+namespace glowutils
+{
+
+AnimationSampler::AnimationSampler()
+: m_kernel(Vectorized)
+, m_threadCount(0)
+, m_parallelThreshold(1 << 14)
+{
+}
+
+AnimationSampler::~AnimationSampler()
+{
+}
+
+AnimationSampler::Kernel AnimationSampler::kernel() const
+{
+    return m_kernel;
+}
+
+void AnimationSampler::setKernel(Kernel kernel)
+{
+    m_kernel = kernel;
+}
+
+unsigned int AnimationSampler::threadCount() const
+{
+    return m_threadCount;
+}
+
+void AnimationSampler::setThreadCount(unsigned int count)
+{
+    m_threadCount = count;
+}
+
+unsigned int AnimationSampler::parallelThreshold() const
+{
+    return m_parallelThreshold;
+}
+
+void AnimationSampler::setParallelThreshold(unsigned int trackCount)
+{
+    m_parallelThreshold = trackCount;
+}
+
+const char * AnimationSampler::vectorExtension()
+{
+#if defined(ANIMATION_AVX)
+    return "AVX";
+#elif defined(ANIMATION_SSE)
+    return "SSE";
+#else
+    return "none";
+#endif
+}
+
+void AnimationSampler::sample(const AnimationTrackSet & tracks, float time, float * output, unsigned int stride)
+{
+    sampleTracks(tracks, time, nullptr, output, stride);
+}
+
+void AnimationSampler::sample(const AnimationTrackSet & tracks, const float * times, float * output, unsigned int stride)
+{
+    assert(times != nullptr);
+
+    sampleTracks(tracks, 0.f, times, output, stride);
+}
+
+void AnimationSampler::sample(const AnimationTrackSet & tracks, float time, std::vector<float> & output)
+{
+    output.resize(tracks.size() * tracks.componentCount());
+    sampleTracks(tracks, time, nullptr, output.data(), 0);
+}
+
+bool AnimationSampler::sample(const AnimationTrackSet & tracks, float time, glow::Buffer * buffer, GLintptr offset, unsigned int stride)
+{
+    assert(buffer != nullptr);
+
+    if (tracks.empty())
+        return true;
+
+    const unsigned int valueSize = tracks.componentCount() * static_cast<unsigned int>(sizeof(float));
+    if (stride == 0)
+        stride = valueSize;
+
+    const GLsizeiptr length = static_cast<GLsizeiptr>(tracks.size() - 1) * stride + valueSize;
+
+    void * data = buffer->mapRange(offset, length, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+    if (!data)
+        return false;
+
+    sampleTracks(tracks, time, nullptr, static_cast<float *>(data), stride);
+
+    return buffer->unmap();
+}
+
+void AnimationSampler::sampleTracks(const AnimationTrackSet & tracks, float time, const float * times, float * output, unsigned int stride)
+{
+    assert(output != nullptr);
+
+    const unsigned int size = tracks.size();
+
+    if (stride == 0)
+        stride = tracks.componentCount() * static_cast<unsigned int>(sizeof(float));
+
+    m_segments.resize(size, 0);
+
+    unsigned int threadCount = parallelRangeCount(size, BlockSize, m_threadCount);
+    if (size < m_parallelThreshold || threadCount < 2)
+    {
+        sampleRange(tracks, time, times, 0, size, output, stride);
+        return;
+    }
+
+    // each thread samples a contiguous range of whole blocks, tracks and segments are only read
+    // and written by the thread of their range
+
+    const unsigned int rangeSize = ((size + threadCount - 1) / threadCount + BlockSize - 1) / BlockSize * BlockSize;
+    threadCount = (size + rangeSize - 1) / rangeSize;
+
+    parallelFor(threadCount, [this, &tracks, time, times, size, rangeSize, output, stride](unsigned int t)
+    {
+        const unsigned int begin = t * rangeSize;
+        const unsigned int end = std::min(size, begin + rangeSize);
+
+        sampleRange(tracks, time, times, begin, end, output, stride);
+    });
+}
+
+void AnimationSampler::sampleRange(
+    const AnimationTrackSet & tracks
+,   float time
+,   const float * times
+,   unsigned int begin
+,   unsigned int end
+,   float * output
+,   unsigned int stride)
+{
+    const bool vectorized = m_kernel == Vectorized;
+
+    Block block;
+
+    for (unsigned int blockBegin = begin; blockBegin < end; blockBegin += BlockSize)
+    {
+        const unsigned int blockEnd = std::min(end, blockBegin + BlockSize);
+
+        switch (tracks.valueType())
+        {
+        case AnimationTrackSet::Float:
+            sampleBlock<1>(tracks, time, times, blockBegin, blockEnd, m_segments.data(), vectorized, block, output, stride);
+            break;
+        case AnimationTrackSet::Vec3:
+            sampleBlock<3>(tracks, time, times, blockBegin, blockEnd, m_segments.data(), vectorized, block, output, stride);
+            break;
+        case AnimationTrackSet::Quat:
+            sampleBlock<4>(tracks, time, times, blockBegin, blockEnd, m_segments.data(), vectorized, block, output, stride);
+            break;
+        }
+    }
+}
+
+} // namespace glowutils
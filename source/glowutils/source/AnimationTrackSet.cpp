@@ -0,0 +1,214 @@
+#include <glowutils/AnimationTrackSet.h>
+
+#include <cassert>
+
+#include "keyframes.h"
+
+using namespace glm;
+
+namespace glowutils
+{
+
+AnimationTrackSet::AnimationTrackSet(ValueType valueType)
+: m_valueType(valueType)
+{
+}
+
+AnimationTrackSet::~AnimationTrackSet()
+{
+}
+
+AnimationTrackSet::ValueType AnimationTrackSet::valueType() const
+{
+    return m_valueType;
+}
+
+unsigned int AnimationTrackSet::componentCount() const
+{
+    return static_cast<unsigned int>(m_valueType);
+}
+
+unsigned int AnimationTrackSet::size() const
+{
+    return static_cast<unsigned int>(m_firstKeys.size());
+}
+
+bool AnimationTrackSet::empty() const
+{
+    return m_firstKeys.empty();
+}
+
+unsigned int AnimationTrackSet::keyCount() const
+{
+    return static_cast<unsigned int>(m_times.size());
+}
+
+void AnimationTrackSet::reserve(unsigned int trackCount, unsigned int keyCount)
+{
+    m_firstKeys.reserve(trackCount);
+    m_keyCounts.reserve(trackCount);
+
+    m_times.reserve(keyCount);
+    m_interpolations.reserve(keyCount);
+    m_values.reserve(keyCount * componentCount());
+}
+
+void AnimationTrackSet::clear()
+{
+    m_firstKeys.clear();
+    m_keyCounts.clear();
+
+    m_times.clear();
+    m_interpolations.clear();
+    m_values.clear();
+}
+
+unsigned int AnimationTrackSet::add(const std::vector<Keyframe<float>> & keys)
+{
+    assert(m_valueType == Float);
+
+    const unsigned int track = addTrack(static_cast<unsigned int>(keys.size()));
+
+    for (const Keyframe<float> & key : keys)
+    {
+        m_times.push_back(key.time);
+        m_interpolations.push_back(static_cast<unsigned char>(key.interpolation));
+        m_values.push_back(key.value);
+    }
+    return track;
+}
+
+unsigned int AnimationTrackSet::add(const std::vector<Keyframe<vec3>> & keys)
+{
+    assert(m_valueType == Vec3);
+
+    const unsigned int track = addTrack(static_cast<unsigned int>(keys.size()));
+
+    for (const Keyframe<vec3> & key : keys)
+    {
+        m_times.push_back(key.time);
+        m_interpolations.push_back(static_cast<unsigned char>(key.interpolation));
+        for (int c = 0; c < 3; ++c)
+            m_values.push_back(key.value[c]);
+    }
+    return track;
+}
+
+unsigned int AnimationTrackSet::add(const std::vector<Keyframe<quat>> & keys)
+{
+    assert(m_valueType == Quat);
+
+    const unsigned int track = addTrack(static_cast<unsigned int>(keys.size()));
+
+    for (const Keyframe<quat> & key : keys)
+    {
+        m_times.push_back(key.time);
+        m_interpolations.push_back(static_cast<unsigned char>(key.interpolation));
+        m_values.push_back(key.value.x);
+        m_values.push_back(key.value.y);
+        m_values.push_back(key.value.z);
+        m_values.push_back(key.value.w);
+    }
+    return track;
+}
+
+unsigned int AnimationTrackSet::add(unsigned int keyCount, const float * times, const float * values, const InterpolationType * interpolations)
+{
+    assert(times != nullptr && values != nullptr);
+
+    const unsigned int track = addTrack(keyCount);
+
+    for (unsigned int k = 0; k < keyCount; ++k)
+    {
+        m_times.push_back(times[k]);
+        m_interpolations.push_back(static_cast<unsigned char>(interpolations ? interpolations[k] : LinearInterpolation));
+    }
+    m_values.insert(m_values.end(), values, values + keyCount * componentCount());
+    return track;
+}
+
+unsigned int AnimationTrackSet::addTrack(unsigned int keyCount)
+{
+    assert(keyCount > 0);
+
+    m_firstKeys.push_back(this->keyCount());
+    m_keyCounts.push_back(keyCount);
+
+    return size() - 1;
+}
+
+unsigned int AnimationTrackSet::firstKey(unsigned int track) const
+{
+    assert(track < size());
+    return m_firstKeys[track];
+}
+
+unsigned int AnimationTrackSet::keyCount(unsigned int track) const
+{
+    assert(track < size());
+    return m_keyCounts[track];
+}
+
+float AnimationTrackSet::startTime(unsigned int track) const
+{
+    return m_times[firstKey(track)];
+}
+
+float AnimationTrackSet::endTime(unsigned int track) const
+{
+    return m_times[firstKey(track) + keyCount(track) - 1];
+}
+
+vec4 AnimationTrackSet::evaluate(unsigned int track, float time) const
+{
+    const unsigned int first = firstKey(track);
+    const unsigned int count = keyCount(track);
+
+    const unsigned int k = findSegment(&m_times[first], count, time, 0);
+    const float weight = segmentWeight(&m_times[first], &m_interpolations[first], count, k, time);
+
+    const unsigned int components = componentCount();
+
+    const float * a = &m_values[(first + k) * components];
+    const float * b = count > 1 ? a + components : a;
+
+    vec4 result(0.f);
+
+    if (m_valueType == Quat)
+    {
+        nlerp(a, b, weight, &result[0]);
+        return result;
+    }
+
+    for (unsigned int c = 0; c < components; ++c)
+        result[c] = lerp(a[c], b[c], weight);
+
+    return result;
+}
+
+const unsigned int * AnimationTrackSet::firstKeys() const
+{
+    return m_firstKeys.data();
+}
+
+const unsigned int * AnimationTrackSet::keyCounts() const
+{
+    return m_keyCounts.data();
+}
+
+const float * AnimationTrackSet::times() const
+{
+    return m_times.data();
+}
+
+const unsigned char * AnimationTrackSet::interpolations() const
+{
+    return m_interpolations.data();
+}
+
+const float * AnimationTrackSet::values() const
+{
+    return m_values.data();
+}
+
+} // namespace glowutils
@@ -2,6 +2,8 @@
 
 #include <cfloat>
 
+#include <glowutils/bounds.h>
+
 using namespace glm;
 
 namespace glowutils
@@ -26,7 +28,7 @@ AxisAlignedBoundingBox::AxisAlignedBoundingBox(const glm::vec3& llf, const glm::
     glm::min(llf.z, urb.z)
 ))
 , m_center(m_llf + (m_urb - m_llf) * .5f)
-, m_radius(static_cast<float>((m_urb - m_llf).length()) * .5f)
+, m_radius(length(m_urb - m_llf) * .5f)
 {
 }
 
@@ -54,17 +56,50 @@ bool AxisAlignedBoundingBox::extend(const vec3 & vertex)
     if (vertex.z > m_urb.z)
         m_urb.z = vertex.z;
 
-    const bool extended(urb != m_urb && llf != m_llf);
+    const bool extended(urb != m_urb || llf != m_llf);
 
     if (extended)
     {
         m_center = m_llf + (m_urb - m_llf) * .5f;
-        m_radius = static_cast<float>((m_urb - m_llf).length()) * .5f;
+        m_radius = length(m_urb - m_llf) * .5f;
     }
 
     return extended;
 }
 
+bool AxisAlignedBoundingBox::extend(const AxisAlignedBoundingBox & box)
+{
+    const vec3 llf(min(m_llf, box.m_llf));
+    const vec3 urb(max(m_urb, box.m_urb));
+
+    const bool extended(urb != m_urb || llf != m_llf);
+
+    if (extended)
+    {
+        m_llf = llf;
+        m_urb = urb;
+
+        m_center = m_llf + (m_urb - m_llf) * .5f;
+        m_radius = length(m_urb - m_llf) * .5f;
+    }
+
+    return extended;
+}
+
+bool AxisAlignedBoundingBox::extend(const std::vector<vec3> & vertices)
+{
+    return extend(boundingBox(vertices));
+}
+
+bool AxisAlignedBoundingBox::extend(
+    const void * data
+,   unsigned int count
+,   std::size_t baseoffset
+,   std::size_t stride)
+{
+    return extend(boundingBox(data, count, baseoffset, stride));
+}
+
 const vec3 & AxisAlignedBoundingBox::center() const
 {
     return m_center;
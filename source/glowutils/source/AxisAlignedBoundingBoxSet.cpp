@@ -0,0 +1,131 @@
+#include <glowutils/AxisAlignedBoundingBoxSet.h>
+
+#include <cassert>
+#include <cfloat>
+
+#include <glowutils/AxisAlignedBoundingBox.h>
+
+using namespace glm;
+
+namespace glowutils
+{
+
+AxisAlignedBoundingBoxSet::AxisAlignedBoundingBoxSet()
+{
+}
+
+AxisAlignedBoundingBoxSet::~AxisAlignedBoundingBoxSet()
+{
+}
+
+unsigned int AxisAlignedBoundingBoxSet::size() const
+{
+    return static_cast<unsigned int>(m_centers[0].size());
+}
+
+bool AxisAlignedBoundingBoxSet::empty() const
+{
+    return m_centers[0].empty();
+}
+
+void AxisAlignedBoundingBoxSet::reserve(unsigned int count)
+{
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        m_centers[axis].reserve(count);
+        m_extents[axis].reserve(count);
+    }
+}
+
+void AxisAlignedBoundingBoxSet::clear()
+{
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        m_centers[axis].clear();
+        m_extents[axis].clear();
+    }
+}
+
+unsigned int AxisAlignedBoundingBoxSet::add(const AxisAlignedBoundingBox & box)
+{
+    return add(box.llf(), box.urb());
+}
+
+unsigned int AxisAlignedBoundingBoxSet::add(const vec3 & llf, const vec3 & urb)
+{
+    const unsigned int index = size();
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        m_centers[axis].push_back(0.f);
+        m_extents[axis].push_back(0.f);
+    }
+
+    set(index, llf, urb);
+
+    return index;
+}
+
+void AxisAlignedBoundingBoxSet::set(unsigned int index, const AxisAlignedBoundingBox & box)
+{
+    set(index, box.llf(), box.urb());
+}
+
+void AxisAlignedBoundingBoxSet::set(unsigned int index, const vec3 & llf, const vec3 & urb)
+{
+    assert(index < size());
+
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (llf[axis] > urb[axis])
+        {
+            // empty box (e.g., default AxisAlignedBoundingBox): negative extent, never visible
+            m_centers[axis][index] = 0.f;
+            m_extents[axis][index] = -FLT_MAX;
+            continue;
+        }
+
+        m_centers[axis][index] = llf[axis] * .5f + urb[axis] * .5f;
+        m_extents[axis][index] = urb[axis] * .5f - llf[axis] * .5f;
+    }
+}
+
+vec3 AxisAlignedBoundingBoxSet::center(unsigned int index) const
+{
+    assert(index < size());
+
+    return vec3(m_centers[0][index], m_centers[1][index], m_centers[2][index]);
+}
+
+vec3 AxisAlignedBoundingBoxSet::extent(unsigned int index) const
+{
+    assert(index < size());
+
+    return vec3(m_extents[0][index], m_extents[1][index], m_extents[2][index]);
+}
+
+vec3 AxisAlignedBoundingBoxSet::llf(unsigned int index) const
+{
+    return center(index) - extent(index);
+}
+
+vec3 AxisAlignedBoundingBoxSet::urb(unsigned int index) const
+{
+    return center(index) + extent(index);
+}
+
+const float * AxisAlignedBoundingBoxSet::centers(unsigned int axis) const
+{
+    assert(axis < 3);
+
+    return m_centers[axis].data();
+}
+
+const float * AxisAlignedBoundingBoxSet::extents(unsigned int axis) const
+{
+    assert(axis < 3);
+
+    return m_extents[axis].data();
+}
+
+} // namespace glowutils
@@ -0,0 +1,44 @@
+#include <glowutils/BoundingSphere.h>
+
+using namespace glm;
+
+namespace glowutils
+{
+
+BoundingSphere::BoundingSphere()
+: m_radius(-1.f)
+{
+}
+
+BoundingSphere::BoundingSphere(const vec3 & center, float radius)
+: m_center(center)
+, m_radius(radius)
+{
+}
+
+BoundingSphere::~BoundingSphere()
+{
+}
+
+const vec3 & BoundingSphere::center() const
+{
+    return m_center;
+}
+
+float BoundingSphere::radius() const
+{
+    return m_radius;
+}
+
+bool BoundingSphere::inside(const vec3 & vertex) const
+{
+    const vec3 distance = vertex - m_center;
+    return m_radius >= 0.f && dot(distance, distance) <= m_radius * m_radius;
+}
+
+bool BoundingSphere::outside(const vec3 & vertex) const
+{
+    return !inside(vertex);
+}
+
+} // namespace glowutils
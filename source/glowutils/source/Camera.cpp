@@ -5,6 +5,8 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/matrix_inverse.hpp>
 
+#include <glowutils/Plane3.h>
+
 using namespace glm;
 
 namespace glowutils
@@ -40,6 +42,7 @@ void Camera::invalidateMatrices() const
     m_viewProjection.invalidate();
     m_viewProjectionInverted.invalidate();
     m_normal.invalidate();
+    m_frustumPlanes.invalidate();
 }
 
 void Camera::dirty(bool update)
@@ -255,6 +258,17 @@ const mat3 & Camera::normal() const
     return m_normal.value();
 }
 
+const std::array<vec4, 6> & Camera::frustumPlanes() const
+{
+    if (m_dirty)
+        update();
+
+    if (!m_frustumPlanes.isValid())
+        m_frustumPlanes.setValue(glowutils::frustumPlanes(viewProjection()));
+
+    return m_frustumPlanes.value();
+}
+
 void Camera::changed() const
 {
 }
@@ -1,9 +1,57 @@
 #include <glowutils/CameraPath.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
 #include <glm/gtc/type_ptr.hpp>
 
+#include <glow/logging.h>
+
 #include <glowutils/Camera.h>
 
+namespace
+{
+
+const char signature[4] = { 'g', 'c', 'p', '1' };
+
+// eye, center, up, fov
+const unsigned int floatsPerPoint = 10;
+
+void writeUInt32(std::uint32_t value, char * bytes)
+{
+    for (int i = 0; i < 4; ++i)
+        bytes[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+}
+
+std::uint32_t readUInt32(const char * bytes)
+{
+    std::uint32_t value = 0;
+    for (int i = 0; i < 4; ++i)
+        value |= static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+
+    return value;
+}
+
+void writeFloat(float value, char * bytes)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeUInt32(bits, bytes);
+}
+
+float readFloat(const char * bytes)
+{
+    const std::uint32_t bits = readUInt32(bytes);
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+}
+
 namespace glowutils
 {
 
@@ -37,6 +85,11 @@ void CameraPath::append(const CameraPathPoint& point)
     m_points.push_back(point);
 }
 
+void CameraPath::clear()
+{
+    m_points.clear();
+}
+
 CameraPath & CameraPath::operator<<(const CameraPathPoint& point)
 {
     append(point);
@@ -48,4 +101,85 @@ const std::vector<CameraPathPoint>& CameraPath::points() const
     return m_points;
 }
 
+bool CameraPath::save(const std::string & filePath) const
+{
+    std::ofstream stream(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    if (!stream || !write(stream))
+    {
+        glow::warning() << "Writing camera path to file \"" << filePath << "\" failed.";
+        return false;
+    }
+    return true;
+}
+
+bool CameraPath::load(const std::string & filePath)
+{
+    std::ifstream stream(filePath, std::ios::in | std::ios::binary);
+
+    if (!stream || !read(stream))
+    {
+        glow::warning() << "Reading camera path from file \"" << filePath << "\" failed.";
+        return false;
+    }
+    return true;
+}
+
+bool CameraPath::write(std::ostream & stream) const
+{
+    std::vector<char> bytes(sizeof(signature) + 4 + m_points.size() * floatsPerPoint * 4);
+
+    std::memcpy(bytes.data(), signature, sizeof(signature));
+    writeUInt32(static_cast<std::uint32_t>(m_points.size()), bytes.data() + sizeof(signature));
+
+    char * data = bytes.data() + sizeof(signature) + 4;
+    for (const CameraPathPoint & point : m_points)
+    {
+        const float values[floatsPerPoint] = {
+            point.eye.x, point.eye.y, point.eye.z
+        ,   point.center.x, point.center.y, point.center.z
+        ,   point.up.x, point.up.y, point.up.z
+        ,   point.fov };
+
+        for (unsigned int i = 0; i < floatsPerPoint; ++i, data += 4)
+            writeFloat(values[i], data);
+    }
+
+    stream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(stream);
+}
+
+bool CameraPath::read(std::istream & stream)
+{
+    char header[sizeof(signature) + 4];
+    if (!stream.read(header, sizeof(header)) || std::memcmp(header, signature, sizeof(signature)) != 0)
+        return false;
+
+    const std::uint32_t count = readUInt32(header + sizeof(signature));
+
+    // the count is not trusted for the reservation, a corrupt file could claim too many points
+    std::vector<CameraPathPoint> points;
+    points.reserve(std::min(count, std::uint32_t(1) << 16));
+
+    char bytes[floatsPerPoint * 4];
+    for (std::uint32_t p = 0; p < count; ++p)
+    {
+        if (!stream.read(bytes, sizeof(bytes)))
+            return false;
+
+        float values[floatsPerPoint];
+        for (unsigned int i = 0; i < floatsPerPoint; ++i)
+            values[i] = readFloat(bytes + i * 4);
+
+        points.push_back(CameraPathPoint(
+            glm::vec3(values[0], values[1], values[2])
+        ,   glm::vec3(values[3], values[4], values[5])
+        ,   glm::vec3(values[6], values[7], values[8])
+        ,   values[9]));
+    }
+
+    m_points = std::move(points);
+    return true;
+}
+
 } // namespace glowutils
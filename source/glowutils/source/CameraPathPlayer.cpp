@@ -20,13 +20,27 @@
 #include <glowutils/StringTemplate.h>
 #include <glowutils/math/BezierCurve.h>
 
+#include "parallelfor.h"
+
 using namespace glm;
 
 namespace glowutils
 {
 
+namespace
+{
+
+// Bezier samples per section for the arc length approximation
+const unsigned int arcLengthSamples = 256;
+
+// points per thread for batch sampling, below that a single thread is used
+const unsigned int minSampleRangeSize = 1 << 12;
+
+}
+
 CameraPathPlayer::CameraPathPlayer(Camera & camera)
 : m_camera(camera)
+, m_length(0.f)
 {
 }
 
@@ -36,10 +50,24 @@ void CameraPathPlayer::setPath(const CameraPath & path)
    prepare();
 }
 
+const CameraPath & CameraPathPlayer::path() const
+{
+    return m_path;
+}
+
+float CameraPathPlayer::length() const
+{
+    return m_length;
+}
+
 void CameraPathPlayer::prepare()
 {
     const std::vector<CameraPathPoint>& points = m_path.points();
 
+    m_sections.clear();
+    m_arcLengthTable.clear();
+    m_length = 0.f;
+
     if (points.size()<=1)
         return;
 
@@ -82,6 +110,53 @@ void CameraPathPlayer::prepare()
     }
 
     prepareControlPoints();
+    prepareArcLengthTable();
+}
+
+void CameraPathPlayer::prepareArcLengthTable()
+{
+    // accumulated arc length at uniformly sampled section parameters
+
+    const unsigned int sampleCount = static_cast<unsigned int>(m_sections.size()) * arcLengthSamples + 1;
+
+    std::vector<float> lengths(sampleCount, 0.f);
+    vec3 previous = m_sections.front().start->eye;
+
+    for (unsigned int i = 1; i < sampleCount; ++i)
+    {
+        const unsigned int section = (i - 1) / arcLengthSamples;
+        const vec3 current = eye(m_sections[section], static_cast<float>(i - section * arcLengthSamples) / arcLengthSamples);
+
+        lengths[i] = lengths[i - 1] + glm::length(current - previous);
+        previous = current;
+    }
+
+    m_length = lengths.back();
+
+    // invert: section parameter (section index + section t) at equidistant arc lengths
+
+    m_arcLengthTable.resize(sampleCount);
+
+    unsigned int i = 0;
+    for (unsigned int j = 0; j < sampleCount; ++j)
+    {
+        const float s = m_length * static_cast<float>(j) / static_cast<float>(sampleCount - 1);
+
+        while (i + 2 < sampleCount && lengths[i + 1] < s)
+            ++i;
+
+        const float delta = lengths[i + 1] - lengths[i];
+        const float f = delta > 0.f ? glm::clamp((s - lengths[i]) / delta, 0.f, 1.f) : 0.f;
+
+        m_arcLengthTable[j] = (static_cast<float>(i) + f) / arcLengthSamples;
+    }
+
+    // static eye: fall back to uniform section parameters
+    if (m_length <= 0.f)
+    {
+        for (unsigned int j = 0; j < sampleCount; ++j)
+            m_arcLengthTable[j] = static_cast<float>(j) / arcLengthSamples;
+    }
 }
 
 namespace {
@@ -180,19 +255,17 @@ void CameraPathPlayer::prepareControlPoints()
     }
 }
 
-CameraPathPlayer::PathSection& CameraPathPlayer::find(const float t)
+vec3 CameraPathPlayer::eye(const PathSection& section, const float t) const
 {
-    return *std::lower_bound(m_sections.begin(), m_sections.end(), t, [](const PathSection& section, float value) {
-        return section.endT < value;
-    });
+    return math::BezierCurve::bezier(section.start->eye, section.c1, section.c2, section.end->eye, t);
 }
 
-CameraPathPoint CameraPathPlayer::interpolate(const PathSection& section, const float t)
+CameraPathPoint CameraPathPlayer::interpolate(const PathSection& section, const float t) const
 {
     const CameraPathPoint& p1 = *section.start;
     const CameraPathPoint& p2 = *section.end;
 
-    vec3 eye = math::BezierCurve(p1.eye, section.c1, section.c2, p2.eye)(t);
+    vec3 eye = this->eye(section, t);
 
     //glow::debug() << eye << " (" << (p1.eye*(1.0f-t) + p2.eye*t) << ")";
 
@@ -215,12 +288,49 @@ void CameraPathPlayer::moveCamera(const CameraPathPoint& point)
 
 void CameraPathPlayer::play(const float t)
 {
-    const float clampedT = glm::clamp(t, 0.f, 1.f);
+    moveCamera(point(t));
+}
+
+CameraPathPoint CameraPathPlayer::point(const float t) const
+{
+    if (m_sections.empty())
+        return m_path.points().empty() ? CameraPathPoint() : m_path.points().front();
+
+    // lookup of the section parameter at arc length t * length()
+
+    const float x = glm::clamp(t, 0.f, 1.f) * static_cast<float>(m_arcLengthTable.size() - 1);
+    const unsigned int j = std::min(static_cast<unsigned int>(x), static_cast<unsigned int>(m_arcLengthTable.size() - 2));
+    const float f = x - static_cast<float>(j);
 
-    PathSection& section = find(clampedT);
-    const float sectionT = (clampedT - section.startT) / (section.endT - section.startT);
+    const float u = m_arcLengthTable[j] * (1.f - f) + m_arcLengthTable[j + 1] * f;
+    const unsigned int section = std::min(static_cast<unsigned int>(u), static_cast<unsigned int>(m_sections.size() - 1));
 
-    moveCamera(interpolate(section, sectionT));
+    return interpolate(m_sections[section], u - static_cast<float>(section));
+}
+
+std::vector<CameraPathPoint> CameraPathPlayer::sample(const unsigned int count) const
+{
+    std::vector<CameraPathPoint> points(count);
+    sample(count, points.data());
+
+    return points;
+}
+
+void CameraPathPlayer::sample(const unsigned int count, CameraPathPoint * points) const
+{
+    if (count == 0)
+        return;
+
+    const float step = count > 1 ? 1.f / static_cast<float>(count - 1) : 0.f;
+    const unsigned int rangeCount = parallelRangeCount(count, minSampleRangeSize);
+
+    parallelFor(rangeCount, [this, count, step, rangeCount, points](unsigned int range)
+    {
+        const unsigned int end = count / rangeCount * (range + 1) + (range + 1 == rangeCount ? count % rangeCount : 0);
+
+        for (unsigned int i = count / rangeCount * range; i < end; ++i)
+            points[i] = point(static_cast<float>(i) * step);
+    });
 }
 
 void CameraPathPlayer::createVao()
@@ -234,12 +344,7 @@ void CameraPathPlayer::createVao()
     for (int i=0; i<m_bufferSize; ++i)
     {
         float t = float(i)/float(m_bufferSize-1);
-        PathSection& section = find(t);
-        const float sectionT = (t - section.startT) / (section.endT - section.startT);
-        const CameraPathPoint& p1 = *section.start;
-        const CameraPathPoint& p2 = *section.end;
-        vec3 pos = math::BezierCurve(p1.eye, section.c1, section.c2, p2.eye)(sectionT);
-        array.emplace_back(pos, t);
+        array.emplace_back(point(t).eye, t);
     }
 
     m_buffer->setData(array);
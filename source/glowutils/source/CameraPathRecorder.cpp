@@ -15,4 +15,14 @@ void CameraPathRecorder::record()
     m_path.append(CameraPathPoint(m_camera));
 }
 
+void CameraPathRecorder::clear()
+{
+    m_path.clear();
+}
+
+const CameraPath & CameraPathRecorder::path() const
+{
+    return m_path;
+}
+
 } // namespace glowutils
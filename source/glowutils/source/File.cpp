@@ -29,7 +29,15 @@ std::string File::string() const
     if (!m_valid)
         loadFileContent();
 
-	return m_source;
+	return m_source.string();
+}
+
+void File::chunksInto(std::vector<StringChunk>& vector) const
+{
+    if (!m_valid)
+        loadFileContent();
+
+    vector.push_back(m_source);
 }
 
 std::string File::shortInfo() const
@@ -58,11 +66,11 @@ void File::loadFileContent() const
     RawFile<char> raw(m_filePath);
     if (raw.valid())
     {
-        m_source = std::string(raw.data(), raw.size());
+        m_source = StringChunk(raw.data(), raw.size());
     }
     else
     {
-        m_source = "";
+        m_source = StringChunk();
     }
 
     m_valid = true;
@@ -2,6 +2,8 @@
 
 #include <cassert>
 
+#include <glow/ChangeBatch.h>
+
 #include <glowutils/File.h>
 
 namespace glowutils
@@ -34,6 +36,9 @@ void FileRegistry::deregisterFile(File * file)
 
 void FileRegistry::reloadAll()
 {
+    // shaders depending on several of the files are updated once
+    glow::ChangeBatch batch;
+
     for (File* file: s_instance->m_registeredFiles)
     {
         file->reload();
@@ -0,0 +1,348 @@
+#include <glowutils/FrustumCulling.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <glowutils/AxisAlignedBoundingBox.h>
+#include <glowutils/AxisAlignedBoundingBoxSet.h>
+#include <glowutils/Camera.h>
+
+#include "parallelfor.h"
+
+#if defined(__AVX__)
+    #define CULLING_AVX
+    #include <immintrin.h>
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define CULLING_SSE
+    #include <xmmintrin.h>
+#endif
+
+using namespace glm;
+
+namespace
+{
+
+typedef std::array<vec4, 6> Planes;
+
+// All kernels evaluate the same expressions in the same order, so they classify every box identically:
+// a box is outside if it lies completely on the negative side of any plane, i.e.,
+// (n.x * c.x + n.y * c.y + n.z * c.z + w) + (|n.x| * e.x + |n.y| * e.y + |n.z| * e.z) < 0.
+
+bool outside(const vec4 & plane, const vec4 & absPlane, float cx, float cy, float cz, float ex, float ey, float ez)
+{
+    const float distance = plane.x * cx + plane.y * cy + plane.z * cz + plane.w;
+    const float radius = absPlane.x * ex + absPlane.y * ey + absPlane.z * ez;
+
+    return distance + radius < 0.f;
+}
+
+Planes absolute(const Planes & planes)
+{
+    Planes result;
+    for (size_t i = 0; i < planes.size(); ++i)
+        result[i] = abs(planes[i]);
+
+    return result;
+}
+
+unsigned int cullScalar(const Planes & planes, const float * const c[3], const float * const e[3]
+    , unsigned int begin, unsigned int end, unsigned int * visibleIndices)
+{
+    const Planes absPlanes = absolute(planes);
+
+    unsigned int count = 0;
+    for (unsigned int i = begin; i < end; ++i)
+    {
+        bool visible = true;
+        for (size_t p = 0; p < planes.size() && visible; ++p)
+            visible = !outside(planes[p], absPlanes[p], c[0][i], c[1][i], c[2][i], e[0][i], e[1][i], e[2][i]);
+
+        // branchless append, the slot is overwritten by the next index if this box is culled
+        visibleIndices[count] = i;
+        count += visible ? 1 : 0;
+    }
+    return count;
+}
+
+#if defined(CULLING_SSE)
+
+unsigned int cullSSE(const Planes & planes, const float * const c[3], const float * const e[3]
+    , unsigned int begin, unsigned int end, unsigned int * visibleIndices)
+{
+    __m128 n[6][3];
+    __m128 a[6][3];
+    __m128 w[6];
+
+    for (int p = 0; p < 6; ++p)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            n[p][k] = _mm_set1_ps(planes[p][k]);
+            a[p][k] = _mm_set1_ps(std::abs(planes[p][k]));
+        }
+        w[p] = _mm_set1_ps(planes[p].w);
+    }
+
+    const __m128 zero = _mm_setzero_ps();
+
+    unsigned int count = 0;
+    unsigned int i = begin;
+
+    for (; i + 4 <= end; i += 4)
+    {
+        const __m128 cx = _mm_loadu_ps(c[0] + i);
+        const __m128 cy = _mm_loadu_ps(c[1] + i);
+        const __m128 cz = _mm_loadu_ps(c[2] + i);
+        const __m128 ex = _mm_loadu_ps(e[0] + i);
+        const __m128 ey = _mm_loadu_ps(e[1] + i);
+        const __m128 ez = _mm_loadu_ps(e[2] + i);
+
+        __m128 culled = zero;
+        for (int p = 0; p < 6; ++p)
+        {
+            const __m128 distance = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(n[p][0], cx), _mm_mul_ps(n[p][1], cy)), _mm_mul_ps(n[p][2], cz)), w[p]);
+            const __m128 radius = _mm_add_ps(_mm_add_ps(
+                _mm_mul_ps(a[p][0], ex), _mm_mul_ps(a[p][1], ey)), _mm_mul_ps(a[p][2], ez));
+
+            culled = _mm_or_ps(culled, _mm_cmplt_ps(_mm_add_ps(distance, radius), zero));
+        }
+
+        const unsigned int mask = static_cast<unsigned int>(~_mm_movemask_ps(culled));
+        for (unsigned int k = 0; k < 4; ++k)
+        {
+            visibleIndices[count] = i + k;
+            count += (mask >> k) & 1u;
+        }
+    }
+
+    return count + cullScalar(planes, c, e, i, end, visibleIndices + count);
+}
+
+#endif
+
+#if defined(CULLING_AVX)
+
+unsigned int cullAVX(const Planes & planes, const float * const c[3], const float * const e[3]
+    , unsigned int begin, unsigned int end, unsigned int * visibleIndices)
+{
+    __m256 n[6][3];
+    __m256 a[6][3];
+    __m256 w[6];
+
+    for (int p = 0; p < 6; ++p)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            n[p][k] = _mm256_set1_ps(planes[p][k]);
+            a[p][k] = _mm256_set1_ps(std::abs(planes[p][k]));
+        }
+        w[p] = _mm256_set1_ps(planes[p].w);
+    }
+
+    const __m256 zero = _mm256_setzero_ps();
+
+    unsigned int count = 0;
+    unsigned int i = begin;
+
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256 cx = _mm256_loadu_ps(c[0] + i);
+        const __m256 cy = _mm256_loadu_ps(c[1] + i);
+        const __m256 cz = _mm256_loadu_ps(c[2] + i);
+        const __m256 ex = _mm256_loadu_ps(e[0] + i);
+        const __m256 ey = _mm256_loadu_ps(e[1] + i);
+        const __m256 ez = _mm256_loadu_ps(e[2] + i);
+
+        __m256 culled = zero;
+        for (int p = 0; p < 6; ++p)
+        {
+            const __m256 distance = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                _mm256_mul_ps(n[p][0], cx), _mm256_mul_ps(n[p][1], cy)), _mm256_mul_ps(n[p][2], cz)), w[p]);
+            const __m256 radius = _mm256_add_ps(_mm256_add_ps(
+                _mm256_mul_ps(a[p][0], ex), _mm256_mul_ps(a[p][1], ey)), _mm256_mul_ps(a[p][2], ez));
+
+            culled = _mm256_or_ps(culled, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_LT_OQ));
+        }
+
+        const unsigned int mask = static_cast<unsigned int>(~_mm256_movemask_ps(culled));
+        for (unsigned int k = 0; k < 8; ++k)
+        {
+            visibleIndices[count] = i + k;
+            count += (mask >> k) & 1u;
+        }
+    }
+
+    return count + cullScalar(planes, c, e, i, end, visibleIndices + count);
+}
+
+#endif
+
+}
+
+namespace glowutils
+{
+
+FrustumCulling::FrustumCulling()
+: m_kernel(Vectorized)
+, m_threadCount(0)
+, m_parallelThreshold(1 << 16)
+{
+    // planes that contain everything
+    m_planes.fill(vec4(0.f, 0.f, 0.f, 1.f));
+}
+
+FrustumCulling::FrustumCulling(const Camera & camera)
+: m_planes(camera.frustumPlanes())
+, m_kernel(Vectorized)
+, m_threadCount(0)
+, m_parallelThreshold(1 << 16)
+{
+}
+
+FrustumCulling::FrustumCulling(const std::array<vec4, 6> & planes)
+: m_planes(planes)
+, m_kernel(Vectorized)
+, m_threadCount(0)
+, m_parallelThreshold(1 << 16)
+{
+}
+
+FrustumCulling::~FrustumCulling()
+{
+}
+
+const std::array<vec4, 6> & FrustumCulling::planes() const
+{
+    return m_planes;
+}
+
+void FrustumCulling::setPlanes(const std::array<vec4, 6> & planes)
+{
+    m_planes = planes;
+}
+
+void FrustumCulling::setPlanes(const Camera & camera)
+{
+    m_planes = camera.frustumPlanes();
+}
+
+FrustumCulling::Kernel FrustumCulling::kernel() const
+{
+    return m_kernel;
+}
+
+void FrustumCulling::setKernel(Kernel kernel)
+{
+    m_kernel = kernel;
+}
+
+unsigned int FrustumCulling::threadCount() const
+{
+    return m_threadCount;
+}
+
+void FrustumCulling::setThreadCount(unsigned int count)
+{
+    m_threadCount = count;
+}
+
+unsigned int FrustumCulling::parallelThreshold() const
+{
+    return m_parallelThreshold;
+}
+
+void FrustumCulling::setParallelThreshold(unsigned int boxCount)
+{
+    m_parallelThreshold = boxCount;
+}
+
+bool FrustumCulling::visible(const AxisAlignedBoundingBox & box) const
+{
+    return visible(box.center(), (box.urb() - box.llf()) * .5f);
+}
+
+bool FrustumCulling::visible(const vec3 & center, const vec3 & extent) const
+{
+    for (const vec4 & plane : m_planes)
+    {
+        if (outside(plane, abs(plane), center.x, center.y, center.z, extent.x, extent.y, extent.z))
+            return false;
+    }
+    return true;
+}
+
+const char * FrustumCulling::vectorExtension()
+{
+#if defined(CULLING_AVX)
+    return "AVX";
+#elif defined(CULLING_SSE)
+    return "SSE";
+#else
+    return "none";
+#endif
+}
+
+unsigned int FrustumCulling::cullRange(
+    const AxisAlignedBoundingBoxSet & boxes
+,   unsigned int begin
+,   unsigned int end
+,   unsigned int * visibleIndices) const
+{
+    const float * const c[3] = { boxes.centers(0), boxes.centers(1), boxes.centers(2) };
+    const float * const e[3] = { boxes.extents(0), boxes.extents(1), boxes.extents(2) };
+
+    if (m_kernel == Scalar)
+        return cullScalar(m_planes, c, e, begin, end, visibleIndices);
+
+#if defined(CULLING_AVX)
+    return cullAVX(m_planes, c, e, begin, end, visibleIndices);
+#elif defined(CULLING_SSE)
+    return cullSSE(m_planes, c, e, begin, end, visibleIndices);
+#else
+    return cullScalar(m_planes, c, e, begin, end, visibleIndices);
+#endif
+}
+
+unsigned int FrustumCulling::cull(const AxisAlignedBoundingBoxSet & boxes, unsigned int * visibleIndices) const
+{
+    const unsigned int size = boxes.size();
+
+    unsigned int threadCount = parallelRangeCount(size, 8, m_threadCount);
+    if (size < m_parallelThreshold || threadCount < 2)
+        return cullRange(boxes, 0, size, visibleIndices);
+
+    // each thread culls a contiguous range (a multiple of the vector width) into the same range
+    // of the output, the ranges are compacted afterwards
+
+    const unsigned int rangeSize = ((size + threadCount - 1) / threadCount + 7u) & ~7u;
+    threadCount = (size + rangeSize - 1) / rangeSize;
+
+    std::vector<unsigned int> counts(threadCount, 0);
+
+    parallelFor(threadCount, [this, &boxes, &counts, size, rangeSize, visibleIndices](unsigned int t)
+    {
+        const unsigned int begin = t * rangeSize;
+        const unsigned int end = std::min(size, begin + rangeSize);
+
+        counts[t] = cullRange(boxes, begin, end, visibleIndices + begin);
+    });
+
+    unsigned int count = counts[0];
+    for (unsigned int t = 1; t < threadCount; ++t)
+    {
+        std::memmove(visibleIndices + count, visibleIndices + t * rangeSize, counts[t] * sizeof(unsigned int));
+        count += counts[t];
+    }
+
+    return count;
+}
+
+void FrustumCulling::cull(const AxisAlignedBoundingBoxSet & boxes, std::vector<unsigned int> & visibleIndices) const
+{
+    visibleIndices.resize(boxes.size());
+    visibleIndices.resize(cull(boxes, visibleIndices.data()));
+}
+
+} // namespace glowutils
@@ -21,6 +21,12 @@ const int VISIBILITY_KTAB_SIZE = ABUFFER_SIZE + 1;
 
 namespace glowutils {
 
+HybridAlgorithm::HybridAlgorithm()
+: m_pixelCapacity(0)
+, m_pixelCount(0)
+{
+}
+
 void HybridAlgorithm::initialize(const std::string & transparencyShaderFilePath, glow::Shader *vertexShader, glow::Shader *geometryShader) {
     glow::createNamedString("/transparency/hybrid_definitions", "const int ABUFFER_SIZE = " + std::to_string(ABUFFER_SIZE) + ";");
     glow::createNamedString("/transparency/hybrid.glsl", new glowutils::File(transparencyShaderFilePath + "hybrid.glsl"));
@@ -97,7 +103,7 @@ void HybridAlgorithm::draw(const DrawFunction& drawFunction, glowutils::Camera*
     CheckGLError();
 
     static unsigned int initialDepthKTab = std::numeric_limits<unsigned int>::max();
-    m_depthKTab->clearData(GL_R32UI, GL_RED, GL_UNSIGNED_INT, &initialDepthKTab);
+    clearPixelBuffer(m_depthKTab, ABUFFER_SIZE, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &initialDepthKTab);
     m_depthKTab->bindBase(GL_SHADER_STORAGE_BUFFER, 0);
 
     m_depthKTabProgram->setUniform("viewprojectionmatrix", camera->viewProjection());
@@ -125,7 +131,7 @@ void HybridAlgorithm::draw(const DrawFunction& drawFunction, glowutils::Camera*
 	//	
     // This pass computes "factor" for each fragment so that in the final path the colors of the k fragments can be combined order independent
     static float initialVisibilityKTab = 0.0f;
-    m_visibilityKTab->clearData(GL_R32F, GL_RED, GL_FLOAT, &initialVisibilityKTab);
+    clearPixelBuffer(m_visibilityKTab, VISIBILITY_KTAB_SIZE, GL_R32F, GL_RED, GL_FLOAT, &initialVisibilityKTab);
     m_visibilityKTab->bindBase(GL_SHADER_STORAGE_BUFFER, 1);
 
     m_visibilityKTabProgram->setUniform("dimension", width * height);
@@ -149,7 +155,7 @@ void HybridAlgorithm::draw(const DrawFunction& drawFunction, glowutils::Camera*
     CheckGLError();
 
     static unsigned int initialDepthComplexity = 0;
-    m_depthComplexityBuffer->clearData(GL_R32UI, GL_RED, GL_UNSIGNED_INT, &initialDepthComplexity);
+    clearPixelBuffer(m_depthComplexityBuffer, 1, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, &initialDepthComplexity);
     m_depthComplexityBuffer->bindBase(GL_SHADER_STORAGE_BUFFER, 2);
 
     m_colorProgram->setUniform("viewprojectionmatrix", camera->viewProjection());
@@ -197,9 +203,18 @@ void HybridAlgorithm::resize(int width, int height) {
     m_colorBuffer->image2D(0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
     m_accumulationBuffer->image2D(0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, nullptr);
     m_coreBuffer->image2D(0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
-    m_depthKTab->setData(static_cast<GLsizei>(width * height * ABUFFER_SIZE * sizeof(unsigned int)), nullptr, GL_DYNAMIC_DRAW);
-    m_visibilityKTab->setData(static_cast<GLsizei>(width * height * VISIBILITY_KTAB_SIZE * sizeof(float)), nullptr, GL_DYNAMIC_DRAW);
-    m_depthComplexityBuffer->setData(static_cast<GLsizei>(width * height * sizeof(unsigned int)), nullptr, GL_DYNAMIC_DRAW);
+
+    m_pixelCount = width * height;
+
+    // interactive resizing should not reallocate every frame, so the buffers are kept as long as they are not too large
+    if (m_pixelCount <= m_pixelCapacity && m_pixelCount >= m_pixelCapacity / 4)
+        return;
+
+    m_pixelCapacity = m_pixelCount;
+
+    m_depthKTab->setData(static_cast<GLsizeiptr>(m_pixelCapacity) * ABUFFER_SIZE * static_cast<GLsizeiptr>(sizeof(unsigned int)), nullptr, GL_DYNAMIC_DRAW);
+    m_visibilityKTab->setData(static_cast<GLsizeiptr>(m_pixelCapacity) * VISIBILITY_KTAB_SIZE * static_cast<GLsizeiptr>(sizeof(float)), nullptr, GL_DYNAMIC_DRAW);
+    m_depthComplexityBuffer->setData(static_cast<GLsizeiptr>(m_pixelCapacity) * static_cast<GLsizeiptr>(sizeof(unsigned int)), nullptr, GL_DYNAMIC_DRAW);
 }
 
 glow::Texture* HybridAlgorithm::getOutput()
@@ -207,4 +222,10 @@ glow::Texture* HybridAlgorithm::getOutput()
     return m_colorBuffer;
 }
 
+void HybridAlgorithm::clearPixelBuffer(glow::Buffer * buffer, int valuesPerPixel, GLenum internalFormat, GLenum format, GLenum type, const void * value)
+{
+    // all buffers store 4 byte values
+    buffer->clearSubData(internalFormat, 0, static_cast<GLsizeiptr>(m_pixelCount) * valuesPerPixel * 4, format, type, value);
+}
+
 } // namespace glow
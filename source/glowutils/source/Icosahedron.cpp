@@ -11,6 +11,8 @@
 #include <glow/Buffer.h>
 #include <glow/Error.h>
 
+#include <glowutils/MeshOptimizer.h>
+
 using namespace glm;
 using namespace glow;
 
@@ -85,6 +87,7 @@ Icosahedron::Icosahedron(
     std::vector<Face> indices(i.begin(), i.end());
 
     refine(vertices, indices, static_cast<char>(clamp(iterations, 0, 8)));
+    optimize(vertices, indices);
 
     m_indices->setData(indices, GL_STATIC_DRAW);
     m_vertices->setData(vertices, GL_STATIC_DRAW);
@@ -152,6 +155,33 @@ void Icosahedron::refine(
     }
 }
 
+void Icosahedron::optimize(
+    std::vector<vec3> & vertices
+,   std::vector<Face> & indices)
+{
+    MeshOptimizer::Mesh mesh;
+    mesh.setVertices(vertices);
+
+    mesh.indices.reserve(indices.size() * 3);
+    for (const Face & face : indices)
+        mesh.indices.insert(mesh.indices.end(), face.begin(), face.end());
+
+    // refinement creates no duplicates, but scatters the faces of each level across the sphere
+    MeshOptimizer optimizer;
+    optimizer.setSteps(MeshOptimizer::OptimizeVertexCache | MeshOptimizer::OptimizeVertexFetch);
+    optimizer.optimize(mesh);
+
+    vertices = mesh.vertexData<vec3>();
+
+    for (size_t f = 0; f < indices.size(); ++f)
+    {
+        indices[f] = Face{{
+            static_cast<u_int16_t>(mesh.indices[f * 3])
+        ,   static_cast<u_int16_t>(mesh.indices[f * 3 + 1])
+        ,   static_cast<u_int16_t>(mesh.indices[f * 3 + 2]) }};
+    }
+}
+
 u_int16_t Icosahedron::split(
     const u_int16_t a
 ,   const u_int16_t b
@@ -0,0 +1,433 @@
+#include <glowutils/MeshOptimizer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "parallelfor.h"
+
+namespace
+{
+
+const GLuint InvalidIndex = std::numeric_limits<GLuint>::max();
+
+// FNV-1a over the bytes of a vertex
+std::size_t hashVertex(const unsigned char * vertex, unsigned int size)
+{
+    std::size_t hash = 2166136261u;
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        hash ^= vertex[i];
+        hash *= 16777619u;
+    }
+
+    return hash ^ (hash >> 15);
+}
+
+std::size_t tableSize(unsigned int count)
+{
+    std::size_t size = 16;
+
+    while (size < static_cast<std::size_t>(count) * 2)
+        size *= 2;
+
+    return size;
+}
+
+float signNotZero(float value)
+{
+    return value >= 0.f ? 1.f : -1.f;
+}
+
+/** Vertex to triangle adjacency in compressed rows: the triangles of vertex v are
+    triangles[offsets[v]] to triangles[offsets[v + 1] - 1].
+*/
+struct Adjacency
+{
+    Adjacency(const std::vector<GLuint> & indices, unsigned int vertexCount)
+    : offsets(vertexCount + 1, 0)
+    , triangles(indices.size())
+    {
+        for (GLuint index : indices)
+            ++offsets[index + 1];
+
+        for (unsigned int v = 0; v < vertexCount; ++v)
+            offsets[v + 1] += offsets[v];
+
+        std::vector<unsigned int> fill(offsets.begin(), offsets.end() - 1);
+
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            triangles[fill[indices[i]]++] = static_cast<unsigned int>(i / 3);
+    }
+
+    std::vector<unsigned int> offsets;
+    std::vector<unsigned int> triangles;
+};
+
+}
+
+namespace glowutils
+{
+
+MeshOptimizer::Mesh::Mesh(unsigned int vertexSize)
+: vertexSize(vertexSize)
+{
+}
+
+unsigned int MeshOptimizer::Mesh::vertexCount() const
+{
+    return vertexSize > 0 ? static_cast<unsigned int>(vertices.size() / vertexSize) : 0;
+}
+
+MeshOptimizer::MeshOptimizer()
+: m_steps(AllSteps)
+, m_cacheSize(16)
+, m_threadCount(0)
+{
+}
+
+MeshOptimizer::~MeshOptimizer()
+{
+}
+
+unsigned int MeshOptimizer::steps() const
+{
+    return m_steps;
+}
+
+void MeshOptimizer::setSteps(unsigned int steps)
+{
+    m_steps = steps;
+}
+
+unsigned int MeshOptimizer::cacheSize() const
+{
+    return m_cacheSize;
+}
+
+void MeshOptimizer::setCacheSize(unsigned int size)
+{
+    m_cacheSize = std::max(size, 3u);
+}
+
+unsigned int MeshOptimizer::threadCount() const
+{
+    return m_threadCount;
+}
+
+void MeshOptimizer::setThreadCount(unsigned int count)
+{
+    m_threadCount = count;
+}
+
+MeshOptimizer::Report MeshOptimizer::optimize(Mesh & mesh) const
+{
+    Report report;
+    report.triangleCount = static_cast<unsigned int>(mesh.indices.size() / 3);
+    report.vertexCountBefore = mesh.vertexCount();
+    report.acmrBefore = acmr(mesh.indices, mesh.vertexCount(), m_cacheSize);
+
+    if (m_steps & RemoveDuplicates)
+        removeDuplicates(mesh);
+
+    if (m_steps & OptimizeVertexCache)
+        optimizeVertexCache(mesh.indices, mesh.vertexCount(), m_cacheSize);
+
+    if (m_steps & OptimizeVertexFetch)
+        optimizeVertexFetch(mesh);
+
+    report.vertexCountAfter = mesh.vertexCount();
+    report.acmrAfter = acmr(mesh.indices, mesh.vertexCount(), m_cacheSize);
+
+    return report;
+}
+
+std::vector<MeshOptimizer::Report> MeshOptimizer::optimize(std::vector<Mesh> & meshes) const
+{
+    const unsigned int count = static_cast<unsigned int>(meshes.size());
+
+    std::vector<Report> reports(count);
+
+    // meshes differ in size, so threads take the next mesh instead of fixed ranges
+    std::atomic<unsigned int> next(0);
+
+    parallelFor(parallelRangeCount(count, 1, m_threadCount), [&](unsigned int)
+    {
+        for (unsigned int i = next++; i < count; i = next++)
+            reports[i] = optimize(meshes[i]);
+    });
+
+    return reports;
+}
+
+unsigned int MeshOptimizer::removeDuplicates(Mesh & mesh)
+{
+    const unsigned int vertexCount = mesh.vertexCount();
+    const unsigned int size = mesh.vertexSize;
+
+    if (vertexCount == 0)
+        return 0;
+
+    // open addressing table of compacted vertex indices, compacted vertices are not moved again
+    std::vector<GLuint> table(tableSize(vertexCount), InvalidIndex);
+    const std::size_t mask = table.size() - 1;
+
+    std::vector<GLuint> remap(vertexCount);
+    unsigned char * vertices = mesh.vertices.data();
+    GLuint uniqueCount = 0;
+
+    for (unsigned int v = 0; v < vertexCount; ++v)
+    {
+        const unsigned char * vertex = vertices + static_cast<std::size_t>(v) * size;
+
+        std::size_t slot = hashVertex(vertex, size) & mask;
+
+        while (table[slot] != InvalidIndex && std::memcmp(vertices + static_cast<std::size_t>(table[slot]) * size, vertex, size) != 0)
+            slot = (slot + 1) & mask;
+
+        if (table[slot] != InvalidIndex)
+        {
+            remap[v] = table[slot];
+            continue;
+        }
+
+        if (uniqueCount != v)
+            std::memcpy(vertices + static_cast<std::size_t>(uniqueCount) * size, vertex, size);
+
+        table[slot] = uniqueCount;
+        remap[v] = uniqueCount++;
+    }
+
+    for (GLuint & index : mesh.indices)
+        index = remap[index];
+
+    mesh.vertices.resize(static_cast<std::size_t>(uniqueCount) * size);
+
+    return vertexCount - uniqueCount;
+}
+
+void MeshOptimizer::optimizeVertexCache(std::vector<GLuint> & indices, unsigned int vertexCount, unsigned int cacheSize)
+{
+    const std::size_t triangleCount = indices.size() / 3;
+
+    if (triangleCount == 0)
+        return;
+
+    const Adjacency adjacency(indices, vertexCount);
+
+    std::vector<unsigned int> liveTriangles(vertexCount);
+    for (unsigned int v = 0; v < vertexCount; ++v)
+        liveTriangles[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+
+    // a vertex is in the cache while fewer than cacheSize vertices were transformed after it
+    std::vector<unsigned int> cacheTime(vertexCount, 0);
+    unsigned int time = cacheSize + 1;
+
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<GLuint> deadEnds;
+    std::vector<GLuint> candidates;
+
+    std::vector<GLuint> result;
+    result.reserve(indices.size());
+
+    unsigned int cursor = 0;
+    GLuint fanning = 0;
+
+    while (fanning != InvalidIndex)
+    {
+        candidates.clear();
+
+        // emit all remaining triangles of the fanning vertex
+        for (unsigned int i = adjacency.offsets[fanning]; i < adjacency.offsets[fanning + 1]; ++i)
+        {
+            const unsigned int triangle = adjacency.triangles[i];
+
+            if (emitted[triangle])
+                continue;
+
+            for (unsigned int corner = 0; corner < 3; ++corner)
+            {
+                const GLuint v = indices[triangle * 3 + corner];
+
+                result.push_back(v);
+                deadEnds.push_back(v);
+                candidates.push_back(v);
+
+                --liveTriangles[v];
+
+                if (time - cacheTime[v] > cacheSize)
+                    cacheTime[v] = time++;
+            }
+
+            emitted[triangle] = true;
+        }
+
+        // continue with the oldest candidate whose remaining triangles still hit it in the cache
+        GLuint best = InvalidIndex;
+        int bestPriority = -1;
+
+        for (GLuint v : candidates)
+        {
+            if (liveTriangles[v] == 0)
+                continue;
+
+            int priority = 0;
+            if (time - cacheTime[v] + 2 * liveTriangles[v] <= cacheSize)
+                priority = static_cast<int>(time - cacheTime[v]);
+
+            if (priority > bestPriority)
+            {
+                bestPriority = priority;
+                best = v;
+            }
+        }
+
+        // otherwise, skip the dead end: recently used vertices first, then by input order
+        while (best == InvalidIndex && !deadEnds.empty())
+        {
+            const GLuint v = deadEnds.back();
+            deadEnds.pop_back();
+
+            if (liveTriangles[v] > 0)
+                best = v;
+        }
+
+        while (best == InvalidIndex && cursor < vertexCount)
+        {
+            if (liveTriangles[cursor] > 0)
+                best = cursor;
+
+            ++cursor;
+        }
+
+        fanning = best;
+    }
+
+    indices.swap(result);
+}
+
+void MeshOptimizer::optimizeVertexFetch(Mesh & mesh)
+{
+    const unsigned int vertexCount = mesh.vertexCount();
+    const unsigned int size = mesh.vertexSize;
+
+    std::vector<GLuint> remap(vertexCount, InvalidIndex);
+    std::vector<unsigned char> vertices(mesh.vertices.size());
+    GLuint usedCount = 0;
+
+    for (GLuint & index : mesh.indices)
+    {
+        assert(index < vertexCount);
+
+        if (remap[index] == InvalidIndex)
+        {
+            std::memcpy(vertices.data() + static_cast<std::size_t>(usedCount) * size, mesh.vertices.data() + static_cast<std::size_t>(index) * size, size);
+            remap[index] = usedCount++;
+        }
+
+        index = remap[index];
+    }
+
+    vertices.resize(static_cast<std::size_t>(usedCount) * size);
+    mesh.vertices.swap(vertices);
+}
+
+float MeshOptimizer::acmr(const std::vector<GLuint> & indices, unsigned int vertexCount, unsigned int cacheSize)
+{
+    if (indices.size() < 3)
+        return 0.f;
+
+    std::vector<unsigned int> cacheTime(vertexCount, 0);
+    unsigned int time = cacheSize + 1;
+    unsigned int misses = 0;
+
+    for (GLuint index : indices)
+    {
+        if (time - cacheTime[index] > cacheSize)
+        {
+            cacheTime[index] = time++;
+            ++misses;
+        }
+    }
+
+    return static_cast<float>(misses) / static_cast<float>(indices.size() / 3);
+}
+
+MeshOptimizer::Quantization MeshOptimizer::quantize(const std::vector<glm::vec3> & positions, const std::vector<glm::vec3> & normals, std::vector<QuantizedVertex> & vertices)
+{
+    assert(normals.empty() || normals.size() == positions.size());
+
+    glm::vec3 minimum(std::numeric_limits<float>::max());
+    glm::vec3 maximum(-std::numeric_limits<float>::max());
+
+    for (const glm::vec3 & position : positions)
+    {
+        minimum = glm::min(minimum, position);
+        maximum = glm::max(maximum, position);
+    }
+
+    Quantization quantization;
+    quantization.offset = positions.empty() ? glm::vec3(0.f) : minimum;
+    quantization.scale = positions.empty() ? glm::vec3(0.f) : maximum - minimum;
+
+    glm::vec3 inverseScale(0.f);
+    for (int i = 0; i < 3; ++i)
+    {
+        if (quantization.scale[i] > 0.f)
+            inverseScale[i] = 65535.f / quantization.scale[i];
+    }
+
+    vertices.resize(positions.size());
+
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        QuantizedVertex & vertex = vertices[i];
+
+        const glm::vec3 position = glm::round((positions[i] - quantization.offset) * inverseScale);
+        for (int c = 0; c < 3; ++c)
+            vertex.position[c] = static_cast<GLushort>(glm::clamp(position[c], 0.f, 65535.f));
+
+        vertex.padding = 0;
+
+        const glm::vec2 normal = normals.empty() ? glm::vec2(0.f) : glm::round(encodeOctahedral(normals[i]) * 32767.f);
+        vertex.normal[0] = static_cast<GLshort>(normal.x);
+        vertex.normal[1] = static_cast<GLshort>(normal.y);
+    }
+
+    return quantization;
+}
+
+std::vector<VertexDrawable::AttributeFormat> MeshOptimizer::quantizedFormats()
+{
+    return {
+        Format(3, GL_UNSIGNED_SHORT, static_cast<GLuint>(offsetof(QuantizedVertex, position)), GL_TRUE)
+    ,   Format(2, GL_SHORT, static_cast<GLuint>(offsetof(QuantizedVertex, normal)), GL_TRUE)
+    };
+}
+
+glm::vec2 MeshOptimizer::encodeOctahedral(const glm::vec3 & normal)
+{
+    const glm::vec3 n = normal / (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+
+    if (n.z >= 0.f)
+        return glm::vec2(n.x, n.y);
+
+    // fold the lower hemisphere over the diagonals
+    return glm::vec2((1.f - std::abs(n.y)) * signNotZero(n.x), (1.f - std::abs(n.x)) * signNotZero(n.y));
+}
+
+glm::vec3 MeshOptimizer::decodeOctahedral(const glm::vec2 & encoded)
+{
+    glm::vec3 n(encoded.x, encoded.y, 1.f - std::abs(encoded.x) - std::abs(encoded.y));
+
+    if (n.z < 0.f)
+        n = glm::vec3((1.f - std::abs(encoded.y)) * signNotZero(encoded.x), (1.f - std::abs(encoded.x)) * signNotZero(encoded.y), n.z);
+
+    return glm::normalize(n);
+}
+
+} // namespace glowutils
@@ -65,4 +65,37 @@ const vec3 intersection(
 	return t * r + r0; // retrieve point via the ray
 }
 
+float signedDistance(
+    const vec4 & plane
+,   const vec3 & point)
+{
+    return dot(vec3(plane), point) + plane.w;
+}
+
+const std::array<vec4, 6> frustumPlanes(const mat4 & viewProjection)
+{
+    // Gribb and Hartmann: the planes are sums and differences of the matrix rows
+
+    const mat4 & m = viewProjection;
+
+    const vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    const vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    const vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    const vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+    std::array<vec4, 6> planes = {{
+        row3 + row0   // left
+    ,   row3 - row0   // right
+    ,   row3 + row1   // bottom
+    ,   row3 - row1   // top
+    ,   row3 + row2   // near
+    ,   row3 - row2   // far
+    }};
+
+    for (vec4 & plane : planes)
+        plane /= length(vec3(plane));
+
+    return planes;
+}
+
 } // namespace glowutils
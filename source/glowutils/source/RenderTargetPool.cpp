@@ -0,0 +1,301 @@
+#include <glowutils/RenderTargetPool.h>
+
+#include <algorithm>
+#include <cassert>
+
+#include <glow/Extension.h>
+#include <glow/FrameBufferObject.h>
+#include <glow/logging.h>
+#include <glow/Texture.h>
+
+namespace
+{
+
+enum Attachment
+{
+    Color
+,   Depth
+,   Stencil
+,   DepthStencil
+};
+
+struct FormatInfo
+{
+    GLenum internalFormat;
+    unsigned int bytesPerPixel;
+    Attachment attachment;
+    GLenum format; ///< pixel transfer format and type, required for allocations without texture storage
+    GLenum type;
+};
+
+// formats are padded to the sizes drivers typically use
+const FormatInfo formatInfos[] =
+{
+    { GL_R8, 1, Color, GL_RED, GL_UNSIGNED_BYTE }
+,   { GL_RG8, 2, Color, GL_RG, GL_UNSIGNED_BYTE }
+,   { GL_RGB8, 4, Color, GL_RGB, GL_UNSIGNED_BYTE }
+,   { GL_RGBA8, 4, Color, GL_RGBA, GL_UNSIGNED_BYTE }
+,   { GL_SRGB8_ALPHA8, 4, Color, GL_RGBA, GL_UNSIGNED_BYTE }
+,   { GL_RGB10_A2, 4, Color, GL_RGBA, GL_UNSIGNED_INT_10_10_10_2 }
+,   { GL_R11F_G11F_B10F, 4, Color, GL_RGB, GL_FLOAT }
+,   { GL_R16, 2, Color, GL_RED, GL_UNSIGNED_SHORT }
+,   { GL_RG16, 4, Color, GL_RG, GL_UNSIGNED_SHORT }
+,   { GL_RGBA16, 8, Color, GL_RGBA, GL_UNSIGNED_SHORT }
+,   { GL_R16F, 2, Color, GL_RED, GL_FLOAT }
+,   { GL_RG16F, 4, Color, GL_RG, GL_FLOAT }
+,   { GL_RGB16F, 8, Color, GL_RGB, GL_FLOAT }
+,   { GL_RGBA16F, 8, Color, GL_RGBA, GL_FLOAT }
+,   { GL_R32F, 4, Color, GL_RED, GL_FLOAT }
+,   { GL_RG32F, 8, Color, GL_RG, GL_FLOAT }
+,   { GL_RGB32F, 16, Color, GL_RGB, GL_FLOAT }
+,   { GL_RGBA32F, 16, Color, GL_RGBA, GL_FLOAT }
+,   { GL_R32I, 4, Color, GL_RED_INTEGER, GL_INT }
+,   { GL_R32UI, 4, Color, GL_RED_INTEGER, GL_UNSIGNED_INT }
+,   { GL_RG32UI, 8, Color, GL_RG_INTEGER, GL_UNSIGNED_INT }
+,   { GL_RGBA32UI, 16, Color, GL_RGBA_INTEGER, GL_UNSIGNED_INT }
+,   { GL_DEPTH_COMPONENT16, 2, Depth, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT }
+,   { GL_DEPTH_COMPONENT24, 4, Depth, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT }
+,   { GL_DEPTH_COMPONENT32, 4, Depth, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT }
+,   { GL_DEPTH_COMPONENT32F, 4, Depth, GL_DEPTH_COMPONENT, GL_FLOAT }
+,   { GL_DEPTH24_STENCIL8, 4, DepthStencil, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8 }
+,   { GL_DEPTH32F_STENCIL8, 8, DepthStencil, GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV }
+,   { GL_STENCIL_INDEX8, 1, Stencil, GL_STENCIL_INDEX, GL_UNSIGNED_BYTE }
+};
+
+FormatInfo formatInfo(GLenum internalFormat)
+{
+    for (const FormatInfo & info : formatInfos)
+    {
+        if (info.internalFormat == internalFormat)
+            return info;
+    }
+    return FormatInfo{ internalFormat, 4, Color, GL_RGBA, GL_UNSIGNED_BYTE };
+}
+
+}
+
+namespace glowutils
+{
+
+bool RenderTargetPool::Description::operator==(const Description & description) const
+{
+    return size == description.size && internalFormat == description.internalFormat && samples == description.samples;
+}
+
+RenderTargetPool::RenderTargetPool()
+: m_frame(0)
+, m_maxIdleFrames(2)
+, m_statistics()
+{
+}
+
+RenderTargetPool::~RenderTargetPool()
+{
+}
+
+std::size_t RenderTargetPool::byteSize(const Description & description)
+{
+    return static_cast<std::size_t>(description.size.x) * static_cast<std::size_t>(description.size.y)
+        * formatInfo(description.internalFormat).bytesPerPixel * static_cast<std::size_t>(std::max(description.samples, 1));
+}
+
+glow::Texture * RenderTargetPool::acquire(const Description & description)
+{
+    auto it = std::find_if(m_entries.begin(), m_entries.end(), [&description](const Entry & entry)
+    {
+        return !entry.inUse && entry.description == description;
+    });
+
+    if (it == m_entries.end())
+    {
+        m_entries.push_back(Entry{ createTexture(description), description, byteSize(description), false, m_frame });
+        it = m_entries.end() - 1;
+
+        ++m_statistics.textureCount;
+        m_statistics.allocatedBytes += it->byteSize;
+        m_statistics.peakAllocatedBytes = std::max(m_statistics.peakAllocatedBytes, m_statistics.allocatedBytes);
+    }
+
+    it->inUse = true;
+    it->lastUsedFrame = m_frame;
+
+    m_statistics.inUseBytes += it->byteSize;
+    m_statistics.peakInUseBytes = std::max(m_statistics.peakInUseBytes, m_statistics.inUseBytes);
+    m_statistics.frameRequestedBytes += it->byteSize;
+    m_statistics.peakFrameRequestedBytes = std::max(m_statistics.peakFrameRequestedBytes, m_statistics.frameRequestedBytes);
+
+    return it->texture;
+}
+
+glow::Texture * RenderTargetPool::acquire(const glm::ivec2 & size, GLenum internalFormat, GLsizei samples)
+{
+    return acquire(Description{ size, internalFormat, samples });
+}
+
+RenderTargetPool::Target RenderTargetPool::acquire(const glm::ivec2 & size, const std::vector<GLenum> & internalFormats, GLsizei samples)
+{
+    Target target;
+    for (GLenum internalFormat : internalFormats)
+        target.textures.push_back(acquire(size, internalFormat, samples));
+
+    target.fbo = framebuffer(target.textures, internalFormats);
+
+    return target;
+}
+
+void RenderTargetPool::release(glow::Texture * texture)
+{
+    auto it = std::find_if(m_entries.begin(), m_entries.end(), [texture](const Entry & entry)
+    {
+        return entry.texture == texture;
+    });
+
+    assert(it != m_entries.end() && it->inUse);
+    if (it == m_entries.end() || !it->inUse)
+        return;
+
+    it->inUse = false;
+    m_statistics.inUseBytes -= it->byteSize;
+}
+
+void RenderTargetPool::release(const Target & target)
+{
+    for (glow::Texture * texture : target.textures)
+        release(texture);
+}
+
+void RenderTargetPool::nextFrame()
+{
+    ++m_frame;
+    m_statistics.frameRequestedBytes = 0;
+
+    for (std::size_t i = m_entries.size(); i > 0; --i)
+    {
+        const Entry & entry = m_entries[i - 1];
+        if (!entry.inUse && m_frame - entry.lastUsedFrame > m_maxIdleFrames)
+            remove(i - 1);
+    }
+}
+
+void RenderTargetPool::clear()
+{
+    for (std::size_t i = m_entries.size(); i > 0; --i)
+    {
+        if (!m_entries[i - 1].inUse)
+            remove(i - 1);
+    }
+}
+
+unsigned int RenderTargetPool::maxIdleFrames() const
+{
+    return m_maxIdleFrames;
+}
+
+void RenderTargetPool::setMaxIdleFrames(unsigned int frames)
+{
+    m_maxIdleFrames = frames;
+}
+
+const RenderTargetPool::Statistics & RenderTargetPool::statistics() const
+{
+    return m_statistics;
+}
+
+void RenderTargetPool::printReport() const
+{
+    const float mib = 1.f / (1024.f * 1024.f);
+
+    glow::info() << "Render target pool: " << m_statistics.textureCount << " textures, " << m_statistics.framebufferCount << " framebuffers";
+    glow::info() << "  allocated: " << static_cast<float>(m_statistics.allocatedBytes) * mib << " MiB (peak " << static_cast<float>(m_statistics.peakAllocatedBytes) * mib << " MiB)";
+    glow::info() << "  in use:    " << static_cast<float>(m_statistics.inUseBytes) * mib << " MiB (peak " << static_cast<float>(m_statistics.peakInUseBytes) * mib << " MiB)";
+    glow::info() << "  without reuse, peak per frame: " << static_cast<float>(m_statistics.peakFrameRequestedBytes) * mib << " MiB";
+}
+
+glow::Texture * RenderTargetPool::createTexture(const Description & description)
+{
+    const FormatInfo info = formatInfo(description.internalFormat);
+
+    if (description.samples > 0)
+    {
+        glow::Texture * texture = new glow::Texture(GL_TEXTURE_2D_MULTISAMPLE);
+        texture->image2DMultisample(description.samples, description.internalFormat, description.size, GL_TRUE);
+
+        return texture;
+    }
+
+    glow::Texture * texture = new glow::Texture(GL_TEXTURE_2D);
+
+    texture->setParameter(GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    texture->setParameter(GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    texture->setParameter(GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    texture->setParameter(GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // immutable storage avoids the consistency checks of mutable textures on every use
+    if (glow::hasExtension(glow::GLOW_ARB_texture_storage))
+        texture->storage2D(1, description.internalFormat, description.size);
+    else
+        texture->image2D(0, description.internalFormat, description.size, 0, info.format, info.type, nullptr);
+
+    return texture;
+}
+
+glow::FrameBufferObject * RenderTargetPool::framebuffer(const std::vector<glow::Texture *> & textures, const std::vector<GLenum> & internalFormats)
+{
+    glow::ref_ptr<glow::FrameBufferObject> & fbo = m_framebuffers[textures];
+    if (fbo)
+        return fbo;
+
+    fbo = new glow::FrameBufferObject();
+    ++m_statistics.framebufferCount;
+
+    std::vector<GLenum> drawBuffers;
+
+    for (std::size_t i = 0; i < textures.size(); ++i)
+    {
+        switch (formatInfo(internalFormats[i]).attachment)
+        {
+        case Depth:
+            fbo->attachTexture2D(GL_DEPTH_ATTACHMENT, textures[i]);
+            break;
+        case Stencil:
+            fbo->attachTexture2D(GL_STENCIL_ATTACHMENT, textures[i]);
+            break;
+        case DepthStencil:
+            fbo->attachTexture2D(GL_DEPTH_STENCIL_ATTACHMENT, textures[i]);
+            break;
+        default:
+            drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(drawBuffers.size()));
+            fbo->attachTexture2D(drawBuffers.back(), textures[i]);
+            break;
+        }
+    }
+
+    fbo->setDrawBuffers(drawBuffers);
+
+    return fbo;
+}
+
+void RenderTargetPool::remove(std::size_t index)
+{
+    glow::Texture * texture = m_entries[index].texture;
+
+    for (auto it = m_framebuffers.begin(); it != m_framebuffers.end();)
+    {
+        if (std::find(it->first.begin(), it->first.end(), texture) != it->first.end())
+        {
+            it = m_framebuffers.erase(it);
+            --m_statistics.framebufferCount;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    --m_statistics.textureCount;
+    m_statistics.allocatedBytes -= m_entries[index].byteSize;
+
+    m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(index));
+}
+
+} // namespace glowutils
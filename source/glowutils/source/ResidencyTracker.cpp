@@ -0,0 +1,160 @@
+#include <glowutils/ResidencyTracker.h>
+
+namespace glowutils
+{
+
+ResidencyTracker::ResidencyTracker(std::size_t budget)
+: m_budget(budget)
+, m_frame(1)
+, m_residentSize(0)
+{
+}
+
+ResidencyTracker::~ResidencyTracker()
+{
+}
+
+std::size_t ResidencyTracker::budget() const
+{
+    return m_budget;
+}
+
+void ResidencyTracker::setBudget(std::size_t budget)
+{
+    m_budget = budget;
+}
+
+void ResidencyTracker::insert(unsigned int id, std::size_t size)
+{
+    auto i = m_entries.find(id);
+    if (i == m_entries.end())
+    {
+        // frame 0 is never the current one, so new resources are unused
+        m_entries[id] = Entry{ size, false, 0, m_lru.end() };
+        return;
+    }
+
+    if (i->second.resident)
+        m_residentSize = m_residentSize - i->second.size + size;
+
+    i->second.size = size;
+}
+
+bool ResidencyTracker::remove(unsigned int id)
+{
+    auto i = m_entries.find(id);
+    if (i == m_entries.end())
+        return false;
+
+    const bool resident = i->second.resident;
+    if (resident)
+    {
+        m_lru.erase(i->second.lruPosition);
+        m_residentSize -= i->second.size;
+    }
+
+    m_entries.erase(i);
+
+    // ids used in this frame are checked against m_entries in update()
+    return resident;
+}
+
+bool ResidencyTracker::contains(unsigned int id) const
+{
+    return m_entries.count(id) > 0;
+}
+
+bool ResidencyTracker::isResident(unsigned int id) const
+{
+    auto i = m_entries.find(id);
+    return i != m_entries.end() && i->second.resident;
+}
+
+void ResidencyTracker::use(unsigned int id)
+{
+    auto i = m_entries.find(id);
+    if (i == m_entries.end() || i->second.lastUsedFrame == m_frame)
+        return;
+
+    i->second.lastUsedFrame = m_frame;
+    m_used.push_back(id);
+}
+
+void ResidencyTracker::update(std::vector<unsigned int> & madeResident, std::vector<unsigned int> & madeNonResident)
+{
+    for (unsigned int id : m_used)
+    {
+        auto i = m_entries.find(id);
+        if (i == m_entries.end())
+            continue;
+
+        Entry & entry = i->second;
+        if (entry.resident)
+        {
+            m_lru.splice(m_lru.begin(), m_lru, entry.lruPosition);
+            continue;
+        }
+
+        entry.resident = true;
+        entry.lruPosition = m_lru.insert(m_lru.begin(), id);
+        m_residentSize += entry.size;
+
+        madeResident.push_back(id);
+    }
+
+    // used resources are at the front, so eviction stops at the first one
+    while (m_budget > 0 && m_residentSize > m_budget && !m_lru.empty())
+    {
+        Entry & entry = m_entries[m_lru.back()];
+        if (entry.lastUsedFrame == m_frame)
+            break;
+
+        madeNonResident.push_back(m_lru.back());
+
+        entry.resident = false;
+        entry.lruPosition = m_lru.end();
+        m_residentSize -= entry.size;
+
+        m_lru.pop_back();
+    }
+
+    m_used.clear();
+    ++m_frame;
+}
+
+void ResidencyTracker::evictAll(std::vector<unsigned int> & madeNonResident)
+{
+    for (unsigned int id : m_lru)
+    {
+        Entry & entry = m_entries[id];
+        entry.resident = false;
+        entry.lruPosition = m_lru.end();
+
+        madeNonResident.push_back(id);
+    }
+
+    m_lru.clear();
+    m_residentSize = 0;
+}
+
+unsigned int ResidencyTracker::frame() const
+{
+    return m_frame;
+}
+
+unsigned int ResidencyTracker::count() const
+{
+    return static_cast<unsigned int>(m_entries.size());
+}
+
+std::size_t ResidencyTracker::residentSize() const
+{
+    return m_residentSize;
+}
+
+unsigned int ResidencyTracker::residentCount() const
+{
+    return static_cast<unsigned int>(m_lru.size());
+}
+
+} // namespace glowutils
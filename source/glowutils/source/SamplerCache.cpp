@@ -0,0 +1,244 @@
+#include <glowutils/SamplerCache.h>
+
+#include <cstring>
+#include <functional>
+
+#include <glow/Error.h>
+#include <glow/Extension.h>
+#include <glow/Sampler.h>
+
+namespace
+{
+
+// descriptions are compared and hashed by the bits of their floats, equal states are exactly equal
+
+unsigned int bits(GLfloat value)
+{
+    unsigned int result;
+    std::memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+bool equal(GLfloat a, GLfloat b)
+{
+    return bits(a) == bits(b);
+}
+
+void combine(std::size_t & seed, std::size_t value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+GLenum magnificationFilter(GLenum minFilter)
+{
+    switch (minFilter)
+    {
+    case GL_NEAREST:
+    case GL_NEAREST_MIPMAP_NEAREST:
+    case GL_NEAREST_MIPMAP_LINEAR:
+        return GL_NEAREST;
+    default:
+        return GL_LINEAR;
+    }
+}
+
+}
+
+namespace glowutils
+{
+
+SamplerCache::Description::Description(GLenum filter, GLenum wrap, GLfloat maxAnisotropy)
+: minFilter(filter)
+, magFilter(magnificationFilter(filter))
+, wrapS(wrap)
+, wrapT(wrap)
+, wrapR(wrap)
+, minLod(-1000.f)
+, maxLod(1000.f)
+, lodBias(0.f)
+, maxAnisotropy(maxAnisotropy)
+, compareMode(GL_NONE)
+, compareFunc(GL_LEQUAL)
+, borderColor(0.f)
+{
+}
+
+bool SamplerCache::Description::operator==(const Description & description) const
+{
+    return minFilter == description.minFilter
+        && magFilter == description.magFilter
+        && wrapS == description.wrapS
+        && wrapT == description.wrapT
+        && wrapR == description.wrapR
+        && equal(minLod, description.minLod)
+        && equal(maxLod, description.maxLod)
+        && equal(lodBias, description.lodBias)
+        && equal(maxAnisotropy, description.maxAnisotropy)
+        && compareMode == description.compareMode
+        && compareFunc == description.compareFunc
+        && equal(borderColor.r, description.borderColor.r)
+        && equal(borderColor.g, description.borderColor.g)
+        && equal(borderColor.b, description.borderColor.b)
+        && equal(borderColor.a, description.borderColor.a);
+}
+
+bool SamplerCache::Description::operator!=(const Description & description) const
+{
+    return !(*this == description);
+}
+
+std::size_t SamplerCache::Description::hash() const
+{
+    std::size_t seed = 0;
+
+    for (GLenum value : { minFilter, magFilter, wrapS, wrapT, wrapR, compareMode, compareFunc })
+        combine(seed, std::hash<GLenum>()(value));
+
+    for (GLfloat value : { minLod, maxLod, lodBias, maxAnisotropy, borderColor.r, borderColor.g, borderColor.b, borderColor.a })
+        combine(seed, std::hash<unsigned int>()(bits(value)));
+
+    return seed;
+}
+
+std::size_t SamplerCache::Hash::operator()(const Description & description) const
+{
+    return description.hash();
+}
+
+SamplerCache::SamplerCache()
+: m_statistics()
+{
+}
+
+SamplerCache::~SamplerCache()
+{
+}
+
+glow::Sampler * SamplerCache::sampler(const Description & description)
+{
+    ++m_statistics.requestCount;
+
+    glow::ref_ptr<glow::Sampler> & sampler = m_samplers[description];
+
+    if (!sampler)
+    {
+        sampler = new glow::Sampler();
+        configure(sampler, description);
+
+        m_statistics.samplerCount = size();
+    }
+
+    return sampler;
+}
+
+void SamplerCache::bind(GLuint unit, const Description & description)
+{
+    bind(unit, sampler(description)->id());
+}
+
+void SamplerCache::bind(GLuint unit, glow::Sampler * sampler)
+{
+    bind(unit, sampler ? sampler->id() : 0);
+}
+
+void SamplerCache::unbind(GLuint unit)
+{
+    bind(unit, 0u);
+}
+
+void SamplerCache::bind(GLuint unit, GLuint id)
+{
+    if (unit >= m_boundSamplers.size())
+        m_boundSamplers.resize(unit + 1, GL_INVALID_INDEX);
+
+    if (m_boundSamplers[unit] == id)
+    {
+        ++m_statistics.skippedBindCount;
+        return;
+    }
+
+    glBindSampler(unit, id);
+    CheckGLError();
+
+    m_boundSamplers[unit] = id;
+    ++m_statistics.bindCount;
+}
+
+void SamplerCache::invalidateBindings()
+{
+    m_boundSamplers.clear();
+}
+
+void SamplerCache::clear()
+{
+    for (auto it = m_samplers.begin(); it != m_samplers.end();)
+    {
+        if (it->second->refCounter() > 1)
+        {
+            ++it;
+            continue;
+        }
+
+        // the id may be reused by a new sampler
+        for (GLuint & bound : m_boundSamplers)
+        {
+            if (bound == it->second->id())
+                bound = GL_INVALID_INDEX;
+        }
+
+        it = m_samplers.erase(it);
+    }
+
+    m_statistics.samplerCount = size();
+}
+
+unsigned int SamplerCache::size() const
+{
+    return static_cast<unsigned int>(m_samplers.size());
+}
+
+const SamplerCache::Statistics & SamplerCache::statistics() const
+{
+    return m_statistics;
+}
+
+void SamplerCache::configure(glow::Sampler * sampler, const Description & description)
+{
+    // new samplers start with the GL defaults, which Description() matches except for the filters
+
+    const Description defaults(GL_NEAREST_MIPMAP_LINEAR);
+
+    sampler->setParameter(GL_TEXTURE_MIN_FILTER, static_cast<GLint>(description.minFilter));
+    sampler->setParameter(GL_TEXTURE_MAG_FILTER, static_cast<GLint>(description.magFilter));
+
+    if (description.wrapS != defaults.wrapS)
+        sampler->setParameter(GL_TEXTURE_WRAP_S, static_cast<GLint>(description.wrapS));
+    if (description.wrapT != defaults.wrapT)
+        sampler->setParameter(GL_TEXTURE_WRAP_T, static_cast<GLint>(description.wrapT));
+    if (description.wrapR != defaults.wrapR)
+        sampler->setParameter(GL_TEXTURE_WRAP_R, static_cast<GLint>(description.wrapR));
+
+    if (!equal(description.minLod, defaults.minLod))
+        sampler->setParameter(GL_TEXTURE_MIN_LOD, description.minLod);
+    if (!equal(description.maxLod, defaults.maxLod))
+        sampler->setParameter(GL_TEXTURE_MAX_LOD, description.maxLod);
+    if (!equal(description.lodBias, defaults.lodBias))
+        sampler->setParameter(GL_TEXTURE_LOD_BIAS, description.lodBias);
+
+    if (description.maxAnisotropy > 1.f && glow::hasExtension(glow::GLOW_EXT_texture_filter_anisotropic))
+        sampler->setParameter(GL_TEXTURE_MAX_ANISOTROPY_EXT, description.maxAnisotropy);
+
+    if (description.compareMode != defaults.compareMode)
+        sampler->setParameter(GL_TEXTURE_COMPARE_MODE, static_cast<GLint>(description.compareMode));
+    if (description.compareFunc != defaults.compareFunc)
+        sampler->setParameter(GL_TEXTURE_COMPARE_FUNC, static_cast<GLint>(description.compareFunc));
+
+    if (!equal(description.borderColor.r, 0.f) || !equal(description.borderColor.g, 0.f)
+        || !equal(description.borderColor.b, 0.f) || !equal(description.borderColor.a, 0.f))
+    {
+        glSamplerParameterfv(sampler->id(), GL_TEXTURE_BORDER_COLOR, &description.borderColor[0]);
+        CheckGLError();
+    }
+}
+
+} // namespace glowutils
@@ -0,0 +1,287 @@
+#include <glowutils/ShaderPermutationCache.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <set>
+
+#include <glow/AbstractStringSource.h>
+#include <glow/Program.h>
+#include <glow/Shader.h>
+#include <glow/StaticStringSource.h>
+
+namespace
+{
+
+/** \brief Resolved source of a permutation, keeping the short info of its base source for compiler messages.
+ */
+class PermutationSource : public glow::StaticStringSource
+{
+public:
+    PermutationSource(const std::string & string, const std::string & info)
+    : glow::StaticStringSource(string)
+    , m_info(info)
+    {
+    }
+
+    virtual std::string shortInfo() const override
+    {
+        return m_info;
+    }
+
+protected:
+    std::string m_info;
+};
+
+std::string definesInfo(const glowutils::ShaderPermutationCache::Defines & defines)
+{
+    std::string info;
+    for (const glowutils::ShaderPermutationCache::Defines::value_type & define : defines)
+    {
+        info += info.empty() ? "" : " ";
+        info += define.second.empty() ? define.first : define.first + "=" + define.second;
+    }
+    return info;
+}
+
+}
+
+namespace glowutils
+{
+
+ShaderPermutationCache::Stage::Stage(GLenum type, glow::AbstractStringSource * source)
+: type(type)
+, source(source)
+{
+}
+
+ShaderPermutationCache::ShaderPermutationCache()
+: m_statistics()
+{
+}
+
+ShaderPermutationCache::~ShaderPermutationCache()
+{
+}
+
+glow::Shader * ShaderPermutationCache::shader(GLenum type, glow::AbstractStringSource * source, const Defines & defines)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    bool created;
+    return obtainShader(type, source, defines, created);
+}
+
+glow::Program * ShaderPermutationCache::program(const std::vector<Stage> & stages, const Defines & defines)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    bool created;
+    return obtainProgram(stages, defines, created);
+}
+
+void ShaderPermutationCache::declare(const std::vector<Stage> & stages, const Defines & defines)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    Declaration declaration;
+    declaration.stages = stages;
+    declaration.defines = defines;
+
+    m_declarations.push_back(std::move(declaration));
+}
+
+unsigned int ShaderPermutationCache::precompile(unsigned int maxCount)
+{
+    unsigned int count = 0;
+
+    // the lock is released between permutations, so requests of other threads wait for one permutation at most
+    while (count < maxCount)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_declarations.empty())
+            break;
+
+        const Declaration declaration = std::move(m_declarations.front());
+        m_declarations.pop_front();
+
+        bool created;
+        obtainProgram(declaration.stages, declaration.defines, created);
+
+        if (created)
+            ++count;
+    }
+
+    return declaredCount();
+}
+
+unsigned int ShaderPermutationCache::declaredCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return static_cast<unsigned int>(m_declarations.size());
+}
+
+void ShaderPermutationCache::collect()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // programs first, as they reference their shaders
+    for (auto i = m_programs.begin(); i != m_programs.end(); )
+        i = i->second->refCounter() == 1 ? m_programs.erase(i) : std::next(i);
+
+    for (auto i = m_shaders.begin(); i != m_shaders.end(); )
+        i = i->second->refCounter() == 1 ? m_shaders.erase(i) : std::next(i);
+}
+
+void ShaderPermutationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_programs.clear();
+    m_shaders.clear();
+    m_declarations.clear();
+}
+
+unsigned int ShaderPermutationCache::shaderCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return static_cast<unsigned int>(m_shaders.size());
+}
+
+unsigned int ShaderPermutationCache::programCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return static_cast<unsigned int>(m_programs.size());
+}
+
+ShaderPermutationCache::Statistics ShaderPermutationCache::statistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_statistics;
+}
+
+std::string ShaderPermutationCache::resolve(const std::string & source, const Defines & defines)
+{
+    if (defines.empty())
+        return source;
+
+    std::string lines;
+    for (const Defines::value_type & define : defines)
+        lines += "#define " + define.first + (define.second.empty() ? "" : " " + define.second) + "\n";
+
+    // the #version directive has to stay the first statement
+    std::size_t position = 0;
+
+    const std::size_t version = source.find("#version");
+    if (version != std::string::npos)
+    {
+        const std::size_t lineEnd = source.find('\n', version);
+        if (lineEnd == std::string::npos)
+            return source + "\n" + lines;
+
+        position = lineEnd + 1;
+    }
+
+    return source.substr(0, position) + lines + source.substr(position);
+}
+
+std::uint64_t ShaderPermutationCache::hash(const std::string & string, std::uint64_t seed)
+{
+    std::uint64_t hash = seed;
+    for (const char c : string)
+        hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+
+    return hash;
+}
+
+glow::Shader * ShaderPermutationCache::obtainShader(GLenum type, const glow::AbstractStringSource * source, const Defines & defines, bool & created)
+{
+    assert(source != nullptr);
+
+    ++m_statistics.shaderRequests;
+
+    const std::string resolved = resolve(source->string(), defines);
+
+    std::uint64_t key = hash(resolved, hash(std::to_string(type)));
+
+    auto i = m_shaders.find(key);
+
+    // on collisions, the key is rehashed until a matching or free entry is found
+    while (i != m_shaders.end() && (i->second->type() != type || i->second->source()->string() != resolved))
+    {
+        key = hash(resolved, key);
+        i = m_shaders.find(key);
+    }
+
+    created = i == m_shaders.end();
+
+    if (!created)
+    {
+        ++m_statistics.shaderHits;
+        return i->second;
+    }
+
+    const std::string info = definesInfo(defines);
+
+    glow::Shader * shader = new glow::Shader(type, new PermutationSource(resolved
+        , info.empty() ? source->shortInfo() : source->shortInfo() + " [" + info + "]"));
+    shader->compile();
+
+    m_shaders[key] = shader;
+
+    return shader;
+}
+
+glow::Program * ShaderPermutationCache::obtainProgram(const std::vector<Stage> & stages, const Defines & defines, bool & created)
+{
+    ++m_statistics.programRequests;
+
+    std::vector<glow::Shader *> shaders;
+    for (const Stage & stage : stages)
+    {
+        bool shaderCreated;
+        shaders.push_back(obtainShader(stage.type, stage.source, defines, shaderCreated));
+    }
+
+    // shaders are unique per source, so their addresses identify the program regardless of the stage order
+    std::sort(shaders.begin(), shaders.end());
+    shaders.erase(std::unique(shaders.begin(), shaders.end()), shaders.end());
+
+    const std::string addresses(reinterpret_cast<const char *>(shaders.data()), shaders.size() * sizeof(glow::Shader *));
+
+    std::uint64_t key = hash(addresses);
+
+    const std::set<glow::Shader *> shaderSet(shaders.begin(), shaders.end());
+
+    auto i = m_programs.find(key);
+    while (i != m_programs.end() && i->second->shaders() != shaderSet)
+    {
+        key = hash(addresses, key);
+        i = m_programs.find(key);
+    }
+
+    created = i == m_programs.end();
+
+    if (!created)
+    {
+        ++m_statistics.programHits;
+        return i->second;
+    }
+
+    glow::Program * program = new glow::Program;
+    for (glow::Shader * shader : shaders)
+        program->attach(shader);
+
+    program->link();
+
+    m_programs[key] = program;
+
+    return program;
+}
+
+} // namespace glowutils
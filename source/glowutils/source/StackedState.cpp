@@ -54,7 +54,7 @@ void StackedState::undoState(glow::State * state)
         }
         else
         {
-            glow::warning() << "Could not undo capability " << glow::enumName(oldCap->capability()) << ".";
+            glow::warning() << "Could not undo capability " << glow::enumNameCStr(oldCap->capability()) << ".";
         }
     }
 
@@ -26,6 +26,11 @@ void StringSourceDecorator::notifyChanged(Changeable *)
     changed();
 }
 
+glow::Changeable * StringSourceDecorator::propagatesTo()
+{
+    return this;
+}
+
 void StringSourceDecorator::update()
 {
 }
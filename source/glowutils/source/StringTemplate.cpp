@@ -35,6 +35,16 @@ StringTemplate::~StringTemplate()
 }
 
 std::string StringTemplate::string() const
+{
+    return modifiedSourceChunk().string();
+}
+
+void StringTemplate::chunksInto(std::vector<glow::StringChunk>& vector) const
+{
+    vector.push_back(modifiedSourceChunk());
+}
+
+const glow::StringChunk & StringTemplate::modifiedSourceChunk() const
 {
     if (!m_modifiedSource.isValid())
     {
@@ -0,0 +1,251 @@
+#include <glowutils/TextureResidencyManager.h>
+
+#include <algorithm>
+
+#include <glow/Buffer.h>
+#include <glow/Error.h>
+#include <glow/Texture.h>
+
+#include <glowutils/RenderTargetPool.h>
+
+namespace glowutils
+{
+
+TextureResidencyManager::TextureResidencyManager(std::size_t budget, Layout layout)
+: m_layout(layout)
+, m_tracker(budget)
+, m_fallbackHandle(0)
+, m_handlesChanged(false)
+, m_handleTable(new glow::Buffer)
+{
+}
+
+TextureResidencyManager::~TextureResidencyManager()
+{
+    evictAll();
+    setFallback(nullptr);
+}
+
+void TextureResidencyManager::setTexture(unsigned int material, glow::Texture * texture, std::size_t size)
+{
+    removeTexture(material);
+
+    if (!texture)
+        return;
+
+    if (m_materials.size() <= material)
+        m_materials.resize(material + 1, 0);
+
+    m_materials[material] = texture->id();
+
+    auto i = m_entries.find(texture->id());
+    if (i == m_entries.end())
+    {
+        i = m_entries.insert(std::make_pair(texture->id(), Entry{ texture, texture->textureHandle(), {} })).first;
+        m_tracker.insert(texture->id(), size > 0 ? size : estimateByteSize(texture));
+    }
+
+    i->second.materials.push_back(material);
+
+    setHandle(material, m_tracker.isResident(texture->id()) ? i->second.handle : 0);
+}
+
+void TextureResidencyManager::removeTexture(unsigned int material)
+{
+    if (material >= m_materials.size() || m_materials[material] == 0)
+        return;
+
+    const GLuint id = m_materials[material];
+    m_materials[material] = 0;
+
+    setHandle(material, 0);
+
+    Entry & entry = m_entries[id];
+    entry.materials.erase(std::remove(entry.materials.begin(), entry.materials.end(), material), entry.materials.end());
+
+    if (!entry.materials.empty())
+        return;
+
+    if (m_tracker.remove(id))
+        makeNonResident(id);
+
+    m_entries.erase(id);
+}
+
+glow::Texture * TextureResidencyManager::texture(unsigned int material)
+{
+    if (material >= m_materials.size() || m_materials[material] == 0)
+        return nullptr;
+
+    return m_entries.at(m_materials[material]).texture;
+}
+
+void TextureResidencyManager::setFallback(glow::Texture * texture)
+{
+    if (m_fallback == texture)
+        return;
+
+    // a fallback that is registered for materials as well stays resident while the tracker says so
+    if (m_fallback && !m_tracker.isResident(m_fallback->id()))
+    {
+        glMakeTextureHandleNonResidentARB(m_fallbackHandle);
+        CheckGLError();
+    }
+
+    m_fallback = texture;
+    m_fallbackHandle = 0;
+
+    if (m_fallback)
+    {
+        m_fallbackHandle = m_fallback->textureHandle();
+
+        if (!m_tracker.isResident(m_fallback->id()))
+        {
+            glMakeTextureHandleResidentARB(m_fallbackHandle);
+            CheckGLError();
+        }
+    }
+
+    m_handlesChanged = true;
+}
+
+glow::Texture * TextureResidencyManager::fallback()
+{
+    return m_fallback;
+}
+
+void TextureResidencyManager::use(unsigned int material)
+{
+    if (material < m_materials.size() && m_materials[material] != 0)
+        m_tracker.use(m_materials[material]);
+}
+
+void TextureResidencyManager::update()
+{
+    m_tracker.update(m_madeResident, m_madeNonResident);
+
+    for (GLuint id : m_madeNonResident)
+        makeNonResident(id);
+
+    for (GLuint id : m_madeResident)
+        makeResident(id);
+
+    m_madeResident.clear();
+    m_madeNonResident.clear();
+
+    if (!m_handlesChanged)
+        return;
+
+    std::vector<glow::TextureHandle> handles(m_handles);
+    std::replace(handles.begin(), handles.end(), glow::TextureHandle(0), m_fallbackHandle);
+
+    m_handleTable->setData(packHandles(handles, m_layout), GL_DYNAMIC_DRAW);
+    m_handlesChanged = false;
+}
+
+void TextureResidencyManager::evictAll()
+{
+    m_tracker.evictAll(m_madeNonResident);
+
+    for (GLuint id : m_madeNonResident)
+        makeNonResident(id);
+
+    m_madeNonResident.clear();
+}
+
+glow::Buffer * TextureResidencyManager::handleTable()
+{
+    return m_handleTable;
+}
+
+std::size_t TextureResidencyManager::budget() const
+{
+    return m_tracker.budget();
+}
+
+void TextureResidencyManager::setBudget(std::size_t budget)
+{
+    m_tracker.setBudget(budget);
+}
+
+const ResidencyTracker & TextureResidencyManager::tracker() const
+{
+    return m_tracker;
+}
+
+std::vector<glow::TextureHandle> TextureResidencyManager::packHandles(const std::vector<glow::TextureHandle> & handles, Layout layout)
+{
+    if (layout == Std430)
+        return handles;
+
+    // std140 rounds the array stride up to 16 bytes
+    std::vector<glow::TextureHandle> packed(handles.size() * 2, 0);
+    for (std::size_t i = 0; i < handles.size(); ++i)
+        packed[i * 2] = handles[i];
+
+    return packed;
+}
+
+std::size_t TextureResidencyManager::estimateByteSize(glow::Texture * texture)
+{
+    // size and format are read from the texture's description where known
+    const glm::ivec3 extent = texture->size(0);
+    const GLenum internalFormat = texture->internalFormat();
+
+    std::size_t size = texture->getLevelParameter(0, GL_TEXTURE_COMPRESSED) == GL_TRUE
+        ? static_cast<std::size_t>(texture->getLevelParameter(0, GL_TEXTURE_COMPRESSED_IMAGE_SIZE))
+        : RenderTargetPool::byteSize(RenderTargetPool::Description{ glm::ivec2(extent.x, extent.y), internalFormat, 0 })
+            * static_cast<std::size_t>(std::max(extent.z, 1));
+
+    // a complete mipmap chain adds a third
+    const bool mipmapped = texture->description().isSpecified()
+        ? texture->description().levels > 1
+        : texture->getLevelParameter(1, GL_TEXTURE_WIDTH) > 0;
+
+    if (mipmapped)
+        size += size / 3;
+
+    return size;
+}
+
+void TextureResidencyManager::makeResident(GLuint texture)
+{
+    const Entry & entry = m_entries.at(texture);
+
+    if (entry.handle != m_fallbackHandle)
+    {
+        glMakeTextureHandleResidentARB(entry.handle);
+        CheckGLError();
+    }
+
+    for (unsigned int material : entry.materials)
+        setHandle(material, entry.handle);
+}
+
+void TextureResidencyManager::makeNonResident(GLuint texture)
+{
+    const Entry & entry = m_entries.at(texture);
+
+    if (entry.handle != m_fallbackHandle)
+    {
+        glMakeTextureHandleNonResidentARB(entry.handle);
+        CheckGLError();
+    }
+
+    for (unsigned int material : entry.materials)
+        setHandle(material, 0);
+}
+
+void TextureResidencyManager::setHandle(unsigned int material, glow::TextureHandle handle)
+{
+    if (m_handles.size() <= material)
+        m_handles.resize(material + 1, 0);
+
+    if (m_handles[material] == handle)
+        return;
+
+    m_handles[material] = handle;
+    m_handlesChanged = true;
+}
+
+} // namespace glowutils
@@ -0,0 +1,219 @@
+#include <glowutils/bounds.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#include "parallelfor.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define BOUNDS_SSE
+    #include <xmmintrin.h>
+#endif
+
+using namespace glm;
+
+namespace
+{
+
+// vertices per thread, below that a single thread is used
+const unsigned int minRangeSize = 1 << 18;
+
+struct Positions
+{
+    Positions(const void * data, unsigned int count, std::size_t baseoffset, std::size_t stride)
+    : data(static_cast<const char *>(data) + baseoffset)
+    , count(count)
+    , stride(stride > 0 ? stride : 3 * sizeof(float))
+    {
+    }
+
+    vec3 operator[](unsigned int index) const
+    {
+        // memcpy, since the positions are not necessarily aligned
+        float position[3];
+        std::memcpy(position, data + index * stride, sizeof(position));
+
+        return vec3(position[0], position[1], position[2]);
+    }
+
+    const char * data;
+    unsigned int count;
+    std::size_t stride;
+};
+
+void minMaxScalar(const Positions & positions, unsigned int begin, unsigned int end, vec3 & llf, vec3 & urb)
+{
+    for (unsigned int i = begin; i < end; ++i)
+    {
+        const vec3 position = positions[i];
+
+        llf = min(llf, position);
+        urb = max(urb, position);
+    }
+}
+
+#if defined(BOUNDS_SSE)
+
+void minMaxSSE(const Positions & positions, unsigned int begin, unsigned int end, vec3 & llf, vec3 & urb)
+{
+    float result[4];
+    unsigned int i = begin;
+
+    if (positions.stride == 3 * sizeof(float))
+    {
+        // tightly packed: four positions in three registers, the component order in the registers
+        // is xyzx yzxy zxyz, hence three separate minima and maxima are kept
+        __m128 min0 = _mm_set1_ps(FLT_MAX), min1 = min0, min2 = min0;
+        __m128 max0 = _mm_set1_ps(-FLT_MAX), max1 = max0, max2 = max0;
+
+        const float * data = reinterpret_cast<const float *>(positions.data);
+        for (; i + 4 <= end; i += 4)
+        {
+            const float * v = data + i * 3;
+
+            const __m128 v0 = _mm_loadu_ps(v);
+            const __m128 v1 = _mm_loadu_ps(v + 4);
+            const __m128 v2 = _mm_loadu_ps(v + 8);
+
+            min0 = _mm_min_ps(min0, v0); max0 = _mm_max_ps(max0, v0);
+            min1 = _mm_min_ps(min1, v1); max1 = _mm_max_ps(max1, v1);
+            min2 = _mm_min_ps(min2, v2); max2 = _mm_max_ps(max2, v2);
+        }
+
+        float mins[12];
+        float maxs[12];
+        _mm_storeu_ps(mins, min0); _mm_storeu_ps(mins + 4, min1); _mm_storeu_ps(mins + 8, min2);
+        _mm_storeu_ps(maxs, max0); _mm_storeu_ps(maxs + 4, max1); _mm_storeu_ps(maxs + 8, max2);
+
+        for (int k = 0; k < 12; ++k)
+        {
+            llf[k % 3] = std::min(llf[k % 3], mins[k]);
+            urb[k % 3] = std::max(urb[k % 3], maxs[k]);
+        }
+    }
+    else
+    {
+        // strided: one position per register, loading one float past its z component, which is
+        // safe for all but the very last position of the array
+        const unsigned int vectorEnd = std::min(end, positions.count - 1);
+
+        __m128 minimum = _mm_set_ps(0.f, llf.z, llf.y, llf.x);
+        __m128 maximum = _mm_set_ps(0.f, urb.z, urb.y, urb.x);
+
+        for (; i < vectorEnd; ++i)
+        {
+            const __m128 v = _mm_loadu_ps(reinterpret_cast<const float *>(positions.data + i * positions.stride));
+
+            minimum = _mm_min_ps(minimum, v);
+            maximum = _mm_max_ps(maximum, v);
+        }
+
+        _mm_storeu_ps(result, minimum);
+        llf = vec3(result[0], result[1], result[2]);
+        _mm_storeu_ps(result, maximum);
+        urb = vec3(result[0], result[1], result[2]);
+    }
+
+    minMaxScalar(positions, i, end, llf, urb);
+}
+
+#endif
+
+void minMax(const Positions & positions, unsigned int begin, unsigned int end, vec3 & llf, vec3 & urb)
+{
+#if defined(BOUNDS_SSE)
+    minMaxSSE(positions, begin, end, llf, urb);
+#else
+    minMaxScalar(positions, begin, end, llf, urb);
+#endif
+}
+
+float maxDistance2(const Positions & positions, unsigned int begin, unsigned int end, const vec3 & center)
+{
+    float result = 0.f;
+    for (unsigned int i = begin; i < end; ++i)
+    {
+        const vec3 distance = positions[i] - center;
+        result = std::max(result, dot(distance, distance));
+    }
+    return result;
+}
+
+unsigned int rangeBegin(const Positions & positions, unsigned int rangeCount, unsigned int range)
+{
+    return static_cast<unsigned int>(static_cast<unsigned long long>(positions.count) * range / rangeCount);
+}
+
+}
+
+namespace glowutils
+{
+
+const AxisAlignedBoundingBox boundingBox(
+    const void * data
+,   unsigned int count
+,   std::size_t baseoffset
+,   std::size_t stride)
+{
+    if (count == 0)
+        return AxisAlignedBoundingBox();
+
+    const Positions positions(data, count, baseoffset, stride);
+    const unsigned int rangeCount = parallelRangeCount(count, minRangeSize);
+
+    std::vector<vec3> llfs(rangeCount, vec3(FLT_MAX));
+    std::vector<vec3> urbs(rangeCount, vec3(-FLT_MAX));
+
+    parallelFor(rangeCount, [&positions, &llfs, &urbs, rangeCount](unsigned int range)
+    {
+        minMax(positions, rangeBegin(positions, rangeCount, range), rangeBegin(positions, rangeCount, range + 1)
+            , llfs[range], urbs[range]);
+    });
+
+    for (unsigned int range = 1; range < rangeCount; ++range)
+    {
+        llfs[0] = min(llfs[0], llfs[range]);
+        urbs[0] = max(urbs[0], urbs[range]);
+    }
+
+    return AxisAlignedBoundingBox(llfs[0], urbs[0]);
+}
+
+const AxisAlignedBoundingBox boundingBox(const std::vector<vec3> & vertices)
+{
+    return boundingBox(vertices.data(), static_cast<unsigned int>(vertices.size()), 0, sizeof(vec3));
+}
+
+const BoundingSphere boundingSphere(
+    const void * data
+,   unsigned int count
+,   std::size_t baseoffset
+,   std::size_t stride)
+{
+    if (count == 0)
+        return BoundingSphere();
+
+    const vec3 center = boundingBox(data, count, baseoffset, stride).center();
+
+    const Positions positions(data, count, baseoffset, stride);
+    const unsigned int rangeCount = parallelRangeCount(count, minRangeSize);
+
+    std::vector<float> distances2(rangeCount, 0.f);
+
+    parallelFor(rangeCount, [&positions, &distances2, &center, rangeCount](unsigned int range)
+    {
+        distances2[range] = maxDistance2(positions, rangeBegin(positions, rangeCount, range)
+            , rangeBegin(positions, rangeCount, range + 1), center);
+    });
+
+    return BoundingSphere(center, std::sqrt(*std::max_element(distances2.begin(), distances2.end())));
+}
+
+const BoundingSphere boundingSphere(const std::vector<vec3> & vertices)
+{
+    return boundingSphere(vertices.data(), static_cast<unsigned int>(vertices.size()), 0, sizeof(vec3));
+}
+
+} // namespace glowutils
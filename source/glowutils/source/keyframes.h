@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+#include <glowutils/Interpolation.h>
+
+namespace glowutils
+{
+
+/** Index k of the segment [times[k], times[k + 1]) of count sorted key times containing time, clamped
+    to [0, count - 2] (0 for a single key). The search starts at hint, so lookups for steadily advancing
+    times, e.g., successive frames, take a few comparisons only.
+*/
+inline unsigned int findSegment(const float * times, unsigned int count, float time, unsigned int hint)
+{
+    if (count < 2)
+        return 0;
+
+    const unsigned int last = count - 2;
+    unsigned int k = std::min(hint, last);
+
+    if (times[k] <= time)
+    {
+        for (int step = 0; step < 4; ++step)
+        {
+            if (k == last || time < times[k + 1])
+                return k;
+            ++k;
+        }
+        return static_cast<unsigned int>(std::upper_bound(times + k, times + last + 1, time) - times) - 1;
+    }
+
+    const unsigned int upper = static_cast<unsigned int>(std::upper_bound(times, times + k, time) - times);
+    return upper > 0 ? upper - 1 : 0;
+}
+
+/** Eased weight of the second key of segment k at time, clamped to [0, 1].
+*/
+inline float segmentWeight(const float * times, const unsigned char * interpolations, unsigned int count, unsigned int k, float time)
+{
+    if (count < 2)
+        return 0.f;
+
+    const float duration = times[k + 1] - times[k];
+    const float t = duration > 0.f ? std::min(std::max((time - times[k]) / duration, 0.f), 1.f) : 1.f;
+
+    return interpolate(t, static_cast<InterpolationType>(interpolations[k]));
+}
+
+// The vectorized blending in AnimationSampler evaluates the same expressions in the same order.
+
+inline float lerp(float a, float b, float weight)
+{
+    return a + weight * (b - a);
+}
+
+/** Normalized linear interpolation of the quaternions a and b (x, y, z, w) along the shorter arc.
+*/
+inline void nlerp(const float * a, const float * b, float weight, float * result)
+{
+    const float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    const float sign = dot < 0.f ? -1.f : 1.f;
+
+    for (int c = 0; c < 4; ++c)
+        result[c] = lerp(a[c], sign * b[c], weight);
+
+    const float inverseLength = 1.f / std::sqrt(result[0] * result[0] + result[1] * result[1] + result[2] * result[2] + result[3] * result[3]);
+
+    for (int c = 0; c < 4; ++c)
+        result[c] *= inverseLength;
+}
+
+} // namespace glowutils
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace glowutils
+{
+
+/** Number of ranges (and thus threads) to split count elements into, such that every range holds
+    at least minRangeSize elements. A maxThreadCount of 0 uses the hardware concurrency.
+*/
+inline unsigned int parallelRangeCount(unsigned int count, unsigned int minRangeSize, unsigned int maxThreadCount = 0)
+{
+    const unsigned int threadCount = maxThreadCount > 0 ? maxThreadCount : std::thread::hardware_concurrency();
+    return std::max(1u, std::min(threadCount, count / std::max(1u, minRangeSize)));
+}
+
+/** Calls function(i) for every i in [0, count), each on its own thread. Index 0 is processed on
+    the calling thread, the call returns when all threads are finished.
+*/
+template <typename Function>
+void parallelFor(unsigned int count, Function function)
+{
+    std::vector<std::thread> threads;
+    threads.reserve(count > 1 ? count - 1 : 0);
+
+    for (unsigned int i = 1; i < count; ++i)
+        threads.push_back(std::thread(function, i));
+
+    if (count > 0)
+        function(0u);
+
+    for (std::thread & thread : threads)
+        thread.join();
+}
+
+} // namespace glowutils
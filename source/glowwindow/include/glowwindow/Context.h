@@ -37,6 +37,14 @@ public:
      \return isValid() is returned
      */
     bool create(const ContextFormat & format, int width, int height, GLFWmonitor * monitor = nullptr);
+
+    /** Creates a hidden context with the format of shared that shares its objects, e.g., for
+     creating resources in worker threads. As all window creation, this has to be called from
+     the main thread, but the context can be made current in any thread afterwards.
+
+     \return isValid() is returned
+     */
+    bool createShared(const Context & shared);
     void release();
 
     void makeCurrent();
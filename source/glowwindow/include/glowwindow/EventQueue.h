@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <glowwindow/glowwindow.h>
+#include <glowwindow/events.h>
+
+namespace glowwindow
+{
+
+/** \brief Allocation-free FIFO of window events.
+
+    Events are copied by value into type-agnostic slots of a ring buffer that only grows,
+    hence queueing allocates only until the queue reached its working size. Events are stored
+    by their type(), so subclasses of the glowwindow events are sliced.
+
+    With coalescing enabled (default), an event is merged into the last queued event if both
+    are of the same type: cursor moves and resizes keep the latest state, scroll events
+    accumulate their offsets and paint events collapse into one. Handlers that require every
+    raw sample, e.g., for stroke input, can disable coalescing.
+
+    Popped events are moved into a caller-provided Slot, so events can be queued while a
+    popped event is being handled.
+
+    \code{.cpp}
+
+        EventQueue::Slot slot;
+        while (!queue.isEmpty())
+        {
+            WindowEvent * event = queue.pop(slot);
+            handle(*event);
+            EventQueue::destroy(event);
+        }
+
+    \endcode
+ */
+class GLOWWINDOW_API EventQueue
+{
+public:
+    using Slot = std::aligned_union<0
+        , KeyEvent, MouseEvent, ScrollEvent, MoveEvent, ResizeEvent
+        , PaintEvent, CloseEvent, FocusEvent, IconifyEvent, TimerEvent>::type;
+
+public:
+    EventQueue(std::size_t capacity = 64);
+    ~EventQueue();
+
+    EventQueue(const EventQueue &) = delete;
+    EventQueue & operator=(const EventQueue &) = delete;
+
+    void setCoalescing(bool enable);
+    bool coalesces() const;
+
+    /** Queues a copy of event, merging it into the last queued event if coalescing applies. */
+    void push(const WindowEvent & event);
+
+    /** Moves the oldest event into slot and returns it, the queue must not be empty.
+        The returned event has to be destroyed using destroy().
+     */
+    WindowEvent * pop(Slot & slot);
+
+    void clear();
+
+    bool isEmpty() const;
+    std::size_t size() const;
+    std::size_t capacity() const;
+
+    /** \return number of events merged into already queued ones since construction */
+    std::size_t coalescedCount() const;
+
+    static bool isCoalescable(WindowEvent::Type type);
+
+    static WindowEvent * copy(const WindowEvent & event, void * storage);
+    static void destroy(WindowEvent * event);
+
+protected:
+    WindowEvent * at(std::size_t index);
+
+    bool coalesce(const WindowEvent & event);
+    void grow();
+
+protected:
+    std::vector<Slot> m_slots;
+    std::size_t m_head;
+    std::size_t m_size;
+
+    bool m_coalescing;
+    std::size_t m_coalescedCount;
+};
+
+} // namespace glowwindow
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <glowwindow/glowwindow.h>
+#include <glowwindow/ContextFormat.h>
+
+namespace glowwindow {
+
+/** \brief OpenGL context without window and window system, based on EGL.
+
+    The context renders into a pbuffer of the given size or, if pbuffers are not supported by
+    the EGL implementation, is created surfaceless, requiring all rendering to go into
+    framebuffer objects. With Mesa, the surfaceless platform is used, so neither an X server nor
+    a GPU (llvmpipe) are required, e.g., for batch rendering, integration tests and benchmarks.
+
+    Several independent contexts can be created per process and used in parallel from
+    different threads, each context being current in at most one thread.
+
+    \code{.cpp}
+
+        ContextFormat format;
+        format.setVersion(3, 2);
+        format.setProfile(ContextFormat::CoreProfile);
+
+        OffscreenContext context;
+        if (!context.create(format, 1920, 1080))
+            return 1;
+
+        context.makeCurrent();
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            // render and read back
+            context.swap();
+        }
+        context.doneCurrent();
+
+    \endcode
+
+    Creating contexts requires glowwindow to be built with EGL, cf. isSupported().
+
+    \see Context
+ */
+class GLOWWINDOW_API OffscreenContext {
+
+public:
+
+    OffscreenContext();
+    virtual ~OffscreenContext();
+
+    /** Tries to create a context with the given format and a default framebuffer of the given
+     size. If shared is given, objects are shared with the context of shared.
+
+     \return isValid() is returned
+     */
+    bool create(const ContextFormat & format, int width, int height, OffscreenContext * shared = nullptr);
+    void release();
+
+    void makeCurrent();
+    void doneCurrent();
+
+    /** Finishes the frame, a no-op for pbuffers besides an implicit flush.
+     */
+    void swap();
+
+    /** The returned format refers to the created context, not the requested one.
+     */
+    const ContextFormat & format() const;
+
+    bool isValid() const;
+
+    /** \return true if the context has no default framebuffer.
+     */
+    bool isSurfaceless() const;
+
+    int width() const;
+    int height() const;
+
+    /** \return true if glowwindow was built with EGL and an EGL display could be initialized.
+     */
+    static bool isSupported();
+
+protected:
+    ContextFormat m_format;
+    int m_width;
+    int m_height;
+
+private:
+    // EGL handles, opaque to avoid exposing EGL (and its platform headers)
+    void * m_config;
+    void * m_context;
+    void * m_surface;
+};
+
+} // namespace glowwindow
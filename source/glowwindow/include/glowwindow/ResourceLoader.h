@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/ref_ptr.h>
+
+#include <glowwindow/glowwindow.h>
+
+namespace glowwindow {
+
+class Context;
+class OffscreenContext;
+class WorkerContext;
+
+/** \brief Creates GL objects asynchronously in worker threads with shared contexts.
+
+    Each worker owns a hidden context that shares its objects with the given render context.
+    A load consists of a create function, executed in a worker thread with its context current,
+    e.g., reading a file and uploading it into a texture or buffer, and a finished function,
+    executed in the render thread once the GPU completed all commands issued by the create
+    function, which is tracked with a fence per load. Until then, the created object must not
+    be used by the render context.
+
+    \code{.cpp}
+
+        ResourceLoader loader(context, 2);
+
+        loader.load<Texture>([]() { return loadTexture("data/emblem-important.raw"); }
+            , [this](Texture * texture) { m_texture = texture; });
+
+        // once per frame, in the render thread
+        loader.processFinished();
+
+    \endcode
+
+    Worker contexts are created in the constructor, which therefore has to be called from the
+    main thread for window based contexts (as all window creation). As creating the contexts
+    may change the current context, the render context is made current afterwards.
+    The loader has to be destroyed while the render context is current.
+ */
+class GLOWWINDOW_API ResourceLoader
+{
+public:
+    ResourceLoader(Context & context, unsigned int workerCount = 1);
+    ResourceLoader(OffscreenContext & context, unsigned int workerCount = 1);
+
+    /** Stops the workers after their current loads, pending loads are discarded.
+     */
+    virtual ~ResourceLoader();
+
+    /** Queues create for execution in a worker thread. The created object is passed to finished
+     (if given) within processFinished() and is referenced until finished returned.
+     */
+    template <typename T>
+    void load(std::function<T * ()> create, std::function<void(T *)> finished = nullptr);
+
+    /** Hands all objects whose creation is completed on the GPU to their finished functions.
+     Has to be called from the render thread, e.g., once per frame.
+
+     \return number of finished loads
+     */
+    unsigned int processFinished();
+
+    /** Blocks until all queued loads are created and processed (cf. processFinished()).
+     */
+    void finish();
+
+    /** \return number of loads not yet processed.
+     */
+    unsigned int pendingCount() const;
+    unsigned int workerCount() const;
+
+protected:
+    typedef std::function<void()> Completion;
+    typedef std::function<Completion()> Task;
+
+    struct Finished
+    {
+        GLsync fence;
+        Completion completion;
+    };
+
+    void startWorkers(std::vector<std::unique_ptr<WorkerContext>> && contexts);
+    void enqueue(Task && task);
+    void work(WorkerContext & context);
+
+    unsigned int processFinished(GLuint64 timeout);
+
+protected:
+    std::vector<std::unique_ptr<WorkerContext>> m_contexts;
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    std::condition_variable m_idle;
+
+    std::deque<Task> m_tasks;
+    std::deque<Finished> m_finished;
+    unsigned int m_activeCount;
+    bool m_stopping;
+
+    std::atomic<unsigned int> m_pendingCount;
+};
+
+} // namespace glowwindow
+
+#include <glowwindow/ResourceLoader.hpp>
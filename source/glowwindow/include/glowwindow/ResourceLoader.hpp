@@ -0,0 +1,23 @@
+#pragma once
+
+#include <glowwindow/ResourceLoader.h>
+
+namespace glowwindow {
+
+template <typename T>
+void ResourceLoader::load(std::function<T * ()> create, std::function<void(T *)> finished)
+{
+    enqueue([create, finished]() -> Completion
+    {
+        // the reference keeps the object alive until it is handed over in the render thread
+        glow::ref_ptr<T> object = create();
+
+        return [object, finished]() mutable
+        {
+            if (finished)
+                finished(object.get());
+        };
+    });
+}
+
+} // namespace glowwindow
@@ -2,13 +2,13 @@
 
 #include <set>
 #include <string>
-#include <queue>
 
 #include <glm/glm.hpp>
 
 #include <glow/ref_ptr.h>
 
 #include <glowwindow/glowwindow.h>
+#include <glowwindow/EventQueue.h>
 #include <glowwindow/MainLoop.h>
 
 struct GLFWwindow;
@@ -88,10 +88,25 @@ public:
 
     GLFWwindow * internalWindow() const;
 
+    /**
+     * Queues a copy of the given event.
+     */
+    void queueEvent(const WindowEvent & event);
+    /**
+     * Queues the given event and deletes it, prefer queueing by reference.
+     */
     void queueEvent(WindowEvent * event);
     bool hasPendingEvents();
     void processEvents();
 
+    /**
+     * If enabled (default), consecutive cursor move, scroll, resize, and paint
+     * events are merged before being handled (see EventQueue). Disable for
+     * event handlers that require every raw sample.
+     */
+    void setEventCoalescing(bool enable);
+    bool coalescesEvents() const;
+
     static const std::set<Window*>& instances();
 
     void addTimer(int id, int interval, bool singleShot = false);
@@ -113,7 +128,7 @@ protected:
     Context * m_context;
     GLFWwindow * m_window;
     glow::ref_ptr<WindowEventHandler> m_eventHandler;
-    std::queue<WindowEvent*> m_eventQueue;
+    EventQueue m_eventQueue;
     glm::ivec2 m_windowedModeSize;
     std::string m_title;
 
@@ -86,6 +86,36 @@ bool Context::create(const ContextFormat & format, const int width, const int he
     return true;
 }
 
+bool Context::createShared(const Context & shared)
+{
+    if (isValid())
+    {
+        warning() << "Context is already valid. Create was probably called before.";
+        return true;
+    }
+
+    if (!shared.isValid())
+    {
+        warning() << "Shared context creation requires a valid context to share with.";
+        return false;
+    }
+
+    m_format = shared.format();
+    prepareFormat(m_format);
+
+    glfwWindowHint(GLFW_VISIBLE, GL_FALSE);
+
+    m_window = glfwCreateWindow(1, 1, "glow", nullptr, shared.m_window);
+
+    if (!m_window)
+    {
+        fatal() << "Shared context creation failed (GLFW).";
+        return false;
+    }
+
+    return true;
+}
+
 void Context::prepareFormat(const ContextFormat & format)
 {
     Version version = validateVersion(format.version());
@@ -0,0 +1,206 @@
+#include <glowwindow/EventQueue.h>
+
+#include <cassert>
+#include <new>
+
+namespace glowwindow
+{
+
+EventQueue::EventQueue(std::size_t capacity)
+: m_slots(capacity > 0 ? capacity : 1)
+, m_head(0)
+, m_size(0)
+, m_coalescing(true)
+, m_coalescedCount(0)
+{
+}
+
+EventQueue::~EventQueue()
+{
+    clear();
+}
+
+void EventQueue::setCoalescing(bool enable)
+{
+    m_coalescing = enable;
+}
+
+bool EventQueue::coalesces() const
+{
+    return m_coalescing;
+}
+
+void EventQueue::push(const WindowEvent & event)
+{
+    if (m_coalescing && coalesce(event))
+    {
+        ++m_coalescedCount;
+        return;
+    }
+
+    if (m_size == m_slots.size())
+        grow();
+
+    copy(event, &m_slots[(m_head + m_size) % m_slots.size()]);
+    ++m_size;
+}
+
+WindowEvent * EventQueue::pop(Slot & slot)
+{
+    assert(m_size > 0);
+
+    WindowEvent * front = at(0);
+
+    WindowEvent * event = copy(*front, &slot);
+    destroy(front);
+
+    m_head = (m_head + 1) % m_slots.size();
+    --m_size;
+
+    return event;
+}
+
+void EventQueue::clear()
+{
+    for (std::size_t i = 0; i < m_size; ++i)
+        destroy(at(i));
+
+    m_head = 0;
+    m_size = 0;
+}
+
+bool EventQueue::isEmpty() const
+{
+    return m_size == 0;
+}
+
+std::size_t EventQueue::size() const
+{
+    return m_size;
+}
+
+std::size_t EventQueue::capacity() const
+{
+    return m_slots.size();
+}
+
+std::size_t EventQueue::coalescedCount() const
+{
+    return m_coalescedCount;
+}
+
+bool EventQueue::isCoalescable(WindowEvent::Type type)
+{
+    switch (type)
+    {
+        case WindowEvent::MouseMove:
+        case WindowEvent::Scroll:
+        case WindowEvent::Resize:
+        case WindowEvent::FrameBufferResize:
+        case WindowEvent::Paint:
+            return true;
+        default:
+            return false;
+    }
+}
+
+WindowEvent * EventQueue::copy(const WindowEvent & event, void * storage)
+{
+    switch (event.type())
+    {
+        case WindowEvent::KeyPress:
+        case WindowEvent::KeyRelease:
+        case WindowEvent::KeyTyped:
+            return new (storage) KeyEvent(static_cast<const KeyEvent &>(event));
+
+        case WindowEvent::MousePress:
+        case WindowEvent::MouseRelease:
+        case WindowEvent::MouseMove:
+            return new (storage) MouseEvent(static_cast<const MouseEvent &>(event));
+
+        case WindowEvent::Scroll:
+            return new (storage) ScrollEvent(static_cast<const ScrollEvent &>(event));
+
+        case WindowEvent::Resize:
+        case WindowEvent::FrameBufferResize:
+            return new (storage) ResizeEvent(static_cast<const ResizeEvent &>(event));
+
+        case WindowEvent::Move:
+            return new (storage) MoveEvent(static_cast<const MoveEvent &>(event));
+
+        case WindowEvent::Close:
+            return new (storage) CloseEvent(static_cast<const CloseEvent &>(event));
+
+        case WindowEvent::Focus:
+            return new (storage) FocusEvent(static_cast<const FocusEvent &>(event));
+
+        case WindowEvent::Iconify:
+            return new (storage) IconifyEvent(static_cast<const IconifyEvent &>(event));
+
+        case WindowEvent::Paint:
+            return new (storage) PaintEvent(static_cast<const PaintEvent &>(event));
+
+        case WindowEvent::Timer:
+            return new (storage) TimerEvent(static_cast<const TimerEvent &>(event));
+    }
+
+    assert(false);
+    return nullptr;
+}
+
+void EventQueue::destroy(WindowEvent * event)
+{
+    if (event)
+        event->~WindowEvent();
+}
+
+WindowEvent * EventQueue::at(std::size_t index)
+{
+    return reinterpret_cast<WindowEvent *>(&m_slots[(m_head + index) % m_slots.size()]);
+}
+
+bool EventQueue::coalesce(const WindowEvent & event)
+{
+    if (m_size == 0 || !isCoalescable(event.type()))
+        return false;
+
+    WindowEvent * last = at(m_size - 1);
+
+    if (last->type() != event.type())
+        return false;
+
+    // scroll offsets accumulate, all other coalescable events carry absolute state
+    if (event.type() == WindowEvent::Scroll)
+    {
+        const ScrollEvent & scroll = static_cast<const ScrollEvent &>(event);
+        const glm::vec2 offset = static_cast<ScrollEvent *>(last)->offset() + scroll.offset();
+
+        destroy(last);
+        new (last) ScrollEvent(offset, scroll.pos());
+
+        return true;
+    }
+
+    destroy(last);
+    copy(event, last);
+
+    return true;
+}
+
+void EventQueue::grow()
+{
+    std::vector<Slot> slots(m_slots.size() * 2);
+
+    for (std::size_t i = 0; i < m_size; ++i)
+    {
+        WindowEvent * event = at(i);
+
+        copy(*event, &slots[i]);
+        destroy(event);
+    }
+
+    m_slots.swap(slots);
+    m_head = 0;
+}
+
+} // namespace glowwindow
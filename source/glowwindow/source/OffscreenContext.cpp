@@ -0,0 +1,292 @@
+#include <glowwindow/OffscreenContext.h>
+
+#include <mutex>
+#include <vector>
+
+#include <GL/glew.h>
+
+#ifdef GLOWWINDOW_EGL
+    #define MESA_EGL_NO_X11_HEADERS
+    #define EGL_NO_X11
+    #include <EGL/egl.h>
+    #include <EGL/eglext.h>
+#endif
+
+#include <glow/logging.h>
+#include <glow/global.h>
+
+using namespace glow;
+
+#ifdef GLOWWINDOW_EGL
+
+namespace
+{
+
+EGLDisplay display()
+{
+    static std::once_flag initialized;
+    static EGLDisplay display = EGL_NO_DISPLAY;
+
+    // the display is shared by all contexts and never terminated
+    std::call_once(initialized, []()
+    {
+        // prefer the surfaceless platform, which neither requires a window system nor a GPU
+        PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+            reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+        if (getPlatformDisplay)
+            display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+
+        if (display == EGL_NO_DISPLAY)
+            display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+        if (display != EGL_NO_DISPLAY && !eglInitialize(display, nullptr, nullptr))
+        {
+            warning("EGL initialization failed (error 0x%x;).", eglGetError());
+            display = EGL_NO_DISPLAY;
+        }
+    });
+
+    return display;
+}
+
+EGLConfig chooseConfig(const glowwindow::ContextFormat & format, bool pbuffer)
+{
+    const EGLint attributes[] = {
+        EGL_SURFACE_TYPE, pbuffer ? EGL_PBUFFER_BIT : 0
+    ,   EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT
+    ,   EGL_RED_SIZE, format.redBufferSize()
+    ,   EGL_GREEN_SIZE, format.greenBufferSize()
+    ,   EGL_BLUE_SIZE, format.blueBufferSize()
+    ,   EGL_ALPHA_SIZE, format.alphaBufferSize()
+    ,   EGL_DEPTH_SIZE, format.depthBufferSize()
+    ,   EGL_STENCIL_SIZE, format.stencilBufferSize()
+    ,   EGL_SAMPLES, format.samples()
+    ,   EGL_NONE
+    };
+
+    EGLConfig config = nullptr;
+    EGLint count = 0;
+
+    if (!eglChooseConfig(display(), attributes, &config, 1, &count) || count < 1)
+        return nullptr;
+
+    return config;
+}
+
+std::vector<EGLint> contextAttributes(const glowwindow::ContextFormat & format)
+{
+    std::vector<EGLint> attributes;
+
+    // a null version requests the highest version available
+    if (!format.version().isNull())
+    {
+        attributes.insert(attributes.end(), { EGL_CONTEXT_MAJOR_VERSION_KHR, format.majorVersion() });
+        attributes.insert(attributes.end(), { EGL_CONTEXT_MINOR_VERSION_KHR, format.minorVersion() });
+
+        if (format.version() >= Version(3, 2) && format.profile() != glowwindow::ContextFormat::AnyProfile)
+        {
+            attributes.insert(attributes.end(), { EGL_CONTEXT_OPENGL_PROFILE_MASK_KHR
+                , format.profile() == glowwindow::ContextFormat::CoreProfile
+                    ? EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT_KHR : EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR });
+        }
+    }
+
+    EGLint flags = 0;
+    if (format.debugContext())
+        flags |= EGL_CONTEXT_OPENGL_DEBUG_BIT_KHR;
+    if (format.forwardCompatible())
+        flags |= EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE_BIT_KHR;
+
+    if (flags)
+        attributes.insert(attributes.end(), { EGL_CONTEXT_FLAGS_KHR, flags });
+
+    attributes.push_back(EGL_NONE);
+
+    return attributes;
+}
+
+}
+
+#endif
+
+namespace glowwindow
+{
+
+OffscreenContext::OffscreenContext()
+: m_width(0)
+, m_height(0)
+, m_config(nullptr)
+, m_context(nullptr)
+, m_surface(nullptr)
+{
+}
+
+OffscreenContext::~OffscreenContext()
+{
+    release();
+}
+
+bool OffscreenContext::isSupported()
+{
+#ifdef GLOWWINDOW_EGL
+    return display() != EGL_NO_DISPLAY;
+#else
+    return false;
+#endif
+}
+
+bool OffscreenContext::create(const ContextFormat & format, const int width, const int height, OffscreenContext * shared)
+{
+    if (isValid())
+    {
+        warning() << "Context is already valid. Create was probably called before.";
+        return true;
+    }
+
+#ifdef GLOWWINDOW_EGL
+
+    if (!isSupported())
+    {
+        fatal() << "Offscreen context creation failed (no EGL display).";
+        return false;
+    }
+
+    // the API is bound per thread
+    eglBindAPI(EGL_OPENGL_API);
+
+    m_format = format;
+    m_width = width;
+    m_height = height;
+
+    m_config = chooseConfig(format, true);
+    if (m_config)
+    {
+        const EGLint attributes[] = { EGL_WIDTH, width, EGL_HEIGHT, height, EGL_NONE };
+        m_surface = eglCreatePbufferSurface(display(), m_config, attributes);
+    }
+
+    if (!m_surface)
+    {
+        // without pbuffer support, fall back to a surfaceless context (EGL_KHR_surfaceless_context)
+        m_config = chooseConfig(format, false);
+    }
+
+    if (!m_config)
+    {
+        fatal() << "Offscreen context creation failed (no matching EGL config).";
+        return false;
+    }
+
+    const std::vector<EGLint> attributes = contextAttributes(format);
+    m_context = eglCreateContext(display(), m_config, shared ? shared->m_context : EGL_NO_CONTEXT, attributes.data());
+
+    if (!m_context)
+    {
+        fatal("Offscreen context creation failed (EGL error 0x%x;).", eglGetError());
+        release();
+        return false;
+    }
+
+    makeCurrent();
+
+    if (!glow::init())
+    {
+        fatal() << "GLOW/GLEW initialization failed.";
+        doneCurrent();
+        release();
+        return false;
+    }
+
+    m_format.setVersion(Version::current());
+
+    doneCurrent();
+
+    return true;
+
+#else
+
+    (void)format; (void)width; (void)height; (void)shared;
+
+    fatal() << "Offscreen context creation failed (glowwindow was built without EGL).";
+    return false;
+
+#endif
+}
+
+void OffscreenContext::release()
+{
+#ifdef GLOWWINDOW_EGL
+    if (m_context)
+        eglDestroyContext(display(), m_context);
+    if (m_surface)
+        eglDestroySurface(display(), m_surface);
+#endif
+
+    m_context = nullptr;
+    m_surface = nullptr;
+    m_config = nullptr;
+}
+
+void OffscreenContext::makeCurrent()
+{
+    if (!isValid())
+        return;
+
+#ifdef GLOWWINDOW_EGL
+    eglBindAPI(EGL_OPENGL_API);
+
+    if (!eglMakeCurrent(display(), m_surface ? m_surface : EGL_NO_SURFACE, m_surface ? m_surface : EGL_NO_SURFACE, m_context))
+        warning("Making the offscreen context current failed (EGL error 0x%x;).", eglGetError());
+#endif
+}
+
+void OffscreenContext::doneCurrent()
+{
+    if (!isValid())
+        return;
+
+#ifdef GLOWWINDOW_EGL
+    eglMakeCurrent(display(), EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+#endif
+}
+
+void OffscreenContext::swap()
+{
+    if (!isValid())
+        return;
+
+#ifdef GLOWWINDOW_EGL
+    if (m_surface)
+        eglSwapBuffers(display(), m_surface);
+    else
+        glFlush();
+#endif
+}
+
+const ContextFormat & OffscreenContext::format() const
+{
+    return m_format;
+}
+
+bool OffscreenContext::isValid() const
+{
+    return m_context != nullptr;
+}
+
+bool OffscreenContext::isSurfaceless() const
+{
+    return m_surface == nullptr;
+}
+
+int OffscreenContext::width() const
+{
+    return m_width;
+}
+
+int OffscreenContext::height() const
+{
+    return m_height;
+}
+
+} // namespace glowwindow
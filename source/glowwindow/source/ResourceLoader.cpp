@@ -0,0 +1,262 @@
+#include <glowwindow/ResourceLoader.h>
+
+#include <cassert>
+
+#include <glow/logging.h>
+
+#include <glowwindow/Context.h>
+#include <glowwindow/OffscreenContext.h>
+
+using namespace glow;
+
+namespace
+{
+
+// timeout for blocking waits on fences, in nanoseconds
+const GLuint64 finishTimeout = 1000000000;
+
+}
+
+namespace glowwindow {
+
+/** \brief Worker context of a ResourceLoader, independent of the kind of context.
+ */
+class WorkerContext
+{
+public:
+    virtual ~WorkerContext()
+    {
+    }
+
+    virtual void makeCurrent() = 0;
+    virtual void doneCurrent() = 0;
+};
+
+namespace
+{
+
+class SharedContext : public WorkerContext
+{
+public:
+    bool create(Context & shared)
+    {
+        return m_context.createShared(shared);
+    }
+
+    virtual void makeCurrent() override
+    {
+        m_context.makeCurrent();
+    }
+
+    virtual void doneCurrent() override
+    {
+        m_context.doneCurrent();
+    }
+
+protected:
+    Context m_context;
+};
+
+class SharedOffscreenContext : public WorkerContext
+{
+public:
+    bool create(OffscreenContext & shared)
+    {
+        return m_context.create(shared.format(), 1, 1, &shared);
+    }
+
+    virtual void makeCurrent() override
+    {
+        m_context.makeCurrent();
+    }
+
+    virtual void doneCurrent() override
+    {
+        m_context.doneCurrent();
+    }
+
+protected:
+    OffscreenContext m_context;
+};
+
+template <typename WorkerContextType, typename ContextType>
+std::vector<std::unique_ptr<WorkerContext>> createWorkerContexts(ContextType & context, unsigned int count)
+{
+    std::vector<std::unique_ptr<WorkerContext>> contexts;
+
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        std::unique_ptr<WorkerContextType> worker(new WorkerContextType);
+        if (!worker->create(context))
+        {
+            warning() << "ResourceLoader: only " << i << " of " << count << " worker contexts could be created.";
+            break;
+        }
+        contexts.push_back(std::move(worker));
+    }
+
+    // context creation may have changed the current context
+    context.makeCurrent();
+
+    return contexts;
+}
+
+}
+
+ResourceLoader::ResourceLoader(Context & context, unsigned int workerCount)
+: m_activeCount(0)
+, m_stopping(false)
+, m_pendingCount(0)
+{
+    startWorkers(createWorkerContexts<SharedContext>(context, workerCount));
+}
+
+ResourceLoader::ResourceLoader(OffscreenContext & context, unsigned int workerCount)
+: m_activeCount(0)
+, m_stopping(false)
+, m_pendingCount(0)
+{
+    startWorkers(createWorkerContexts<SharedOffscreenContext>(context, workerCount));
+}
+
+ResourceLoader::~ResourceLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+        m_tasks.clear();
+    }
+    m_taskAvailable.notify_all();
+
+    for (std::thread & worker : m_workers)
+        worker.join();
+
+    for (Finished & finished : m_finished)
+        glDeleteSync(finished.fence);
+}
+
+void ResourceLoader::startWorkers(std::vector<std::unique_ptr<WorkerContext>> && contexts)
+{
+    m_contexts = std::move(contexts);
+
+    for (std::unique_ptr<WorkerContext> & context : m_contexts)
+        m_workers.emplace_back(&ResourceLoader::work, this, std::ref(*context));
+}
+
+unsigned int ResourceLoader::workerCount() const
+{
+    return static_cast<unsigned int>(m_workers.size());
+}
+
+unsigned int ResourceLoader::pendingCount() const
+{
+    return m_pendingCount;
+}
+
+void ResourceLoader::enqueue(Task && task)
+{
+    if (m_workers.empty())
+    {
+        warning() << "ResourceLoader: no worker available, load is discarded.";
+        return;
+    }
+
+    ++m_pendingCount;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+    }
+    m_taskAvailable.notify_one();
+}
+
+void ResourceLoader::work(WorkerContext & context)
+{
+    context.makeCurrent();
+
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_taskAvailable.wait(lock, [this]() { return m_stopping || !m_tasks.empty(); });
+
+            if (m_stopping)
+                break;
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            ++m_activeCount;
+        }
+
+        Finished finished;
+        finished.completion = task();
+
+        // the fence signals the render thread that all commands of the task are completed,
+        // flushing ensures that it is signaled eventually
+        finished.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_finished.push_back(std::move(finished));
+            --m_activeCount;
+        }
+        m_idle.notify_all();
+    }
+
+    context.doneCurrent();
+}
+
+unsigned int ResourceLoader::processFinished()
+{
+    return processFinished(0);
+}
+
+unsigned int ResourceLoader::processFinished(GLuint64 timeout)
+{
+    std::deque<Finished> finished;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        finished.swap(m_finished);
+    }
+
+    unsigned int count = 0;
+
+    // loads are processed in order, the first one not completed defers all following ones
+    while (!finished.empty())
+    {
+        const GLenum status = glClientWaitSync(finished.front().fence, 0, timeout);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            break;
+
+        glDeleteSync(finished.front().fence);
+        Completion completion = std::move(finished.front().completion);
+        finished.pop_front();
+
+        completion();
+
+        --m_pendingCount;
+        ++count;
+    }
+
+    if (!finished.empty())
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_finished.insert(m_finished.begin(), finished.begin(), finished.end());
+    }
+
+    return count;
+}
+
+void ResourceLoader::finish()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idle.wait(lock, [this]() { return m_tasks.empty() && m_activeCount == 0; });
+    }
+
+    while (m_pendingCount > 0)
+        processFinished(finishTimeout);
+}
+
+} // namespace glowwindow
@@ -187,8 +187,8 @@ void Window::initializeEventHandler()
         m_eventHandler->initialize(*this);
         m_context->doneCurrent();
 
-        queueEvent(new ResizeEvent(size()));
-        queueEvent(new ResizeEvent(framebufferSize(), true));
+        queueEvent(ResizeEvent(size()));
+        queueEvent(ResizeEvent(framebufferSize(), true));
     }
 }
 
@@ -342,12 +342,12 @@ void Window::setInputMode(int mode, int value)
 
 void Window::repaint()
 {
-    queueEvent(new PaintEvent);
+    queueEvent(PaintEvent());
 }
 
 void Window::close()
 {
-    queueEvent(new CloseEvent);
+    queueEvent(CloseEvent());
 }
 
 void Window::idle()
@@ -377,35 +377,53 @@ GLFWwindow * Window::internalWindow() const
     return m_window;
 }
 
+void Window::queueEvent(const WindowEvent & event)
+{
+    m_eventQueue.push(event);
+}
+
 void Window::queueEvent(WindowEvent * event)
 {
     if (!event)
         return;
 
-    m_eventQueue.push(event);
+    m_eventQueue.push(*event);
+    delete event;
 }
 
 bool Window::hasPendingEvents()
 {
-    return !m_eventQueue.empty();
+    return !m_eventQueue.isEmpty();
+}
+
+void Window::setEventCoalescing(bool enable)
+{
+    m_eventQueue.setCoalescing(enable);
+}
+
+bool Window::coalescesEvents() const
+{
+    return m_eventQueue.coalesces();
 }
 
 void Window::processEvents()
 {
-    if (m_eventQueue.empty() || !m_context)
+    if (m_eventQueue.isEmpty() || !m_context)
         return;
 
     m_context->makeCurrent();
 
-    while (!m_eventQueue.empty())
+    // events queued while handling are appended and handled in this pass
+    EventQueue::Slot slot;
+
+    while (!m_eventQueue.isEmpty())
     {
-        WindowEvent* event = m_eventQueue.front();
-        m_eventQueue.pop();
+        WindowEvent* event = m_eventQueue.pop(slot);
         event->setWindow(this);
 
         processEvent(*event);
 
-        delete event;
+        EventQueue::destroy(event);
 
         if (!m_context)
         {
@@ -445,11 +463,7 @@ void Window::postprocessEvent(WindowEvent & event)
 
 void Window::clearEventQueue()
 {
-    while (!m_eventQueue.empty())
-    {
-        delete m_eventQueue.front();
-        m_eventQueue.pop();
-    }
+    m_eventQueue.clear();
 }
 
 void Window::addTimer(int id, int interval, bool singleShot)
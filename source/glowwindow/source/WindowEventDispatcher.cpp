@@ -132,7 +132,7 @@ void WindowEventDispatcher::checkForTimerEvents()
 
             if (timer.ready())
             {
-                dispatchEvent(window, new TimerEvent(id));
+                dispatchEvent(window, TimerEvent(id));
                 if (timer.singleShot)
                 {
                     discarded.emplace_back(window, id);
@@ -171,18 +171,15 @@ glm::ivec2 WindowEventDispatcher::mousePosition(GLFWwindow* glfwWindow)
     }
 }
 
-void WindowEventDispatcher::dispatchEvent(GLFWwindow* glfwWindow, WindowEvent* event)
+void WindowEventDispatcher::dispatchEvent(GLFWwindow* glfwWindow, const WindowEvent & event)
 {
     dispatchEvent(fromGLFW(glfwWindow), event);
 }
 
-void WindowEventDispatcher::dispatchEvent(Window* window, WindowEvent* event)
+void WindowEventDispatcher::dispatchEvent(Window* window, const WindowEvent & event)
 {
     if (!window)
-    {
-        delete event;
         return;
-    }
 
     window->queueEvent(event);
 }
@@ -191,27 +188,27 @@ void WindowEventDispatcher::dispatchEvent(Window* window, WindowEvent* event)
 
 void WindowEventDispatcher::handleRefresh(GLFWwindow* glfwWindow)
 {
-    dispatchEvent(glfwWindow, new PaintEvent);
+    dispatchEvent(glfwWindow, PaintEvent());
 }
 
 void WindowEventDispatcher::handleKey(GLFWwindow* glfwWindow, int key, int scanCode, int action, int modifiers)
 {
-    dispatchEvent(glfwWindow, new KeyEvent(key, scanCode, action, modifiers));
+    dispatchEvent(glfwWindow, KeyEvent(key, scanCode, action, modifiers));
 }
 
 void WindowEventDispatcher::handleChar(GLFWwindow* glfwWindow, unsigned int character)
 {
-    dispatchEvent(glfwWindow, new KeyEvent(character));
+    dispatchEvent(glfwWindow, KeyEvent(character));
 }
 
 void WindowEventDispatcher::handleMouse(GLFWwindow* glfwWindow, int button, int action, int modifiers)
 {
-    dispatchEvent(glfwWindow, new MouseEvent(mousePosition(glfwWindow), button, action, modifiers));
+    dispatchEvent(glfwWindow, MouseEvent(mousePosition(glfwWindow), button, action, modifiers));
 }
 
 void WindowEventDispatcher::handleCursorPos(GLFWwindow* glfwWindow, double xPos, double yPos)
 {
-    dispatchEvent(glfwWindow, new MouseEvent(glm::ivec2(std::floor(xPos), std::floor(yPos))));
+    dispatchEvent(glfwWindow, MouseEvent(glm::ivec2(std::floor(xPos), std::floor(yPos))));
 }
 
 void WindowEventDispatcher::handleCursorEnter(GLFWwindow* /*glfwWindow*/, int /*entered*/)
@@ -221,37 +218,37 @@ void WindowEventDispatcher::handleCursorEnter(GLFWwindow* /*glfwWindow*/, int /*
 
 void WindowEventDispatcher::handleScroll(GLFWwindow* glfwWindow, double xOffset, double yOffset)
 {
-    dispatchEvent(glfwWindow, new ScrollEvent(glm::vec2(xOffset, yOffset), mousePosition(glfwWindow)));
+    dispatchEvent(glfwWindow, ScrollEvent(glm::vec2(xOffset, yOffset), mousePosition(glfwWindow)));
 }
 
 void WindowEventDispatcher::handleResize(GLFWwindow* glfwWindow, int width, int height)
 {
-    dispatchEvent(glfwWindow, new ResizeEvent(glm::ivec2(width, height)));
+    dispatchEvent(glfwWindow, ResizeEvent(glm::ivec2(width, height)));
 }
 
 void WindowEventDispatcher::handleFramebufferResize(GLFWwindow* glfwWindow, int width, int height)
 {
-    dispatchEvent(glfwWindow, new ResizeEvent(glm::ivec2(width, height), true));
+    dispatchEvent(glfwWindow, ResizeEvent(glm::ivec2(width, height), true));
 }
 
 void WindowEventDispatcher::handleMove(GLFWwindow* glfwWindow, int x, int y)
 {
-    dispatchEvent(glfwWindow, new MoveEvent(glm::ivec2(x, y)));
+    dispatchEvent(glfwWindow, MoveEvent(glm::ivec2(x, y)));
 }
 
 void WindowEventDispatcher::handleFocus(GLFWwindow* glfwWindow, int focused)
 {
-    dispatchEvent(glfwWindow, new FocusEvent(focused == GL_TRUE));
+    dispatchEvent(glfwWindow, FocusEvent(focused == GL_TRUE));
 }
 
 void WindowEventDispatcher::handleIconify(GLFWwindow* glfwWindow, int iconified)
 {
-    dispatchEvent(glfwWindow, new IconifyEvent(iconified == GL_TRUE));
+    dispatchEvent(glfwWindow, IconifyEvent(iconified == GL_TRUE));
 }
 
 void WindowEventDispatcher::handleClose(GLFWwindow* glfwWindow)
 {
-    dispatchEvent(glfwWindow, new CloseEvent);
+    dispatchEvent(glfwWindow, CloseEvent());
 }
 
 } // namespace glowwindow
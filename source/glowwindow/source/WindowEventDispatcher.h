@@ -52,8 +52,8 @@ protected:
     static Window* fromGLFW(GLFWwindow* glfwWindow);
     static glm::ivec2 mousePosition(GLFWwindow* glfwWindow);
 
-    static void dispatchEvent(GLFWwindow* glfwWindow, WindowEvent* event);
-    static void dispatchEvent(Window* window, WindowEvent* event);
+    static void dispatchEvent(GLFWwindow* glfwWindow, const WindowEvent & event);
+    static void dispatchEvent(Window* window, const WindowEvent & event);
 
     static void handleRefresh(GLFWwindow* glfwWindow);
     static void handleKey(GLFWwindow* glfwWindow, int key, int scanCode, int action, int modifiers);
@@ -0,0 +1,268 @@
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <glow/ChangeBatch.h>
+#include <glow/Changeable.h>
+#include <glow/ChangeListener.h>
+
+class ChangeBatch_test : public testing::Test
+{
+public:
+    class Source : public glow::Changeable
+    {
+    };
+
+    // forwards changes, like a CompositeStringSource or Shader
+    class Node : public glow::Changeable, public glow::ChangeListener
+    {
+    public:
+        Node(const std::string & name, std::vector<std::string> & log)
+        : m_name(name)
+        , m_log(log)
+        , m_forward(true)
+        {
+        }
+
+        virtual void notifyChanged(glow::Changeable *) override
+        {
+            m_log.push_back(m_name);
+
+            if (m_forward)
+                changed();
+        }
+
+        void setForward(bool forward)
+        {
+            m_forward = forward;
+        }
+
+    protected:
+        virtual glow::Changeable * propagatesTo() override
+        {
+            return this;
+        }
+
+    protected:
+        std::string m_name;
+        std::vector<std::string> & m_log;
+        bool m_forward;
+    };
+
+    // forwards changes to another Changeable, like a decorator of a string source
+    class Forwarder : public glow::ChangeListener
+    {
+    public:
+        Forwarder(const std::string & name, std::vector<std::string> & log, Source & target)
+        : m_name(name)
+        , m_log(log)
+        , m_target(target)
+        {
+        }
+
+        virtual void notifyChanged(glow::Changeable *) override
+        {
+            m_log.push_back(m_name);
+            m_target.changed();
+        }
+
+    protected:
+        virtual glow::Changeable * propagatesTo() override
+        {
+            return &m_target;
+        }
+
+    protected:
+        std::string m_name;
+        std::vector<std::string> & m_log;
+        Source & m_target;
+    };
+
+protected:
+    std::vector<std::string> log;
+};
+
+TEST_F(ChangeBatch_test, PropagatesImmediatelyWithoutBatch)
+{
+    Source source;
+    Node a("a", log);
+    Node b("b", log);
+
+    source.registerListener(&a);
+    a.registerListener(&b);
+
+    source.changed();
+
+    EXPECT_FALSE(glow::ChangeBatch::isActive());
+    EXPECT_THAT(log, testing::ElementsAre("a", "b"));
+}
+
+TEST_F(ChangeBatch_test, DefersPropagationToEndOfBatch)
+{
+    Source source;
+    Node a("a", log);
+
+    source.registerListener(&a);
+
+    {
+        glow::ChangeBatch batch;
+        EXPECT_TRUE(glow::ChangeBatch::isActive());
+
+        source.changed();
+        source.changed();
+
+        EXPECT_TRUE(log.empty());
+    }
+
+    EXPECT_THAT(log, testing::ElementsAre("a"));
+}
+
+TEST_F(ChangeBatch_test, UpdatesShadersOnceForSharedInclude)
+{
+    // an include shared by the sources of both shaders of a program
+    Source include;
+    Source vertexFile;
+    Node vertexSource("vertexSource", log);
+    Node fragmentSource("fragmentSource", log);
+    Node vertexShader("vertexShader", log);
+    Node fragmentShader("fragmentShader", log);
+    Node program("program", log);
+
+    include.registerListener(&vertexSource);
+    include.registerListener(&fragmentSource);
+    vertexFile.registerListener(&vertexSource);
+    vertexSource.registerListener(&vertexShader);
+    fragmentSource.registerListener(&fragmentShader);
+    vertexShader.registerListener(&program);
+    fragmentShader.registerListener(&program);
+
+    {
+        glow::ChangeBatch batch;
+        include.changed();
+        vertexFile.changed();
+    }
+
+    // listeners are notified per changed subject, after all listeners they depend on
+    EXPECT_EQ(std::count(log.begin(), log.end(), "vertexSource"), 2);
+    EXPECT_EQ(std::count(log.begin(), log.end(), "fragmentSource"), 1);
+    EXPECT_EQ(std::count(log.begin(), log.end(), "vertexShader"), 1);
+    EXPECT_EQ(std::count(log.begin(), log.end(), "fragmentShader"), 1);
+    EXPECT_EQ(std::count(log.begin(), log.end(), "program"), 2);
+
+    EXPECT_LT(std::find(log.begin(), log.end(), "vertexSource"), std::find(log.begin(), log.end(), "vertexShader"));
+    EXPECT_EQ(log[log.size() - 2], "program");
+    EXPECT_EQ(log.back(), "program");
+}
+
+TEST_F(ChangeBatch_test, NotifiesDiamondOnce)
+{
+    Source source;
+    Node left("left", log);
+    Node right("right", log);
+    Node bottom("bottom", log);
+    Node last("last", log);
+
+    source.registerListener(&left);
+    source.registerListener(&right);
+    left.registerListener(&bottom);
+    right.registerListener(&bottom);
+    bottom.registerListener(&last);
+
+    {
+        glow::ChangeBatch batch;
+        source.changed();
+    }
+
+    // bottom is notified per changed subject, its single change reaches last once
+    ASSERT_EQ(log.size(), 5u);
+    EXPECT_THAT(std::vector<std::string>(log.begin(), log.begin() + 2), testing::UnorderedElementsAre("left", "right"));
+    EXPECT_EQ(log[2], "bottom");
+    EXPECT_EQ(log[3], "bottom");
+    EXPECT_EQ(log[4], "last");
+}
+
+TEST_F(ChangeBatch_test, OrdersAfterAllListenersPropagatingToSubject)
+{
+    Source source;
+    Source target;
+    Forwarder first("first", log, target);
+    Forwarder second("second", log, target);
+    Node dependent("dependent", log);
+
+    source.registerListener(&first);
+    source.registerListener(&second);
+    target.registerListener(&dependent);
+
+    {
+        glow::ChangeBatch batch;
+        source.changed();
+    }
+
+    EXPECT_THAT(log, testing::UnorderedElementsAre("first", "second", "dependent"));
+    EXPECT_EQ(log.back(), "dependent");
+}
+
+TEST_F(ChangeBatch_test, StopsAtListenersNotSignalingChanges)
+{
+    Source source;
+    Node a("a", log);
+    Node b("b", log);
+
+    source.registerListener(&a);
+    a.registerListener(&b);
+    a.setForward(false);
+
+    {
+        glow::ChangeBatch batch;
+        source.changed();
+    }
+
+    EXPECT_THAT(log, testing::ElementsAre("a"));
+}
+
+TEST_F(ChangeBatch_test, PropagatesWhenOutermostBatchEnds)
+{
+    Source source;
+    Node a("a", log);
+
+    source.registerListener(&a);
+
+    {
+        glow::ChangeBatch outer;
+        {
+            glow::ChangeBatch inner;
+            source.changed();
+        }
+        EXPECT_TRUE(log.empty());
+    }
+
+    EXPECT_THAT(log, testing::ElementsAre("a"));
+}
+
+TEST_F(ChangeBatch_test, SkipsListenersDestroyedInBatch)
+{
+    Source source;
+    Node a("a", log);
+
+    source.registerListener(&a);
+
+    {
+        glow::ChangeBatch batch;
+        source.changed();
+
+        Node * b = new Node("b", log);
+        source.registerListener(b);
+        delete b;
+
+        Source * removed = new Source;
+        removed->registerListener(&a);
+        removed->changed();
+        removed->deregisterListener(&a);
+        delete removed;
+    }
+
+    EXPECT_THAT(log, testing::ElementsAre("a"));
+}
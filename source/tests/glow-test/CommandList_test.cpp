@@ -0,0 +1,128 @@
+
+#include <gmock/gmock.h>
+
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glow/CommandList.h>
+
+class CommandList_test : public testing::Test
+{
+public:
+    static void record(glow::CommandList & list, unsigned int drawCount)
+    {
+        list.useProgram(nullptr);
+        for (unsigned int i = 0; i < drawCount; ++i)
+        {
+            list.setUniform(0, glm::mat4());
+            list.setUniform(1, static_cast<GLint>(i));
+            list.drawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT);
+        }
+    }
+
+    static void trace(int value)
+    {
+        calls.push_back(value);
+    }
+
+    static std::vector<int> calls;
+};
+
+std::vector<int> CommandList_test::calls;
+
+TEST_F(CommandList_test, CountsRecordedCommands)
+{
+    glow::CommandList list;
+    EXPECT_TRUE(list.isEmpty());
+
+    record(list, 10);
+
+    EXPECT_FALSE(list.isEmpty());
+    EXPECT_EQ(list.commandCount(), 31u);
+}
+
+TEST_F(CommandList_test, EncodesCompactly)
+{
+    glow::CommandList list;
+    list.drawArrays(GL_POINTS, 0, 1);
+    const std::size_t drawSize = list.size();
+
+    list.reset();
+    list.setUniform(0, glm::mat4());
+
+    // header and payload, without per command allocations
+    EXPECT_LE(drawSize, 32u);
+    EXPECT_LE(list.size(), 8u + 16u + sizeof(glm::mat4));
+}
+
+TEST_F(CommandList_test, AcceptsNullObjects)
+{
+    glow::CommandList list;
+    list.useProgram(nullptr);
+    list.bindVertexArray(nullptr);
+    list.bindBuffer(GL_ARRAY_BUFFER, nullptr);
+    list.bindTexture(0, nullptr);
+    list.bindFramebuffer(GL_FRAMEBUFFER, nullptr);
+
+    EXPECT_EQ(list.commandCount(), 5u);
+}
+
+TEST_F(CommandList_test, ExecutesInOrder)
+{
+    calls.clear();
+
+    glow::CommandList list;
+    list.call(&CommandList_test::trace, 1);
+    list.call(&CommandList_test::trace, 2);
+    list.call(new glow::FunctionCall<int>(&CommandList_test::trace, 3));
+    list.call(&CommandList_test::trace, 4);
+
+    list.execute();
+    list.execute();
+
+    EXPECT_THAT(calls, testing::ElementsAre(1, 2, 3, 4, 1, 2, 3, 4));
+
+    list.reset();
+    list.call(&CommandList_test::trace, 5);
+
+    calls.clear();
+    list.execute();
+
+    EXPECT_THAT(calls, testing::ElementsAre(5));
+}
+
+TEST_F(CommandList_test, ResetKeepsMemory)
+{
+    glow::CommandList list;
+    record(list, 100);
+
+    const std::size_t size = list.size();
+    const std::size_t capacity = list.capacity();
+
+    list.reset();
+    EXPECT_TRUE(list.isEmpty());
+    EXPECT_EQ(list.size(), 0u);
+    EXPECT_EQ(list.capacity(), capacity);
+
+    record(list, 100);
+    EXPECT_EQ(list.size(), size);
+    EXPECT_EQ(list.capacity(), capacity);
+}
+
+TEST_F(CommandList_test, RecordsInParallel)
+{
+    std::vector<glow::CommandList> lists(4);
+
+    std::vector<std::thread> threads;
+    for (glow::CommandList & list : lists)
+        threads.emplace_back(&CommandList_test::record, std::ref(list), 1000u);
+
+    for (std::thread & thread : threads)
+        thread.join();
+
+    for (const glow::CommandList & list : lists)
+        EXPECT_EQ(list.commandCount(), 3001u);
+}
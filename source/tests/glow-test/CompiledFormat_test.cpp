@@ -0,0 +1,132 @@
+#include <gmock/gmock.h>
+
+#include <climits>
+#include <sstream>
+#include <string>
+
+#include <glow/CompiledFormat.h>
+#include <glow/formatString.h>
+
+class CompiledFormat_test : public testing::Test
+{
+public:
+    template <typename... Args>
+    static std::string reference(const char * format, Args... args)
+    {
+        std::stringstream stream;
+        glow::streamprintf(stream, format, args...);
+        return stream.str();
+    }
+
+    template <typename... Args>
+    static void expectCompatible(const char * format, Args... args)
+    {
+        EXPECT_EQ(glow::CompiledFormat(format)(args...), reference(format, args...)) << "format: " << format;
+    }
+};
+
+struct Custom
+{
+    int value;
+};
+
+std::ostream & operator<<(std::ostream & stream, const Custom & custom)
+{
+    return stream << "Custom(" << custom.value << ")";
+}
+
+TEST_F(CompiledFormat_test, WritesExamplesOfTheDocumentation)
+{
+    EXPECT_EQ(glow::formatString("This is a test: %; pi = %+0E10.5;", 42, 3.141592653589793), "This is a test: 42 pi = +3.14159E+00");
+    EXPECT_EQ(glow::formatString("%; - %X; - %rf?_10.2;", "a string", 255, 2.71828182846), "a string - 255 - ______2.72");
+    EXPECT_EQ(glow::formatString("GLFW error 0x%x;: %;", 65544, "description"), "GLFW error 0x10008: description");
+}
+
+TEST_F(CompiledFormat_test, MatchesStreamprintfForIntegers)
+{
+    expectCompatible("%;|%d;|%o;|%x;", 42, -42, 42, 255);
+    expectCompatible("%x;|%o;", -1, -8);
+    expectCompatible("%#x;|%#ux;|%#o;|%#x;", 255, 255, 8, 0);
+    expectCompatible("%+;|%+;|%+;", 7, -7, 7u);
+    expectCompatible("[%8;][%l8;][%i8;][%08;][%?*8;]", -42, -42, -42, -42, 42);
+    expectCompatible("[%i#10x;][%i+10;]", 255, 3);
+    expectCompatible("%;|%;|%;|%;", LLONG_MIN, ULLONG_MAX, static_cast<short>(-2), static_cast<unsigned short>(65535));
+    expectCompatible("%x;|%x;", static_cast<short>(-1), -1l);
+}
+
+TEST_F(CompiledFormat_test, MatchesStreamprintfForFloats)
+{
+    expectCompatible("%;|%;|%;|%;", 3.14f, 3.141592654, 1e-10, 123456789.0);
+    expectCompatible("%f;|%e;|%E;|%F.3;", 3.14159, 3.14159, 3.14159, 3.14159);
+    expectCompatible("%.2;|%f.1;|%p;|%+;", 3.14159, 2.5, 3.0, 1.5);
+    expectCompatible("[%10.3;][%l10.3;][%i+10.3;][%010;]", -3.14159, 3.14159, 3.14159, 2.5);
+    expectCompatible("%;|%f;", 2.71828l, 1e300);
+}
+
+TEST_F(CompiledFormat_test, MatchesStreamprintfForOtherTypes)
+{
+    const std::string string("string");
+    int value = 0;
+
+    expectCompatible("%;|%a;|%a;|%;", true, true, false, 'c');
+    expectCompatible("[%8;][%l8;][%i8;][%8;]", "text", string, 'c', false);
+    expectCompatible("%;|%;|%#x;|%10;", static_cast<void *>(&value), static_cast<void *>(nullptr), static_cast<const void *>(&value), static_cast<void *>(&value));
+    expectCompatible("%;|%l12;|%#x;", Custom{ 3 }, Custom{ 4 }, Custom{ 255 });
+    expectCompatible("%; %;", &value, static_cast<unsigned char>('a'));
+}
+
+TEST_F(CompiledFormat_test, CarriesFillAndPrecisionOver)
+{
+    expectCompatible("[%?*6;][%6;][%.3;][%;]", 1, 2, 3.14159, 2.71828);
+    expectCompatible("[%06;][%6;]", 1, 2);
+}
+
+TEST_F(CompiledFormat_test, HandlesEscapesAndArgumentCounts)
+{
+    expectCompatible("100%% done");
+    expectCompatible("%%%;%%", 42);
+    expectCompatible("%; and %; but %%", 1);
+    expectCompatible("%; and %; but %%", 1, 2);
+    expectCompatible("%;", 1, 2, 3);
+    expectCompatible("unterminated %", 5);
+    expectCompatible("%d", 5);
+}
+
+TEST_F(CompiledFormat_test, ParsesSpecifiers)
+{
+    const glow::CompiledFormat format("%l#uf?*12.3x;%;");
+
+    ASSERT_EQ(format.specifierCount(), 2u);
+
+    const glow::CompiledFormat::Specifier & specifier = format.specifier(0);
+    EXPECT_EQ(specifier.adjustment, glow::CompiledFormat::Specifier::Left);
+    EXPECT_TRUE(specifier.showBase);
+    EXPECT_TRUE(specifier.upperCase);
+    EXPECT_EQ(specifier.floatField, glow::CompiledFormat::Specifier::Fixed);
+    EXPECT_EQ(specifier.fill, '*');
+    EXPECT_EQ(specifier.width, 12);
+    EXPECT_EQ(specifier.precision, 3);
+    EXPECT_EQ(specifier.base, glow::CompiledFormat::Specifier::Hexadecimal);
+}
+
+TEST_F(CompiledFormat_test, CachesFormatsByAddress)
+{
+    static const char * format = "cached %;";
+
+    EXPECT_EQ(glow::formatString(format, 1), "cached 1");
+    const std::size_t size = glow::CompiledFormat::cacheSize();
+
+    EXPECT_EQ(glow::formatString(format, 2), "cached 2");
+    EXPECT_EQ(glow::CompiledFormat::cacheSize(), size);
+
+    // changed content at a cached address is compiled again
+    char buffer[16] = "first %;";
+    EXPECT_EQ(glow::formatString(buffer, 1), "first 1");
+    std::snprintf(buffer, sizeof(buffer), "second %%;");
+    EXPECT_EQ(glow::formatString(buffer, 2), "second 2");
+
+    std::string reused;
+    glow::appendFormatted(reused, "%;-", 1);
+    glow::appendFormatted(reused, "%;", 2);
+    EXPECT_EQ(reused, "1-2");
+}
@@ -0,0 +1,154 @@
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glow/DebugMessage.h>
+#include <glow/DebugMessageAggregator.h>
+
+class DebugMessageAggregator_test : public testing::Test
+{
+public:
+    struct Reported
+    {
+        GLuint id;
+        std::string message;
+        unsigned long long suppressedCount;
+    };
+
+    DebugMessageAggregator_test()
+    : aggregator(16, 64)
+    {
+        aggregator.setHandler([this](const glow::DebugMessage & message, unsigned long long suppressedCount)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            reported.push_back(Reported{ message.id, message.message, suppressedCount });
+        });
+    }
+
+    bool performanceWarning(GLuint id, const char * message = "draw call stalled")
+    {
+        return aggregator.aggregate(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_PERFORMANCE, id, GL_DEBUG_SEVERITY_MEDIUM, static_cast<GLsizei>(std::strlen(message)), message);
+    }
+
+protected:
+    glow::DebugMessageAggregator aggregator;
+
+    std::mutex mutex;
+    std::vector<Reported> reported;
+};
+
+TEST_F(DebugMessageAggregator_test, DeduplicatesRepeatedMessages)
+{
+    aggregator.setRepeatInterval(std::chrono::hours(1));
+
+    for (int i = 0; i < 100; ++i)
+        EXPECT_TRUE(performanceWarning(7));
+    performanceWarning(8, "another one");
+
+    aggregator.flush();
+
+    ASSERT_EQ(reported.size(), 2u);
+    EXPECT_EQ(reported[0].id, 7u);
+    EXPECT_EQ(reported[0].message, "draw call stalled");
+    EXPECT_EQ(reported[1].id, 8u);
+
+    EXPECT_EQ(aggregator.messageCount(), 101u);
+    EXPECT_EQ(aggregator.distinctCount(), 2u);
+    EXPECT_EQ(aggregator.reportedCount(), 2u);
+
+    const std::vector<glow::DebugMessageAggregator::Summary> summary = aggregator.summary();
+    ASSERT_EQ(summary.size(), 2u);
+    EXPECT_EQ(summary[0].id, 7u);
+    EXPECT_EQ(summary[0].count, 100u);
+    EXPECT_EQ(summary[0].type, static_cast<GLenum>(GL_DEBUG_TYPE_PERFORMANCE));
+    EXPECT_EQ(summary[0].message, "draw call stalled");
+    EXPECT_LE(summary[0].first, summary[0].last);
+
+    EXPECT_THAT(aggregator.report(), testing::HasSubstr("100x performance 0x7"));
+}
+
+TEST_F(DebugMessageAggregator_test, ReportsSuppressedRepeats)
+{
+    aggregator.setRepeatInterval(std::chrono::hours(1));
+
+    for (int i = 0; i < 10; ++i)
+        performanceWarning(1);
+
+    aggregator.setRepeatInterval(std::chrono::steady_clock::duration::zero());
+    performanceWarning(1);
+    performanceWarning(1);
+
+    aggregator.flush();
+
+    ASSERT_EQ(reported.size(), 3u);
+    EXPECT_EQ(reported[0].suppressedCount, 0u);
+    EXPECT_EQ(reported[1].suppressedCount, 9u);
+    EXPECT_EQ(reported[2].suppressedCount, 0u);
+}
+
+TEST_F(DebugMessageAggregator_test, ForwardsErrors)
+{
+    const char * message = "invalid operation";
+
+    EXPECT_FALSE(aggregator.aggregate(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, GL_INVALID_OPERATION, GL_DEBUG_SEVERITY_HIGH, -1, message));
+
+    aggregator.setForwardErrors(false);
+    EXPECT_TRUE(aggregator.aggregate(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_ERROR, GL_INVALID_OPERATION, GL_DEBUG_SEVERITY_HIGH, -1, message));
+
+    aggregator.flush();
+
+    // both are aggregated, the second one is a suppressed repeat
+    ASSERT_EQ(reported.size(), 1u);
+    EXPECT_EQ(reported[0].message, message);
+    EXPECT_EQ(aggregator.summary()[0].count, 2u);
+}
+
+TEST_F(DebugMessageAggregator_test, DropsMessagesOfFullQueue)
+{
+    for (GLuint id = 0; id < 20; ++id)
+        performanceWarning(id);
+
+    EXPECT_EQ(aggregator.droppedCount(), 4u);
+
+    aggregator.flush();
+    EXPECT_EQ(reported.size(), 16u);
+    EXPECT_EQ(aggregator.distinctCount(), 20u);
+}
+
+TEST_F(DebugMessageAggregator_test, AggregatesConcurrentMessagesInBackground)
+{
+    aggregator.setRepeatInterval(std::chrono::hours(1));
+    aggregator.start();
+    EXPECT_TRUE(aggregator.isRunning());
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.push_back(std::thread([this]()
+        {
+            for (GLuint i = 0; i < 1000; ++i)
+                performanceWarning(i % 10);
+        }));
+    }
+
+    for (std::thread & thread : threads)
+        thread.join();
+
+    aggregator.stop();
+    EXPECT_FALSE(aggregator.isRunning());
+
+    EXPECT_EQ(aggregator.messageCount(), 4000u);
+    EXPECT_EQ(aggregator.distinctCount(), 10u);
+    EXPECT_EQ(reported.size(), 10u);
+
+    unsigned long long count = 0;
+    for (const glow::DebugMessageAggregator::Summary & summary : aggregator.summary())
+        count += summary.count;
+
+    EXPECT_EQ(count, 4000u);
+}
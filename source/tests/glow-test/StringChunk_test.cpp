@@ -0,0 +1,70 @@
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include <glow/ref_ptr.h>
+#include <glow/StringChunk.h>
+#include <glow/StaticStringSource.h>
+#include <glow/CompositeStringSource.h>
+
+class StringChunk_test : public testing::Test
+{
+public:
+    static glow::ref_ptr<glow::CompositeStringSource> compose(glow::AbstractStringSource * first, glow::AbstractStringSource * second)
+    {
+        return new glow::CompositeStringSource({ first, second });
+    }
+};
+
+TEST_F(StringChunk_test, CopiesShareCharacters)
+{
+    const glow::StringChunk chunk(std::string("#version 330\n"));
+    const glow::StringChunk copy = chunk;
+
+    EXPECT_EQ(copy.data(), chunk.data());
+    EXPECT_EQ(copy.length(), chunk.length());
+    EXPECT_EQ(copy.hash(), chunk.hash());
+}
+
+TEST_F(StringChunk_test, CompositeSharesChunksOfSources)
+{
+    glow::ref_ptr<glow::StaticStringSource> header = new glow::StaticStringSource("#version 330\n");
+    glow::ref_ptr<glow::StaticStringSource> body = new glow::StaticStringSource("void main() {}\n");
+    glow::ref_ptr<glow::CompositeStringSource> composite = compose(header, body);
+    glow::ref_ptr<glow::CompositeStringSource> nested = compose(composite, header);
+
+    const std::vector<glow::StringChunk> chunks = nested->chunks();
+    ASSERT_EQ(chunks.size(), 3u);
+
+    EXPECT_EQ(chunks[0].data(), header->chunks()[0].data());
+    EXPECT_EQ(chunks[1].data(), body->chunks()[0].data());
+    EXPECT_EQ(chunks[2].data(), header->chunks()[0].data());
+
+    EXPECT_EQ(nested->string(), "#version 330\n\nvoid main() {}\n\n#version 330\n\n");
+}
+
+TEST_F(StringChunk_test, HashesAreStable)
+{
+    glow::ref_ptr<glow::StaticStringSource> a = new glow::StaticStringSource("uniform float a;\n");
+    glow::ref_ptr<glow::StaticStringSource> b = new glow::StaticStringSource("uniform float b;\n");
+    glow::ref_ptr<glow::StaticStringSource> copyOfA = new glow::StaticStringSource("uniform float a;\n");
+
+    EXPECT_EQ(a->hash(), copyOfA->hash());
+    EXPECT_NE(a->hash(), b->hash());
+
+    glow::ref_ptr<glow::CompositeStringSource> ab = compose(a, b);
+    glow::ref_ptr<glow::CompositeStringSource> ba = compose(b, a);
+
+    const std::size_t hash = ab->hash();
+    EXPECT_EQ(ab->hash(), hash);
+    EXPECT_EQ(compose(copyOfA, b)->hash(), hash);
+    EXPECT_NE(ba->hash(), hash);
+
+    // changes of a source propagate, equal content restores the hash
+    b->setString("uniform float c;\n");
+    EXPECT_NE(ab->hash(), hash);
+
+    b->setString("uniform float b;\n");
+    EXPECT_EQ(ab->hash(), hash);
+}
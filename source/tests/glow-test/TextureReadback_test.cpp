@@ -0,0 +1,134 @@
+#include <gmock/gmock.h>
+
+#include <glow/ref_ptr.h>
+#include <glow/Buffer.h>
+#include <glow/TextureReadback.h>
+
+class TextureReadback_test : public testing::Test
+{
+public:
+    // wraps buffer names instead of creating buffers, the pool bookkeeping needs no context
+    class PoolReadback : public glow::TextureReadback
+    {
+    public:
+        PoolReadback(unsigned int maxPooledBuffers)
+        : TextureReadback(maxPooledBuffers)
+        , m_nextId(1)
+        {
+        }
+
+        glow::ref_ptr<Request> request(GLsizeiptr size)
+        {
+            return TextureReadback::request(size);
+        }
+
+    protected:
+        virtual glow::Buffer * createBuffer(GLsizeiptr) override
+        {
+            return new glow::Buffer(m_nextId++, GL_PIXEL_PACK_BUFFER);
+        }
+
+    protected:
+        GLuint m_nextId;
+    };
+};
+
+TEST_F(TextureReadback_test, StagingCapacityIsAtLeastFourKiB)
+{
+    EXPECT_EQ(glow::TextureReadback::capacity(0), 4096);
+    EXPECT_EQ(glow::TextureReadback::capacity(1), 4096);
+    EXPECT_EQ(glow::TextureReadback::capacity(4096), 4096);
+}
+
+TEST_F(TextureReadback_test, RoundsStagingCapacityToPowersOfTwo)
+{
+    EXPECT_EQ(glow::TextureReadback::capacity(4097), 8192);
+    EXPECT_EQ(glow::TextureReadback::capacity(1920 * 1080 * 4), 8 * 1024 * 1024);
+
+    // similar sizes share staging buffers
+    EXPECT_EQ(glow::TextureReadback::capacity(640 * 480 * 4), glow::TextureReadback::capacity(512 * 512 * 4 + 1));
+}
+
+TEST_F(TextureReadback_test, ReusesBufferAfterRequestIsReleased)
+{
+    glow::ref_ptr<PoolReadback> readback = new PoolReadback(8);
+
+    glow::ref_ptr<glow::TextureReadback::Request> first = readback->request(1000);
+    glow::ref_ptr<glow::TextureReadback::Request> second = readback->request(2000);
+
+    // pending requests keep their buffers
+    EXPECT_NE(first->buffer(), second->buffer());
+    EXPECT_EQ(readback->pooledCount(), 0u);
+
+    const GLuint firstId = first->buffer()->id();
+    first = nullptr;
+
+    EXPECT_EQ(readback->pooledCount(), 1u);
+
+    glow::ref_ptr<glow::TextureReadback::Request> third = readback->request(3000);
+
+    EXPECT_EQ(third->buffer()->id(), firstId);
+    EXPECT_EQ(third->size(), 3000);
+    EXPECT_EQ(readback->pooledCount(), 0u);
+
+    EXPECT_EQ(readback->statistics().requestCount, 3u);
+    EXPECT_EQ(readback->statistics().allocationCount, 2u);
+    EXPECT_EQ(readback->statistics().reuseCount, 1u);
+}
+
+TEST_F(TextureReadback_test, ReusesBuffersOfEqualCapacityOnly)
+{
+    glow::ref_ptr<PoolReadback> readback = new PoolReadback(8);
+
+    readback->request(1000);
+    glow::ref_ptr<glow::TextureReadback::Request> larger = readback->request(5000);
+
+    EXPECT_EQ(readback->pooledCount(), 1u);
+    EXPECT_EQ(readback->statistics().allocationCount, 2u);
+    EXPECT_EQ(readback->statistics().reuseCount, 0u);
+}
+
+TEST_F(TextureReadback_test, EvictsLeastRecentlyReleasedBuffers)
+{
+    glow::ref_ptr<PoolReadback> readback = new PoolReadback(2);
+
+    glow::ref_ptr<glow::TextureReadback::Request> requests[3] = { readback->request(100), readback->request(100), readback->request(100) };
+    const GLuint ids[3] = { requests[0]->buffer()->id(), requests[1]->buffer()->id(), requests[2]->buffer()->id() };
+
+    for (glow::ref_ptr<glow::TextureReadback::Request> & request : requests)
+        request = nullptr;
+
+    EXPECT_EQ(readback->pooledCount(), 2u);
+
+    // the most recently released buffer is reused first, the first released one was evicted
+    glow::ref_ptr<glow::TextureReadback::Request> reused[2] = { readback->request(100), readback->request(100) };
+    EXPECT_EQ(reused[0]->buffer()->id(), ids[2]);
+    EXPECT_EQ(reused[1]->buffer()->id(), ids[1]);
+
+    glow::ref_ptr<glow::TextureReadback::Request> allocated = readback->request(100);
+    EXPECT_NE(allocated->buffer()->id(), ids[0]);
+    EXPECT_EQ(readback->statistics().allocationCount, 4u);
+}
+
+TEST_F(TextureReadback_test, PoolsNothingWithoutPooledBuffers)
+{
+    glow::ref_ptr<PoolReadback> readback = new PoolReadback(0);
+
+    readback->request(100);
+    readback->request(100);
+
+    EXPECT_EQ(readback->pooledCount(), 0u);
+    EXPECT_EQ(readback->statistics().allocationCount, 2u);
+}
+
+TEST_F(TextureReadback_test, ClearDropsPooledBuffers)
+{
+    glow::ref_ptr<PoolReadback> readback = new PoolReadback(8);
+
+    readback->request(100);
+    readback->request(10000);
+    EXPECT_EQ(readback->pooledCount(), 2u);
+
+    readback->clear();
+    EXPECT_EQ(readback->pooledCount(), 0u);
+}
@@ -0,0 +1,49 @@
+#include <gmock/gmock.h>
+
+#include <glow/Texture.h>
+
+class Texture_test : public testing::Test
+{
+public:
+};
+
+TEST_F(Texture_test, DescriptionIsUnspecifiedByDefault)
+{
+    const glow::Texture::Description description;
+
+    EXPECT_FALSE(description.isSpecified());
+    EXPECT_EQ(description.target, static_cast<GLenum>(GL_TEXTURE_2D));
+    EXPECT_EQ(description.levels, 0);
+    EXPECT_FALSE(description.immutable);
+}
+
+TEST_F(Texture_test, ReducesLevelSizes)
+{
+    glow::Texture::Description description(GL_TEXTURE_2D);
+    description.internalFormat = GL_RGBA8;
+    description.size = glm::ivec3(256, 64, 1);
+    description.levels = 9;
+
+    EXPECT_TRUE(description.isSpecified());
+    EXPECT_EQ(description.levelSize(0), glm::ivec3(256, 64, 1));
+    EXPECT_EQ(description.levelSize(2), glm::ivec3(64, 16, 1));
+    EXPECT_EQ(description.levelSize(8), glm::ivec3(1, 1, 1));
+}
+
+TEST_F(Texture_test, KeepsLayersOfArrayTextures)
+{
+    glow::Texture::Description array2D(GL_TEXTURE_2D_ARRAY);
+    array2D.size = glm::ivec3(64, 64, 6);
+
+    EXPECT_EQ(array2D.levelSize(3), glm::ivec3(8, 8, 6));
+
+    glow::Texture::Description array1D(GL_TEXTURE_1D_ARRAY);
+    array1D.size = glm::ivec3(64, 4, 1);
+
+    EXPECT_EQ(array1D.levelSize(3), glm::ivec3(8, 4, 1));
+
+    glow::Texture::Description volume(GL_TEXTURE_3D);
+    volume.size = glm::ivec3(64, 32, 16);
+
+    EXPECT_EQ(volume.levelSize(3), glm::ivec3(8, 4, 2));
+}
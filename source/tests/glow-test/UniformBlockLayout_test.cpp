@@ -0,0 +1,122 @@
+
+#include <gmock/gmock.h>
+
+#include <cstring>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glow/UniformBlockLayout.h>
+#include <glow/UniformBufferArena.h>
+
+class UniformBlockLayout_test : public testing::Test
+{
+public:
+    template <typename T>
+    static T read(const std::vector<char> & data, GLint offset)
+    {
+        T value;
+        std::memcpy(&value, data.data() + offset, sizeof(T));
+        return value;
+    }
+};
+
+TEST_F(UniformBlockLayout_test, ComputesStd140Offsets)
+{
+    // offsets following the std140 rules of the ARB_uniform_buffer_object specification
+    glow::UniformBlockLayout layout(glow::UniformBlockLayout::Std140);
+
+    EXPECT_EQ(layout.add("a", GL_FLOAT), 0);
+    EXPECT_EQ(layout.add("b", GL_FLOAT_VEC2), 8);
+    EXPECT_EQ(layout.add("c", GL_FLOAT_VEC3), 16);
+    EXPECT_EQ(layout.add("f", GL_FLOAT), 28);
+    EXPECT_EQ(layout.add("g", GL_FLOAT), 32);
+    EXPECT_EQ(layout.addArray("h", GL_FLOAT, 2), 48);
+    EXPECT_EQ(layout.add("i", GL_FLOAT_MAT2x3), 80);
+    EXPECT_EQ(layout.addArray("k", GL_FLOAT_MAT3x2, 2), 112);
+
+    EXPECT_EQ(layout.member("h")->arrayStride, 16);
+    EXPECT_EQ(layout.member("i")->matrixStride, 16);
+    EXPECT_EQ(layout.member("k")->arrayStride, 48);
+    EXPECT_EQ(layout.dataSize(), 208);
+}
+
+TEST_F(UniformBlockLayout_test, ComputesStd430Offsets)
+{
+    glow::UniformBlockLayout layout(glow::UniformBlockLayout::Std430);
+
+    EXPECT_EQ(layout.add("a", GL_FLOAT), 0);
+    EXPECT_EQ(layout.addArray("h", GL_FLOAT, 2), 4);
+    EXPECT_EQ(layout.add("c", GL_FLOAT_VEC3), 16);
+    EXPECT_EQ(layout.add("m", GL_FLOAT_MAT3x2), 32);
+    EXPECT_EQ(layout.addArray("v", GL_FLOAT_VEC3, 2), 64);
+
+    EXPECT_EQ(layout.member("h")->arrayStride, 4);
+    EXPECT_EQ(layout.member("m")->matrixStride, 8);
+    EXPECT_EQ(layout.member("v")->arrayStride, 16);
+    EXPECT_EQ(layout.dataSize(), 96);
+}
+
+TEST_F(UniformBlockLayout_test, LaysOutSingleElementArraysAsArrays)
+{
+    // float a[1] has the array stride of a vec4 under std140, unlike float a
+    glow::UniformBlockLayout std140(glow::UniformBlockLayout::Std140);
+
+    EXPECT_EQ(std140.addArray("a", GL_FLOAT, 1), 0);
+    EXPECT_EQ(std140.add("b", GL_FLOAT), 16);
+    EXPECT_EQ(std140.member("a")->arrayStride, 16);
+    EXPECT_EQ(std140.member("b")->arrayStride, 0);
+
+    glow::UniformBlockLayout std430(glow::UniformBlockLayout::Std430);
+
+    EXPECT_EQ(std430.addArray("a", GL_FLOAT, 1), 0);
+    EXPECT_EQ(std430.add("b", GL_FLOAT), 4);
+    EXPECT_EQ(std430.member("a")->arrayStride, 4);
+}
+
+TEST_F(UniformBlockLayout_test, WritesStridedValues)
+{
+    glow::UniformBlockLayout layout(glow::UniformBlockLayout::Std140);
+    layout.add("flag", GL_BOOL);
+    layout.add("rotation", GL_FLOAT_MAT3);
+    layout.addArray("weights", GL_FLOAT, 3);
+
+    std::vector<char> data(layout.dataSize(), 0);
+
+    EXPECT_TRUE(layout.write(data.data(), "flag", true));
+    EXPECT_TRUE(layout.write(data.data(), "rotation", glm::mat3(2.f)));
+    EXPECT_TRUE(layout.write(data.data(), "weights", 5.f, 2));
+    EXPECT_FALSE(layout.write(data.data(), "missing", 1.f));
+
+    EXPECT_EQ(read<GLuint>(data, 0), 1u);
+
+    // columns are padded to vec4
+    EXPECT_EQ(read<glm::vec3>(data, 16), glm::vec3(2.f, 0.f, 0.f));
+    EXPECT_EQ(read<glm::vec3>(data, 32), glm::vec3(0.f, 2.f, 0.f));
+    EXPECT_EQ(read<glm::vec3>(data, 48), glm::vec3(0.f, 0.f, 2.f));
+
+    EXPECT_EQ(read<float>(data, 64 + 2 * 16), 5.f);
+}
+
+TEST_F(UniformBlockLayout_test, ArenaAlignsAllocations)
+{
+    glow::UniformBlockLayout layout;
+    layout.add("color", GL_FLOAT_VEC4);
+
+    glow::UniformBufferArena arena(256);
+
+    const glow::UniformBufferArena::Range first = arena.allocate(layout);
+    const glow::UniformBufferArena::Range second = arena.allocate(layout);
+
+    EXPECT_EQ(first.offset, 0);
+    EXPECT_EQ(second.offset, 256);
+    EXPECT_EQ(second.size, 16);
+    EXPECT_EQ(arena.size(), 272);
+
+    EXPECT_TRUE(arena.write(second, layout, "color", glm::vec4(1.f, 2.f, 3.f, 4.f)));
+    EXPECT_EQ(static_cast<float *>(arena.data(second))[2], 3.f);
+
+    arena.clear();
+    EXPECT_EQ(arena.size(), 0);
+    EXPECT_EQ(arena.allocate(layout).offset, 0);
+}
@@ -0,0 +1,83 @@
+
+#include <gmock/gmock.h>
+
+#include <string>
+#include <vector>
+
+#include <glow/ref_ptr.h>
+#include <glow/Uniform.h>
+#include <glow/UniformName.h>
+#include <glow/UniformNameTable.h>
+
+class UniformName_test : public testing::Test
+{
+public:
+};
+
+TEST_F(UniformName_test, HashesAtCompileTime)
+{
+    static CONSTEXPR glow::UniformName name("modelView");
+    static_assert(name.length() == 9, "length of a literal name has to be known at compile time");
+    static_assert(name.hash() == glow::UniformName::hash("modelView", 9), "hash of a literal name has to be known at compile time");
+
+    // reference values of 64 bit FNV-1a
+    EXPECT_EQ(glow::UniformName::hash("", 0), 14695981039346656037ull);
+    EXPECT_EQ(glow::UniformName::hash("a", 1), 0xaf63dc4c8601ec8cull);
+}
+
+TEST_F(UniformName_test, InternsRuntimeNames)
+{
+    std::string string = "transform";
+    const glow::UniformName name(string);
+    string = "changed";
+
+    EXPECT_EQ(name.string(), "transform");
+    EXPECT_EQ(name, glow::UniformName("transform"));
+    EXPECT_NE(name, glow::UniformName("transforms"));
+    EXPECT_EQ(name.data(), glow::UniformName(std::string("transform")).data());
+}
+
+TEST_F(UniformName_test, TableFindsInsertedUniforms)
+{
+    std::vector<glow::ref_ptr<glow::AbstractUniform>> uniforms;
+    glow::UniformNameTable table;
+
+    // enough uniforms to let the table grow a few times
+    for (int i = 0; i < 100; ++i)
+    {
+        uniforms.push_back(new glow::Uniform<float>("u" + std::to_string(i)));
+        table.insert(uniforms.back(), glow::Uniform<float>::typeTag());
+    }
+    EXPECT_EQ(table.size(), 100u);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        const glow::UniformName name("u" + std::to_string(i));
+        glow::UniformNameTable::Entry * entry = table.find(name.data(), name.length(), name.hash());
+
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(entry->uniform, uniforms[i].get());
+        EXPECT_EQ(entry->type, glow::Uniform<float>::typeTag());
+    }
+
+    const glow::UniformName missing("u100");
+    EXPECT_EQ(table.find(missing.data(), missing.length(), missing.hash()), nullptr);
+}
+
+TEST_F(UniformName_test, TableReplacesEquallyNamedUniforms)
+{
+    glow::ref_ptr<glow::AbstractUniform> first = new glow::Uniform<float>("value");
+    glow::ref_ptr<glow::AbstractUniform> second = new glow::Uniform<int>("value");
+
+    glow::UniformNameTable table;
+    table.insert(first, glow::Uniform<float>::typeTag());
+    table.insert(second);
+
+    const glow::UniformName name("value");
+    glow::UniformNameTable::Entry * entry = table.find(name.data(), name.length(), name.hash());
+
+    EXPECT_EQ(table.size(), 1u);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->uniform, second.get());
+    EXPECT_EQ(entry->type, nullptr);
+}
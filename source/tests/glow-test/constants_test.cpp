@@ -0,0 +1,33 @@
+#include <gmock/gmock.h>
+
+#include <cstring>
+#include <string>
+
+#include <GL/glew.h>
+
+#include <glow/constants.h>
+
+class constants_test : public testing::Test
+{
+};
+
+TEST_F(constants_test, NamesEnumsWithoutAllocating)
+{
+    EXPECT_STREQ(glow::enumNameCStr(GL_TEXTURE_2D), "GL_TEXTURE_2D");
+    EXPECT_STREQ(glow::enumNameCStr(GL_FLOAT_MAT4), "GL_FLOAT_MAT4");
+
+    // the static table entry is returned
+    EXPECT_EQ(glow::enumNameCStr(GL_TEXTURE_2D), glow::enumNameCStr(GL_TEXTURE_2D));
+}
+
+TEST_F(constants_test, NamesUnknownEnums)
+{
+    EXPECT_STREQ(glow::enumNameCStr(0x12345u), "UNKNOWN_GL_ENUM");
+    EXPECT_EQ(glow::enumName(0x12345u), "UNKNOWN_GL_ENUM");
+}
+
+TEST_F(constants_test, StringVariantMatches)
+{
+    EXPECT_EQ(glow::enumName(GL_RGBA8), std::string(glow::enumNameCStr(GL_RGBA8)));
+    EXPECT_EQ(glow::enumNames(GL_RGBA8).front(), glow::enumName(GL_RGBA8));
+}
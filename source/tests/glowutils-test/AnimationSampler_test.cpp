@@ -0,0 +1,169 @@
+#include <gmock/gmock.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <glowutils/AnimationSampler.h>
+#include <glowutils/AnimationTrackSet.h>
+
+class AnimationSampler_test : public testing::Test
+{
+public:
+    static float random(float min, float max)
+    {
+        return min + (max - min) * static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+    }
+
+    // tracks of 1 to 8 keys with random times, values, and interpolations
+    static void fillRandom(glowutils::AnimationTrackSet & tracks, unsigned int count)
+    {
+        std::srand(0);
+
+        const unsigned int components = tracks.componentCount();
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            const unsigned int keyCount = 1 + static_cast<unsigned int>(std::rand()) % 8;
+
+            std::vector<float> times(keyCount);
+            std::vector<float> values(keyCount * components);
+            std::vector<glowutils::InterpolationType> interpolations(keyCount);
+
+            float time = random(-1.f, 1.f);
+            for (unsigned int k = 0; k < keyCount; ++k)
+            {
+                times[k] = time;
+                time += random(0.f, 2.f);
+
+                interpolations[k] = static_cast<glowutils::InterpolationType>(std::rand() % (glowutils::SinInterpolation + 1));
+
+                for (unsigned int c = 0; c < components; ++c)
+                    values[k * components + c] = random(-10.f, 10.f);
+
+                if (components == 4)
+                {
+                    const glm::vec4 q = glm::normalize(glm::vec4(values[k * 4], values[k * 4 + 1], values[k * 4 + 2], values[k * 4 + 3]));
+                    for (unsigned int c = 0; c < 4; ++c)
+                        values[k * 4 + c] = q[c];
+                }
+            }
+
+            tracks.add(keyCount, times.data(), values.data(), interpolations.data());
+        }
+    }
+
+    static void expectMatchesEvaluate(const glowutils::AnimationTrackSet & tracks, float time, const std::vector<float> & values)
+    {
+        const unsigned int components = tracks.componentCount();
+
+        ASSERT_EQ(values.size(), tracks.size() * components);
+
+        for (unsigned int i = 0; i < tracks.size(); ++i)
+        {
+            const glm::vec4 expected = tracks.evaluate(i, time);
+            for (unsigned int c = 0; c < components; ++c)
+                ASSERT_NEAR(values[i * components + c], expected[c], 1e-5f) << "track " << i << ", time " << time;
+        }
+    }
+};
+
+TEST_F(AnimationSampler_test, EvaluatesSingleTracks)
+{
+    glowutils::AnimationTrackSet tracks(glowutils::AnimationTrackSet::Vec3);
+
+    const unsigned int track = tracks.add({
+        { 1.f, glm::vec3(0.f) },
+        { 3.f, glm::vec3(2.f, 4.f, -2.f), glowutils::SmoothStepInterpolation },
+        { 5.f, glm::vec3(0.f) } });
+
+    EXPECT_EQ(tracks.keyCount(track), 3u);
+    EXPECT_EQ(tracks.startTime(track), 1.f);
+    EXPECT_EQ(tracks.endTime(track), 5.f);
+
+    // clamped outside of the keys
+    EXPECT_EQ(glm::vec3(tracks.evaluate(track, 0.f)), glm::vec3(0.f));
+    EXPECT_EQ(glm::vec3(tracks.evaluate(track, 9.f)), glm::vec3(0.f));
+
+    EXPECT_EQ(glm::vec3(tracks.evaluate(track, 2.f)), glm::vec3(1.f, 2.f, -1.f));
+    EXPECT_EQ(glm::vec3(tracks.evaluate(track, 3.f)), glm::vec3(2.f, 4.f, -2.f));
+
+    // smoothstep(0.25) = 0.15625
+    EXPECT_NEAR(tracks.evaluate(track, 3.5f).x, 2.f - 2.f * 0.15625f, 1e-6f);
+}
+
+TEST_F(AnimationSampler_test, BlendsQuaternionsAlongTheShorterArc)
+{
+    glowutils::AnimationTrackSet tracks(glowutils::AnimationTrackSet::Quat);
+
+    const glm::quat a = glm::angleAxis(0.f, glm::vec3(0.f, 1.f, 0.f));
+    const glm::quat b = glm::angleAxis(glm::radians(90.f), glm::vec3(0.f, 1.f, 0.f));
+
+    // -b is the same rotation as b
+    tracks.add({ { 0.f, a }, { 1.f, -b } });
+
+    const glm::vec4 value = tracks.evaluate(0, .5f);
+    const glm::quat expected = glm::angleAxis(glm::radians(45.f), glm::vec3(0.f, 1.f, 0.f));
+
+    EXPECT_NEAR(glm::length(value), 1.f, 1e-6f);
+    EXPECT_NEAR(value.y, expected.y, 1e-6f);
+    EXPECT_NEAR(value.w, expected.w, 1e-6f);
+}
+
+TEST_F(AnimationSampler_test, KernelsMatchEvaluate)
+{
+    const glowutils::AnimationTrackSet::ValueType types[] = {
+        glowutils::AnimationTrackSet::Float, glowutils::AnimationTrackSet::Vec3, glowutils::AnimationTrackSet::Quat };
+
+    for (glowutils::AnimationTrackSet::ValueType type : types)
+    {
+        glowutils::AnimationTrackSet tracks(type);
+        fillRandom(tracks, 1003);
+
+        glowutils::AnimationSampler scalar;
+        scalar.setKernel(glowutils::AnimationSampler::Scalar);
+
+        glowutils::AnimationSampler vectorized;
+
+        std::vector<float> values;
+
+        // advancing and jumping back in time reuses and invalidates the remembered segments
+        for (float time : { -2.f, -.5f, 0.f, .3f, 1.7f, 4.f, 20.f, .1f })
+        {
+            scalar.sample(tracks, time, values);
+            expectMatchesEvaluate(tracks, time, values);
+
+            vectorized.sample(tracks, time, values);
+            expectMatchesEvaluate(tracks, time, values);
+        }
+    }
+}
+
+TEST_F(AnimationSampler_test, SamplesInParallelWithIndividualTimesAndStride)
+{
+    glowutils::AnimationTrackSet tracks(glowutils::AnimationTrackSet::Vec3);
+    fillRandom(tracks, 5000);
+
+    std::vector<float> times(tracks.size());
+    for (unsigned int i = 0; i < tracks.size(); ++i)
+        times[i] = random(-2.f, 12.f);
+
+    glowutils::AnimationSampler sampler;
+    sampler.setThreadCount(4);
+    sampler.setParallelThreshold(0);
+
+    // vec3 values padded to vec4, e.g., a per instance position with a spare w
+    std::vector<float> output(tracks.size() * 4, -1.f);
+    sampler.sample(tracks, times.data(), output.data(), 4 * sizeof(float));
+
+    for (unsigned int i = 0; i < tracks.size(); ++i)
+    {
+        const glm::vec4 expected = tracks.evaluate(i, times[i]);
+        for (unsigned int c = 0; c < 3; ++c)
+            ASSERT_NEAR(output[i * 4 + c], expected[c], 1e-5f) << "track " << i;
+
+        ASSERT_EQ(output[i * 4 + 3], -1.f);
+    }
+}
@@ -0,0 +1,107 @@
+#include <gmock/gmock.h>
+
+#include <sstream>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/Camera.h>
+#include <glowutils/CameraPath.h>
+#include <glowutils/CameraPathPlayer.h>
+
+class CameraPath_test : public testing::Test
+{
+public:
+    // sections of very different lengths
+    static glowutils::CameraPath unevenPath()
+    {
+        const glm::vec3 center(0.f, 0.f, 0.f);
+        const glm::vec3 up(0.f, 1.f, 0.f);
+
+        glowutils::CameraPath path;
+        path << glowutils::CameraPathPoint(glm::vec3(0.f, 0.f, 10.f), center, up, .7f)
+             << glowutils::CameraPathPoint(glm::vec3(1.f, 0.f, 10.f), center, up, .7f)
+             << glowutils::CameraPathPoint(glm::vec3(10.f, 2.f, 8.f), center, up, .8f)
+             << glowutils::CameraPathPoint(glm::vec3(11.f, 3.f, 8.f), center, up, .9f);
+
+        return path;
+    }
+};
+
+TEST_F(CameraPath_test, BinaryRoundTripIsExact)
+{
+    const glowutils::CameraPath path = unevenPath();
+
+    std::stringstream stream;
+    ASSERT_TRUE(path.write(stream));
+
+    glowutils::CameraPath loaded;
+    ASSERT_TRUE(loaded.read(stream));
+
+    ASSERT_EQ(path.points().size(), loaded.points().size());
+    for (size_t i = 0; i < path.points().size(); ++i)
+    {
+        EXPECT_EQ(path.points()[i].eye, loaded.points()[i].eye);
+        EXPECT_EQ(path.points()[i].center, loaded.points()[i].center);
+        EXPECT_EQ(path.points()[i].up, loaded.points()[i].up);
+        EXPECT_EQ(path.points()[i].fov, loaded.points()[i].fov);
+    }
+}
+
+TEST_F(CameraPath_test, RejectsTruncatedData)
+{
+    std::stringstream stream;
+    unevenPath().write(stream);
+
+    std::string data = stream.str();
+    std::stringstream truncated(data.substr(0, data.size() - 1));
+
+    glowutils::CameraPath path;
+    path << glowutils::CameraPathPoint();
+
+    EXPECT_FALSE(path.read(truncated));
+    EXPECT_EQ(path.points().size(), 1u);
+
+    std::stringstream garbage("not a camera path");
+    EXPECT_FALSE(path.read(garbage));
+}
+
+TEST_F(CameraPath_test, SamplesWithConstantSpeed)
+{
+    glowutils::Camera camera;
+    glowutils::CameraPathPlayer player(camera);
+    player.setPath(unevenPath());
+
+    // distance traveled per frame, measured along ten sub steps per frame
+    const unsigned int frames = 100;
+    const unsigned int subSteps = 10;
+
+    const std::vector<glowutils::CameraPathPoint> points = player.sample(frames * subSteps + 1);
+    ASSERT_EQ(points.size(), frames * subSteps + 1);
+
+    EXPECT_EQ(points.front().eye, unevenPath().points().front().eye);
+    EXPECT_EQ(points.back().eye, unevenPath().points().back().eye);
+
+    const float step = player.length() / static_cast<float>(frames);
+    for (unsigned int frame = 0; frame < frames; ++frame)
+    {
+        float distance = 0.f;
+        for (unsigned int i = frame * subSteps; i < (frame + 1) * subSteps; ++i)
+            distance += glm::length(points[i + 1].eye - points[i].eye);
+
+        EXPECT_NEAR(distance, step, step * .02f);
+    }
+}
+
+TEST_F(CameraPath_test, PlayMatchesSample)
+{
+    glowutils::Camera camera;
+    glowutils::CameraPathPlayer player(camera);
+    player.setPath(unevenPath());
+
+    const std::vector<glowutils::CameraPathPoint> points = player.sample(5);
+
+    player.play(.75f);
+    EXPECT_EQ(camera.eye(), points[3].eye);
+    EXPECT_EQ(camera.fovy(), points[3].fov);
+}
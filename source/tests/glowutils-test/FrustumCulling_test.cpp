@@ -0,0 +1,125 @@
+#include <gmock/gmock.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <glowutils/AxisAlignedBoundingBox.h>
+#include <glowutils/AxisAlignedBoundingBoxSet.h>
+#include <glowutils/Camera.h>
+#include <glowutils/FrustumCulling.h>
+
+class FrustumCulling_test : public testing::Test
+{
+public:
+    FrustumCulling_test()
+    : camera(glm::vec3(0.f, 0.f, 0.f), glm::vec3(0.f, 0.f, -1.f))
+    {
+        camera.setViewport(400, 400);
+        camera.setFovy(glm::radians(90.f));
+        camera.setZNear(1.f);
+        camera.setZFar(100.f);
+    }
+
+    static float random(float min, float max)
+    {
+        return min + (max - min) * static_cast<float>(std::rand()) / static_cast<float>(RAND_MAX);
+    }
+
+    void fillRandom(glowutils::AxisAlignedBoundingBoxSet & boxes, unsigned int count)
+    {
+        std::srand(0);
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            const glm::vec3 center(random(-200.f, 200.f), random(-200.f, 200.f), random(-200.f, 200.f));
+            const glm::vec3 extent(random(0.f, 10.f), random(0.f, 10.f), random(0.f, 10.f));
+            boxes.add(center - extent, center + extent);
+        }
+    }
+
+protected:
+    glowutils::Camera camera;
+};
+
+TEST_F(FrustumCulling_test, ExtractsNormalizedInwardPlanes)
+{
+    const std::array<glm::vec4, 6> & planes = camera.frustumPlanes();
+
+    for (const glm::vec4 & plane : planes)
+        EXPECT_NEAR(glm::length(glm::vec3(plane)), 1.f, 1e-5f);
+
+    // near plane at z = -1 facing the viewing direction, far plane at z = -100 facing the camera
+    EXPECT_NEAR(planes[4].z, -1.f, 1e-4f);
+    EXPECT_NEAR(planes[4].w, -1.f, 1e-3f);
+    EXPECT_NEAR(planes[5].z, 1.f, 1e-4f);
+    EXPECT_NEAR(planes[5].w, 100.f, 1e-2f);
+}
+
+TEST_F(FrustumCulling_test, ClassifiesSingleBoxes)
+{
+    glowutils::FrustumCulling culling(camera);
+
+    EXPECT_TRUE(culling.visible(glowutils::AxisAlignedBoundingBox(glm::vec3(-1.f, -1.f, -11.f), glm::vec3(1.f, 1.f, -9.f))));
+    EXPECT_FALSE(culling.visible(glowutils::AxisAlignedBoundingBox(glm::vec3(-1.f, -1.f, 9.f), glm::vec3(1.f, 1.f, 11.f))));
+    EXPECT_FALSE(culling.visible(glowutils::AxisAlignedBoundingBox(glm::vec3(-1.f, -1.f, -111.f), glm::vec3(1.f, 1.f, -109.f))));
+    EXPECT_FALSE(culling.visible(glowutils::AxisAlignedBoundingBox(glm::vec3(20.f, -1.f, -11.f), glm::vec3(22.f, 1.f, -9.f))));
+
+    // intersecting the left plane
+    EXPECT_TRUE(culling.visible(glowutils::AxisAlignedBoundingBox(glm::vec3(-12.f, -1.f, -11.f), glm::vec3(-9.f, 1.f, -9.f))));
+}
+
+TEST_F(FrustumCulling_test, SkipsEmptyBoxes)
+{
+    glowutils::AxisAlignedBoundingBoxSet boxes;
+    boxes.add(glowutils::AxisAlignedBoundingBox());
+    boxes.add(glm::vec3(-1.f, -1.f, -11.f), glm::vec3(1.f, 1.f, -9.f));
+
+    std::vector<unsigned int> visible;
+    glowutils::FrustumCulling(camera).cull(boxes, visible);
+
+    ASSERT_EQ(visible.size(), 1u);
+    EXPECT_EQ(visible[0], 1u);
+}
+
+TEST_F(FrustumCulling_test, VectorizedMatchesScalar)
+{
+    glowutils::AxisAlignedBoundingBoxSet boxes;
+    fillRandom(boxes, 10003);
+
+    glowutils::FrustumCulling culling(camera);
+
+    culling.setKernel(glowutils::FrustumCulling::Scalar);
+    std::vector<unsigned int> scalar;
+    culling.cull(boxes, scalar);
+
+    culling.setKernel(glowutils::FrustumCulling::Vectorized);
+    std::vector<unsigned int> vectorized;
+    culling.cull(boxes, vectorized);
+
+    EXPECT_FALSE(scalar.empty());
+    EXPECT_LT(scalar.size(), boxes.size());
+    EXPECT_EQ(scalar, vectorized);
+
+    for (unsigned int i : scalar)
+        EXPECT_TRUE(culling.visible(boxes.center(i), boxes.extent(i)));
+}
+
+TEST_F(FrustumCulling_test, ParallelMatchesSequential)
+{
+    glowutils::AxisAlignedBoundingBoxSet boxes;
+    fillRandom(boxes, 10003);
+
+    glowutils::FrustumCulling culling(camera);
+
+    std::vector<unsigned int> sequential;
+    culling.cull(boxes, sequential);
+
+    culling.setThreadCount(7);
+    culling.setParallelThreshold(0);
+    std::vector<unsigned int> parallel;
+    culling.cull(boxes, parallel);
+
+    EXPECT_EQ(sequential, parallel);
+}
@@ -0,0 +1,134 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/MeshOptimizer.h>
+
+class MeshOptimizer_test : public testing::Test
+{
+public:
+    // grid of size x size quads, two triangles each, emitted in a scattered (column major, strided) order
+    static glowutils::MeshOptimizer::Mesh grid(unsigned int size)
+    {
+        std::vector<glm::vec3> vertices;
+        for (unsigned int y = 0; y <= size; ++y)
+            for (unsigned int x = 0; x <= size; ++x)
+                vertices.push_back(glm::vec3(static_cast<float>(x), static_cast<float>(y), 0.f));
+
+        glowutils::MeshOptimizer::Mesh mesh;
+        mesh.setVertices(vertices);
+
+        for (unsigned int offset = 0; offset < 3; ++offset)
+        {
+            for (unsigned int x = offset; x < size; x += 3)
+            {
+                for (unsigned int y = 0; y < size; ++y)
+                {
+                    const GLuint i = y * (size + 1) + x;
+                    const GLuint quad[] = { i, i + 1, i + size + 2, i, i + size + 2, i + size + 1 };
+                    mesh.indices.insert(mesh.indices.end(), quad, quad + 6);
+                }
+            }
+        }
+
+        return mesh;
+    }
+
+    static std::vector<glm::vec3> triangles(const glowutils::MeshOptimizer::Mesh & mesh)
+    {
+        const std::vector<glm::vec3> vertices = mesh.vertexData<glm::vec3>();
+
+        std::vector<glm::vec3> result;
+        for (GLuint index : mesh.indices)
+            result.push_back(vertices[index]);
+
+        return result;
+    }
+};
+
+TEST_F(MeshOptimizer_test, RemovesDuplicateVertices)
+{
+    // two triangles of a quad without shared vertices
+    const std::vector<glm::vec3> vertices = {
+        glm::vec3(0, 0, 0), glm::vec3(1, 0, 0), glm::vec3(1, 1, 0)
+    ,   glm::vec3(0, 0, 0), glm::vec3(1, 1, 0), glm::vec3(0, 1, 0) };
+
+    glowutils::MeshOptimizer::Mesh mesh;
+    mesh.setVertices(vertices);
+    mesh.indices = { 0, 1, 2, 3, 4, 5 };
+
+    const std::vector<glm::vec3> before = triangles(mesh);
+
+    EXPECT_EQ(glowutils::MeshOptimizer::removeDuplicates(mesh), 2u);
+    EXPECT_EQ(mesh.vertexCount(), 4u);
+    EXPECT_EQ(mesh.indices, std::vector<GLuint>({ 0, 1, 2, 0, 2, 3 }));
+    EXPECT_EQ(triangles(mesh), before);
+}
+
+TEST_F(MeshOptimizer_test, ImprovesCacheMissRatio)
+{
+    glowutils::MeshOptimizer::Mesh mesh = grid(32);
+    const unsigned int triangleCount = static_cast<unsigned int>(mesh.indices.size() / 3);
+
+    glowutils::MeshOptimizer optimizer;
+    const glowutils::MeshOptimizer::Report report = optimizer.optimize(mesh);
+
+    EXPECT_EQ(report.triangleCount, triangleCount);
+    EXPECT_EQ(report.vertexCountAfter, report.vertexCountBefore);
+    EXPECT_EQ(mesh.indices.size(), static_cast<std::size_t>(triangleCount) * 3);
+
+    EXPECT_GT(report.acmrBefore, 1.f);
+    EXPECT_LT(report.acmrAfter, 0.8f);
+    EXPECT_FLOAT_EQ(report.acmrAfter, glowutils::MeshOptimizer::acmr(mesh.indices, mesh.vertexCount(), optimizer.cacheSize()));
+}
+
+TEST_F(MeshOptimizer_test, OrdersVerticesByFirstUse)
+{
+    std::vector<glowutils::MeshOptimizer::Mesh> meshes = { grid(8), grid(16), grid(4) };
+
+    glowutils::MeshOptimizer optimizer;
+    optimizer.setThreadCount(2);
+    const std::vector<glowutils::MeshOptimizer::Report> reports = optimizer.optimize(meshes);
+
+    ASSERT_EQ(reports.size(), meshes.size());
+
+    for (const glowutils::MeshOptimizer::Mesh & mesh : meshes)
+    {
+        GLuint next = 0;
+        for (GLuint index : mesh.indices)
+        {
+            EXPECT_LE(index, next);
+            if (index == next)
+                ++next;
+        }
+
+        EXPECT_EQ(next, mesh.vertexCount());
+    }
+}
+
+TEST_F(MeshOptimizer_test, QuantizesPositionsAndNormals)
+{
+    const std::vector<glm::vec3> positions = { glm::vec3(-2.f, 0.f, 1.f), glm::vec3(2.f, 4.f, 1.f), glm::vec3(0.5f, 1.f, 1.f) };
+    const std::vector<glm::vec3> normals = { glm::normalize(glm::vec3(1.f, 2.f, 3.f)), glm::vec3(0.f, 0.f, -1.f), glm::normalize(glm::vec3(-1.f, 1.f, -0.5f)) };
+
+    std::vector<glowutils::MeshOptimizer::QuantizedVertex> vertices;
+    const glowutils::MeshOptimizer::Quantization quantization = glowutils::MeshOptimizer::quantize(positions, normals, vertices);
+
+    ASSERT_EQ(vertices.size(), positions.size());
+    EXPECT_EQ(sizeof(glowutils::MeshOptimizer::QuantizedVertex), 12u);
+
+    for (std::size_t i = 0; i < positions.size(); ++i)
+    {
+        const glm::vec3 quantized(vertices[i].position[0], vertices[i].position[1], vertices[i].position[2]);
+        const glm::vec3 position = quantization.offset + quantized / 65535.f * quantization.scale;
+
+        EXPECT_LT(glm::length(position - positions[i]), 1e-4f);
+
+        const glm::vec2 encoded = glm::max(glm::vec2(vertices[i].normal[0], vertices[i].normal[1]) / 32767.f, glm::vec2(-1.f));
+        const glm::vec3 normal = glowutils::MeshOptimizer::decodeOctahedral(encoded);
+
+        EXPECT_GT(glm::dot(normal, normals[i]), 0.99999f);
+    }
+}
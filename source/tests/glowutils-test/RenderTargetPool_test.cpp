@@ -0,0 +1,27 @@
+#include <gmock/gmock.h>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/RenderTargetPool.h>
+
+class RenderTargetPool_test : public testing::Test
+{
+public:
+};
+
+TEST_F(RenderTargetPool_test, EstimatesByteSizeOfFormats)
+{
+    using Description = glowutils::RenderTargetPool::Description;
+
+    EXPECT_EQ(glowutils::RenderTargetPool::byteSize(Description{ glm::ivec2(1920, 1080), GL_RGBA8, 0 }), 1920u * 1080u * 4u);
+    EXPECT_EQ(glowutils::RenderTargetPool::byteSize(Description{ glm::ivec2(1920, 1080), GL_RGBA32F, 0 }), 1920u * 1080u * 16u);
+    EXPECT_EQ(glowutils::RenderTargetPool::byteSize(Description{ glm::ivec2(640, 480), GL_DEPTH_COMPONENT16, 0 }), 640u * 480u * 2u);
+}
+
+TEST_F(RenderTargetPool_test, MultipliesByteSizeBySamples)
+{
+    using Description = glowutils::RenderTargetPool::Description;
+
+    EXPECT_EQ(glowutils::RenderTargetPool::byteSize(Description{ glm::ivec2(100, 100), GL_RGBA16F, 4 }), 100u * 100u * 8u * 4u);
+    EXPECT_EQ(glowutils::RenderTargetPool::byteSize(Description{ glm::ivec2(100, 100), GL_DEPTH24_STENCIL8, 1 }), 100u * 100u * 4u);
+}
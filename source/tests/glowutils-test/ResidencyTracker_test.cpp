@@ -0,0 +1,141 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include <glowutils/ResidencyTracker.h>
+
+class ResidencyTracker_test : public testing::Test
+{
+public:
+    void update(glowutils::ResidencyTracker & tracker)
+    {
+        madeResident.clear();
+        madeNonResident.clear();
+
+        tracker.update(madeResident, madeNonResident);
+    }
+
+protected:
+    std::vector<unsigned int> madeResident;
+    std::vector<unsigned int> madeNonResident;
+};
+
+TEST_F(ResidencyTracker_test, MakesUsedResourcesResidentOnce)
+{
+    glowutils::ResidencyTracker tracker;
+    tracker.insert(1, 100);
+    tracker.insert(2, 200);
+
+    tracker.use(1);
+    tracker.use(1);
+    update(tracker);
+
+    EXPECT_THAT(madeResident, testing::ElementsAre(1u));
+    EXPECT_TRUE(madeNonResident.empty());
+    EXPECT_TRUE(tracker.isResident(1));
+    EXPECT_FALSE(tracker.isResident(2));
+    EXPECT_EQ(tracker.residentSize(), 100u);
+
+    tracker.use(1);
+    update(tracker);
+
+    EXPECT_TRUE(madeResident.empty());
+}
+
+TEST_F(ResidencyTracker_test, KeepsUnusedResourcesResidentWithinBudget)
+{
+    glowutils::ResidencyTracker tracker(300);
+    tracker.insert(1, 100);
+    tracker.insert(2, 200);
+
+    tracker.use(1);
+    tracker.use(2);
+    update(tracker);
+
+    update(tracker);
+
+    EXPECT_TRUE(madeNonResident.empty());
+    EXPECT_EQ(tracker.residentCount(), 2u);
+}
+
+TEST_F(ResidencyTracker_test, EvictsLeastRecentlyUsedOverBudget)
+{
+    glowutils::ResidencyTracker tracker(250);
+    tracker.insert(1, 100);
+    tracker.insert(2, 100);
+    tracker.insert(3, 100);
+
+    tracker.use(1);
+    update(tracker);
+    tracker.use(2);
+    update(tracker);
+    tracker.use(3);
+    update(tracker);
+
+    EXPECT_THAT(madeResident, testing::ElementsAre(3u));
+    EXPECT_THAT(madeNonResident, testing::ElementsAre(1u));
+    EXPECT_EQ(tracker.residentSize(), 200u);
+
+    // using 2 again makes 3 the least recently used one
+    tracker.use(2);
+    update(tracker);
+    tracker.use(1);
+    update(tracker);
+
+    EXPECT_THAT(madeNonResident, testing::ElementsAre(3u));
+}
+
+TEST_F(ResidencyTracker_test, ExceedsBudgetForResourcesUsedInFrame)
+{
+    glowutils::ResidencyTracker tracker(150);
+    tracker.insert(1, 100);
+    tracker.insert(2, 100);
+
+    tracker.use(1);
+    tracker.use(2);
+    update(tracker);
+
+    EXPECT_TRUE(madeNonResident.empty());
+    EXPECT_EQ(tracker.residentSize(), 200u);
+
+    update(tracker);
+
+    EXPECT_EQ(madeNonResident.size(), 1u);
+    EXPECT_EQ(tracker.residentSize(), 100u);
+}
+
+TEST_F(ResidencyTracker_test, RemovesResources)
+{
+    glowutils::ResidencyTracker tracker;
+    tracker.insert(1, 100);
+    tracker.insert(2, 100);
+
+    tracker.use(1);
+    update(tracker);
+
+    tracker.use(2);
+    EXPECT_TRUE(tracker.remove(1));
+    EXPECT_FALSE(tracker.remove(2));
+    update(tracker);
+
+    EXPECT_TRUE(madeResident.empty());
+    EXPECT_EQ(tracker.count(), 0u);
+    EXPECT_EQ(tracker.residentSize(), 0u);
+}
+
+TEST_F(ResidencyTracker_test, EvictsAll)
+{
+    glowutils::ResidencyTracker tracker;
+    tracker.insert(1, 100);
+    tracker.insert(2, 100);
+
+    tracker.use(1);
+    tracker.use(2);
+    update(tracker);
+
+    tracker.evictAll(madeNonResident);
+
+    EXPECT_EQ(madeNonResident.size(), 2u);
+    EXPECT_EQ(tracker.residentCount(), 0u);
+    EXPECT_FALSE(tracker.isResident(1));
+}
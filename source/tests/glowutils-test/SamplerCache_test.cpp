@@ -0,0 +1,56 @@
+#include <gmock/gmock.h>
+
+#include <unordered_set>
+
+#include <glowutils/SamplerCache.h>
+
+class SamplerCache_test : public testing::Test
+{
+public:
+    using Description = glowutils::SamplerCache::Description;
+};
+
+TEST_F(SamplerCache_test, DerivesMagnificationFilter)
+{
+    EXPECT_EQ(Description(GL_NEAREST).magFilter, static_cast<GLenum>(GL_NEAREST));
+    EXPECT_EQ(Description(GL_NEAREST_MIPMAP_LINEAR).magFilter, static_cast<GLenum>(GL_NEAREST));
+    EXPECT_EQ(Description(GL_LINEAR_MIPMAP_NEAREST).magFilter, static_cast<GLenum>(GL_LINEAR));
+    EXPECT_EQ(Description().magFilter, static_cast<GLenum>(GL_LINEAR));
+}
+
+TEST_F(SamplerCache_test, ComparesFullState)
+{
+    const Description linear(GL_LINEAR, GL_CLAMP_TO_EDGE);
+
+    EXPECT_EQ(linear, Description(GL_LINEAR, GL_CLAMP_TO_EDGE));
+    EXPECT_EQ(linear.hash(), Description(GL_LINEAR, GL_CLAMP_TO_EDGE).hash());
+
+    Description other = linear;
+    other.wrapR = GL_REPEAT;
+    EXPECT_NE(linear, other);
+
+    other = linear;
+    other.borderColor.a = 1.f;
+    EXPECT_NE(linear, other);
+
+    other = linear;
+    other.compareMode = GL_COMPARE_REF_TO_TEXTURE;
+    EXPECT_NE(linear, other);
+
+    EXPECT_NE(linear, Description(GL_LINEAR, GL_CLAMP_TO_EDGE, 16.f));
+}
+
+TEST_F(SamplerCache_test, HashesDistinctStatesApart)
+{
+    const GLenum filters[] = { GL_NEAREST, GL_LINEAR, GL_NEAREST_MIPMAP_NEAREST, GL_LINEAR_MIPMAP_NEAREST, GL_NEAREST_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR };
+    const GLenum wraps[] = { GL_REPEAT, GL_MIRRORED_REPEAT, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_BORDER };
+    const float anisotropies[] = { 1.f, 2.f, 4.f, 8.f, 16.f };
+
+    std::unordered_set<std::size_t> hashes;
+    for (GLenum filter : filters)
+        for (GLenum wrap : wraps)
+            for (float anisotropy : anisotropies)
+                hashes.insert(Description(filter, wrap, anisotropy).hash());
+
+    EXPECT_EQ(hashes.size(), 6u * 4u * 5u);
+}
@@ -0,0 +1,58 @@
+#include <gmock/gmock.h>
+
+#include <string>
+
+#include <glowutils/ShaderPermutationCache.h>
+
+class ShaderPermutationCache_test : public testing::Test
+{
+public:
+    using Defines = glowutils::ShaderPermutationCache::Defines;
+};
+
+TEST_F(ShaderPermutationCache_test, InsertsDefinesAfterVersion)
+{
+    const std::string source = "#version 330\nvoid main() {}\n";
+
+    EXPECT_EQ(glowutils::ShaderPermutationCache::resolve(source, Defines{ { "LIGHTS", "4" }, { "SHADOWS", "" } })
+        , "#version 330\n#define LIGHTS 4\n#define SHADOWS\nvoid main() {}\n");
+}
+
+TEST_F(ShaderPermutationCache_test, PrependsDefinesWithoutVersion)
+{
+    EXPECT_EQ(glowutils::ShaderPermutationCache::resolve("void main() {}\n", Defines{ { "A", "1" } }), "#define A 1\nvoid main() {}\n");
+    EXPECT_EQ(glowutils::ShaderPermutationCache::resolve("#version 150", Defines{ { "A", "1" } }), "#version 150\n#define A 1\n");
+}
+
+TEST_F(ShaderPermutationCache_test, KeepsSourceWithoutDefines)
+{
+    const std::string source = "#version 330\nvoid main() {}\n";
+
+    EXPECT_EQ(glowutils::ShaderPermutationCache::resolve(source, Defines()), source);
+}
+
+TEST_F(ShaderPermutationCache_test, ResolvesEqualDefineSetsCanonically)
+{
+    Defines a;
+    a["B"] = "2";
+    a["A"] = "1";
+
+    Defines b;
+    b["A"] = "1";
+    b["B"] = "2";
+
+    const std::string source = "#version 330\nvoid main() {}\n";
+    const std::string resolvedA = glowutils::ShaderPermutationCache::resolve(source, a);
+    const std::string resolvedB = glowutils::ShaderPermutationCache::resolve(source, b);
+
+    EXPECT_EQ(resolvedA, resolvedB);
+    EXPECT_EQ(glowutils::ShaderPermutationCache::hash(resolvedA), glowutils::ShaderPermutationCache::hash(resolvedB));
+}
+
+TEST_F(ShaderPermutationCache_test, HashesWithFNV1a)
+{
+    // reference values of the 64 bit FNV-1a
+    EXPECT_EQ(glowutils::ShaderPermutationCache::hash(""), 14695981039346656037ull);
+    EXPECT_EQ(glowutils::ShaderPermutationCache::hash("a"), 0xaf63dc4c8601ec8cull);
+    EXPECT_NE(glowutils::ShaderPermutationCache::hash("#define A 1\n"), glowutils::ShaderPermutationCache::hash("#define A 2\n"));
+}
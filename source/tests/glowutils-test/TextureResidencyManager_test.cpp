@@ -0,0 +1,25 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include <glowutils/TextureResidencyManager.h>
+
+class TextureResidencyManager_test : public testing::Test
+{
+public:
+};
+
+TEST_F(TextureResidencyManager_test, PacksHandlesForStd430)
+{
+    const std::vector<glow::TextureHandle> handles = { 1, 2, 3 };
+
+    EXPECT_EQ(glowutils::TextureResidencyManager::packHandles(handles, glowutils::TextureResidencyManager::Std430), handles);
+}
+
+TEST_F(TextureResidencyManager_test, PadsHandlesForStd140)
+{
+    const std::vector<glow::TextureHandle> handles = { 1, 2, 0x100000002ull };
+
+    EXPECT_THAT(glowutils::TextureResidencyManager::packHandles(handles, glowutils::TextureResidencyManager::Std140)
+        , testing::ElementsAre(1u, 0u, 2u, 0u, 0x100000002ull, 0u));
+}
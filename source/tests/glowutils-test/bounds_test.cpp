@@ -0,0 +1,135 @@
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glowutils/AxisAlignedBoundingBox.h>
+#include <glowutils/bounds.h>
+
+class bounds_test : public testing::Test
+{
+public:
+    // interleaved vertex layout with the position in the middle
+    struct Vertex
+    {
+        float texCoord[2];
+        float position[3];
+        float normal[3];
+    };
+
+    static std::vector<glm::vec3> randomPositions(unsigned int count)
+    {
+        std::mt19937 generator(count);
+        std::uniform_real_distribution<float> distribution(-1000.f, 1000.f);
+
+        std::vector<glm::vec3> positions(count);
+        for (glm::vec3 & position : positions)
+            position = glm::vec3(distribution(generator), distribution(generator), distribution(generator));
+
+        return positions;
+    }
+
+    static glowutils::AxisAlignedBoundingBox scalarBoundingBox(const std::vector<glm::vec3> & positions)
+    {
+        glowutils::AxisAlignedBoundingBox aabb;
+        for (const glm::vec3 & position : positions)
+            aabb.extend(position);
+
+        return aabb;
+    }
+
+    static void expectEqual(const glowutils::AxisAlignedBoundingBox & expected, const glowutils::AxisAlignedBoundingBox & actual)
+    {
+        EXPECT_EQ(expected.llf(), actual.llf());
+        EXPECT_EQ(expected.urb(), actual.urb());
+        EXPECT_EQ(expected.center(), actual.center());
+    }
+};
+
+TEST_F(bounds_test, ExtendReportsChangeOfAnyCorner)
+{
+    glowutils::AxisAlignedBoundingBox aabb(glm::vec3(0.f, 0.f, 0.f), glm::vec3(1.f, 1.f, 1.f));
+
+    EXPECT_TRUE(aabb.extend(glm::vec3(3.f, .5f, .5f)));
+    EXPECT_TRUE(aabb.extend(glm::vec3(.5f, -1.f, .5f)));
+    EXPECT_FALSE(aabb.extend(glm::vec3(.5f, .5f, .5f)));
+
+    EXPECT_EQ(aabb.center(), glm::vec3(1.5f, 0.f, .5f));
+    EXPECT_FLOAT_EQ(aabb.radius(), std::sqrt(9.f + 4.f + 1.f) * .5f);
+}
+
+TEST_F(bounds_test, EmptyArrayYieldsEmptyBounds)
+{
+    const std::vector<glm::vec3> positions;
+
+    expectEqual(glowutils::AxisAlignedBoundingBox(), glowutils::boundingBox(positions));
+    EXPECT_LT(glowutils::boundingSphere(positions).radius(), 0.f);
+}
+
+TEST_F(bounds_test, PackedMatchesScalar)
+{
+    // odd counts cover the remainder handling of the vectorized path
+    for (unsigned int count : { 1u, 3u, 4u, 1001u })
+    {
+        const std::vector<glm::vec3> positions = randomPositions(count);
+        expectEqual(scalarBoundingBox(positions), glowutils::boundingBox(positions));
+    }
+}
+
+TEST_F(bounds_test, StridedMatchesScalar)
+{
+    const std::vector<glm::vec3> positions = randomPositions(1001);
+
+    std::vector<Vertex> vertices(positions.size());
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        vertices[i].position[0] = positions[i].x;
+        vertices[i].position[1] = positions[i].y;
+        vertices[i].position[2] = positions[i].z;
+    }
+
+    const glowutils::AxisAlignedBoundingBox aabb = glowutils::boundingBox(vertices.data()
+        , static_cast<unsigned int>(vertices.size()), offsetof(Vertex, position), sizeof(Vertex));
+
+    expectEqual(scalarBoundingBox(positions), aabb);
+}
+
+TEST_F(bounds_test, ParallelMatchesScalar)
+{
+    const std::vector<glm::vec3> positions = randomPositions(1 << 21);
+
+    expectEqual(scalarBoundingBox(positions), glowutils::boundingBox(positions));
+}
+
+TEST_F(bounds_test, BulkExtendMatchesScalar)
+{
+    const std::vector<glm::vec3> positions = randomPositions(1001);
+
+    glowutils::AxisAlignedBoundingBox aabb(glm::vec3(-2000.f, 0.f, 0.f), glm::vec3(0.f, 0.f, 0.f));
+    glowutils::AxisAlignedBoundingBox expected = aabb;
+
+    EXPECT_TRUE(aabb.extend(positions));
+    for (const glm::vec3 & position : positions)
+        expected.extend(position);
+
+    expectEqual(expected, aabb);
+    EXPECT_FALSE(aabb.extend(positions));
+}
+
+TEST_F(bounds_test, SphereContainsAllPositions)
+{
+    const std::vector<glm::vec3> positions = randomPositions(1001);
+
+    const glowutils::BoundingSphere sphere = glowutils::boundingSphere(positions);
+    EXPECT_EQ(sphere.center(), scalarBoundingBox(positions).center());
+
+    float maxDistance = 0.f;
+    for (const glm::vec3 & position : positions)
+        maxDistance = std::max(maxDistance, glm::length(position - sphere.center()));
+
+    EXPECT_FLOAT_EQ(maxDistance, sphere.radius());
+}
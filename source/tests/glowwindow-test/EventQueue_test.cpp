@@ -0,0 +1,139 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include <glowwindow/EventQueue.h>
+#include <glowwindow/events.h>
+
+class EventQueue_test : public testing::Test
+{
+public:
+    static std::vector<glowwindow::WindowEvent::Type> drain(glowwindow::EventQueue & queue)
+    {
+        std::vector<glowwindow::WindowEvent::Type> types;
+
+        glowwindow::EventQueue::Slot slot;
+        while (!queue.isEmpty())
+        {
+            glowwindow::WindowEvent * event = queue.pop(slot);
+            types.push_back(event->type());
+            glowwindow::EventQueue::destroy(event);
+        }
+
+        return types;
+    }
+};
+
+TEST_F(EventQueue_test, KeepsOrderOfEvents)
+{
+    glowwindow::EventQueue queue(2);
+
+    queue.push(glowwindow::KeyEvent('a'));
+    queue.push(glowwindow::FocusEvent(true));
+    queue.push(glowwindow::TimerEvent(3));
+    queue.push(glowwindow::CloseEvent());
+
+    EXPECT_EQ(queue.size(), 4u);
+    EXPECT_GE(queue.capacity(), 4u);
+
+    const std::vector<glowwindow::WindowEvent::Type> expected {
+        glowwindow::WindowEvent::KeyTyped, glowwindow::WindowEvent::Focus, glowwindow::WindowEvent::Timer, glowwindow::WindowEvent::Close };
+
+    EXPECT_EQ(drain(queue), expected);
+}
+
+TEST_F(EventQueue_test, CoalescesConsecutiveCursorMoves)
+{
+    glowwindow::EventQueue queue;
+
+    for (int i = 0; i < 100; ++i)
+        queue.push(glowwindow::MouseEvent(glm::ivec2(i, 2 * i)));
+
+    ASSERT_EQ(queue.size(), 1u);
+    EXPECT_EQ(queue.coalescedCount(), 99u);
+
+    glowwindow::EventQueue::Slot slot;
+    glowwindow::WindowEvent * event = queue.pop(slot);
+
+    EXPECT_EQ(static_cast<glowwindow::MouseEvent *>(event)->pos(), glm::ivec2(99, 198));
+    glowwindow::EventQueue::destroy(event);
+}
+
+TEST_F(EventQueue_test, AccumulatesScrollOffsets)
+{
+    glowwindow::EventQueue queue;
+
+    queue.push(glowwindow::ScrollEvent(glm::vec2(0.f, 1.f), glm::ivec2(1, 1)));
+    queue.push(glowwindow::ScrollEvent(glm::vec2(1.f, 2.f), glm::ivec2(2, 2)));
+
+    ASSERT_EQ(queue.size(), 1u);
+
+    glowwindow::EventQueue::Slot slot;
+    glowwindow::ScrollEvent * event = static_cast<glowwindow::ScrollEvent *>(queue.pop(slot));
+
+    EXPECT_EQ(event->offset(), glm::vec2(1.f, 3.f));
+    EXPECT_EQ(event->pos(), glm::ivec2(2, 2));
+    glowwindow::EventQueue::destroy(event);
+}
+
+TEST_F(EventQueue_test, CoalescesOnlyConsecutiveEvents)
+{
+    glowwindow::EventQueue queue;
+
+    queue.push(glowwindow::MouseEvent(glm::ivec2(1, 1)));
+    queue.push(glowwindow::MouseEvent(glm::ivec2(2, 2), 0, GLFW_PRESS, 0));
+    queue.push(glowwindow::MouseEvent(glm::ivec2(3, 3)));
+    queue.push(glowwindow::ResizeEvent(glm::ivec2(10, 10)));
+    queue.push(glowwindow::ResizeEvent(glm::ivec2(20, 20), true));
+    queue.push(glowwindow::ResizeEvent(glm::ivec2(30, 30), true));
+    queue.push(glowwindow::PaintEvent());
+    queue.push(glowwindow::PaintEvent());
+
+    const std::vector<glowwindow::WindowEvent::Type> expected {
+        glowwindow::WindowEvent::MouseMove, glowwindow::WindowEvent::MousePress, glowwindow::WindowEvent::MouseMove
+        , glowwindow::WindowEvent::Resize, glowwindow::WindowEvent::FrameBufferResize, glowwindow::WindowEvent::Paint };
+
+    EXPECT_EQ(drain(queue), expected);
+}
+
+TEST_F(EventQueue_test, KeepsRawSamplesWithoutCoalescing)
+{
+    glowwindow::EventQueue queue;
+    queue.setCoalescing(false);
+
+    for (int i = 0; i < 100; ++i)
+        queue.push(glowwindow::MouseEvent(glm::ivec2(i, i)));
+
+    EXPECT_EQ(queue.size(), 100u);
+    EXPECT_EQ(queue.coalescedCount(), 0u);
+
+    glowwindow::EventQueue::Slot slot;
+    for (int i = 0; i < 100; ++i)
+    {
+        glowwindow::WindowEvent * event = queue.pop(slot);
+        EXPECT_EQ(static_cast<glowwindow::MouseEvent *>(event)->x(), i);
+        glowwindow::EventQueue::destroy(event);
+    }
+}
+
+TEST_F(EventQueue_test, ReusesSlotsAfterWrapAround)
+{
+    glowwindow::EventQueue queue(4);
+    queue.setCoalescing(false);
+
+    queue.push(glowwindow::TimerEvent(0));
+    queue.push(glowwindow::TimerEvent(1));
+
+    glowwindow::EventQueue::Slot slot;
+    for (int i = 0; i < 64; ++i)
+    {
+        queue.push(glowwindow::TimerEvent(i + 2));
+
+        glowwindow::WindowEvent * event = queue.pop(slot);
+        EXPECT_EQ(static_cast<glowwindow::TimerEvent *>(event)->id(), i);
+        glowwindow::EventQueue::destroy(event);
+    }
+
+    EXPECT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue.capacity(), 4u);
+}
@@ -0,0 +1,83 @@
+#include <gmock/gmock.h>
+
+#include <GL/glew.h>
+
+#include <glow/ref_ptr.h>
+#include <glow/Buffer.h>
+
+#include <glowwindow/ContextFormat.h>
+#include <glowwindow/OffscreenContext.h>
+
+class OffscreenContext_test : public testing::Test
+{
+public:
+    static glowwindow::ContextFormat coreFormat()
+    {
+        glowwindow::ContextFormat format;
+        format.setVersion(3, 2);
+        format.setProfile(glowwindow::ContextFormat::CoreProfile);
+
+        return format;
+    }
+};
+
+// without EGL (or without a display EGL can initialize), the tests pass without checking anything
+
+TEST_F(OffscreenContext_test, CreatesContextOfRequestedFormat)
+{
+    if (!glowwindow::OffscreenContext::isSupported())
+        return;
+
+    glowwindow::OffscreenContext context;
+    ASSERT_TRUE(context.create(coreFormat(), 64, 48));
+
+    EXPECT_TRUE(context.isValid());
+    EXPECT_EQ(context.width(), 64);
+    EXPECT_EQ(context.height(), 48);
+    EXPECT_GE(context.format().majorVersion() * 10 + context.format().minorVersion(), 32);
+
+    context.makeCurrent();
+
+    if (!context.isSurfaceless())
+    {
+        GLubyte pixel[4] = { 0, 0, 0, 0 };
+
+        glClearColor(1.f, 0.f, 0.f, 1.f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+
+        EXPECT_EQ(pixel[0], 255);
+        EXPECT_EQ(pixel[1], 0);
+    }
+
+    context.doneCurrent();
+
+    context.release();
+    EXPECT_FALSE(context.isValid());
+}
+
+TEST_F(OffscreenContext_test, SharesObjectsWithSharedContext)
+{
+    if (!glowwindow::OffscreenContext::isSupported())
+        return;
+
+    glowwindow::OffscreenContext context;
+    ASSERT_TRUE(context.create(coreFormat(), 16, 16));
+
+    glowwindow::OffscreenContext shared;
+    ASSERT_TRUE(shared.create(coreFormat(), 16, 16, &context));
+
+    context.makeCurrent();
+    glow::ref_ptr<glow::Buffer> buffer = new glow::Buffer(GL_ARRAY_BUFFER);
+    buffer->setData(16, nullptr, GL_STATIC_DRAW);
+    glFinish();
+    context.doneCurrent();
+
+    shared.makeCurrent();
+    EXPECT_EQ(glIsBuffer(buffer->id()), GL_TRUE);
+    shared.doneCurrent();
+
+    context.makeCurrent();
+    buffer = nullptr;
+    context.doneCurrent();
+}
@@ -0,0 +1,91 @@
+#include <gmock/gmock.h>
+
+#include <cstring>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/ref_ptr.h>
+#include <glow/Extension.h>
+#include <glow/Texture.h>
+#include <glow/TextureReadback.h>
+
+#include <glowwindow/ContextFormat.h>
+#include <glowwindow/OffscreenContext.h>
+
+class TextureReadback_test : public testing::Test
+{
+public:
+    static std::vector<unsigned char> ramp(std::size_t size)
+    {
+        std::vector<unsigned char> data(size);
+        for (std::size_t i = 0; i < size; ++i)
+            data[i] = static_cast<unsigned char>(i * 7);
+
+        return data;
+    }
+
+    static bool equals(glow::TextureReadback::Request * request, const std::vector<unsigned char> & data)
+    {
+        return request->size() == static_cast<GLsizeiptr>(data.size())
+            && std::memcmp(request->map(), data.data(), data.size()) == 0;
+    }
+};
+
+// without EGL, the test passes without checking anything
+
+TEST_F(TextureReadback_test, ReadsWhatVectorOverloadsReturn)
+{
+    if (!glowwindow::OffscreenContext::isSupported())
+        return;
+
+    glowwindow::ContextFormat format;
+    format.setVersion(3, 2);
+    format.setProfile(glowwindow::ContextFormat::CoreProfile);
+
+    glowwindow::OffscreenContext context;
+    ASSERT_TRUE(context.create(format, 16, 16));
+    context.makeCurrent();
+
+    {
+        glow::ref_ptr<glow::TextureReadback> readback = new glow::TextureReadback();
+
+        // rows of 9 bytes are padded to the pack alignment of 4
+        glow::ref_ptr<glow::Texture> texture = new glow::Texture(GL_TEXTURE_2D);
+        texture->image2D(0, GL_RGB8, 3, 3, 0, GL_RGB, GL_UNSIGNED_BYTE, ramp(3 * 12).data());
+
+        glow::ref_ptr<glow::TextureReadback::Request> request = readback->getImage(texture, 0, GL_RGB, GL_UNSIGNED_BYTE);
+        const std::vector<unsigned char> image = texture->getImage(0, GL_RGB, GL_UNSIGNED_BYTE);
+
+        EXPECT_EQ(texture->imageSize(0, GL_RGB, GL_UNSIGNED_BYTE), 3 * 12);
+        EXPECT_EQ(image.size(), 3u * 12u);
+        EXPECT_TRUE(equals(request, image));
+
+        // layers are returned consecutively
+        glow::ref_ptr<glow::Texture> array = new glow::Texture(GL_TEXTURE_2D_ARRAY);
+        array->image3D(0, GL_RGBA8, 2, 2, 3, 0, GL_RGBA, GL_UNSIGNED_BYTE, ramp(2 * 2 * 3 * 4).data());
+
+        glow::ref_ptr<glow::TextureReadback::Request> arrayRequest = readback->getImage(array, 0, GL_RGBA, GL_UNSIGNED_BYTE);
+        const std::vector<unsigned char> arrayImage = array->getImage(0, GL_RGBA, GL_UNSIGNED_BYTE);
+
+        EXPECT_EQ(array->imageSize(0, GL_RGBA, GL_UNSIGNED_BYTE), 2 * 2 * 3 * 4);
+        EXPECT_EQ(arrayImage, ramp(2 * 2 * 3 * 4));
+        EXPECT_TRUE(equals(arrayRequest, arrayImage));
+
+        if (glow::hasExtension(glow::GLOW_EXT_texture_compression_s3tc))
+        {
+            // four 4x4 blocks of 8 bytes
+            glow::ref_ptr<glow::Texture> compressed = new glow::Texture(GL_TEXTURE_2D);
+            compressed->image2D(0, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 8, 8, 0, GL_RGBA, GL_UNSIGNED_BYTE, ramp(8 * 8 * 4).data());
+
+            glow::ref_ptr<glow::TextureReadback::Request> compressedRequest = readback->getCompressedImage(compressed);
+            const std::vector<unsigned char> compressedImage = compressed->getCompressedImage();
+
+            EXPECT_EQ(compressed->compressedImageSize(), 4 * 8);
+            EXPECT_EQ(compressedImage.size(), 4u * 8u);
+            EXPECT_TRUE(equals(compressedRequest, compressedImage));
+        }
+    }
+
+    context.doneCurrent();
+}
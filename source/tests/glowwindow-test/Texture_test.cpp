@@ -0,0 +1,74 @@
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <glow/ref_ptr.h>
+#include <glow/Extension.h>
+#include <glow/Texture.h>
+
+#include <glowwindow/ContextFormat.h>
+#include <glowwindow/OffscreenContext.h>
+
+class Texture_test : public testing::Test
+{
+public:
+    static GLint integer(GLenum pname)
+    {
+        GLint value = 0;
+        glGetIntegerv(pname, &value);
+
+        return value;
+    }
+};
+
+// without EGL or EXT_direct_state_access, the test passes without checking anything
+
+TEST_F(Texture_test, EditsLeaveBindingsUnchanged)
+{
+    if (!glowwindow::OffscreenContext::isSupported())
+        return;
+
+    // EXT_direct_state_access is commonly exposed in compatibility profiles only
+    glowwindow::ContextFormat format;
+    format.setVersion(3, 2);
+    format.setProfile(glowwindow::ContextFormat::CompatibilityProfile);
+
+    glowwindow::OffscreenContext context;
+    ASSERT_TRUE(context.create(format, 16, 16));
+    context.makeCurrent();
+
+    if (glow::hasExtension(glow::GLOW_EXT_direct_state_access))
+    {
+        glow::ref_ptr<glow::Texture> bound = new glow::Texture(GL_TEXTURE_2D);
+        bound->bindActive(GL_TEXTURE1);
+
+        const std::vector<unsigned char> pixels(4 * 4 * 4, 128);
+        const unsigned char pixel[4] = { 255, 0, 0, 255 };
+
+        glow::ref_ptr<glow::Texture> edited = new glow::Texture(GL_TEXTURE_2D);
+        edited->setParameter(GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        edited->image2D(0, GL_RGBA8, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        edited->subImage2D(0, 1, 1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+        edited->generateMipmap();
+
+        const std::vector<unsigned char> image = edited->getImage(0, GL_RGBA, GL_UNSIGNED_BYTE);
+
+        EXPECT_EQ(integer(GL_ACTIVE_TEXTURE), GL_TEXTURE1);
+        EXPECT_EQ(static_cast<GLuint>(integer(GL_TEXTURE_BINDING_2D)), bound->id());
+
+        EXPECT_EQ(edited->getParameter(GL_TEXTURE_MIN_FILTER), GL_LINEAR_MIPMAP_LINEAR);
+        EXPECT_EQ(edited->size(2), glm::ivec3(1, 1, 1));
+        ASSERT_EQ(image.size(), pixels.size());
+        EXPECT_EQ(image[(4 + 1) * 4], 255);
+        EXPECT_EQ(image[0], 128);
+
+        EXPECT_EQ(static_cast<GLuint>(integer(GL_TEXTURE_BINDING_2D)), bound->id());
+
+        edited = nullptr;
+        bound = nullptr;
+    }
+
+    context.doneCurrent();
+}